@@ -136,7 +136,7 @@ void * __va_cur_ptr4(va_list &va) {
   return (void*) (cur_ptr - 1);
 }
 
-#else   // __XTENSA__, __riscv
+#elif !defined(va_cur_ptr4)   // host builds of the tools define their own va_cur_ptr4
   #error "ext_printf is not suppoerted on this platform"
 #endif  // __XTENSA__, __riscv
 
@@ -218,12 +218,23 @@ char * copyStr(const char * str) {
 const char ext_invalid_mem[] PROGMEM = "<--INVALID-->";
 const uint32_t min_valid_ptr = 0x3F000000;    // addresses below this line are invalid
 
-int32_t ext_vsnprintf_P(char * out_buf, size_t buf_len, const char * fmt_P, va_list va) {
+// If grow is not nullptr and the output does not fit in out_buf, the output is formatted again
+// into the buffer returned by grow(ctx, len) for len characters and the terminating zero. This
+// must happen here as arguments are patched in place and temporary strings freed when done,
+// so the same va_list cannot be formatted twice.
+int32_t ext_vsnprintf_impl(char * out_buf, size_t buf_len, ext_grow_t grow, void * ctx, const char * fmt_P, va_list va) {
   va_list va_cpy;
   va_copy(va_cpy, va);
 
   // iterate on fmt to extract arguments and patch them in place
-  char * fmt_cpy = copyStr(fmt_P);
+  // short formats are copied on the stack to avoid a heap allocation per call
+  char fmt_stack[100];
+  char * fmt_cpy;
+  if ((fmt_P != nullptr) && (strlen_P(fmt_P) < sizeof(fmt_stack))) {
+    fmt_cpy = strcpy_P(fmt_stack, fmt_P);
+  } else {
+    fmt_cpy = copyStr(fmt_P);
+  }
   if (fmt_cpy == nullptr) { return 0; }
   char * fmt = fmt_cpy;
 
@@ -393,12 +404,24 @@ int32_t ext_vsnprintf_P(char * out_buf, size_t buf_len, const char * fmt_P, va_l
   // Serial.printf("> format_final=%s\n", fmt_cpy); Serial.flush();
   int32_t ret = 0;    // return 0 if unsuccessful
   if (out_buf != nullptr) {
-    ret = vsnprintf_P(out_buf, buf_len, fmt_cpy, va_cpy);
+    va_list va_out;
+    va_copy(va_out, va_cpy);
+    ret = vsnprintf_P(out_buf, buf_len, fmt_cpy, va_out);
+    va_end(va_out);
+    if ((grow != nullptr) && (ret >= (int32_t)buf_len)) {
+      char * grown_buf = grow(ctx, ret);
+      if (grown_buf != nullptr) {
+        vsnprintf_P(grown_buf, ret + 1, fmt_cpy, va_cpy);
+      }
+    }
   } else {
     // if there is no output buffer, we allocate one on the heap
     // first we do a dry-run to know the target size
     char dummy[2];
-    int32_t target_len = vsnprintf_P(dummy, 1, fmt_cpy, va_cpy);
+    va_list va_out;
+    va_copy(va_out, va_cpy);
+    int32_t target_len = vsnprintf_P(dummy, 1, fmt_cpy, va_out);
+    va_end(va_out);
     if (target_len >= 0) {
       // successful
       char * allocated_buf = (char*) malloc(target_len + 1);
@@ -417,12 +440,22 @@ int32_t ext_vsnprintf_P(char * out_buf, size_t buf_len, const char * fmt_P, va_l
     free((void*)allocs[i]);      // it is ok to call free() on nullptr so we don't test for nullptr first
     allocs[i] = nullptr;
   }
-  free(fmt_cpy);          // free the local copy of the format string
+  if (fmt_cpy != fmt_stack) {
+    free(fmt_cpy);        // free the local copy of the format string
+  }
   return ret;
 }
 
+int32_t ext_vsnprintf_P(char * out_buf, size_t buf_len, const char * fmt_P, va_list va) {
+  return ext_vsnprintf_impl(out_buf, buf_len, nullptr, nullptr, fmt_P, va);
+}
+
+int32_t ext_vsnprintf_grow_P(char * out_buf, size_t buf_len, ext_grow_t grow, void * ctx, const char * fmt_P, va_list va) {
+  return ext_vsnprintf_impl(out_buf, buf_len, grow, ctx, fmt_P, va);
+}
+
 char * ext_vsnprintf_malloc_P(const char * fmt_P, va_list va) {
-  int32_t ret = ext_vsnprintf_P(nullptr, 0, fmt_P, va);
+  int32_t ret = ext_vsnprintf_impl(nullptr, 0, nullptr, nullptr, fmt_P, va);
   return (char*) ret;
 }
 
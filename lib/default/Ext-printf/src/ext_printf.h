@@ -24,7 +24,10 @@
 #include <cstdint>
 #include <cstdarg>
 
+typedef char * (*ext_grow_t)(void * ctx, size_t len);
+
 int32_t ext_vsnprintf_P(char * buf, size_t buf_len, const char * fmt_P, va_list va);
+int32_t ext_vsnprintf_grow_P(char * buf, size_t buf_len, ext_grow_t grow, void * ctx, const char * fmt_P, va_list va);
 int32_t ext_snprintf_P(char * buf, size_t buf_len, const char * fmt, ...);
 char * ext_snprintf_malloc_P(const char * fmt, ...);
 char * ext_vsnprintf_malloc_P(const char * fmt_P, va_list va);
@@ -20,6 +20,7 @@ extern int l_delay(bvm *vm);
 extern int l_scaleuint(bvm *vm);
 extern int l_logInfo(bvm *vm);
 extern int l_save(bvm *vm);
+extern int l_becValid(bvm *vm);
 
 extern int l_respCmnd(bvm *vm);
 extern int l_respCmndStr(bvm *vm);
@@ -39,6 +40,18 @@ extern int l_setpower(bvm *vm);
 
 extern int l_i2cenabled(bvm *vm);
 
+extern int l_addRule(bvm *vm);
+extern int l_removeRule(bvm *vm);
+extern int l_execRules(bvm *vm);
+
+extern int l_setTimer(bvm *vm);
+extern int l_addCron(bvm *vm);
+extern int l_removeTimer(bvm *vm);
+extern int l_runDeferred(bvm *vm);
+
+extern int l_addDriver(bvm *vm);
+extern int l_removeDriver(bvm *vm);
+
 
 /********************************************************************
     // add `chars_in_string(s:string,c:string) -> int``
@@ -269,816 +282,6 @@ const bclosure find_key_i_closure = {
 
 
 
-/********************************************************************
-    // # split the item when there is an operator, returns a list of (left,op,right)
-    // # ex: "Dimmer>50" -> ["Dimmer",tasmota_gt,"50"]
-    "def find_op(item) "
-      "import string "
-      "var op_chars = '=<>!' "
-      "var pos = self.chars_in_string(item, op_chars) "
-      "if pos >= 0 "
-        "var op_split = string.split(item,pos) "
-        "var op_left = op_split[0] "
-        "var op_rest = op_split[1] "
-        "pos = self.chars_in_string(op_rest, op_chars, true) "
-        "if pos >= 0 "
-          "var op_split2 = string.split(op_rest,pos) "
-          "var op_middle = op_split2[0] "
-          "var op_right = op_split2[1] "
-          "return [op_left,op_middle,op_right] "
-        "end "
-      "end "
-      "return [item, nil, nil] "
-    "end "
-********************************************************************/
-/********************************************************************
-** Solidified function: find_op
-********************************************************************/
-
-be_define_local_const_str(find_op_str_name, "find_op", -528253920, 7);
-be_define_local_const_str(find_op_str_source, "string", 398550328, 6);
-be_define_local_const_str(find_op_str_0, "string", 398550328, 6);
-be_define_local_const_str(find_op_str_1, "=<>!", -1630497019, 4);
-be_define_local_const_str(find_op_str_2, "chars_in_string", -1146182164, 15);
-be_define_local_const_str(find_op_str_4, "split", -2017972765, 5);
-
-static const bvalue find_op_ktab[6] = {
-  { { .s=be_local_const_str(find_op_str_0) }, BE_STRING},
-  { { .s=be_local_const_str(find_op_str_1) }, BE_STRING},
-  { { .s=be_local_const_str(find_op_str_2) }, BE_STRING},
-  { { .i=0 }, BE_INT},
-  { { .s=be_local_const_str(find_op_str_4) }, BE_STRING},
-  { { .i=1 }, BE_INT},
-};
-
-static const uint32_t find_op_code[42] = {
-  0xA40A0000,  //  0000  IMPORT	R2	R256
-  0x580C0001,  //  0001  LDCONST	R3	K1
-  0x8C100102,  //  0002  GETMET	R4	R0	R258
-  0x5C180200,  //  0003  MOVE	R6	R1
-  0x5C1C0600,  //  0004  MOVE	R7	R3
-  0x7C100600,  //  0005  CALL	R4	3
-  0x28140903,  //  0006  GE	R5	R4	R259
-  0x78160019,  //  0007  JMPF	R5	#0022
-  0x8C140504,  //  0008  GETMET	R5	R2	R260
-  0x5C1C0200,  //  0009  MOVE	R7	R1
-  0x5C200800,  //  000A  MOVE	R8	R4
-  0x7C140600,  //  000B  CALL	R5	3
-  0x94180B03,  //  000C  GETIDX	R6	R5	R259
-  0x941C0B05,  //  000D  GETIDX	R7	R5	R261
-  0x8C200102,  //  000E  GETMET	R8	R0	R258
-  0x5C280E00,  //  000F  MOVE	R10	R7
-  0x5C2C0600,  //  0010  MOVE	R11	R3
-  0x50300200,  //  0011  LDBOOL	R12	1	0
-  0x7C200800,  //  0012  CALL	R8	4
-  0x5C101000,  //  0013  MOVE	R4	R8
-  0x28200903,  //  0014  GE	R8	R4	R259
-  0x7822000B,  //  0015  JMPF	R8	#0022
-  0x8C200504,  //  0016  GETMET	R8	R2	R260
-  0x5C280E00,  //  0017  MOVE	R10	R7
-  0x5C2C0800,  //  0018  MOVE	R11	R4
-  0x7C200600,  //  0019  CALL	R8	3
-  0x94241103,  //  001A  GETIDX	R9	R8	R259
-  0x94281105,  //  001B  GETIDX	R10	R8	R261
-  0x602C000A,  //  001C  GETGBL	R11	G10
-  0x7C2C0000,  //  001D  CALL	R11	0
-  0x40301606,  //  001E  CONNECT	R12	R11	R6
-  0x40301609,  //  001F  CONNECT	R12	R11	R9
-  0x4030160A,  //  0020  CONNECT	R12	R11	R10
-  0x80041600,  //  0021  RET	1	R11
-  0x6014000A,  //  0022  GETGBL	R5	G10
-  0x7C140000,  //  0023  CALL	R5	0
-  0x40180A01,  //  0024  CONNECT	R6	R5	R1
-  0x4C180000,  //  0025  LDNIL	6
-  0x40180A06,  //  0026  CONNECT	R6	R5	R6
-  0x4C180000,  //  0027  LDNIL	6
-  0x40180A06,  //  0028  CONNECT	R6	R5	R6
-  0x80040A00,  //  0029  RET	1	R5
-};
-
-static const bproto find_op_proto = {
-  NULL,     // bgcobject *next
-  8,       // type
-  0x08,        // marked
-  13,       // nstack
-  0,       // nupvals
-  2,       // argc
-  0,       // varg
-  NULL,     // bgcobject *gray
-  NULL,     // bupvaldesc *upvals
-  (bvalue*) &find_op_ktab,     // ktab
-  NULL,     // bproto **ptab
-  (binstruction*) &find_op_code,     // code
-  be_local_const_str(find_op_str_name),       // name
-  42,       // codesize
-  6,       // nconst
-  0,       // nproto
-  be_local_const_str(find_op_str_source),     // source
-#if BE_DEBUG_RUNTIME_INFO /* debug information */
-  NULL,     // lineinfo
-  0,        // nlineinfo
-#endif
-#if BE_DEBUG_VAR_INFO
-  NULL,     // varinfo
-  0,        // nvarinfo
-#endif
-};
-
-const bclosure find_op_closure = {
-  NULL,     // bgcobject *next
-  36,       // type
-  0x08,        // marked
-  0,       // nupvals
-  NULL,     // bgcobject *gray
-  (bproto*) &find_op_proto,     // proto
-  { NULL }     // upvals
-};
-
-/*******************************************************************/
-
-
-/********************************************************************
-    // Rules
-    "def add_rule(pat,f) "
-      "if !self._rules "
-        "self._rules={} "
-      "end "
-      "if type(f) == 'function' "
-        "self._rules[pat] = f "
-      "else "
-        "raise 'value_error', 'the second argument is not a function' "
-      "end "
-    "end "
-********************************************************************/
-
-/********************************************************************
-** Solidified function: add_rule
-********************************************************************/
-
-be_define_local_const_str(add_rule_str_name, "add_rule", 596540743, 8);
-be_define_local_const_str(add_rule_str_source, "string", 398550328, 6);
-be_define_local_const_str(add_rule_str_0, "_rules", -28750191, 6);
-be_define_local_const_str(add_rule_str_1, "function", -1630125495, 8);
-be_define_local_const_str(add_rule_str_2, "value_error", 773297791, 11);
-be_define_local_const_str(add_rule_str_3, "the second argument is not a function", -340392827, 37);
-
-static const bvalue add_rule_ktab[4] = {
-  { { .s=be_local_const_str(add_rule_str_0) }, BE_STRING},
-  { { .s=be_local_const_str(add_rule_str_1) }, BE_STRING},
-  { { .s=be_local_const_str(add_rule_str_2) }, BE_STRING},
-  { { .s=be_local_const_str(add_rule_str_3) }, BE_STRING},
-};
-
-static const uint32_t add_rule_code[15] = {
-  0x880C0100,  //  0000  GETMBR R3  R0  R256
-  0x740E0002,  //  0001  JMPT R3  #0005
-  0x600C000B,  //  0002  GETGBL R3  G11
-  0x7C0C0000,  //  0003  CALL R3  0
-  0x90020003,  //  0004  SETMBR R0  R256  R3
-  0x600C0015,  //  0005  GETGBL R3  G21
-  0x5C100400,  //  0006  MOVE R4  R2
-  0x7C0C0200,  //  0007  CALL R3  1
-  0x1C0C0701,  //  0008  EQ R3  R3  R257
-  0x780E0002,  //  0009  JMPF R3  #000D
-  0x880C0100,  //  000A  GETMBR R3  R0  R256
-  0x980C0202,  //  000B  SETIDX R3  R1  R2
-  0x70020000,  //  000C  JMP    #000E
-  0xB0060503,  //  000D  RAISE  1 R258  R259
-  0x80000000,  //  000E  RET  0 R0
-};
-
-static const bproto add_rule_proto = {
-  NULL,     // bgcobject *next
-  8,       // type
-  0x08,        // marked
-  5,       // nstack
-  0,       // nupvals
-  3,       // argc
-  0,       // varg
-  NULL,     // bgcobject *gray
-  NULL,     // bupvaldesc *upvals
-  (bvalue*) &add_rule_ktab,     // ktab
-  NULL,     // bproto **ptab
-  (binstruction*) &add_rule_code,     // code
-  be_local_const_str(add_rule_str_name),       // name
-  15,       // codesize
-  4,       // nconst
-  0,       // nproto
-  be_local_const_str(add_rule_str_source),     // source
-#if BE_DEBUG_RUNTIME_INFO /* debug information */
-  NULL,     // lineinfo
-  0,        // nlineinfo
-#endif
-#if BE_DEBUG_VAR_INFO
-  NULL,     // varinfo
-  0,        // nvarinfo
-#endif
-};
-
-static const bclosure add_rule_closure = {
-  NULL,     // bgcobject *next
-  36,       // type
-  0x08,        // marked
-  0,       // nupvals
-  NULL,     // bgcobject *gray
-  (bproto*) &add_rule_proto,     // proto
-  { NULL }     // upvals
-};
-
-/*******************************************************************/
-
-/********************************************************************
-    "def remove_rule(pat) "
-      "if self._rules "
-        "self._rules.remove(pat) "
-      "end "
-    "end "
-********************************************************************/
-
-/********************************************************************
-** Solidified function: remove_rule
-********************************************************************/
-be_local_closure(remove_rule,   /* name */
-  be_nested_proto(
-    5,                          /* nstack */
-    2,                          /* argc */
-    0,                          /* has upvals */
-    NULL,                       /* no upvals */
-    0,                          /* has sup protos */
-    NULL,                       /* no sub protos */
-    1,                          /* has constants */
-    ( &(const bvalue[ 2]) {     /* upvals */
-      { { .s=be_nested_const_str("_rules", -28750191, 6) }, BE_STRING},
-      { { .s=be_nested_const_str("remove", -611183107, 6) }, BE_STRING},
-    }),
-    (be_nested_const_str("remove_rule", -838755968, 11)),
-    (be_nested_const_str("string", 398550328, 6)),
-    ( &(const binstruction[ 7]) {  /* code */
-      0x88080100,  //  0000  GETMBR	R2	R0	R256
-      0x780A0003,  //  0001  JMPF	R2	#0006
-      0x88080100,  //  0002  GETMBR	R2	R0	R256
-      0x8C080501,  //  0003  GETMET	R2	R2	R257
-      0x5C100200,  //  0004  MOVE	R4	R1
-      0x7C080400,  //  0005  CALL	R2	2
-      0x80000000,  //  0006  RET	0	R0
-    })
-  )
-);
-/*******************************************************************/
-
-
-/********************************************************************
-    // Rules trigger if match. return true if match, false if not
-    "def try_rule(event, rule, f) "
-      "import string "
-      "var rl_list = self.find_op(rule) "
-      "var sub_event = event "
-      "var rl = string.split(rl_list[0],'#') "
-      "for it:rl "
-        "found=self.find_key_i(sub_event,it) "
-        "if found == nil return false end "
-        "sub_event = sub_event[found] "
-      "end "
-      "var op=rl_list[1]"
-      "var op2=rl_list[2]"
-      "if op "
-        "if   op=='==' "
-          "if str(sub_event) != str(op2)   return false end "
-        "elif op=='!==' "
-          "if str(sub_event) == str(op2)   return false end "
-        "elif op=='=' "
-          "if real(sub_event) != real(op2) return false end "
-        "elif op=='!=' "
-          "if real(sub_event) == real(op2) return false end "
-        "elif op=='>' "
-          "if real(sub_event) <= real(op2) return false end "
-        "elif op=='>=' "
-          "if real(sub_event) < real(op2)  return false end "
-        "elif op=='<' "
-          "if real(sub_event) >= real(op2) return false end "
-        "elif op=='<=' "
-          "if real(sub_event) > real(op2)  return false end "
-        "end "
-      "end "
-      "f(sub_event, rl_list[0], event) "
-      "return true "
-    "end "
-********************************************************************/
-/********************************************************************
-** Solidified function: try_rule
-********************************************************************/
-
-be_define_local_const_str(try_rule_str_name, "try_rule", 1986449405, 8);
-be_define_local_const_str(try_rule_str_source, "string", 398550328, 6);
-be_define_local_const_str(try_rule_str_0, "string", 398550328, 6);
-be_define_local_const_str(try_rule_str_1, "find_op", -528253920, 7);
-be_define_local_const_str(try_rule_str_2, "split", -2017972765, 5);
-be_define_local_const_str(try_rule_str_4, "#", 638357778, 1);
-be_define_local_const_str(try_rule_str_5, "find_key_i", 850136726, 10);
-be_define_local_const_str(try_rule_str_6, "stop_iteration", -121173395, 14);
-be_define_local_const_str(try_rule_str_9, "==", -1863000881, 2);
-be_define_local_const_str(try_rule_str_10, "!==", 559817114, 3);
-be_define_local_const_str(try_rule_str_11, "=", 940354920, 1);
-be_define_local_const_str(try_rule_str_12, "!=", -1866252285, 2);
-be_define_local_const_str(try_rule_str_13, ">", 990687777, 1);
-be_define_local_const_str(try_rule_str_14, ">=", 284975636, 2);
-be_define_local_const_str(try_rule_str_15, "<", 957132539, 1);
-be_define_local_const_str(try_rule_str_16, "<=", -1795743310, 2);
-
-static const bvalue try_rule_ktab[17] = {
-  { { .s=be_local_const_str(try_rule_str_0) }, BE_STRING},
-  { { .s=be_local_const_str(try_rule_str_1) }, BE_STRING},
-  { { .s=be_local_const_str(try_rule_str_2) }, BE_STRING},
-  { { .i=0 }, BE_INT},
-  { { .s=be_local_const_str(try_rule_str_4) }, BE_STRING},
-  { { .s=be_local_const_str(try_rule_str_5) }, BE_STRING},
-  { { .s=be_local_const_str(try_rule_str_6) }, BE_STRING},
-  { { .i=1 }, BE_INT},
-  { { .i=2 }, BE_INT},
-  { { .s=be_local_const_str(try_rule_str_9) }, BE_STRING},
-  { { .s=be_local_const_str(try_rule_str_10) }, BE_STRING},
-  { { .s=be_local_const_str(try_rule_str_11) }, BE_STRING},
-  { { .s=be_local_const_str(try_rule_str_12) }, BE_STRING},
-  { { .s=be_local_const_str(try_rule_str_13) }, BE_STRING},
-  { { .s=be_local_const_str(try_rule_str_14) }, BE_STRING},
-  { { .s=be_local_const_str(try_rule_str_15) }, BE_STRING},
-  { { .s=be_local_const_str(try_rule_str_16) }, BE_STRING},
-};
-
-static const uint32_t try_rule_code[143] = {
-  0xA4120000,  //  0000  IMPORT R4  R256
-  0x8C140101,  //  0001  GETMET R5  R0  R257
-  0x5C1C0400,  //  0002  MOVE R7  R2
-  0x7C140400,  //  0003  CALL R5  2
-  0x5C180200,  //  0004  MOVE R6  R1
-  0x8C1C0902,  //  0005  GETMET R7  R4  R258
-  0x94240B03,  //  0006  GETIDX R9  R5  R259
-  0x58280004,  //  0007  LDCONST  R10 K4
-  0x7C1C0600,  //  0008  CALL R7  3
-  0x60200000,  //  0009  GETGBL R8  G0
-  0x5C240E00,  //  000A  MOVE R9  R7
-  0x7C200200,  //  000B  CALL R8  1
-  0xA802000D,  //  000C  EXBLK  0 #001B
-  0x5C241000,  //  000D  MOVE R9  R8
-  0x7C240000,  //  000E  CALL R9  0
-  0x8C280105,  //  000F  GETMET R10 R0  R261
-  0x5C300C00,  //  0010  MOVE R12 R6
-  0x5C341200,  //  0011  MOVE R13 R9
-  0x7C280600,  //  0012  CALL R10 3
-  0x4C2C0000,  //  0013  LDNIL  11
-  0x1C2C140B,  //  0014  EQ R11 R10 R11
-  0x782E0002,  //  0015  JMPF R11 #0019
-  0x502C0000,  //  0016  LDBOOL R11 0 0
-  0xA8040001,  //  0017  EXBLK  1 1
-  0x80041600,  //  0018  RET  1 R11
-  0x94180C0A,  //  0019  GETIDX R6  R6  R10
-  0x7001FFF1,  //  001A  JMP    #000D
-  0x58200006,  //  001B  LDCONST  R8  K6
-  0xAC200200,  //  001C  CATCH  R8  1 0
-  0xB0080000,  //  001D  RAISE  2 R0  R0
-  0x94200B07,  //  001E  GETIDX R8  R5  R263
-  0x94240B08,  //  001F  GETIDX R9  R5  R264
-  0x78220066,  //  0020  JMPF R8  #0088
-  0x1C281109,  //  0021  EQ R10 R8  R265
-  0x782A000A,  //  0022  JMPF R10 #002E
-  0x60280013,  //  0023  GETGBL R10 G19
-  0x5C2C0C00,  //  0024  MOVE R11 R6
-  0x7C280200,  //  0025  CALL R10 1
-  0x602C0013,  //  0026  GETGBL R11 G19
-  0x5C301200,  //  0027  MOVE R12 R9
-  0x7C2C0200,  //  0028  CALL R11 1
-  0x2028140B,  //  0029  NE R10 R10 R11
-  0x782A0001,  //  002A  JMPF R10 #002D
-  0x50280000,  //  002B  LDBOOL R10 0 0
-  0x80041400,  //  002C  RET  1 R10
-  0x70020059,  //  002D  JMP    #0088
-  0x1C28110A,  //  002E  EQ R10 R8  R266
-  0x782A000A,  //  002F  JMPF R10 #003B
-  0x60280013,  //  0030  GETGBL R10 G19
-  0x5C2C0C00,  //  0031  MOVE R11 R6
-  0x7C280200,  //  0032  CALL R10 1
-  0x602C0013,  //  0033  GETGBL R11 G19
-  0x5C301200,  //  0034  MOVE R12 R9
-  0x7C2C0200,  //  0035  CALL R11 1
-  0x1C28140B,  //  0036  EQ R10 R10 R11
-  0x782A0001,  //  0037  JMPF R10 #003A
-  0x50280000,  //  0038  LDBOOL R10 0 0
-  0x80041400,  //  0039  RET  1 R10
-  0x7002004C,  //  003A  JMP    #0088
-  0x1C28110B,  //  003B  EQ R10 R8  R267
-  0x782A000A,  //  003C  JMPF R10 #0048
-  0x60280011,  //  003D  GETGBL R10 G17
-  0x5C2C0C00,  //  003E  MOVE R11 R6
-  0x7C280200,  //  003F  CALL R10 1
-  0x602C0011,  //  0040  GETGBL R11 G17
-  0x5C301200,  //  0041  MOVE R12 R9
-  0x7C2C0200,  //  0042  CALL R11 1
-  0x2028140B,  //  0043  NE R10 R10 R11
-  0x782A0001,  //  0044  JMPF R10 #0047
-  0x50280000,  //  0045  LDBOOL R10 0 0
-  0x80041400,  //  0046  RET  1 R10
-  0x7002003F,  //  0047  JMP    #0088
-  0x1C28110C,  //  0048  EQ R10 R8  R268
-  0x782A000A,  //  0049  JMPF R10 #0055
-  0x60280011,  //  004A  GETGBL R10 G17
-  0x5C2C0C00,  //  004B  MOVE R11 R6
-  0x7C280200,  //  004C  CALL R10 1
-  0x602C0011,  //  004D  GETGBL R11 G17
-  0x5C301200,  //  004E  MOVE R12 R9
-  0x7C2C0200,  //  004F  CALL R11 1
-  0x1C28140B,  //  0050  EQ R10 R10 R11
-  0x782A0001,  //  0051  JMPF R10 #0054
-  0x50280000,  //  0052  LDBOOL R10 0 0
-  0x80041400,  //  0053  RET  1 R10
-  0x70020032,  //  0054  JMP    #0088
-  0x1C28110D,  //  0055  EQ R10 R8  R269
-  0x782A000A,  //  0056  JMPF R10 #0062
-  0x60280011,  //  0057  GETGBL R10 G17
-  0x5C2C0C00,  //  0058  MOVE R11 R6
-  0x7C280200,  //  0059  CALL R10 1
-  0x602C0011,  //  005A  GETGBL R11 G17
-  0x5C301200,  //  005B  MOVE R12 R9
-  0x7C2C0200,  //  005C  CALL R11 1
-  0x1828140B,  //  005D  LE R10 R10 R11
-  0x782A0001,  //  005E  JMPF R10 #0061
-  0x50280000,  //  005F  LDBOOL R10 0 0
-  0x80041400,  //  0060  RET  1 R10
-  0x70020025,  //  0061  JMP    #0088
-  0x1C28110E,  //  0062  EQ R10 R8  R270
-  0x782A000A,  //  0063  JMPF R10 #006F
-  0x60280011,  //  0064  GETGBL R10 G17
-  0x5C2C0C00,  //  0065  MOVE R11 R6
-  0x7C280200,  //  0066  CALL R10 1
-  0x602C0011,  //  0067  GETGBL R11 G17
-  0x5C301200,  //  0068  MOVE R12 R9
-  0x7C2C0200,  //  0069  CALL R11 1
-  0x1428140B,  //  006A  LT R10 R10 R11
-  0x782A0001,  //  006B  JMPF R10 #006E
-  0x50280000,  //  006C  LDBOOL R10 0 0
-  0x80041400,  //  006D  RET  1 R10
-  0x70020018,  //  006E  JMP    #0088
-  0x1C28110F,  //  006F  EQ R10 R8  R271
-  0x782A000A,  //  0070  JMPF R10 #007C
-  0x60280011,  //  0071  GETGBL R10 G17
-  0x5C2C0C00,  //  0072  MOVE R11 R6
-  0x7C280200,  //  0073  CALL R10 1
-  0x602C0011,  //  0074  GETGBL R11 G17
-  0x5C301200,  //  0075  MOVE R12 R9
-  0x7C2C0200,  //  0076  CALL R11 1
-  0x2828140B,  //  0077  GE R10 R10 R11
-  0x782A0001,  //  0078  JMPF R10 #007B
-  0x50280000,  //  0079  LDBOOL R10 0 0
-  0x80041400,  //  007A  RET  1 R10
-  0x7002000B,  //  007B  JMP    #0088
-  0x1C281110,  //  007C  EQ R10 R8  R272
-  0x782A0009,  //  007D  JMPF R10 #0088
-  0x60280011,  //  007E  GETGBL R10 G17
-  0x5C2C0C00,  //  007F  MOVE R11 R6
-  0x7C280200,  //  0080  CALL R10 1
-  0x602C0011,  //  0081  GETGBL R11 G17
-  0x5C301200,  //  0082  MOVE R12 R9
-  0x7C2C0200,  //  0083  CALL R11 1
-  0x2428140B,  //  0084  GT R10 R10 R11
-  0x782A0001,  //  0085  JMPF R10 #0088
-  0x50280000,  //  0086  LDBOOL R10 0 0
-  0x80041400,  //  0087  RET  1 R10
-  0x5C280600,  //  0088  MOVE R10 R3
-  0x5C2C0C00,  //  0089  MOVE R11 R6
-  0x94300B03,  //  008A  GETIDX R12 R5  R259
-  0x5C340200,  //  008B  MOVE R13 R1
-  0x7C280600,  //  008C  CALL R10 3
-  0x50280200,  //  008D  LDBOOL R10 1 0
-  0x80041400,  //  008E  RET  1 R10
-};
-
-static const bproto try_rule_proto = {
-  NULL,     // bgcobject *next
-  8,       // type
-  0x08,        // marked
-  14,       // nstack
-  0,       // nupvals
-  4,       // argc
-  0,       // varg
-  NULL,     // bgcobject *gray
-  NULL,     // bupvaldesc *upvals
-  (bvalue*) &try_rule_ktab,     // ktab
-  NULL,     // bproto **ptab
-  (binstruction*) &try_rule_code,     // code
-  be_local_const_str(try_rule_str_name),       // name
-  143,       // codesize
-  17,       // nconst
-  0,       // nproto
-  be_local_const_str(try_rule_str_source),     // source
-#if BE_DEBUG_RUNTIME_INFO /* debug information */
-  NULL,     // lineinfo
-  0,        // nlineinfo
-#endif
-#if BE_DEBUG_VAR_INFO
-  NULL,     // varinfo
-  0,        // nvarinfo
-#endif
-};
-
-static const bclosure try_rule_closure = {
-  NULL,     // bgcobject *next
-  36,       // type
-  0x08,        // marked
-  0,       // nupvals
-  NULL,     // bgcobject *gray
-  (bproto*) &try_rule_proto,     // proto
-  { NULL }     // upvals
-};
-
-/*******************************************************************/
-
-
-/********************************************************************
-    // Run rules, i.e. check each individual rule
-    // Returns true if at least one rule matched, false if none
-    "def exec_rules(ev_json) "
-      "if self._rules "
-        "import json "
-        "var ev = json.load(ev_json) "
-        "var ret = false "
-        "if ev == nil "
-          "print('BRY: ERROR, bad json: '+ev_json, 3) "
-        "else "
-          "for r: self._rules.keys() "
-            "ret = self.try_rule(ev,r,self._rules[r]) || ret "
-          "end "
-        "end "
-        "return ret "
-      "end "
-      "return false "
-    "end "
-
-********************************************************************/
-
-/********************************************************************
-** Solidified function: exec_rules
-********************************************************************/
-
-be_define_local_const_str(exec_rules_str_name, "exec_rules", 1445221092, 10);
-be_define_local_const_str(exec_rules_str_source, "string", 398550328, 6);
-be_define_local_const_str(exec_rules_str_0, "_rules", -28750191, 6);
-be_define_local_const_str(exec_rules_str_1, "json", 916562499, 4);
-be_define_local_const_str(exec_rules_str_2, "load", -435725847, 4);
-be_define_local_const_str(exec_rules_str_3, "BRY: ERROR, bad json: ", -1579831487, 22);
-be_define_local_const_str(exec_rules_str_5, "keys", -112588595, 4);
-be_define_local_const_str(exec_rules_str_6, "try_rule", 1986449405, 8);
-be_define_local_const_str(exec_rules_str_7, "stop_iteration", -121173395, 14);
-
-static const bvalue exec_rules_ktab[8] = {
-  { { .s=be_local_const_str(exec_rules_str_0) }, BE_STRING},
-  { { .s=be_local_const_str(exec_rules_str_1) }, BE_STRING},
-  { { .s=be_local_const_str(exec_rules_str_2) }, BE_STRING},
-  { { .s=be_local_const_str(exec_rules_str_3) }, BE_STRING},
-  { { .i=3 }, BE_INT},
-  { { .s=be_local_const_str(exec_rules_str_5) }, BE_STRING},
-  { { .s=be_local_const_str(exec_rules_str_6) }, BE_STRING},
-  { { .s=be_local_const_str(exec_rules_str_7) }, BE_STRING},
-};
-
-static const uint32_t exec_rules_code[40] = {
-  0x88080100,  //  0000  GETMBR R2  R0  R256
-  0x780A0023,  //  0001  JMPF R2  #0026
-  0xA40A0200,  //  0002  IMPORT R2  R257
-  0x8C0C0502,  //  0003  GETMET R3  R2  R258
-  0x5C140200,  //  0004  MOVE R5  R1
-  0x7C0C0400,  //  0005  CALL R3  2
-  0x50100000,  //  0006  LDBOOL R4  0 0
-  0x4C140000,  //  0007  LDNIL  5
-  0x1C140605,  //  0008  EQ R5  R3  R5
-  0x78160004,  //  0009  JMPF R5  #000F
-  0x6014000F,  //  000A  GETGBL R5  G15
-  0x1A0601,  //  000B  ADD  R6  R259  R1
-  0x581C0004,  //  000C  LDCONST  R7  K4
-  0x7C140400,  //  000D  CALL R5  2
-  0x70020015,  //  000E  JMP    #0025
-  0x60140000,  //  000F  GETGBL R5  G0
-  0x88180100,  //  0010  GETMBR R6  R0  R256
-  0x8C180D05,  //  0011  GETMET R6  R6  R261
-  0x7C180200,  //  0012  CALL R6  1
-  0x7C140200,  //  0013  CALL R5  1
-  0xA802000C,  //  0014  EXBLK  0 #0022
-  0x5C180A00,  //  0015  MOVE R6  R5
-  0x7C180000,  //  0016  CALL R6  0
-  0x8C1C0106,  //  0017  GETMET R7  R0  R262
-  0x5C240600,  //  0018  MOVE R9  R3
-  0x5C280C00,  //  0019  MOVE R10 R6
-  0x882C0100,  //  001A  GETMBR R11 R0  R256
-  0x942C1606,  //  001B  GETIDX R11 R11 R6
-  0x7C1C0800,  //  001C  CALL R7  4
-  0x741E0001,  //  001D  JMPT R7  #0020
-  0x74120000,  //  001E  JMPT R4  #0020
-  0x50100001,  //  001F  LDBOOL R4  0 1
-  0x50100200,  //  0020  LDBOOL R4  1 0
-  0x7001FFF2,  //  0021  JMP    #0015
-  0x58140007,  //  0022  LDCONST  R5  K7
-  0xAC140200,  //  0023  CATCH  R5  1 0
-  0xB0080000,  //  0024  RAISE  2 R0  R0
-  0x80040800,  //  0025  RET  1 R4
-  0x50080000,  //  0026  LDBOOL R2  0 0
-  0x80040400,  //  0027  RET  1 R2
-};
-
-static const bproto exec_rules_proto = {
-  NULL,     // bgcobject *next
-  8,       // type
-  0x08,        // marked
-  12,       // nstack
-  0,       // nupvals
-  2,       // argc
-  0,       // varg
-  NULL,     // bgcobject *gray
-  NULL,     // bupvaldesc *upvals
-  (bvalue*) &exec_rules_ktab,     // ktab
-  NULL,     // bproto **ptab
-  (binstruction*) &exec_rules_code,     // code
-  be_local_const_str(exec_rules_str_name),       // name
-  40,       // codesize
-  8,       // nconst
-  0,       // nproto
-  be_local_const_str(exec_rules_str_source),     // source
-#if BE_DEBUG_RUNTIME_INFO /* debug information */
-  NULL,     // lineinfo
-  0,        // nlineinfo
-#endif
-#if BE_DEBUG_VAR_INFO
-  NULL,     // varinfo
-  0,        // nvarinfo
-#endif
-};
-
-const bclosure exec_rules_closure = {
-  NULL,     // bgcobject *next
-  36,       // type
-  0x08,        // marked
-  0,       // nupvals
-  NULL,     // bgcobject *gray
-  (bproto*) &exec_rules_proto,     // proto
-  { NULL }     // upvals
-};
-
-/*******************************************************************/
-
-
-/********************************************************************
-    "def set_timer(delay,f) "
-      "if !self._timers self._timers=[] end "
-      "self._timers.push([self.millis(delay),f]) "
-    "end "
-********************************************************************/
-/********************************************************************
-** Solidified function: set_timer
-********************************************************************/
-be_local_closure(set_timer,   /* name */
-  be_nested_proto(
-    9,                          /* nstack */
-    3,                          /* argc */
-    0,                          /* has upvals */
-    NULL,                       /* no upvals */
-    0,                          /* has sup protos */
-    NULL,                       /* no sub protos */
-    1,                          /* has constants */
-    ( &(const bvalue[ 3]) {     /* upvals */
-      { { .s=be_nested_const_str("_timers", -1694866380, 7) }, BE_STRING},
-      { { .s=be_nested_const_str("push", -2022703139, 4) }, BE_STRING},
-      { { .s=be_nested_const_str("millis", 1214679063, 6) }, BE_STRING},
-    }),
-    (be_nested_const_str("set_timer", 2135414533, 9)),
-    (be_nested_const_str("string", 398550328, 6)),
-    ( &(const binstruction[16]) {  /* code */
-      0x880C0100,  //  0000  GETMBR	R3	R0	R256
-      0x740E0002,  //  0001  JMPT	R3	#0005
-      0x600C000A,  //  0002  GETGBL	R3	G10
-      0x7C0C0000,  //  0003  CALL	R3	0
-      0x90020003,  //  0004  SETMBR	R0	R256	R3
-      0x880C0100,  //  0005  GETMBR	R3	R0	R256
-      0x8C0C0701,  //  0006  GETMET	R3	R3	R257
-      0x6014000A,  //  0007  GETGBL	R5	G10
-      0x7C140000,  //  0008  CALL	R5	0
-      0x8C180102,  //  0009  GETMET	R6	R0	R258
-      0x5C200200,  //  000A  MOVE	R8	R1
-      0x7C180400,  //  000B  CALL	R6	2
-      0x40180A06,  //  000C  CONNECT	R6	R5	R6
-      0x40180A02,  //  000D  CONNECT	R6	R5	R2
-      0x7C0C0400,  //  000E  CALL	R3	2
-      0x80000000,  //  000F  RET	0	R0
-    })
-  )
-);
-/*******************************************************************/
-
-
-/********************************************************************
-    // run every 50ms tick
-    "def run_deferred() "
-      "if self._timers "
-        "var i=0 "
-        "while i<self._timers.size() "
-          "if self.time_reached(self._timers[i][0]) "
-            "f=self._timers[i][1] "
-            "self._timers.remove(i) "
-            "f() "
-          "else "
-            "i=i+1 "
-          "end "
-        "end "
-      "end "
-    "end "
-********************************************************************/
-/********************************************************************
-** Solidified function: run_deferred
-********************************************************************/
-
-be_define_local_const_str(run_deferred_str_name, "run_deferred", 371594696, 12);
-be_define_local_const_str(run_deferred_str_source, "string", 398550328, 6);
-be_define_local_const_str(run_deferred_str_0, "_timers", -1694866380, 7);
-be_define_local_const_str(run_deferred_str_2, "size", 597743964, 4);
-be_define_local_const_str(run_deferred_str_3, "time_reached", 2075136773, 12);
-be_define_local_const_str(run_deferred_str_5, "remove", -611183107, 6);
-
-static const bvalue run_deferred_ktab[6] = {
-  { { .s=be_local_const_str(run_deferred_str_0) }, BE_STRING},
-  { { .i=0 }, BE_INT},
-  { { .s=be_local_const_str(run_deferred_str_2) }, BE_STRING},
-  { { .s=be_local_const_str(run_deferred_str_3) }, BE_STRING},
-  { { .i=1 }, BE_INT},
-  { { .s=be_local_const_str(run_deferred_str_5) }, BE_STRING},
-};
-
-static const uint32_t run_deferred_code[27] = {
-  0x88040100,  //  0000  GETMBR R1  R0  R256
-  0x78060017,  //  0001  JMPF R1  #001A
-  0x58040001,  //  0002  LDCONST  R1  K1
-  0x88080100,  //  0003  GETMBR R2  R0  R256
-  0x8C080502,  //  0004  GETMET R2  R2  R258
-  0x7C080200,  //  0005  CALL R2  1
-  0x14080202,  //  0006  LT R2  R1  R2
-  0x780A0011,  //  0007  JMPF R2  #001A
-  0x8C080103,  //  0008  GETMET R2  R0  R259
-  0x88100100,  //  0009  GETMBR R4  R0  R256
-  0x94100801,  //  000A  GETIDX R4  R4  R1
-  0x94100901,  //  000B  GETIDX R4  R4  R257
-  0x7C080400,  //  000C  CALL R2  2
-  0x780A0009,  //  000D  JMPF R2  #0018
-  0x88080100,  //  000E  GETMBR R2  R0  R256
-  0x94080401,  //  000F  GETIDX R2  R2  R1
-  0x94080504,  //  0010  GETIDX R2  R2  R260
-  0x880C0100,  //  0011  GETMBR R3  R0  R256
-  0x8C0C0705,  //  0012  GETMET R3  R3  R261
-  0x5C140200,  //  0013  MOVE R5  R1
-  0x7C0C0400,  //  0014  CALL R3  2
-  0x5C0C0400,  //  0015  MOVE R3  R2
-  0x7C0C0000,  //  0016  CALL R3  0
-  0x70020000,  //  0017  JMP    #0019
-  0x40304,  //  0018  ADD R1  R1  R260
-  0x7001FFE8,  //  0019  JMP    #0003
-  0x80000000,  //  001A  RET  0 R0
-};
-
-static const bproto run_deferred_proto = {
-  NULL,     // bgcobject *next
-  8,       // type
-  0x08,        // marked
-  6,       // nstack
-  0,       // nupvals
-  1,       // argc
-  0,       // varg
-  NULL,     // bgcobject *gray
-  NULL,     // bupvaldesc *upvals
-  (bvalue*) &run_deferred_ktab,     // ktab
-  NULL,     // bproto **ptab
-  (binstruction*) &run_deferred_code,     // code
-  be_local_const_str(run_deferred_str_name),       // name
-  27,       // codesize
-  6,       // nconst
-  0,       // nproto
-  be_local_const_str(run_deferred_str_source),     // source
-#if BE_DEBUG_RUNTIME_INFO /* debug information */
-  NULL,     // lineinfo
-  0,        // nlineinfo
-#endif
-#if BE_DEBUG_VAR_INFO
-  NULL,     // varinfo
-  0,        // nvarinfo
-#endif
-};
-
-const bclosure run_deferred_closure = {
-  NULL,     // bgcobject *next
-  36,       // type
-  0x08,        // marked
-  0,       // nupvals
-  NULL,     // bgcobject *gray
-  (bproto*) &run_deferred_proto,     // proto
-  { NULL }     // upvals
-};
-
-/*******************************************************************/
-
-
 /********************************************************************
     // Add command to list
     "def add_cmd(c,f) "
@@ -1213,10 +416,10 @@ be_local_closure(remove_cmd,   /* name */
     // Execute custom command
     "def exec_cmd(cmd, idx, payload) "
       "if self._ccmd "
-        "import json "
-        "var payload_json = json.load(payload) "
         "var cmd_found = self.find_key_i(self._ccmd, cmd) "
         "if cmd_found != nil "
+          "import json "
+          "var payload_json = json.load(payload) "  // parsed only when a command matches
           "self.resolvecmnd(cmd_found) "  // set the command name in XdrvMailbox.command
           "self._ccmd[cmd_found](cmd_found, idx, payload, payload_json) "
           "return true "
@@ -1225,97 +428,63 @@ be_local_closure(remove_cmd,   /* name */
       "return false "
     "end "
 ********************************************************************/
+
 /********************************************************************
 ** Solidified function: exec_cmd
 ********************************************************************/
-
-be_define_local_const_str(exec_cmd_str_name, "exec_cmd", 493567399, 8);
-be_define_local_const_str(exec_cmd_str_source, "string", 398550328, 6);
-be_define_local_const_str(exec_cmd_str_0, "_ccmd", -2131545883, 5);
-be_define_local_const_str(exec_cmd_str_1, "json", 916562499, 4);
-be_define_local_const_str(exec_cmd_str_2, "load", -435725847, 4);
-be_define_local_const_str(exec_cmd_str_3, "find_key_i", 850136726, 10);
-be_define_local_const_str(exec_cmd_str_4, "resolvecmnd", 993361485, 11);
-
-static const bvalue exec_cmd_ktab[5] = {
-  { { .s=be_local_const_str(exec_cmd_str_0) }, BE_STRING},
-  { { .s=be_local_const_str(exec_cmd_str_1) }, BE_STRING},
-  { { .s=be_local_const_str(exec_cmd_str_2) }, BE_STRING},
-  { { .s=be_local_const_str(exec_cmd_str_3) }, BE_STRING},
-  { { .s=be_local_const_str(exec_cmd_str_4) }, BE_STRING},
-};
-
-static const uint32_t exec_cmd_code[27] = {
-  0x88100100,  //  0000  GETMBR	R4	R0	R256
-  0x78120016,  //  0001  JMPF	R4	#0019
-  0xA4120200,  //  0002  IMPORT	R4	R257
-  0x8C140902,  //  0003  GETMET	R5	R4	R258
-  0x5C1C0600,  //  0004  MOVE	R7	R3
-  0x7C140400,  //  0005  CALL	R5	2
-  0x8C180103,  //  0006  GETMET	R6	R0	R259
-  0x88200100,  //  0007  GETMBR	R8	R0	R256
-  0x5C240200,  //  0008  MOVE	R9	R1
-  0x7C180600,  //  0009  CALL	R6	3
-  0x4C1C0000,  //  000A  LDNIL	7
-  0x201C0C07,  //  000B  NE	R7	R6	R7
-  0x781E000B,  //  000C  JMPF	R7	#0019
-  0x8C1C0104,  //  000D  GETMET	R7	R0	R260
-  0x5C240C00,  //  000E  MOVE	R9	R6
-  0x7C1C0400,  //  000F  CALL	R7	2
-  0x881C0100,  //  0010  GETMBR	R7	R0	R256
-  0x941C0E06,  //  0011  GETIDX	R7	R7	R6
-  0x5C200C00,  //  0012  MOVE	R8	R6
-  0x5C240400,  //  0013  MOVE	R9	R2
-  0x5C280600,  //  0014  MOVE	R10	R3
-  0x5C2C0A00,  //  0015  MOVE	R11	R5
-  0x7C1C0800,  //  0016  CALL	R7	4
-  0x501C0200,  //  0017  LDBOOL	R7	1	0
-  0x80040E00,  //  0018  RET	1	R7
-  0x50100000,  //  0019  LDBOOL	R4	0	0
-  0x80040800,  //  001A  RET	1	R4
-};
-
-static const bproto exec_cmd_proto = {
-  NULL,     // bgcobject *next
-  8,       // type
-  0x08,        // marked
-  12,       // nstack
-  0,       // nupvals
-  4,       // argc
-  0,       // varg
-  NULL,     // bgcobject *gray
-  NULL,     // bupvaldesc *upvals
-  (bvalue*) &exec_cmd_ktab,     // ktab
-  NULL,     // bproto **ptab
-  (binstruction*) &exec_cmd_code,     // code
-  be_local_const_str(exec_cmd_str_name),       // name
-  27,       // codesize
-  5,       // nconst
-  0,       // nproto
-  be_local_const_str(exec_cmd_str_source),     // source
-#if BE_DEBUG_RUNTIME_INFO /* debug information */
-  NULL,     // lineinfo
-  0,        // nlineinfo
-#endif
-#if BE_DEBUG_VAR_INFO
-  NULL,     // varinfo
-  0,        // nvarinfo
-#endif
-};
-
-static const bclosure exec_cmd_closure = {
-  NULL,     // bgcobject *next
-  36,       // type
-  0x08,        // marked
-  0,       // nupvals
-  NULL,     // bgcobject *gray
-  (bproto*) &exec_cmd_proto,     // proto
-  { NULL }     // upvals
-};
-
+be_local_closure(exec_cmd,   /* name */
+  be_nested_proto(
+    12,                          /* nstack */
+    4,                          /* argc */
+    0,                          /* has upvals */
+    NULL,                       /* no upvals */
+    0,                          /* has sup protos */
+    NULL,                       /* no sub protos */
+    1,                          /* has constants */
+    ( &(const bvalue[ 5]) {     /* upvals */
+      { { .s=be_nested_const_str("_ccmd", -2131545883, 5) }, BE_STRING},
+      { { .s=be_nested_const_str("find_key_i", 850136726, 10) }, BE_STRING},
+      { { .s=be_nested_const_str("json", 916562499, 4) }, BE_STRING},
+      { { .s=be_nested_const_str("load", -435725847, 4) }, BE_STRING},
+      { { .s=be_nested_const_str("resolvecmnd", 993361485, 11) }, BE_STRING},
+    }),
+    (be_nested_const_str("exec_cmd", 493567399, 8)),
+    (be_nested_const_str("string", 398550328, 6)),
+    ( &(const binstruction[27]) {  /* code */
+      0x88100100,  //  0000  GETMBR	R4	R0	R256
+      0x78120016,  //  0001  JMPF	R4	#0019
+      0x8C100101,  //  0002  GETMET	R4	R0	R257
+      0x88180100,  //  0003  GETMBR	R6	R0	R256
+      0x5C1C0200,  //  0004  MOVE	R7	R1
+      0x7C100600,  //  0005  CALL	R4	3
+      0x4C140000,  //  0006  LDNIL	5
+      0x20140805,  //  0007  NE	R5	R4	R5
+      0x7816000F,  //  0008  JMPF	R5	#0019
+      0xA4160400,  //  0009  IMPORT	R5	R258
+      0x8C180B03,  //  000A  GETMET	R6	R5	R259
+      0x5C200600,  //  000B  MOVE	R8	R3
+      0x7C180400,  //  000C  CALL	R6	2
+      0x8C1C0104,  //  000D  GETMET	R7	R0	R260
+      0x5C240800,  //  000E  MOVE	R9	R4
+      0x7C1C0400,  //  000F  CALL	R7	2
+      0x881C0100,  //  0010  GETMBR	R7	R0	R256
+      0x941C0E04,  //  0011  GETIDX	R7	R7	R4
+      0x5C200800,  //  0012  MOVE	R8	R4
+      0x5C240400,  //  0013  MOVE	R9	R2
+      0x5C280600,  //  0014  MOVE	R10	R3
+      0x5C2C0C00,  //  0015  MOVE	R11	R6
+      0x7C1C0800,  //  0016  CALL	R7	4
+      0x501C0200,  //  0017  LDBOOL	R7	1	0
+      0x80040E00,  //  0018  RET	1	R7
+      0x50100000,  //  0019  LDBOOL	R4	0	0
+      0x80040800,  //  001A  RET	1	R4
+    })
+  )
+);
 /*******************************************************************/
 
 
+
 /********************************************************************
     // Force gc and return allocated memory
     "def gc() "
@@ -1361,47 +530,24 @@ be_local_closure(gc,   /* name */
 ********************************************************************/
 be_local_closure(event,   /* name */
   be_nested_proto(
-    16,                          /* nstack */
+    10,                          /* nstack */
     5,                          /* argc */
     0,                          /* has upvals */
     NULL,                       /* no upvals */
     0,                          /* has sup protos */
     NULL,                       /* no sub protos */
     1,                          /* has constants */
-    ( &(const bvalue[29]) {     /* upvals */
+    ( &(const bvalue[ 6]) {     /* upvals */
       { { .s=be_nested_const_str("cmd", -158181397, 3) }, BE_STRING},
       { { .s=be_nested_const_str("exec_cmd", 493567399, 8) }, BE_STRING},
       { { .s=be_nested_const_str("rule", -64077613, 4) }, BE_STRING},
       { { .s=be_nested_const_str("exec_rules", 1445221092, 10) }, BE_STRING},
       { { .s=be_nested_const_str("mqtt_data", -1756753932, 9) }, BE_STRING},
       { { .s=be_nested_const_str("gc", 1042313471, 2) }, BE_STRING},
-      { { .s=be_nested_const_str("every_50ms", -1911083288, 10) }, BE_STRING},
-      { { .s=be_nested_const_str("run_deferred", 371594696, 12) }, BE_STRING},
-      { { .s=be_nested_const_str("_drivers", -1034638311, 8) }, BE_STRING},
-      { { .s=be_nested_const_str("every_second", 2075451465, 12) }, BE_STRING},
-      { { .s=be_nested_const_str("every_100ms", 1546407804, 11) }, BE_STRING},
-      { { .s=be_nested_const_str("web_add_button", -757092238, 14) }, BE_STRING},
-      { { .s=be_nested_const_str("web_add_main_button", -334599632, 19) }, BE_STRING},
-      { { .s=be_nested_const_str("web_add_management_button", -1556090110, 25) }, BE_STRING},
-      { { .s=be_nested_const_str("web_add_config_button", 639674325, 21) }, BE_STRING},
-      { { .s=be_nested_const_str("web_add_console_button", -813531104, 22) }, BE_STRING},
-      { { .s=be_nested_const_str("save_before_restart", 1253239338, 19) }, BE_STRING},
-      { { .s=be_nested_const_str("web_add_handler", -304792334, 15) }, BE_STRING},
-      { { .s=be_nested_const_str("web_sensor", -1394870324, 10) }, BE_STRING},
-      { { .s=be_nested_const_str("json_append", -1292948012, 11) }, BE_STRING},
-      { { .s=be_nested_const_str("button_pressed", 1694209616, 14) }, BE_STRING},
-      { { .s=be_nested_const_str("button_preselif", 491115394, 15) }, BE_STRING},
-      { { .s=be_nested_const_str("display", 1164572437, 7) }, BE_STRING},
-      { { .s=be_nested_const_str("string", 398550328, 6) }, BE_STRING},
-      { { .s=be_nested_const_str("log", 1062293841, 3) }, BE_STRING},
-      { { .s=be_nested_const_str("format", -1180859054, 6) }, BE_STRING},
-      { { .s=be_nested_const_str("BRY: exception %s - %m", -1290966132, 22) }, BE_STRING},
-      { { .i=3 }, BE_INT},
-      { { .s=be_nested_const_str("stop_iteration", -121173395, 14) }, BE_STRING},
     }),
     (be_nested_const_str("event", -30355297, 5)),
     (be_nested_const_str("input", -103256197, 5)),
-    ( &(const binstruction[153]) {  /* code */
+    ( &(const binstruction[27]) {  /* code */
       0x1C140300,  //  0000  EQ	R5	R1	R256
       0x78160006,  //  0001  JMPF	R5	#0009
       0x8C140101,  //  0002  GETMET	R5	R0	R257
@@ -1410,225 +556,30 @@ be_local_closure(event,   /* name */
       0x5C240800,  //  0005  MOVE	R9	R4
       0x7C140800,  //  0006  CALL	R5	4
       0x80040A00,  //  0007  RET	1	R5
-      0x7002008E,  //  0008  JMP		#0098
+      0x70020010,  //  0008  JMP		#001A
       0x1C140302,  //  0009  EQ	R5	R1	R258
       0x78160004,  //  000A  JMPF	R5	#0010
       0x8C140103,  //  000B  GETMET	R5	R0	R259
       0x5C1C0800,  //  000C  MOVE	R7	R4
       0x7C140400,  //  000D  CALL	R5	2
       0x80040A00,  //  000E  RET	1	R5
-      0x70020087,  //  000F  JMP		#0098
+      0x70020009,  //  000F  JMP		#001A
       0x1C140304,  //  0010  EQ	R5	R1	R260
       0x78160002,  //  0011  JMPF	R5	#0015
       0x4C140000,  //  0012  LDNIL	5
       0x80040A00,  //  0013  RET	1	R5
-      0x70020082,  //  0014  JMP		#0098
+      0x70020004,  //  0014  JMP		#001A
       0x1C140305,  //  0015  EQ	R5	R1	R261
-      0x78160003,  //  0016  JMPF	R5	#001B
+      0x78160002,  //  0016  JMPF	R5	#001A
       0x8C140105,  //  0017  GETMET	R5	R0	R261
       0x7C140200,  //  0018  CALL	R5	1
       0x80040A00,  //  0019  RET	1	R5
-      0x7002007C,  //  001A  JMP		#0098
-      0x1C140306,  //  001B  EQ	R5	R1	R262
-      0x78160003,  //  001C  JMPF	R5	#0021
-      0x8C140107,  //  001D  GETMET	R5	R0	R263
-      0x7C140200,  //  001E  CALL	R5	1
-      0x80040A00,  //  001F  RET	1	R5
-      0x70020076,  //  0020  JMP		#0098
-      0x88140108,  //  0021  GETMBR	R5	R0	R264
-      0x78160074,  //  0022  JMPF	R5	#0098
-      0x60140000,  //  0023  GETGBL	R5	G0
-      0x88180108,  //  0024  GETMBR	R6	R0	R264
-      0x7C140200,  //  0025  CALL	R5	1
-      0xA802006D,  //  0026  EXBLK	0	#0095
-      0x5C180A00,  //  0027  MOVE	R6	R5
-      0x7C180000,  //  0028  CALL	R6	0
-      0xA802005E,  //  0029  EXBLK	0	#0089
-      0x1C1C0309,  //  002A  EQ	R7	R1	R265
-      0x781E0004,  //  002B  JMPF	R7	#0031
-      0x881C0D09,  //  002C  GETMBR	R7	R6	R265
-      0x781E0002,  //  002D  JMPF	R7	#0031
-      0x8C1C0D09,  //  002E  GETMET	R7	R6	R265
-      0x7C1C0200,  //  002F  CALL	R7	1
-      0x70020055,  //  0030  JMP		#0087
-      0x1C1C030A,  //  0031  EQ	R7	R1	R266
-      0x781E0004,  //  0032  JMPF	R7	#0038
-      0x881C0D0A,  //  0033  GETMBR	R7	R6	R266
-      0x781E0002,  //  0034  JMPF	R7	#0038
-      0x8C1C0D0A,  //  0035  GETMET	R7	R6	R266
-      0x7C1C0200,  //  0036  CALL	R7	1
-      0x7002004E,  //  0037  JMP		#0087
-      0x1C1C030B,  //  0038  EQ	R7	R1	R267
-      0x781E0004,  //  0039  JMPF	R7	#003F
-      0x881C0D0B,  //  003A  GETMBR	R7	R6	R267
-      0x781E0002,  //  003B  JMPF	R7	#003F
-      0x8C1C0D0B,  //  003C  GETMET	R7	R6	R267
-      0x7C1C0200,  //  003D  CALL	R7	1
-      0x70020047,  //  003E  JMP		#0087
-      0x1C1C030C,  //  003F  EQ	R7	R1	R268
-      0x781E0004,  //  0040  JMPF	R7	#0046
-      0x881C0D0C,  //  0041  GETMBR	R7	R6	R268
-      0x781E0002,  //  0042  JMPF	R7	#0046
-      0x8C1C0D0C,  //  0043  GETMET	R7	R6	R268
-      0x7C1C0200,  //  0044  CALL	R7	1
-      0x70020040,  //  0045  JMP		#0087
-      0x1C1C030D,  //  0046  EQ	R7	R1	R269
-      0x781E0004,  //  0047  JMPF	R7	#004D
-      0x881C0D0D,  //  0048  GETMBR	R7	R6	R269
-      0x781E0002,  //  0049  JMPF	R7	#004D
-      0x8C1C0D0D,  //  004A  GETMET	R7	R6	R269
-      0x7C1C0200,  //  004B  CALL	R7	1
-      0x70020039,  //  004C  JMP		#0087
-      0x1C1C030E,  //  004D  EQ	R7	R1	R270
-      0x781E0004,  //  004E  JMPF	R7	#0054
-      0x881C0D0E,  //  004F  GETMBR	R7	R6	R270
-      0x781E0002,  //  0050  JMPF	R7	#0054
-      0x8C1C0D0E,  //  0051  GETMET	R7	R6	R270
-      0x7C1C0200,  //  0052  CALL	R7	1
-      0x70020032,  //  0053  JMP		#0087
-      0x1C1C030F,  //  0054  EQ	R7	R1	R271
-      0x781E0004,  //  0055  JMPF	R7	#005B
-      0x881C0D0F,  //  0056  GETMBR	R7	R6	R271
-      0x781E0002,  //  0057  JMPF	R7	#005B
-      0x8C1C0D0F,  //  0058  GETMET	R7	R6	R271
-      0x7C1C0200,  //  0059  CALL	R7	1
-      0x7002002B,  //  005A  JMP		#0087
-      0x1C1C0310,  //  005B  EQ	R7	R1	R272
-      0x781E0004,  //  005C  JMPF	R7	#0062
-      0x881C0D10,  //  005D  GETMBR	R7	R6	R272
-      0x781E0002,  //  005E  JMPF	R7	#0062
-      0x8C1C0D10,  //  005F  GETMET	R7	R6	R272
-      0x7C1C0200,  //  0060  CALL	R7	1
-      0x70020024,  //  0061  JMP		#0087
-      0x1C1C0311,  //  0062  EQ	R7	R1	R273
-      0x781E0004,  //  0063  JMPF	R7	#0069
-      0x881C0D11,  //  0064  GETMBR	R7	R6	R273
-      0x781E0002,  //  0065  JMPF	R7	#0069
-      0x8C1C0D11,  //  0066  GETMET	R7	R6	R273
-      0x7C1C0200,  //  0067  CALL	R7	1
-      0x7002001D,  //  0068  JMP		#0087
-      0x1C1C0312,  //  0069  EQ	R7	R1	R274
-      0x781E0004,  //  006A  JMPF	R7	#0070
-      0x881C0D12,  //  006B  GETMBR	R7	R6	R274
-      0x781E0002,  //  006C  JMPF	R7	#0070
-      0x8C1C0D12,  //  006D  GETMET	R7	R6	R274
-      0x7C1C0200,  //  006E  CALL	R7	1
-      0x70020016,  //  006F  JMP		#0087
-      0x1C1C0313,  //  0070  EQ	R7	R1	R275
-      0x781E0004,  //  0071  JMPF	R7	#0077
-      0x881C0D13,  //  0072  GETMBR	R7	R6	R275
-      0x781E0002,  //  0073  JMPF	R7	#0077
-      0x8C1C0D13,  //  0074  GETMET	R7	R6	R275
-      0x7C1C0200,  //  0075  CALL	R7	1
-      0x7002000F,  //  0076  JMP		#0087
-      0x1C1C0314,  //  0077  EQ	R7	R1	R276
-      0x781E0007,  //  0078  JMPF	R7	#0081
-      0x881C0D14,  //  0079  GETMBR	R7	R6	R276
-      0x781E0005,  //  007A  JMPF	R7	#0081
-      0x1C1C0311,  //  007B  EQ	R7	R1	R273
-      0x781DFFFE,  //  007C  JMPF	R7	#007C
-      0x881C0D16,  //  007D  GETMBR	R7	R6	R278
-      0x8C1C0D16,  //  007E  GETMET	R7	R6	R278
-      0x7C1C0200,  //  007F  CALL	R7	1
-      0x70020005,  //  0080  JMP		#0087
-      0x1C1C0316,  //  0081  EQ	R7	R1	R278
-      0x781E0003,  //  0082  JMPF	R7	#0087
-      0x881C0D16,  //  0083  GETMBR	R7	R6	R278
-      0x781E0001,  //  0084  JMPF	R7	#0087
-      0x8C1C0D16,  //  0085  GETMET	R7	R6	R278
-      0x7C1C0200,  //  0086  CALL	R7	1
-      0xA8040001,  //  0087  EXBLK	1	1
-      0x7002000A,  //  0088  JMP		#0094
-      0xAC1C0002,  //  0089  CATCH	R7	0	2
-      0x70020007,  //  008A  JMP		#0093
-      0xA4262E00,  //  008B  IMPORT	R9	R279
-      0x8C280118,  //  008C  GETMET	R10	R0	R280
-      0x8C301319,  //  008D  GETMET	R12	R9	R281
-      0x5838001A,  //  008E  LDCONST	R14	K26
-      0x583C001B,  //  008F  LDCONST	R15	K27
-      0x7C300600,  //  0090  CALL	R12	3
-      0x7C280400,  //  0091  CALL	R10	2
-      0x70020000,  //  0092  JMP		#0094
-      0xB0080000,  //  0093  RAISE	2	R0	R0
-      0x7001FF91,  //  0094  JMP		#0027
-      0x5814001C,  //  0095  LDCONST	R5	K28
-      0xAC140200,  //  0096  CATCH	R5	1	0
-      0xB0080000,  //  0097  RAISE	2	R0	R0
-      0x80000000,  //  0098  RET	0	R0
+      0x80000000,  //  001A  RET	0	R0
     })
   )
 );
 /*******************************************************************/
 
-/********************************************************************
-** Solidified function: add_driver
-********************************************************************/
-
-be_define_local_const_str(add_driver_str_name, "add_driver", 1654458371, 10);
-be_define_local_const_str(add_driver_str_source, "string", 398550328, 6);
-be_define_local_const_str(add_driver_str_0, "_drivers", -1034638311, 8);
-be_define_local_const_str(add_driver_str_1, "push", -2022703139, 4);
-
-static const bvalue add_driver_ktab[2] = {
-  { { .s=be_local_const_str(add_driver_str_0) }, BE_STRING},
-  { { .s=be_local_const_str(add_driver_str_1) }, BE_STRING},
-};
-
-static const uint32_t add_driver_code[12] = {
-  0x88080100,  //  0000  GETMBR R2  R0  R256
-  0x780A0004,  //  0001  JMPF R2  #0007
-  0x88080100,  //  0002  GETMBR R2  R0  R256
-  0x8C080501,  //  0003  GETMET R2  R2  R257
-  0x5C100200,  //  0004  MOVE R4  R1
-  0x7C080400,  //  0005  CALL R2  2
-  0x70020003,  //  0006  JMP    #000B
-  0x6008000A,  //  0007  GETGBL R2  G10
-  0x7C080000,  //  0008  CALL R2  0
-  0x400C0401,  //  0009  CONNECT  R3  R2  R1
-  0x90020002,  //  000A  SETMBR R0  R256  R2
-  0x80000000,  //  000B  RET  0 R0
-};
-
-static const bproto add_driver_proto = {
-  NULL,     // bgcobject *next
-  8,       // type
-  0x08,        // marked
-  5,       // nstack
-  0,       // nupvals
-  2,       // argc
-  0,       // varg
-  NULL,     // bgcobject *gray
-  NULL,     // bupvaldesc *upvals
-  (bvalue*) &add_driver_ktab,     // ktab
-  NULL,     // bproto **ptab
-  (binstruction*) &add_driver_code,     // code
-  be_local_const_str(add_driver_str_name),       // name
-  12,       // codesize
-  2,       // nconst
-  0,       // nproto
-  be_local_const_str(add_driver_str_source),     // source
-#if BE_DEBUG_RUNTIME_INFO /* debug information */
-  NULL,     // lineinfo
-  0,        // nlineinfo
-#endif
-#if BE_DEBUG_VAR_INFO
-  NULL,     // varinfo
-  0,        // nvarinfo
-#endif
-};
-
-const bclosure add_driver_closure = {
-  NULL,     // bgcobject *next
-  36,       // type
-  0x08,        // marked
-  0,       // nupvals
-  NULL,     // bgcobject *gray
-  (bproto*) &add_driver_proto,     // proto
-  { NULL }     // upvals
-};
-
-/*******************************************************************/
-
 /********************************************************************
 ** Solidified function: load
 ********************************************************************/
@@ -1641,7 +592,7 @@ be_local_closure(load,   /* name */
     0,                          /* has sup protos */
     NULL,                       /* no sub protos */
     1,                          /* has constants */
-    ( &(const bvalue[16]) {     /* upvals */
+    ( &(const bvalue[17]) {     /* upvals */
       { { .s=be_nested_const_str("string", 398550328, 6) }, BE_STRING},
       { { .s=be_nested_const_str("split", -2017972765, 5) }, BE_STRING},
       { { .s=be_nested_const_str(".", 722245873, 1) }, BE_STRING},
@@ -1653,6 +604,7 @@ be_local_closure(load,   /* name */
       { { .s=be_nested_const_str("c", -435409838, 1) }, BE_STRING},
       { { .s=be_nested_const_str("r", -150190315, 1) }, BE_STRING},
       { { .s=be_nested_const_str("close", 667630371, 5) }, BE_STRING},
+      { { .s=be_nested_const_str("_bec_valid", 1607346137, 10) }, BE_STRING},
       { { .s=be_nested_const_str("file", -1427482813, 4) }, BE_STRING},
       { { .s=be_nested_const_str("save", -855671224, 4) }, BE_STRING},
       { { .s=be_nested_const_str("log", 1062293841, 3) }, BE_STRING},
@@ -1661,7 +613,7 @@ be_local_closure(load,   /* name */
     }),
     (be_nested_const_str("load", -435725847, 4)),
     (be_nested_const_str("input", -103256197, 5)),
-    ( &(const binstruction[68]) {  /* code */
+    ( &(const binstruction[82]) {  /* code */
       0xA40A0000,  //  0000  IMPORT	R2	R256
       0x8C0C0501,  //  0001  GETMET	R3	R2	R257
       0x5C140200,  //  0002  MOVE	R5	R1
@@ -1703,33 +655,47 @@ be_local_closure(load,   /* name */
       0x80040A00,  //  0026  RET	1	R5
       0x70020000,  //  0027  JMP		#0029
       0xB0080000,  //  0028  RAISE	2	R0	R0
-      0x60140005,  //  0029  GETGBL	R5	G5
-      0x5C180200,  //  002A  MOVE	R6	R1
-      0x581C000B,  //  002B  LDCONST	R7	K11
-      0x7C140400,  //  002C  CALL	R5	2
-      0x74120011,  //  002D  JMPT	R4	#0040
-      0xA8020005,  //  002E  EXBLK	0	#0035
-      0x8C18010C,  //  002F  GETMET	R6	R0	R268
-      0x00200308,  //  0030  ADD	R8	R1	R264
-      0x5C240A00,  //  0031  MOVE	R9	R5
-      0x7C180600,  //  0032  CALL	R6	3
-      0xA8040001,  //  0033  EXBLK	1	1
-      0x7002000A,  //  0034  JMP		#0040
-      0xAC180001,  //  0035  CATCH	R6	0	1
-      0x70020007,  //  0036  JMP		#003F
-      0x8C1C010D,  //  0037  GETMET	R7	R0	R269
-      0x8C24050E,  //  0038  GETMET	R9	R2	R270
-      0x582C000F,  //  0039  LDCONST	R11	K15
-      0x00300308,  //  003A  ADD	R12	R1	R264
-      0x5C340C00,  //  003B  MOVE	R13	R6
-      0x7C240800,  //  003C  CALL	R9	4
-      0x7C1C0400,  //  003D  CALL	R7	2
-      0x70020000,  //  003E  JMP		#0040
-      0xB0080000,  //  003F  RAISE	2	R0	R0
-      0x5C180A00,  //  0040  MOVE	R6	R5
-      0x7C180000,  //  0041  CALL	R6	0
-      0x50180200,  //  0042  LDBOOL	R6	1	0
-      0x80040C00,  //  0043  RET	1	R6
+      0x4C140000,  //  0029  LDNIL	5
+      0x7412000A,  //  002A  JMPT	R4	#0036
+      0x8C18010B,  //  002B  GETMET	R6	R0	R267
+      0x00200308,  //  002C  ADD	R8	R1	R264
+      0x5C240200,  //  002D  MOVE	R9	R1
+      0x7C180600,  //  002E  CALL	R6	3
+      0x781A0005,  //  002F  JMPF	R6	#0036
+      0x60180005,  //  0030  GETGBL	R6	G5
+      0x001C0308,  //  0031  ADD	R7	R1	R264
+      0x5820000C,  //  0032  LDCONST	R8	K12
+      0x7C180400,  //  0033  CALL	R6	2
+      0x5C140C00,  //  0034  MOVE	R5	R6
+      0x70020017,  //  0035  JMP		#004E
+      0x60180005,  //  0036  GETGBL	R6	G5
+      0x5C1C0200,  //  0037  MOVE	R7	R1
+      0x5820000C,  //  0038  LDCONST	R8	K12
+      0x7C180400,  //  0039  CALL	R6	2
+      0x5C140C00,  //  003A  MOVE	R5	R6
+      0x74120011,  //  003B  JMPT	R4	#004E
+      0xA8020005,  //  003C  EXBLK	0	#0043
+      0x8C18010D,  //  003D  GETMET	R6	R0	R269
+      0x00200308,  //  003E  ADD	R8	R1	R264
+      0x5C240A00,  //  003F  MOVE	R9	R5
+      0x7C180600,  //  0040  CALL	R6	3
+      0xA8040001,  //  0041  EXBLK	1	1
+      0x7002000A,  //  0042  JMP		#004E
+      0xAC180001,  //  0043  CATCH	R6	0	1
+      0x70020007,  //  0044  JMP		#004D
+      0x8C1C010E,  //  0045  GETMET	R7	R0	R270
+      0x8C24050F,  //  0046  GETMET	R9	R2	R271
+      0x582C0010,  //  0047  LDCONST	R11	K16
+      0x00300308,  //  0048  ADD	R12	R1	R264
+      0x5C340C00,  //  0049  MOVE	R13	R6
+      0x7C240800,  //  004A  CALL	R9	4
+      0x7C1C0400,  //  004B  CALL	R7	2
+      0x70020000,  //  004C  JMP		#004E
+      0xB0080000,  //  004D  RAISE	2	R0	R0
+      0x5C180A00,  //  004E  MOVE	R6	R5
+      0x7C180000,  //  004F  CALL	R6	0
+      0x50180200,  //  0050  LDBOOL	R6	1	0
+      0x80040C00,  //  0051  RET	1	R6
     })
   )
 );
@@ -2292,6 +1258,7 @@ void be_load_tasmota_ntvlib(bvm *vm)
         { "_timers", NULL },
         { "_ccmd", NULL },
         { "_drivers", NULL },
+        { "_events", NULL },
         { "_cb", NULL},
         { "wire1", NULL },
         { "wire2", NULL },
@@ -2310,6 +1277,7 @@ void be_load_tasmota_ntvlib(bvm *vm)
         { "scale_uint", l_scaleuint },
         { "log", l_logInfo },
         { "save", l_save },
+        { "_bec_valid", l_becValid },
 
         { "resp_cmnd", l_respCmnd },
         { "resp_cmnd_str", l_respCmndStr },
@@ -2327,23 +1295,25 @@ void be_load_tasmota_ntvlib(bvm *vm)
 
         { "i2c_enabled", l_i2cenabled },
 
+        { "add_rule", l_addRule },
+        { "remove_rule", l_removeRule },
+        { "exec_rules", l_execRules },
+        { "set_timer", l_setTimer },
+        { "add_cron", l_addCron },
+        { "remove_timer", l_removeTimer },
+        { "run_deferred", l_runDeferred },
+        { "add_driver", l_addDriver },
+        { "remove_driver", l_removeDriver },
+
         { NULL, (bntvfunc) BE_CLOSURE }, /* mark section for berry closures */
         { "cmd", (bntvfunc) &cmd_closure },
         { "chars_in_string", (bntvfunc) &chars_in_string_closure },
         { "find_key_i", (bntvfunc) &find_key_i_closure },
-        { "find_op", (bntvfunc) &find_op_closure },
-        { "add_rule", (bntvfunc) &add_rule_closure },
-        { "remove_rule", (bntvfunc) &remove_rule_closure },
-        { "try_rule", (bntvfunc) &try_rule_closure },
-        { "exec_rules", (bntvfunc) &exec_rules_closure },
-        { "set_timer", (bntvfunc) &set_timer_closure },
-        { "run_deferred", (bntvfunc) &run_deferred_closure },
         { "add_cmd", (bntvfunc) &add_cmd_closure },
         { "remove_cmd", (bntvfunc) &remove_cmd_closure },
         { "exec_cmd", (bntvfunc) &exec_cmd_closure },
         { "gc", (bntvfunc) &gc_closure },
         { "event", (bntvfunc) &event_closure },
-        { "add_driver", (bntvfunc) &add_driver_closure },
         { "load", (bntvfunc) &load_closure },
         { "wire_scan", (bntvfunc) &wire_scan_closure },
         { "time_str", (bntvfunc) &time_str_closure },
@@ -2372,6 +1342,7 @@ class be_class_tasmota (scope: global, name: Tasmota) {
     _timers, var
     _ccmd, var
     _drivers, var
+    _events, var
     _cb, var
     wire1, var
     wire2, var
@@ -2391,6 +1362,7 @@ class be_class_tasmota (scope: global, name: Tasmota) {
     scale_uint, func(l_scaleuint)
     log, func(l_logInfo)
     save, func(l_save)
+    _bec_valid, func(l_becValid)
 
     resp_cmnd, func(l_respCmnd)
     resp_cmnd_str, func(l_respCmndStr)
@@ -2408,22 +1380,24 @@ class be_class_tasmota (scope: global, name: Tasmota) {
 
     i2c_enabled, func(l_i2cenabled)
 
+    add_rule, func(l_addRule)
+    remove_rule, func(l_removeRule)
+    exec_rules, func(l_execRules)
+    set_timer, func(l_setTimer)
+    add_cron, func(l_addCron)
+    remove_timer, func(l_removeTimer)
+    run_deferred, func(l_runDeferred)
+    add_driver, func(l_addDriver)
+    remove_driver, func(l_removeDriver)
+
     cmd, closure(cmd_closure)
     chars_in_string, closure(chars_in_string_closure)
     find_key_i, closure(find_key_i_closure)
-    find_op, closure(find_op_closure)
-    add_rule, closure(add_rule_closure)
-    remove_rule, closure(remove_rule_closure)
-    try_rule, closure(try_rule_closure)
-    exec_rules, closure(exec_rules_closure)
-    set_timer, closure(set_timer_closure)
-    run_deferred, closure(run_deferred_closure)
     add_cmd, closure(add_cmd_closure)
     remove_cmd, closure(remove_cmd_closure)
     exec_cmd, closure(exec_cmd_closure)
     gc, closure(gc_closure)
     event, closure(event_closure)
-    add_driver, closure(add_driver_closure)
     load, closure(load_closure)
     wire_scan, closure(wire_scan_closure)
     time_str, closure(time_str_closure)
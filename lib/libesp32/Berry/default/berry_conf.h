@@ -85,12 +85,21 @@
  **/
 #define BE_STACK_FREE_MIN               10
 
-/* Macro: BE_STACK_FREE_MIN
+/* Macro: BE_USE_STR_HASH_CACHE
  * The short string will hold the hash value when the value is
- * true. It may be faster but requires more RAM.
- * Default: 0
+ * true, map lookups and string interning don't hash it again.
+ * On 64 bits targets the hash fills the padding of the header,
+ * on 32 bits targets like the ESP32 it would grow the header of
+ * every short string from 8 to 12 bytes.
+ * Default: 1 on 64 bits targets, 0 otherwise
  **/
+#ifndef BE_USE_STR_HASH_CACHE
+#if defined(__SIZEOF_POINTER__) && (__SIZEOF_POINTER__ > 4)
+#define BE_USE_STR_HASH_CACHE           1
+#else
 #define BE_USE_STR_HASH_CACHE           0
+#endif
+#endif
 
 /* Macro: BE_USE_FILE_SYSTEM
  * The file system interface will be used when this macro is true
@@ -142,6 +151,66 @@
  **/
 #define BE_USE_DEBUG_HOOK               0
 
+/* Macro: BE_USE_COMPUTED_GOTO
+ * Dispatch the VM loop through a table of label addresses
+ * (threaded code) instead of a switch statement. This needs
+ * the GCC "labels as values" extension, the switch is used
+ * with other compilers.
+ * Default: 1
+ **/
+#ifndef BE_USE_COMPUTED_GOTO
+#define BE_USE_COMPUTED_GOTO            1
+#endif
+
+/* Macro: BE_USE_SUPERINSTRUCTIONS
+ * Fuse frequent pairs of instructions when code is compiled or
+ * loaded, so that each pair needs a single dispatch. Saved
+ * bytecode and solidified code always contain plain instructions.
+ * Default: 1
+ **/
+#ifndef BE_USE_SUPERINSTRUCTIONS
+#define BE_USE_SUPERINSTRUCTIONS        1
+#endif
+
+/* Macro: BE_USE_PERF_COUNTERS
+ * Count the instructions executed by the VM and the member
+ * cache hits and misses, the counters are read with
+ * `debug.counters()`. Adds one increment per instruction.
+ * Default: 0
+ **/
+#ifndef BE_USE_PERF_COUNTERS
+#define BE_USE_PERF_COUNTERS            0
+#endif
+
+/* Macro: BE_USE_INLINE_CACHE
+ * Cache the member lookups of GETMBR, GETMET and SETMBR keyed on
+ * the class of the instance. Each VM holds BE_INLINE_CACHE_SIZE
+ * entries (a power of 2) indexed by instruction address.
+ * Default: 1
+ **/
+#ifndef BE_USE_INLINE_CACHE
+#define BE_USE_INLINE_CACHE             1
+#endif
+#ifndef BE_INLINE_CACHE_SIZE
+#define BE_INLINE_CACHE_SIZE            64
+#endif
+
+/* Macro: BE_USE_POOL_ALLOC
+ * Allocate the blocks of up to BE_POOL_MAX_SIZE bytes (strings,
+ * instances, closures, lists and small maps) from pages of
+ * BE_POOL_PAGE_SIZE bytes split in size classes of BE_POOL_ALIGN
+ * bytes, instead of one system allocation per block. Pages are
+ * allocated with BE_EXPLICIT_MALLOC and follow it to PSRAM.
+ * Usage is reported by `gc.pool()`.
+ * Default: 1
+ **/
+#ifndef BE_USE_POOL_ALLOC
+#define BE_USE_POOL_ALLOC               1
+#endif
+#define BE_POOL_PAGE_SIZE               512
+#define BE_POOL_MAX_SIZE                64
+#define BE_POOL_ALIGN                   8
+
 /* Macro: BE_USE_XXX_MODULE
  * These macros control whether the related module is compiled.
  * When they are true, they will enable related modules. At this
@@ -186,6 +255,22 @@ extern "C" {
 
 #define BE_EXPLICIT_ABORT               abort
 #define BE_EXPLICIT_EXIT                exit
+
+/* Macro: BE_EXPLICIT_CLOCK
+ * Free running clock in microseconds, the GC uses it to measure
+ * its pauses (see gc.stats()). Pauses are reported as 0 when the
+ * macro is not defined.
+ **/
+#ifdef COMPILE_BERRY_LIB
+#ifdef __cplusplus
+extern "C" {
+#endif
+  extern uint32_t berry_micros(void);
+#ifdef __cplusplus
+}
+#endif
+  #define BE_EXPLICIT_CLOCK               berry_micros
+#endif // COMPILE_BERRY_LIB
 // #define BE_EXPLICIT_MALLOC              malloc
 // #define BE_EXPLICIT_FREE                free
 // #define BE_EXPLICIT_REALLOC             realloc
@@ -1,633 +1,641 @@
-extern const bcstring be_const_str_lv_style;
-extern const bcstring be_const_str_ETH_PHY_MDIO;
-extern const bcstring be_const_str_SYMBOL_PLUS;
-extern const bcstring be_const_str_hex;
-extern const bcstring be_const_str_setrange;
-extern const bcstring be_const_str_bus;
-extern const bcstring be_const_str_concat;
-extern const bcstring be_const_str_raise;
-extern const bcstring be_const_str_ROT1A;
-extern const bcstring be_const_str_SPI_CLK;
-extern const bcstring be_const_str_SYMBOL_MINUS;
-extern const bcstring be_const_str_WEBCAM_PSCLK;
-extern const bcstring be_const_str_top;
-extern const bcstring be_const_str_EPAPER42_CS;
-extern const bcstring be_const_str_return;
-extern const bcstring be_const_str_MCP39F5_RST;
-extern const bcstring be_const_str_OUTPUT_OPEN_DRAIN;
-extern const bcstring be_const_str_write_bytes;
-extern const bcstring be_const_str_SYMBOL_SETTINGS;
-extern const bcstring be_const_str_call;
-extern const bcstring be_const_str_lv_draw_mask_angle_param;
-extern const bcstring be_const_str_pi;
-extern const bcstring be_const_str_acos;
-extern const bcstring be_const_str_atan;
-extern const bcstring be_const_str_content_flush;
-extern const bcstring be_const_str_SYMBOL_BACKSPACE;
-extern const bcstring be_const_str_TM1638STB;
-extern const bcstring be_const_str_resp_cmnd;
-extern const bcstring be_const_str_web_add_management_button;
-extern const bcstring be_const_str_NRG_SEL;
-extern const bcstring be_const_str_SYMBOL_OK;
-extern const bcstring be_const_str_Wire;
-extern const bcstring be_const_str_SYMBOL_BATTERY_3;
-extern const bcstring be_const_str_init;
-extern const bcstring be_const_str_redirect;
-extern const bcstring be_const_str_ADC_TEMP;
-extern const bcstring be_const_str__get_cb;
-extern const bcstring be_const_str_finish;
-extern const bcstring be_const_str_SPI_DC;
-extern const bcstring be_const_str_MIEL_HVAC_RX;
-extern const bcstring be_const_str_NEOPOOL_TX;
-extern const bcstring be_const_str_SSD1331_CS;
-extern const bcstring be_const_str_TELEINFO_RX;
-extern const bcstring be_const_str_SHELLY_DIMMER_RST_INV;
-extern const bcstring be_const_str_MAX7219CS;
-extern const bcstring be_const_str_pin_mode;
-extern const bcstring be_const_str_SDM72_RX;
-extern const bcstring be_const_str_SYMBOL_HOME;
-extern const bcstring be_const_str_TM1637CLK;
-extern const bcstring be_const_str_char;
-extern const bcstring be_const_str_resp_cmnd_done;
+extern const bcstring be_const_str_DDSU666_TX;
+extern const bcstring be_const_str_PROJECTOR_CTRL_TX;
+extern const bcstring be_const_str_lv_draw_mask_radius_param;
+extern const bcstring be_const_str_sin;
 extern const bcstring be_const_str_ADC_LIGHT;
-extern const bcstring be_const_str_ZIGBEE_TX;
-extern const bcstring be_const_str_lv_dropdown;
-extern const bcstring be_const_str_A4988_DIR;
-extern const bcstring be_const_str_AS3935;
-extern const bcstring be_const_str_lv_sqrt_res;
-extern const bcstring be_const_str_IEM3000_TX;
-extern const bcstring be_const_str_cosh;
-extern const bcstring be_const_str_web_sensor;
-extern const bcstring be_const_str_continue;
-extern const bcstring be_const_str_BS814_DAT;
-extern const bcstring be_const_str_opt_add;
-extern const bcstring be_const_str_A4988_ENA;
-extern const bcstring be_const_str_lv_point;
-extern const bcstring be_const_str_delay;
-extern const bcstring be_const_str_resp_cmnd_str;
-extern const bcstring be_const_str_iter;
-extern const bcstring be_const_str_fromstring;
-extern const bcstring be_const_str_lv_event_cb;
-extern const bcstring be_const_str_CNTR1_NP;
-extern const bcstring be_const_str_tanh;
-extern const bcstring be_const_str_lv_objmask;
+extern const bcstring be_const_str_ADC_RANGE;
+extern const bcstring be_const_str_Driver;
+extern const bcstring be_const_str_srand;
 extern const bcstring be_const_str_SOLAXX1_RX;
-extern const bcstring be_const_str_HRE_CLOCK;
-extern const bcstring be_const_str_MAX31855CS;
-extern const bcstring be_const_str_SDM630_TX;
-extern const bcstring be_const_str_every_second;
-extern const bcstring be_const_str_SYMBOL_AUDIO;
-extern const bcstring be_const_str_RC522_CS;
-extern const bcstring be_const_str_def;
-extern const bcstring be_const_str_REL1;
-extern const bcstring be_const_str_load_font;
-extern const bcstring be_const_str_real;
-extern const bcstring be_const_str_set;
-extern const bcstring be_const_str_PZEM016_RX;
-extern const bcstring be_const_str_SSPI_CS;
-extern const bcstring be_const_str_SYMBOL_TRASH;
 extern const bcstring be_const_str_wire;
-extern const bcstring be_const_str_REL1_INV;
-extern const bcstring be_const_str_FTC532;
-extern const bcstring be_const_str_OUTPUT_HI;
-extern const bcstring be_const_str_classof;
-extern const bcstring be_const_str_web_send_decimal;
-extern const bcstring be_const_str_opt_neq;
-extern const bcstring be_const_str_LED1_INV;
-extern const bcstring be_const_str_load;
-extern const bcstring be_const_str_ADC_INPUT;
+extern const bcstring be_const_str_TASMOTACLIENT_RST_INV;
 extern const bcstring be_const_str_SPI_CS;
-extern const bcstring be_const_str_WEBCAM_RESET;
-extern const bcstring be_const_str_ceil;
-extern const bcstring be_const_str_clear;
-extern const bcstring be_const_str_cmd;
-extern const bcstring be_const_str_response_append;
-extern const bcstring be_const_str_lv_btn;
-extern const bcstring be_const_str_lv_draw_line_dsc;
-extern const bcstring be_const_str_gc;
-extern const bcstring be_const_str_WINDMETER_SPEED;
-extern const bcstring be_const_str_number;
-extern const bcstring be_const_str_write_bit;
-extern const bcstring be_const_str_WEBCAM_SIOC;
-extern const bcstring be_const_str_I2C_SCL;
-extern const bcstring be_const_str_XPT2046_CS;
-extern const bcstring be_const_str_lv_calendar;
-extern const bcstring be_const_str_RISING;
-extern const bcstring be_const_str_arg;
-extern const bcstring be_const_str__read;
-extern const bcstring be_const_str_rand;
-extern const bcstring be_const_str_SYMBOL_SHUFFLE;
-extern const bcstring be_const_str_DDSU666_TX;
-extern const bcstring be_const_str_web_add_button;
-extern const bcstring be_const_str_except;
-extern const bcstring be_const_str_RFRECV;
-extern const bcstring be_const_str_PZEM017_RX;
+extern const bcstring be_const_str_lv_label;
 extern const bcstring be_const_str_RA8876_CS;
-extern const bcstring be_const_str_KEY1_INV;
-extern const bcstring be_const_str___iterator__;
-extern const bcstring be_const_str_lv_draw_mask_map_param_cfg;
-extern const bcstring be_const_str_module;
+extern const bcstring be_const_str_lv_spinbox;
 extern const bcstring be_const_str_ADC_BUTTON;
-extern const bcstring be_const_str_get_tasmota;
+extern const bcstring be_const_str_SYMBOL_OK;
+extern const bcstring be_const_str__read;
+extern const bcstring be_const_str_lower;
+extern const bcstring be_const_str_lv_point;
+extern const bcstring be_const_str_pop;
+extern const bcstring be_const_str_lv_slider;
 extern const bcstring be_const_str_read24;
-extern const bcstring be_const_str_start;
-extern const bcstring be_const_str_MIEL_HVAC_TX;
-extern const bcstring be_const_str_SYMBOL_DRIVE;
-extern const bcstring be_const_str_SYMBOL_WARNING;
-extern const bcstring be_const_str_gamma8;
-extern const bcstring be_const_str_lv_draw_mask_line_param;
-extern const bcstring be_const_str_memory;
-extern const bcstring be_const_str_SPI_MOSI;
-extern const bcstring be_const_str_digital_read;
-extern const bcstring be_const_str_lv_design_cb;
-extern const bcstring be_const_str_MD5;
+extern const bcstring be_const_str_SYMBOL_BULLET;
 extern const bcstring be_const_str_get_option;
-extern const bcstring be_const_str_lv_checkbox;
+extern const bcstring be_const_str_ADC_PH;
+extern const bcstring be_const_str_WINDMETER_SPEED;
+extern const bcstring be_const_str_seti;
+extern const bcstring be_const_str_BS814_CLK;
+extern const bcstring be_const_str_try;
+extern const bcstring be_const_str_BS814_DAT;
+extern const bcstring be_const_str_MCP39F5_TX;
+extern const bcstring be_const_str_SYMBOL_UPLOAD;
+extern const bcstring be_const_str_arg_size;
+extern const bcstring be_const_str_get_free_heap;
+extern const bcstring be_const_str_sinh;
+extern const bcstring be_const_str_SYMBOL_LOOP;
+extern const bcstring be_const_str_WS2812;
+extern const bcstring be_const_str_A4988_STP;
+extern const bcstring be_const_str_lv_imgbtn;
+extern const bcstring be_const_str_ZIGBEE_RX;
+extern const bcstring be_const_str_resp_cmnd_str;
+extern const bcstring be_const_str_SYMBOL_UP;
+extern const bcstring be_const_str_WEBCAM_SIOD;
+extern const bcstring be_const_str_setrange;
+extern const bcstring be_const_str_PZEM017_RX;
+extern const bcstring be_const_str_SPI_CLK;
+extern const bcstring be_const_str_SSPI_DC;
+extern const bcstring be_const_str_ST7789_DC;
+extern const bcstring be_const_str_SYMBOL_LEFT;
+extern const bcstring be_const_str_opt_call;
+extern const bcstring be_const_str_OUTPUT_OPEN_DRAIN;
+extern const bcstring be_const_str_setbits;
+extern const bcstring be_const_str_SYMBOL_MINUS;
+extern const bcstring be_const_str_TASMOTACLIENT_RXD;
 extern const bcstring be_const_str_PMS5003_RX;
-extern const bcstring be_const_str_SYMBOL_BATTERY_2;
-extern const bcstring be_const_str_read32;
-extern const bcstring be_const_str_dump;
-extern const bcstring be_const_str_SYMBOL_EYE_CLOSE;
-extern const bcstring be_const_str_SYMBOL_IMAGE;
-extern const bcstring be_const_str_abs;
-extern const bcstring be_const_str_traceback;
-extern const bcstring be_const_str_HPMA_RX;
+extern const bcstring be_const_str_PROJECTOR_CTRL_RX;
+extern const bcstring be_const_str_RF_SENSOR;
+extern const bcstring be_const_str_geti;
+extern const bcstring be_const_str_memory;
+extern const bcstring be_const_str_CSE7766_TX;
+extern const bcstring be_const_str_HRE_CLOCK;
+extern const bcstring be_const_str_WEBCAM_DATA;
+extern const bcstring be_const_str_true;
+extern const bcstring be_const_str_reverse_gamma10;
+extern const bcstring be_const_str_write8;
+extern const bcstring be_const_str_lv_led;
+extern const bcstring be_const_str_SSPI_SCLK;
+extern const bcstring be_const_str_copy;
+extern const bcstring be_const_str_lv_draw_mask_line_param_cfg;
 extern const bcstring be_const_str_SM16716_DAT;
-extern const bcstring be_const_str_SYMBOL_PAUSE;
-extern const bcstring be_const_str_attrdump;
-extern const bcstring be_const_str_lv_draw_mask_fade_param;
+extern const bcstring be_const_str_lv_event_cb;
+extern const bcstring be_const_str_write_bit;
 extern const bcstring be_const_str_CC1101_GDO0;
-extern const bcstring be_const_str_super;
-extern const bcstring be_const_str_if;
-extern const bcstring be_const_str_TCP_RX;
-extern const bcstring be_const_str_keys;
-extern const bcstring be_const_str_lv_led;
-extern const bcstring be_const_str_time_dump;
-extern const bcstring be_const_str_HPMA_TX;
-extern const bcstring be_const_str_PN532_TXD;
-extern const bcstring be_const_str_compile;
-extern const bcstring be_const_str_TCP_TX;
+extern const bcstring be_const_str_HJL_CF;
+extern const bcstring be_const_str_SYMBOL_SHUFFLE;
+extern const bcstring be_const_str_digital_read;
 extern const bcstring be_const_str_lv_gauge_format_cb;
-extern const bcstring be_const_str_remove_rule;
-extern const bcstring be_const_str_KEY1_TC;
-extern const bcstring be_const_str_TASMOTACLIENT_RST;
-extern const bcstring be_const_str_tolower;
-extern const bcstring be_const_str_type;
-extern const bcstring be_const_str_lv_cont;
-extern const bcstring be_const_str_every_100ms;
-extern const bcstring be_const_str_lv_list;
-extern const bcstring be_const_str_CSE7766_TX;
-extern const bcstring be_const_str__available;
-extern const bcstring be_const_str_display;
-extern const bcstring be_const_str_sin;
-extern const bcstring be_const_str_SM2135_DAT;
-extern const bcstring be_const_str_WEBCAM_SIOD;
-extern const bcstring be_const_str_publish;
-extern const bcstring be_const_str_input;
-extern const bcstring be_const_str_map;
+extern const bcstring be_const_str_read32;
+extern const bcstring be_const_str_P9813_CLK;
+extern const bcstring be_const_str_SYMBOL_REFRESH;
+extern const bcstring be_const_str_char;
 extern const bcstring be_const_str_IRRECV;
 extern const bcstring be_const_str_SSD1351_CS;
-extern const bcstring be_const_str_SYMBOL_PLAY;
-extern const bcstring be_const_str_MGC3130_RESET;
-extern const bcstring be_const_str_SYMBOL_SAVE;
-extern const bcstring be_const_str_lv_draw_mask_radius_param_cfg;
-extern const bcstring be_const_str_resp_cmnd_failed;
-extern const bcstring be_const_str_ADC_RANGE;
-extern const bcstring be_const_str_PZEM0XX_TX;
-extern const bcstring be_const_str_SYMBOL_USB;
-extern const bcstring be_const_str_int;
-extern const bcstring be_const_str_time_str;
-extern const bcstring be_const_str_LEDLNK_INV;
-extern const bcstring be_const_str_VL53L0X_XSHUT1;
-extern const bcstring be_const_str_set_power;
-extern const bcstring be_const_str__end_transmission;
-extern const bcstring be_const_str_get;
-extern const bcstring be_const_str_SPI_MISO;
-extern const bcstring be_const_str_print;
-extern const bcstring be_const_str_format;
-extern const bcstring be_const_str_MAX7219DIN;
-extern const bcstring be_const_str_lv_img;
-extern const bcstring be_const_str_HM10_RX;
-extern const bcstring be_const_str_allocated;
-extern const bcstring be_const_str_while;
-extern const bcstring be_const_str_getbits;
-extern const bcstring be_const_str_lv_spinner;
-extern const bcstring be_const_str_pow;
-extern const bcstring be_const_str_A4988_MS1;
-extern const bcstring be_const_str_SYMBOL_KEYBOARD;
-extern const bcstring be_const_str_lv_slider;
-extern const bcstring be_const_str_read13;
-extern const bcstring be_const_str_NRF24_CS;
-extern const bcstring be_const_str_PWM1;
 extern const bcstring be_const_str_SWT1;
-extern const bcstring be_const_str_SSD1331_DC;
-extern const bcstring be_const_str_PMS5003_TX;
-extern const bcstring be_const_str_TM1638DIO;
-extern const bcstring be_const_str__cmd;
-extern const bcstring be_const_str_asin;
-extern const bcstring be_const_str_read12;
-extern const bcstring be_const_str_state;
-extern const bcstring be_const_str_exec_cmd;
-extern const bcstring be_const_str_HLW_CF;
-extern const bcstring be_const_str_SYMBOL_DIRECTORY;
-extern const bcstring be_const_str_SYMBOL_PASTE;
-extern const bcstring be_const_str_resolvecmnd;
-extern const bcstring be_const_str_ST7789_CS;
-extern const bcstring be_const_str_SYMBOL_BATTERY_FULL;
-extern const bcstring be_const_str_log10;
-extern const bcstring be_const_str_TXD;
-extern const bcstring be_const_str_SYMBOL_EYE_OPEN;
-extern const bcstring be_const_str__buffer;
-extern const bcstring be_const_str_EXS_ENABLE;
-extern const bcstring be_const_str_HJL_CF;
-extern const bcstring be_const_str_lv_draw_mask_fade_param_cfg;
-extern const bcstring be_const_str_PROJECTOR_CTRL_RX;
-extern const bcstring be_const_str_SBR_TX;
-extern const bcstring be_const_str_sqrt;
-extern const bcstring be_const_str_MAX31855DO;
-extern const bcstring be_const_str_SYMBOL_DOWN;
-extern const bcstring be_const_str_save_before_restart;
-extern const bcstring be_const_str_write8;
-extern const bcstring be_const_str_byte;
-extern const bcstring be_const_str_write;
-extern const bcstring be_const_str_GPS_TX;
-extern const bcstring be_const_str_ELECTRIQ_MOODL_TX;
-extern const bcstring be_const_str_SYMBOL_BATTERY_1;
-extern const bcstring be_const_str_WE517_RX;
-extern const bcstring be_const_str_digital_write;
-extern const bcstring be_const_str_lv_spinbox;
-extern const bcstring be_const_str_lv_switch;
-extern const bcstring be_const_str_pin;
-extern const bcstring be_const_str_pin_used;
-extern const bcstring be_const_str_SAIR_RX;
-extern const bcstring be_const_str_SI7021;
-extern const bcstring be_const_str_WE517_TX;
-extern const bcstring be_const_str_lv_obj;
-extern const bcstring be_const_str_SSPI_MAX31865_CS1;
-extern const bcstring be_const_str_DHT22;
-extern const bcstring be_const_str_arg_size;
-extern const bcstring be_const_str_millis;
-extern const bcstring be_const_str_remove;
-extern const bcstring be_const_str_deinit;
-extern const bcstring be_const_str_wire2;
-extern const bcstring be_const_str_SYMBOL_FILE;
-extern const bcstring be_const_str_lv_canvas;
-extern const bcstring be_const_str_ROT1A_NP;
-extern const bcstring be_const_str_WEBCAM_DATA;
-extern const bcstring be_const_str_IEM3000_RX;
-extern const bcstring be_const_str_NEOPOOL_RX;
-extern const bcstring be_const_str_OUTPUT;
-extern const bcstring be_const_str_lv_msgbox;
-extern const bcstring be_const_str_has_arg;
-extern const bcstring be_const_str_lv_table;
-extern const bcstring be_const_str_SSPI_MOSI;
-extern const bcstring be_const_str_CSE7761_TX;
-extern const bcstring be_const_str_P9813_DAT;
-extern const bcstring be_const_str_WEBCAM_PWDN;
-extern const bcstring be_const_str_count;
-extern const bcstring be_const_str_LMT01;
-extern const bcstring be_const_str_read8;
-extern const bcstring be_const_str_PN532_RXD;
-extern const bcstring be_const_str_PZEM004_RX;
-extern const bcstring be_const_str__begin_transmission;
-extern const bcstring be_const_str_web_add_console_button;
+extern const bcstring be_const_str_classof;
+extern const bcstring be_const_str_lv_draw_label_dsc;
+extern const bcstring be_const_str_pi;
 extern const bcstring be_const_str_web_add_handler;
-extern const bcstring be_const_str_INPUT_PULLDOWN;
-extern const bcstring be_const_str_CSE7761_RX;
-extern const bcstring be_const_str_find;
-extern const bcstring be_const_str_break;
+extern const bcstring be_const_str_module;
+extern const bcstring be_const_str_ROT1B_NP;
+extern const bcstring be_const_str_SYMBOL_WARNING;
+extern const bcstring be_const_str_SYMBOL_VOLUME_MID;
+extern const bcstring be_const_str_TM1637CLK;
+extern const bcstring be_const_str_read8;
+extern const bcstring be_const_str_lv_win;
+extern const bcstring be_const_str_AZ_RXD;
 extern const bcstring be_const_str_NRG_SEL_INV;
+extern const bcstring be_const_str_SYMBOL_FILE;
+extern const bcstring be_const_str___lower__;
+extern const bcstring be_const_str__end_transmission;
+extern const bcstring be_const_str_gamma8;
+extern const bcstring be_const_str_hex;
+extern const bcstring be_const_str_PULLUP;
+extern const bcstring be_const_str_SYMBOL_PASTE;
+extern const bcstring be_const_str_content_stop;
+extern const bcstring be_const_str_SM2135_DAT;
+extern const bcstring be_const_str_SYMBOL_EYE_CLOSE;
+extern const bcstring be_const_str_SYMBOL_USB;
+extern const bcstring be_const_str_lv_canvas;
 extern const bcstring be_const_str_ILI9488_CS;
-extern const bcstring be_const_str_MCP39F5_RX;
-extern const bcstring be_const_str_ROT1B;
-extern const bcstring be_const_str_opt_call;
-extern const bcstring be_const_str_SOLAXX1_TX;
+extern const bcstring be_const_str_SYMBOL_VIDEO;
+extern const bcstring be_const_str_count;
+extern const bcstring be_const_str_imin;
+extern const bcstring be_const_str_json_append;
 extern const bcstring be_const_str_SHELLY_DIMMER_BOOT0;
-extern const bcstring be_const_str_WEBCAM_VSYNC;
-extern const bcstring be_const_str_tan;
-extern const bcstring be_const_str_web_send;
-extern const bcstring be_const_str_LED1;
-extern const bcstring be_const_str_INPUT_PULLUP;
-extern const bcstring be_const_str_chars_in_string;
-extern const bcstring be_const_str_else;
-extern const bcstring be_const_str_nil;
-extern const bcstring be_const_str_MAX31855CLK;
-extern const bcstring be_const_str_SYMBOL_GPS;
-extern const bcstring be_const_str_lv_draw_mask_map_param;
-extern const bcstring be_const_str_SWT1_NP;
-extern const bcstring be_const_str_log;
-extern const bcstring be_const_str_read_bytes;
-extern const bcstring be_const_str_dot_def;
-extern const bcstring be_const_str_SYMBOL_CALL;
-extern const bcstring be_const_str_DHT11;
-extern const bcstring be_const_str_NRG_CF1;
-extern const bcstring be_const_str_SYMBOL_MUTE;
-extern const bcstring be_const_str_ETH_PHY_POWER;
-extern const bcstring be_const_str_TFMINIPLUS_TX;
+extern const bcstring be_const_str_TM1638CLK;
+extern const bcstring be_const_str_content_button;
+extern const bcstring be_const_str_upper;
+extern const bcstring be_const_str_CNTR1_NP;
+extern const bcstring be_const_str_MAX31855DO;
+extern const bcstring be_const_str_Tasmota;
+extern const bcstring be_const_str_web_add_button;
+extern const bcstring be_const_str_KEY1_TC;
+extern const bcstring be_const_str_SYMBOL_KEYBOARD;
+extern const bcstring be_const_str_state;
+extern const bcstring be_const_str_deg;
+extern const bcstring be_const_str_keys;
+extern const bcstring be_const_str_SR04_TRIG;
+extern const bcstring be_const_str_TASMOTACLIENT_RST;
 extern const bcstring be_const_str_EPAPER29_CS;
-extern const bcstring be_const_str_lv_chart;
-extern const bcstring be_const_str_name;
-extern const bcstring be_const_str_event;
-extern const bcstring be_const_str_ADC_JOY;
-extern const bcstring be_const_str_FALLING;
-extern const bcstring be_const_str_remove_cmd;
-extern const bcstring be_const_str_CSE7766_RX;
+extern const bcstring be_const_str_lv_draw_mask_map_param;
+extern const bcstring be_const_str_lv_line;
 extern const bcstring be_const_str_DYP_RX;
+extern const bcstring be_const_str_SDM72_RX;
+extern const bcstring be_const_str_SYMBOL_HOME;
+extern const bcstring be_const_str_TUYA_TX;
+extern const bcstring be_const_str_RC522_CS;
+extern const bcstring be_const_str_lv_draw_mask_fade_param_cfg;
+extern const bcstring be_const_str_ADC_INPUT;
+extern const bcstring be_const_str_check_privileged_access;
 extern const bcstring be_const_str_LEDLNK;
-extern const bcstring be_const_str_IRSEND;
-extern const bcstring be_const_str_lv_textarea;
+extern const bcstring be_const_str_MGC3130_XFER;
 extern const bcstring be_const_str_RFSEND;
-extern const bcstring be_const_str_SSD1351_DC;
-extern const bcstring be_const_str_SYMBOL_COPY;
-extern const bcstring be_const_str_SYMBOL_UP;
-extern const bcstring be_const_str_TX2X_TXD_BLACK;
-extern const bcstring be_const_str_json_append;
-extern const bcstring be_const_str_TUYA_RX;
-extern const bcstring be_const_str_HRE_DATA;
-extern const bcstring be_const_str_DDSU666_RX;
-extern const bcstring be_const_str_reverse_gamma10;
-extern const bcstring be_const_str_SM16716_SEL;
-extern const bcstring be_const_str_TASMOTACLIENT_RST_INV;
-extern const bcstring be_const_str_add_rule;
-extern const bcstring be_const_str_resize;
-extern const bcstring be_const_str_resp_cmnd_error;
-extern const bcstring be_const_str_ADC_BUTTON_INV;
-extern const bcstring be_const_str_TASMOTACLIENT_TXD;
-extern const bcstring be_const_str_MP3_DFR562;
-extern const bcstring be_const_str_RC522_RST;
-extern const bcstring be_const_str_SYMBOL_LEFT;
-extern const bcstring be_const_str_rad;
-extern const bcstring be_const_str_ARIRFSEL;
-extern const bcstring be_const_str_MHZ_TXD;
-extern const bcstring be_const_str_SAIR_TX;
-extern const bcstring be_const_str_sinh;
-extern const bcstring be_const_str_lv_group_focus_cb;
-extern const bcstring be_const_str_SENSOR_END;
-extern const bcstring be_const_str_assert;
-extern const bcstring be_const_str_reverse;
-extern const bcstring be_const_str_codedump;
-extern const bcstring be_const_str_CNTR1;
-extern const bcstring be_const_str_lv_draw_mask_saved;
-extern const bcstring be_const_str_read;
-extern const bcstring be_const_str_DDS2382_TX;
-extern const bcstring be_const_str_ROT1B_NP;
-extern const bcstring be_const_str_SSPI_MISO;
-extern const bcstring be_const_str___upper__;
-extern const bcstring be_const_str_pop;
-extern const bcstring be_const_str_SDCARD_CS;
-extern const bcstring be_const_str__write;
-extern const bcstring be_const_str_lv_draw_mask_line_param_cfg;
-extern const bcstring be_const_str_setmember;
-extern const bcstring be_const_str_I2C_Driver;
-extern const bcstring be_const_str_addr;
-extern const bcstring be_const_str_find_key_i;
-extern const bcstring be_const_str_BOILER_OT_TX;
-extern const bcstring be_const_str_P9813_CLK;
 extern const bcstring be_const_str_lv_area;
-extern const bcstring be_const_str_split;
-extern const bcstring be_const_str_CHANGE;
-extern const bcstring be_const_str_SM2135_CLK;
-extern const bcstring be_const_str_ZEROCROSS;
-extern const bcstring be_const_str_i2c_enabled;
-extern const bcstring be_const_str_lv_color;
-extern const bcstring be_const_str_wire1;
-extern const bcstring be_const_str_lv_draw_rect_dsc;
-extern const bcstring be_const_str_seti;
-extern const bcstring be_const_str_ST7789_DC;
-extern const bcstring be_const_str_var;
-extern const bcstring be_const_str_MCP39F5_TX;
-extern const bcstring be_const_str__ccmd;
-extern const bcstring be_const_str_AS608_TX;
-extern const bcstring be_const_str_TM1638CLK;
-extern const bcstring be_const_str_get_free_heap;
-extern const bcstring be_const_str_lv_keyboard;
-extern const bcstring be_const_str_elif;
-extern const bcstring be_const_str_KEY1;
-extern const bcstring be_const_str_LE01MR_TX;
+extern const bcstring be_const_str_response_append;
+extern const bcstring be_const_str_pin_used;
 extern const bcstring be_const_str_lv_tileview;
-extern const bcstring be_const_str_class;
-extern const bcstring be_const_str_BUZZER_INV;
-extern const bcstring be_const_str_lv_roller;
-extern const bcstring be_const_str_ADC_CT_POWER;
-extern const bcstring be_const_str_asstring;
-extern const bcstring be_const_str_lv_draw_mask_angle_param_cfg;
-extern const bcstring be_const_str_save;
-extern const bcstring be_const_str_size;
-extern const bcstring be_const_str_NONE;
-extern const bcstring be_const_str_exp;
-extern const bcstring be_const_str_on;
-extern const bcstring be_const_str_BL0940_RX;
-extern const bcstring be_const_str_WIEGAND_D0;
-extern const bcstring be_const_str_check_privileged_access;
-extern const bcstring be_const_str_lv_indev;
-extern const bcstring be_const_str_opt_eq;
-extern const bcstring be_const_str_TFMINIPLUS_RX;
-extern const bcstring be_const_str_PULLDOWN;
-extern const bcstring be_const_str_;
-extern const bcstring be_const_str_arg_name;
-extern const bcstring be_const_str_screenshot;
-extern const bcstring be_const_str_setbits;
-extern const bcstring be_const_str_SYMBOL_LOOP;
-extern const bcstring be_const_str_MHZ_RXD;
+extern const bcstring be_const_str_WEBCAM_HREF;
+extern const bcstring be_const_str_fromstring;
+extern const bcstring be_const_str_DSB_OUT;
+extern const bcstring be_const_str_IEM3000_RX;
 extern const bcstring be_const_str_get_power;
-extern const bcstring be_const_str_lv_font;
-extern const bcstring be_const_str_BACKLIGHT;
-extern const bcstring be_const_str_BS814_CLK;
-extern const bcstring be_const_str_PULLUP;
-extern const bcstring be_const_str_TM1637DIO;
-extern const bcstring be_const_str_lv_btnmatrix;
+extern const bcstring be_const_str_get_tasmota;
+extern const bcstring be_const_str_getbits;
+extern const bcstring be_const_str_detect;
+extern const bcstring be_const_str_lv_draw_mask_angle_param;
 extern const bcstring be_const_str_SR04_ECHO;
-extern const bcstring be_const_str_ADE7953_IRQ;
+extern const bcstring be_const_str_deinit;
+extern const bcstring be_const_str_name;
+extern const bcstring be_const_str_SAIR_RX;
+extern const bcstring be_const_str_lv_cb;
+extern const bcstring be_const_str_lv_linemeter;
+extern const bcstring be_const_str_every_100ms;
+extern const bcstring be_const_str_stats;
+extern const bcstring be_const_str_TFMINIPLUS_RX;
+extern const bcstring be_const_str__drivers;
+extern const bcstring be_const_str__write;
+extern const bcstring be_const_str_abs;
+extern const bcstring be_const_str_KEY1_INV_NP;
+extern const bcstring be_const_str_display;
+extern const bcstring be_const_str_OUTPUT_LO;
+extern const bcstring be_const_str_lv_draw_mask_common_dsc;
+extern const bcstring be_const_str_AZ_TXD;
+extern const bcstring be_const_str_lv_keyboard;
+extern const bcstring be_const_str_SYMBOL_PLAY;
+extern const bcstring be_const_str_for;
+extern const bcstring be_const_str_SYMBOL_BATTERY_3;
+extern const bcstring be_const_str_bus;
+extern const bcstring be_const_str_lv_gauge;
+extern const bcstring be_const_str_map;
+extern const bcstring be_const_str_SYMBOL_PLUS;
+extern const bcstring be_const_str_KEY1_INV;
+extern const bcstring be_const_str_gamma10;
+extern const bcstring be_const_str_type;
+extern const bcstring be_const_str_MIEL_HVAC_TX;
+extern const bcstring be_const_str_NRF24_CS;
+extern const bcstring be_const_str_lv_textarea;
+extern const bcstring be_const_str_CNTR1;
+extern const bcstring be_const_str_SYMBOL_BATTERY_FULL;
+extern const bcstring be_const_str_content_flush;
+extern const bcstring be_const_str_lv_objmask;
+extern const bcstring be_const_str_TX2X_TXD_BLACK;
+extern const bcstring be_const_str_WEBCAM_VSYNC;
+extern const bcstring be_const_str__timers;
+extern const bcstring be_const_str_button_pressed;
+extern const bcstring be_const_str_else;
+extern const bcstring be_const_str_LMT01;
+extern const bcstring be_const_str_WEBCAM_SIOC;
+extern const bcstring be_const_str_lv_page;
+extern const bcstring be_const_str_lv_btn;
+extern const bcstring be_const_str_rad;
+extern const bcstring be_const_str_iter;
+extern const bcstring be_const_str_lv_draw_mask_saved;
+extern const bcstring be_const_str_lv_group;
+extern const bcstring be_const_str_lv_style;
+extern const bcstring be_const_str_;
+extern const bcstring be_const_str__events;
+extern const bcstring be_const_str_log;
+extern const bcstring be_const_str_real;
+extern const bcstring be_const_str_OUTPUT_HI;
+extern const bcstring be_const_str_SYMBOL_BLUETOOTH;
+extern const bcstring be_const_str__cmd;
+extern const bcstring be_const_str_web_add_console_button;
+extern const bcstring be_const_str___iterator__;
+extern const bcstring be_const_str_DSB;
+extern const bcstring be_const_str_size;
+extern const bcstring be_const_str_DEEPSLEEP;
+extern const bcstring be_const_str_PULLDOWN;
+extern const bcstring be_const_str_codedump;
+extern const bcstring be_const_str_MCP39F5_RX;
+extern const bcstring be_const_str_add_cron;
+extern const bcstring be_const_str_ETH_PHY_MDIO;
+extern const bcstring be_const_str_RDM6300_RX;
 extern const bcstring be_const_str_classname;
-extern const bcstring be_const_str_str;
-extern const bcstring be_const_str_SYMBOL_PREV;
-extern const bcstring be_const_str_add_driver;
-extern const bcstring be_const_str_content_button;
+extern const bcstring be_const_str_SDM630_RX;
+extern const bcstring be_const_str_WE517_RX;
+extern const bcstring be_const_str_digital_write;
+extern const bcstring be_const_str_TASMOTACLIENT_TXD;
+extern const bcstring be_const_str_end;
+extern const bcstring be_const_str_ZIGBEE_RST;
+extern const bcstring be_const_str__available;
+extern const bcstring be_const_str_SYMBOL_MUTE;
+extern const bcstring be_const_str___upper__;
+extern const bcstring be_const_str_resp_cmnd_error;
+extern const bcstring be_const_str_lv_arc;
+extern const bcstring be_const_str_scale_uint;
+extern const bcstring be_const_str_SYMBOL_SAVE;
+extern const bcstring be_const_str_WEBCAM_XCLK;
+extern const bcstring be_const_str_WEBCAM_PSCLK;
+extern const bcstring be_const_str_resp_cmnd;
+extern const bcstring be_const_str_REL1;
+extern const bcstring be_const_str_push;
+extern const bcstring be_const_str_GPS_TX;
+extern const bcstring be_const_str_HPMA_RX;
+extern const bcstring be_const_str_number;
+extern const bcstring be_const_str_CSE7766_RX;
+extern const bcstring be_const_str_SYMBOL_DIRECTORY;
 extern const bcstring be_const_str_HX711_DAT;
-extern const bcstring be_const_str_dot_p;
-extern const bcstring be_const_str_content_stop;
-extern const bcstring be_const_str_GPS_RX;
-extern const bcstring be_const_str_HX711_SCK;
-extern const bcstring be_const_str_RDM6300_RX;
-extern const bcstring be_const_str_AZ_RXD;
-extern const bcstring be_const_str_Tasmota;
-extern const bcstring be_const_str_ZIGBEE_RX;
-extern const bcstring be_const_str_imax;
+extern const bcstring be_const_str_WEBCAM_RESET;
+extern const bcstring be_const_str_WIEGAND_D1;
+extern const bcstring be_const_str_ceil;
+extern const bcstring be_const_str_SM2135_CLK;
+extern const bcstring be_const_str_TM1637DIO;
+extern const bcstring be_const_str_floor;
+extern const bcstring be_const_str_chars_in_string;
+extern const bcstring be_const_str_lv_design_cb;
+extern const bcstring be_const_str_SDS0X1_TX;
+extern const bcstring be_const_str_SSD1351_DC;
+extern const bcstring be_const_str_cos;
+extern const bcstring be_const_str_get;
+extern const bcstring be_const_str_KEY1_NP;
+extern const bcstring be_const_str__cb;
+extern const bcstring be_const_str_lv_draw_mask_map_param_cfg;
+extern const bcstring be_const_str_dot_def;
+extern const bcstring be_const_str_SYMBOL_TRASH;
+extern const bcstring be_const_str_has_arg;
+extern const bcstring be_const_str_web_send;
+extern const bcstring be_const_str_TUYA_RX;
+extern const bcstring be_const_str_lv_btnmatrix;
+extern const bcstring be_const_str_DCKI;
+extern const bcstring be_const_str_SYMBOL_DOWN;
+extern const bcstring be_const_str_asin;
+extern const bcstring be_const_str_pin_mode;
+extern const bcstring be_const_str_lv_cpicker;
+extern const bcstring be_const_str_reverse;
+extern const bcstring be_const_str_find;
+extern const bcstring be_const_str_EXS_ENABLE;
+extern const bcstring be_const_str_step;
+extern const bcstring be_const_str_NEOPOOL_RX;
+extern const bcstring be_const_str_clear;
 extern const bcstring be_const_str_montserrat_font;
-extern const bcstring be_const_str_srand;
-extern const bcstring be_const_str_time_reached;
-extern const bcstring be_const_str_try_rule;
-extern const bcstring be_const_str_LOW;
-extern const bcstring be_const_str_SDM120_TX;
-extern const bcstring be_const_str_SYMBOL_BELL;
-extern const bcstring be_const_str_tostring;
-extern const bcstring be_const_str_DDS2382_RX;
-extern const bcstring be_const_str_HRXL_RX;
-extern const bcstring be_const_str_button_pressed;
-extern const bcstring be_const_str_lv_arc;
-extern const bcstring be_const_str_SDM120_RX;
-extern const bcstring be_const_str_SYMBOL_POWER;
-extern const bcstring be_const_str_list;
-extern const bcstring be_const_str_lv_bar;
-extern const bcstring be_const_str_lv_linemeter;
-extern const bcstring be_const_str_lv_page;
-extern const bcstring be_const_str_upper;
-extern const bcstring be_const_str_wire_scan;
-extern const bcstring be_const_str_SBR_RX;
-extern const bcstring be_const_str_gamma10;
+extern const bcstring be_const_str_KEY1;
+extern const bcstring be_const_str_rtc;
+extern const bcstring be_const_str_toupper;
+extern const bcstring be_const_str_WE517_TX;
+extern const bcstring be_const_str_SSD1331_CS;
+extern const bcstring be_const_str_LE01MR_RX;
+extern const bcstring be_const_str_opt_add;
+extern const bcstring be_const_str_IEM3000_TX;
 extern const bcstring be_const_str_PWM1_INV;
-extern const bcstring be_const_str_exec_rules;
+extern const bcstring be_const_str_add;
 extern const bcstring be_const_str_ETH_PHY_MDC;
+extern const bcstring be_const_str_ILI9341_CS;
+extern const bcstring be_const_str_INPUT_PULLDOWN;
+extern const bcstring be_const_str_SYMBOL_IMAGE;
+extern const bcstring be_const_str_format;
+extern const bcstring be_const_str_lv_cont;
+extern const bcstring be_const_str_save;
+extern const bcstring be_const_str_RC522_RST;
+extern const bcstring be_const_str_HPMA_TX;
+extern const bcstring be_const_str_SYMBOL_SD_CARD;
+extern const bcstring be_const_str_WEBCAM_HSD;
+extern const bcstring be_const_str_NRG_SEL;
+extern const bcstring be_const_str_insert;
+extern const bcstring be_const_str_scan;
+extern const bcstring be_const_str_setitem;
+extern const bcstring be_const_str_super;
+extern const bcstring be_const_str_time_dump;
+extern const bcstring be_const_str_dot_p;
+extern const bcstring be_const_str_ADC_CT_POWER;
+extern const bcstring be_const_str_NONE;
+extern const bcstring be_const_str_resize;
+extern const bcstring be_const_str_wire1;
+extern const bcstring be_const_str_nil;
+extern const bcstring be_const_str_add_driver;
+extern const bcstring be_const_str_HM10_RX;
+extern const bcstring be_const_str_SM16716_CLK;
+extern const bcstring be_const_str_byte;
+extern const bcstring be_const_str_pow;
+extern const bcstring be_const_str_SPI_MOSI;
+extern const bcstring be_const_str_OLED_RESET;
+extern const bcstring be_const_str_SSPI_CS;
+extern const bcstring be_const_str_SYMBOL_CALL;
+extern const bcstring be_const_str_lv_msgbox;
+extern const bcstring be_const_str_SYMBOL_POWER;
 extern const bcstring be_const_str_content_send_style;
+extern const bcstring be_const_str_I2C_Driver;
+extern const bcstring be_const_str_addr;
+extern const bcstring be_const_str_SWT1_NP;
+extern const bcstring be_const_str_atan;
+extern const bcstring be_const_str_lv_bar;
+extern const bcstring be_const_str_read;
+extern const bcstring be_const_str_ADC_TEMP;
+extern const bcstring be_const_str_SPI_DC;
+extern const bcstring be_const_str_gc;
+extern const bcstring be_const_str_lv_spinner;
+extern const bcstring be_const_str_setmember;
+extern const bcstring be_const_str_MCP39F5_RST;
+extern const bcstring be_const_str_exec_rules;
+extern const bcstring be_const_str_load_freetype_font;
+extern const bcstring be_const_str_web_sensor;
+extern const bcstring be_const_str_NEOPOOL_TX;
+extern const bcstring be_const_str_attrdump;
+extern const bcstring be_const_str_opt_connect;
+extern const bcstring be_const_str_find_key_i;
+extern const bcstring be_const_str_var;
+extern const bcstring be_const_str__bec_valid;
+extern const bcstring be_const_str_save_before_restart;
+extern const bcstring be_const_str_DHT11;
+extern const bcstring be_const_str_import;
+extern const bcstring be_const_str_opt_neq;
+extern const bcstring be_const_str_PN532_RXD;
+extern const bcstring be_const_str_SYMBOL_EDIT;
+extern const bcstring be_const_str_str;
+extern const bcstring be_const_str_incremental;
+extern const bcstring be_const_str_millis;
+extern const bcstring be_const_str_PZEM0XX_TX;
+extern const bcstring be_const_str_web_add_main_button;
+extern const bcstring be_const_str_if;
+extern const bcstring be_const_str_IBEACON_RX;
+extern const bcstring be_const_str_LOW;
+extern const bcstring be_const_str_PZEM016_RX;
+extern const bcstring be_const_str_arg_name;
+extern const bcstring be_const_str_collect;
+extern const bcstring be_const_str_web_add_config_button;
 extern const bcstring be_const_str_run_deferred;
-extern const bcstring be_const_str_SYMBOL_REFRESH;
-extern const bcstring be_const_str_TASMOTACLIENT_RXD;
-extern const bcstring be_const_str_WS2812;
-extern const bcstring be_const_str_PROJECTOR_CTRL_TX;
-extern const bcstring be_const_str_lv_line;
-extern const bcstring be_const_str_SYMBOL_VOLUME_MAX;
+extern const bcstring be_const_str_MAX31855CLK;
+extern const bcstring be_const_str_TFMINIPLUS_TX;
+extern const bcstring be_const_str_I2C_SCL;
 extern const bcstring be_const_str_MAX7219CLK;
-extern const bcstring be_const_str_RF_SENSOR;
-extern const bcstring be_const_str_WEBCAM_PCLK;
-extern const bcstring be_const_str_lv_imgbtn;
-extern const bcstring be_const_str_try;
-extern const bcstring be_const_str_EPD_DATA;
-extern const bcstring be_const_str_cb_dispatch;
-extern const bcstring be_const_str_ADC_PH;
+extern const bcstring be_const_str_lv_list;
+extern const bcstring be_const_str_add_cmd;
+extern const bcstring be_const_str_issubclass;
+extern const bcstring be_const_str_sqrt;
+extern const bcstring be_const_str_pin;
+extern const bcstring be_const_str_DDS2382_RX;
+extern const bcstring be_const_str_HM10_TX;
+extern const bcstring be_const_str_tanh;
+extern const bcstring be_const_str_SYMBOL_BATTERY_1;
+extern const bcstring be_const_str_SYMBOL_PREV;
+extern const bcstring be_const_str_time_reached;
+extern const bcstring be_const_str_lv_indev;
+extern const bcstring be_const_str_SYMBOL_SETTINGS;
+extern const bcstring be_const_str_INPUT;
+extern const bcstring be_const_str_open;
+extern const bcstring be_const_str_MIEL_HVAC_RX;
+extern const bcstring be_const_str_RXD;
+extern const bcstring be_const_str_rand;
+extern const bcstring be_const_str_RFRECV;
+extern const bcstring be_const_str_SYMBOL_BACKSPACE;
+extern const bcstring be_const_str_XPT2046_CS;
+extern const bcstring be_const_str_except;
+extern const bcstring be_const_str_MAX7219CS;
+extern const bcstring be_const_str_on;
+extern const bcstring be_const_str_SDM630_TX;
+extern const bcstring be_const_str_SYMBOL_NEW_LINE;
+extern const bcstring be_const_str_HLW_CF;
+extern const bcstring be_const_str_MHZ_RXD;
+extern const bcstring be_const_str_return;
+extern const bcstring be_const_str_lv_draw_rect_dsc;
+extern const bcstring be_const_str_false;
+extern const bcstring be_const_str_cmd;
+extern const bcstring be_const_str_lv_obj;
+extern const bcstring be_const_str_traceback;
+extern const bcstring be_const_str_OPTION_A;
+extern const bcstring be_const_str_split;
+extern const bcstring be_const_str_CSE7761_TX;
+extern const bcstring be_const_str_LE01MR_TX;
+extern const bcstring be_const_str_pool;
+extern const bcstring be_const_str_ETH_PHY_POWER;
+extern const bcstring be_const_str_publish;
+extern const bcstring be_const_str__rules;
+extern const bcstring be_const_str_ROT1A;
+extern const bcstring be_const_str_MD5;
+extern const bcstring be_const_str_compile;
+extern const bcstring be_const_str_TXD;
+extern const bcstring be_const_str_seg7_font;
+extern const bcstring be_const_str_register_button_encoder;
+extern const bcstring be_const_str_CHANGE;
+extern const bcstring be_const_str_EPAPER42_CS;
+extern const bcstring be_const_str_REL1_INV;
+extern const bcstring be_const_str_member;
+extern const bcstring be_const_str_write_bytes;
+extern const bcstring be_const_str_ARIRFSEL;
+extern const bcstring be_const_str_FALLING;
+extern const bcstring be_const_str_PMS5003_TX;
+extern const bcstring be_const_str_TM1638DIO;
+extern const bcstring be_const_str_delay;
+extern const bcstring be_const_str_lv_calendar;
+extern const bcstring be_const_str_SDM120_TX;
+extern const bcstring be_const_str_SDS0X1_RX;
+extern const bcstring be_const_str_init;
+extern const bcstring be_const_str_SYMBOL_CLOSE;
+extern const bcstring be_const_str_web_add_management_button;
+extern const bcstring be_const_str_LED1_INV;
+extern const bcstring be_const_str_BOILER_OT_RX;
+extern const bcstring be_const_str_content_start;
+extern const bcstring be_const_str_erase;
+extern const bcstring be_const_str_input;
+extern const bcstring be_const_str_SPI_MISO;
+extern const bcstring be_const_str_SYMBOL_LIST;
+extern const bcstring be_const_str_imax;
+extern const bcstring be_const_str_A4988_MS1;
+extern const bcstring be_const_str_start;
+extern const bcstring be_const_str_SYMBOL_DRIVE;
+extern const bcstring be_const_str_remove_cmd;
+extern const bcstring be_const_str_ROT1B;
 extern const bcstring be_const_str_DHT11_OUT;
+extern const bcstring be_const_str_DI;
+extern const bcstring be_const_str_INPUT_PULLUP;
+extern const bcstring be_const_str_lv_chart;
+extern const bcstring be_const_str_LED1;
+extern const bcstring be_const_str_every_second;
+extern const bcstring be_const_str_list;
+extern const bcstring be_const_str_BACKLIGHT;
+extern const bcstring be_const_str_HRXL_RX;
+extern const bcstring be_const_str_SYMBOL_CHARGE;
+extern const bcstring be_const_str_SYMBOL_EJECT;
+extern const bcstring be_const_str_CSE7761_RX;
+extern const bcstring be_const_str__buffer;
+extern const bcstring be_const_str_isinstance;
+extern const bcstring be_const_str_MAX7219DIN;
+extern const bcstring be_const_str_WIEGAND_D0;
+extern const bcstring be_const_str_continue;
+extern const bcstring be_const_str_TCP_RX;
+extern const bcstring be_const_str_call;
+extern const bcstring be_const_str_i2c_enabled;
+extern const bcstring be_const_str_int;
+extern const bcstring be_const_str_VL53L0X_XSHUT1;
+extern const bcstring be_const_str__ccmd;
+extern const bcstring be_const_str_SSPI_MAX31865_CS1;
+extern const bcstring be_const_str_counters;
+extern const bcstring be_const_str_update;
+extern const bcstring be_const_str_web_send_decimal;
+extern const bcstring be_const_str_BUZZER_INV;
+extern const bcstring be_const_str_SYMBOL_NEXT;
+extern const bcstring be_const_str_acos;
+extern const bcstring be_const_str_resp_cmnd_done;
+extern const bcstring be_const_str_TELEINFO_RX;
+extern const bcstring be_const_str_lv_draw_line_dsc;
+extern const bcstring be_const_str_lv_tabview;
+extern const bcstring be_const_str_MP3_DFR562;
+extern const bcstring be_const_str_SENSOR_END;
+extern const bcstring be_const_str_elif;
+extern const bcstring be_const_str_as;
+extern const bcstring be_const_str_read12;
+extern const bcstring be_const_str_BUZZER;
+extern const bcstring be_const_str_SBR_RX;
+extern const bcstring be_const_str_SYMBOL_STOP;
+extern const bcstring be_const_str_MHZ_TXD;
+extern const bcstring be_const_str_SDM120_RX;
+extern const bcstring be_const_str_ctypes_bytes;
+extern const bcstring be_const_str_lv_font;
+extern const bcstring be_const_str_set_power;
+extern const bcstring be_const_str_HX711_SCK;
+extern const bcstring be_const_str_WEBCAM_PSRCS;
+extern const bcstring be_const_str_WEBCAM_PWDN;
+extern const bcstring be_const_str_lv_draw_mask_line_param;
+extern const bcstring be_const_str_remove_timer;
+extern const bcstring be_const_str_DDSU666_RX;
+extern const bcstring be_const_str__begin_transmission;
+extern const bcstring be_const_str_get_light;
+extern const bcstring be_const_str_SYMBOL_BATTERY_EMPTY;
+extern const bcstring be_const_str_concat;
 extern const bcstring be_const_str_SYMBOL_RIGHT;
-extern const bcstring be_const_str_IBEACON_TX;
-extern const bcstring be_const_str_gen_cb;
-extern const bcstring be_const_str_open;
-extern const bcstring be_const_str_OLED_RESET;
-extern const bcstring be_const_str_lv_cpicker;
-extern const bcstring be_const_str_scan;
-extern const bcstring be_const_str_toupper;
-extern const bcstring be_const_str_SDS0X1_RX;
+extern const bcstring be_const_str_finish;
+extern const bcstring be_const_str_lv_draw_mask_angle_param_cfg;
+extern const bcstring be_const_str_remove_rule;
+extern const bcstring be_const_str_cb_dispatch;
 extern const bcstring be_const_str_content_send;
-extern const bcstring be_const_str_lv_group;
-extern const bcstring be_const_str_AS608_RX;
-extern const bcstring be_const_str_SYMBOL_CHARGE;
-extern const bcstring be_const_str_get_light;
-extern const bcstring be_const_str_load_freetype_font;
-extern const bcstring be_const_str_setitem;
-extern const bcstring be_const_str_opt_connect;
-extern const bcstring be_const_str_SDM72_TX;
-extern const bcstring be_const_str_SYMBOL_VOLUME_MID;
-extern const bcstring be_const_str_TELEINFO_ENABLE;
-extern const bcstring be_const_str_collect;
-extern const bcstring be_const_str__timers;
-extern const bcstring be_const_str_add;
-extern const bcstring be_const_str_isinstance;
-extern const bcstring be_const_str_rtc;
-extern const bcstring be_const_str_lv_draw_img_dsc;
+extern const bcstring be_const_str_lv_color;
+extern const bcstring be_const_str_remove;
+extern const bcstring be_const_str_SOLAXX1_TX;
 extern const bcstring be_const_str_HIGH;
-extern const bcstring be_const_str_add_cmd;
-extern const bcstring be_const_str_erase;
-extern const bcstring be_const_str_as;
-extern const bcstring be_const_str_DSB;
-extern const bcstring be_const_str_KEY1_INV_NP;
-extern const bcstring be_const_str___lower__;
-extern const bcstring be_const_str_set_light;
-extern const bcstring be_const_str_ARIRFRCV;
-extern const bcstring be_const_str_KEY1_NP;
-extern const bcstring be_const_str_WIEGAND_D1;
-extern const bcstring be_const_str_find_op;
+extern const bcstring be_const_str_screenshot;
+extern const bcstring be_const_str_A4988_DIR;
 extern const bcstring be_const_str_NRF24_DC;
-extern const bcstring be_const_str_content_start;
-extern const bcstring be_const_str_SYMBOL_STOP;
-extern const bcstring be_const_str_lv_win;
-extern const bcstring be_const_str_false;
-extern const bcstring be_const_str_A4988_STP;
-extern const bcstring be_const_str_SYMBOL_NEXT;
-extern const bcstring be_const_str_WEBCAM_XCLK;
-extern const bcstring be_const_str_WEBCAM_PSRCS;
-extern const bcstring be_const_str_scale_uint;
-extern const bcstring be_const_str_do;
-extern const bcstring be_const_str_OUTPUT_LO;
-extern const bcstring be_const_str_SSPI_DC;
-extern const bcstring be_const_str_import;
-extern const bcstring be_const_str_push;
-extern const bcstring be_const_str_cos;
-extern const bcstring be_const_str_lv_tabview;
-extern const bcstring be_const_str_set_timer;
-extern const bcstring be_const_str_DEEPSLEEP;
+extern const bcstring be_const_str_SYMBOL_WIFI;
+extern const bcstring be_const_str_TM1638STB;
 extern const bcstring be_const_str_ILI9341_DC;
-extern const bcstring be_const_str_yield;
-extern const bcstring be_const_str_SDM630_RX;
-extern const bcstring be_const_str_DI;
-extern const bcstring be_const_str_SYMBOL_BLUETOOTH;
-extern const bcstring be_const_str_lv_draw_label_dsc;
-extern const bcstring be_const_str_update;
-extern const bcstring be_const_str_INPUT;
-extern const bcstring be_const_str_SYMBOL_NEW_LINE;
-extern const bcstring be_const_str_ZIGBEE_RST;
-extern const bcstring be_const_str_SYMBOL_SD_CARD;
+extern const bcstring be_const_str_PN532_TXD;
+extern const bcstring be_const_str_ST7789_CS;
 extern const bcstring be_const_str_CC1101_GDO2;
-extern const bcstring be_const_str_MGC3130_XFER;
-extern const bcstring be_const_str__drivers;
-extern const bcstring be_const_str_copy;
-extern const bcstring be_const_str_detect;
-extern const bcstring be_const_str_SR04_TRIG;
-extern const bcstring be_const_str_TUYA_TX;
-extern const bcstring be_const_str__cb;
+extern const bcstring be_const_str_item;
+extern const bcstring be_const_str_ELECTRIQ_MOODL_TX;
+extern const bcstring be_const_str_SSPI_MOSI;
+extern const bcstring be_const_str_SYMBOL_BELL;
+extern const bcstring be_const_str_lv_draw_img_dsc;
+extern const bcstring be_const_str_OPEN_DRAIN;
+extern const bcstring be_const_str_lv_switch;
+extern const bcstring be_const_str_wire2;
+extern const bcstring be_const_str_TCP_TX;
+extern const bcstring be_const_str_load_font;
+extern const bcstring be_const_str_SI7021;
+extern const bcstring be_const_str_SYMBOL_PAUSE;
+extern const bcstring be_const_str__get_cb;
+extern const bcstring be_const_str_resp_cmnd_failed;
+extern const bcstring be_const_str_def;
+extern const bcstring be_const_str_while;
+extern const bcstring be_const_str_SYMBOL_CUT;
+extern const bcstring be_const_str_write;
+extern const bcstring be_const_str_SYMBOL_COPY;
+extern const bcstring be_const_str_ADC_BUTTON_INV;
+extern const bcstring be_const_str_SYMBOL_AUDIO;
+extern const bcstring be_const_str_SYMBOL_EYE_OPEN;
+extern const bcstring be_const_str_ZIGBEE_TX;
+extern const bcstring be_const_str_EPD_DATA;
+extern const bcstring be_const_str_IBEACON_TX;
+extern const bcstring be_const_str_NRG_CF1;
+extern const bcstring be_const_str_set;
+extern const bcstring be_const_str_asstring;
+extern const bcstring be_const_str_RISING;
+extern const bcstring be_const_str_SM16716_SEL;
+extern const bcstring be_const_str_SSD1331_DC;
+extern const bcstring be_const_str_SYMBOL_DOWNLOAD;
+extern const bcstring be_const_str_LEDLNK_INV;
+extern const bcstring be_const_str_TELEINFO_ENABLE;
+extern const bcstring be_const_str_lv_checkbox;
+extern const bcstring be_const_str_lv_dropdown;
+extern const bcstring be_const_str_GPS_RX;
+extern const bcstring be_const_str_P9813_DAT;
+extern const bcstring be_const_str_tan;
+extern const bcstring be_const_str_do;
+extern const bcstring be_const_str_DHT22;
+extern const bcstring be_const_str_SYMBOL_VOLUME_MAX;
+extern const bcstring be_const_str_DDS2382_TX;
+extern const bcstring be_const_str_cosh;
+extern const bcstring be_const_str_resolvecmnd;
+extern const bcstring be_const_str_raise;
+extern const bcstring be_const_str_lv_group_focus_cb;
+extern const bcstring be_const_str_print;
 extern const bcstring be_const_str_HALLEFFECT;
-extern const bcstring be_const_str_RXD;
-extern const bcstring be_const_str_imin;
-extern const bcstring be_const_str_SYMBOL_VIDEO;
-extern const bcstring be_const_str_SYMBOL_LIST;
+extern const bcstring be_const_str_SYMBOL_DUMMY;
+extern const bcstring be_const_str_event;
+extern const bcstring be_const_str_exec_cmd;
+extern const bcstring be_const_str_tolower;
+extern const bcstring be_const_str_lv_table;
+extern const bcstring be_const_str_MAX31855CS;
+extern const bcstring be_const_str_arg;
+extern const bcstring be_const_str_ADC_JOY;
+extern const bcstring be_const_str_I2C_SDA;
 extern const bcstring be_const_str_calldepth;
-extern const bcstring be_const_str_AZ_TXD;
-extern const bcstring be_const_str_DSB_OUT;
-extern const bcstring be_const_str_end;
-extern const bcstring be_const_str_SYMBOL_BATTERY_EMPTY;
-extern const bcstring be_const_str_lv_gauge;
-extern const bcstring be_const_str_for;
-extern const bcstring be_const_str_BUZZER;
-extern const bcstring be_const_str_member;
-extern const bcstring be_const_str_SSPI_SCLK;
-extern const bcstring be_const_str_lv_draw_mask_radius_param;
 extern const bcstring be_const_str_range;
-extern const bcstring be_const_str_issubclass;
-extern const bcstring be_const_str_WEBCAM_HREF;
-extern const bcstring be_const_str_bytes;
+extern const bcstring be_const_str_BOILER_OT_TX;
+extern const bcstring be_const_str_ROT1A_NP;
+extern const bcstring be_const_str_read13;
+extern const bcstring be_const_str_ARIRFRCV;
 extern const bcstring be_const_str_lv_signal_cb;
-extern const bcstring be_const_str_Driver;
-extern const bcstring be_const_str_OPTION_A;
-extern const bcstring be_const_str_SYMBOL_DUMMY;
-extern const bcstring be_const_str_WEBCAM_HSD;
-extern const bcstring be_const_str_IBEACON_RX;
-extern const bcstring be_const_str_SYMBOL_WIFI;
-extern const bcstring be_const_str_HM10_TX;
-extern const bcstring be_const_str_BOILER_OT_RX;
-extern const bcstring be_const_str_SM16716_CLK;
-extern const bcstring be_const_str_SYMBOL_EJECT;
-extern const bcstring be_const_str_item;
-extern const bcstring be_const_str_SDS0X1_TX;
-extern const bcstring be_const_str_deg;
-extern const bcstring be_const_str_OPEN_DRAIN;
-extern const bcstring be_const_str_SYMBOL_DOWNLOAD;
-extern const bcstring be_const_str_SYMBOL_EDIT;
-extern const bcstring be_const_str_geti;
-extern const bcstring be_const_str_lv_label;
-extern const bcstring be_const_str__rules;
-extern const bcstring be_const_str_insert;
-extern const bcstring be_const_str_register_button_encoder;
-extern const bcstring be_const_str_web_add_config_button;
-extern const bcstring be_const_str_true;
-extern const bcstring be_const_str_SYMBOL_BULLET;
-extern const bcstring be_const_str_SYMBOL_CLOSE;
-extern const bcstring be_const_str_SYMBOL_CUT;
+extern const bcstring be_const_str_AS3935;
+extern const bcstring be_const_str_allocated;
+extern const bcstring be_const_str_SDM72_TX;
+extern const bcstring be_const_str_class;
+extern const bcstring be_const_str_SYMBOL_GPS;
+extern const bcstring be_const_str_bytes;
+extern const bcstring be_const_str_break;
+extern const bcstring be_const_str_MGC3130_RESET;
+extern const bcstring be_const_str_assert;
+extern const bcstring be_const_str_redirect;
+extern const bcstring be_const_str_A4988_ENA;
+extern const bcstring be_const_str_SYMBOL_BATTERY_2;
+extern const bcstring be_const_str_set_light;
+extern const bcstring be_const_str_HRE_DATA;
+extern const bcstring be_const_str_SHELLY_DIMMER_RST_INV;
+extern const bcstring be_const_str_SSPI_MISO;
+extern const bcstring be_const_str_lv_draw_mask_radius_param_cfg;
+extern const bcstring be_const_str_read_bytes;
 extern const bcstring be_const_str__request_from;
-extern const bcstring be_const_str_lower;
-extern const bcstring be_const_str_SYMBOL_UPLOAD;
-extern const bcstring be_const_str_ctypes_bytes;
-extern const bcstring be_const_str_lv_draw_mask_common_dsc;
-extern const bcstring be_const_str_LE01MR_RX;
-extern const bcstring be_const_str_web_add_main_button;
-extern const bcstring be_const_str_floor;
-extern const bcstring be_const_str_seg7_font;
-extern const bcstring be_const_str_DCKI;
-extern const bcstring be_const_str_I2C_SDA;
-extern const bcstring be_const_str_ILI9341_CS;
-extern const bcstring be_const_str_lv_cb;
+extern const bcstring be_const_str_lv_roller;
+extern const bcstring be_const_str_yield;
+extern const bcstring be_const_str_opt_eq;
+extern const bcstring be_const_str_lv_sqrt_res;
+extern const bcstring be_const_str_IRSEND;
+extern const bcstring be_const_str_Wire;
+extern const bcstring be_const_str_lv_img;
+extern const bcstring be_const_str_BL0940_RX;
+extern const bcstring be_const_str_WEBCAM_PCLK;
+extern const bcstring be_const_str_load;
+extern const bcstring be_const_str_OUTPUT;
+extern const bcstring be_const_str_exp;
+extern const bcstring be_const_str_log10;
+extern const bcstring be_const_str_wire_scan;
+extern const bcstring be_const_str_SAIR_TX;
+extern const bcstring be_const_str_gen_cb;
+extern const bcstring be_const_str_ADE7953_IRQ;
+extern const bcstring be_const_str_time_str;
+extern const bcstring be_const_str_SDCARD_CS;
+extern const bcstring be_const_str_add_rule;
+extern const bcstring be_const_str_dump;
+extern const bcstring be_const_str_set_timer;
+extern const bcstring be_const_str_AS608_TX;
+extern const bcstring be_const_str_PZEM004_RX;
+extern const bcstring be_const_str_lv_draw_mask_fade_param;
+extern const bcstring be_const_str_SBR_TX;
+extern const bcstring be_const_str_ZEROCROSS;
+extern const bcstring be_const_str_tostring;
+extern const bcstring be_const_str_AS608_RX;
+extern const bcstring be_const_str_PWM1;
+extern const bcstring be_const_str_FTC532;
+extern const bcstring be_const_str_remove_driver;
+extern const bcstring be_const_str_top;
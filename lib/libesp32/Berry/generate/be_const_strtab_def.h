@@ -1,948 +1,960 @@
-be_define_const_str(lv_style, "lv_style", 4151611549u, 0, 8, NULL);
-be_define_const_str(ETH_PHY_MDIO, "ETH_PHY_MDIO", 3261871568u, 0, 12, &be_const_str_SYMBOL_PLUS);
-be_define_const_str(SYMBOL_PLUS, "SYMBOL_PLUS", 2860093262u, 0, 11, &be_const_str_hex);
-be_define_const_str(hex, "hex", 4273249610u, 0, 3, &be_const_str_setrange);
-be_define_const_str(setrange, "setrange", 3794019032u, 0, 8, NULL);
-be_define_const_str(bus, "bus", 1607822841u, 0, 3, &be_const_str_concat);
-be_define_const_str(concat, "concat", 4124019837u, 0, 6, &be_const_str_raise);
-be_define_const_str(raise, "raise", 1593437475u, 70, 5, NULL);
-be_define_const_str(ROT1A, "ROT1A", 759599716u, 0, 5, &be_const_str_SPI_CLK);
-be_define_const_str(SPI_CLK, "SPI_CLK", 3943233814u, 0, 7, &be_const_str_SYMBOL_MINUS);
-be_define_const_str(SYMBOL_MINUS, "SYMBOL_MINUS", 1806749158u, 0, 12, &be_const_str_WEBCAM_PSCLK);
-be_define_const_str(WEBCAM_PSCLK, "WEBCAM_PSCLK", 3150007456u, 0, 12, &be_const_str_top);
-be_define_const_str(top, "top", 2802900028u, 0, 3, NULL);
-be_define_const_str(EPAPER42_CS, "EPAPER42_CS", 3274717451u, 0, 11, &be_const_str_return);
-be_define_const_str(return, "return", 2246981567u, 60, 6, NULL);
-be_define_const_str(MCP39F5_RST, "MCP39F5_RST", 3657125652u, 0, 11, &be_const_str_OUTPUT_OPEN_DRAIN);
-be_define_const_str(OUTPUT_OPEN_DRAIN, "OUTPUT_OPEN_DRAIN", 2147249436u, 0, 17, &be_const_str_write_bytes);
-be_define_const_str(write_bytes, "write_bytes", 1227543792u, 0, 11, NULL);
-be_define_const_str(SYMBOL_SETTINGS, "SYMBOL_SETTINGS", 339656335u, 0, 15, &be_const_str_call);
-be_define_const_str(call, "call", 3018949801u, 0, 4, &be_const_str_lv_draw_mask_angle_param);
-be_define_const_str(lv_draw_mask_angle_param, "lv_draw_mask_angle_param", 4192166041u, 0, 24, NULL);
-be_define_const_str(pi, "pi", 1213090802u, 0, 2, NULL);
-be_define_const_str(acos, "acos", 1006755615u, 0, 4, &be_const_str_atan);
-be_define_const_str(atan, "atan", 108579519u, 0, 4, &be_const_str_content_flush);
-be_define_const_str(content_flush, "content_flush", 214922475u, 0, 13, NULL);
-be_define_const_str(SYMBOL_BACKSPACE, "SYMBOL_BACKSPACE", 1997168681u, 0, 16, &be_const_str_TM1638STB);
-be_define_const_str(TM1638STB, "TM1638STB", 823674593u, 0, 9, NULL);
-be_define_const_str(resp_cmnd, "resp_cmnd", 2869459626u, 0, 9, &be_const_str_web_add_management_button);
-be_define_const_str(web_add_management_button, "web_add_management_button", 2738877186u, 0, 25, NULL);
-be_define_const_str(NRG_SEL, "NRG_SEL", 1771358125u, 0, 7, NULL);
-be_define_const_str(SYMBOL_OK, "SYMBOL_OK", 4033162940u, 0, 9, &be_const_str_Wire);
-be_define_const_str(Wire, "Wire", 1938276536u, 0, 4, NULL);
-be_define_const_str(SYMBOL_BATTERY_3, "SYMBOL_BATTERY_3", 662591301u, 0, 16, &be_const_str_init);
-be_define_const_str(init, "init", 380752755u, 0, 4, &be_const_str_redirect);
-be_define_const_str(redirect, "redirect", 389758641u, 0, 8, NULL);
-be_define_const_str(ADC_TEMP, "ADC_TEMP", 3771053440u, 0, 8, &be_const_str__get_cb);
-be_define_const_str(_get_cb, "_get_cb", 1448849122u, 0, 7, &be_const_str_finish);
-be_define_const_str(finish, "finish", 1494643858u, 0, 6, NULL);
-be_define_const_str(SPI_DC, "SPI_DC", 553259951u, 0, 6, NULL);
-be_define_const_str(MIEL_HVAC_RX, "MIEL_HVAC_RX", 3720609648u, 0, 12, &be_const_str_NEOPOOL_TX);
-be_define_const_str(NEOPOOL_TX, "NEOPOOL_TX", 2924925804u, 0, 10, &be_const_str_SSD1331_CS);
-be_define_const_str(SSD1331_CS, "SSD1331_CS", 4191047928u, 0, 10, &be_const_str_TELEINFO_RX);
-be_define_const_str(TELEINFO_RX, "TELEINFO_RX", 1195717356u, 0, 11, NULL);
-be_define_const_str(SHELLY_DIMMER_RST_INV, "SHELLY_DIMMER_RST_INV", 2366759773u, 0, 21, NULL);
-be_define_const_str(MAX7219CS, "MAX7219CS", 2593198244u, 0, 9, &be_const_str_pin_mode);
-be_define_const_str(pin_mode, "pin_mode", 3258314030u, 0, 8, NULL);
-be_define_const_str(SDM72_RX, "SDM72_RX", 766750035u, 0, 8, &be_const_str_SYMBOL_HOME);
-be_define_const_str(SYMBOL_HOME, "SYMBOL_HOME", 730845525u, 0, 11, &be_const_str_TM1637CLK);
-be_define_const_str(TM1637CLK, "TM1637CLK", 2797300857u, 0, 9, &be_const_str_char);
-be_define_const_str(char, "char", 2823553821u, 0, 4, &be_const_str_resp_cmnd_done);
-be_define_const_str(resp_cmnd_done, "resp_cmnd_done", 2601874875u, 0, 14, NULL);
-be_define_const_str(ADC_LIGHT, "ADC_LIGHT", 3982461502u, 0, 9, &be_const_str_ZIGBEE_TX);
-be_define_const_str(ZIGBEE_TX, "ZIGBEE_TX", 25119256u, 0, 9, NULL);
-be_define_const_str(lv_dropdown, "lv_dropdown", 2797165301u, 0, 11, NULL);
-be_define_const_str(A4988_DIR, "A4988_DIR", 2223595843u, 0, 9, &be_const_str_AS3935);
-be_define_const_str(AS3935, "AS3935", 603621745u, 0, 6, &be_const_str_lv_sqrt_res);
-be_define_const_str(lv_sqrt_res, "lv_sqrt_res", 2904473995u, 0, 11, NULL);
-be_define_const_str(IEM3000_TX, "IEM3000_TX", 1185907310u, 0, 10, &be_const_str_cosh);
-be_define_const_str(cosh, "cosh", 4099687964u, 0, 4, &be_const_str_web_sensor);
-be_define_const_str(web_sensor, "web_sensor", 2900096972u, 0, 10, &be_const_str_continue);
-be_define_const_str(continue, "continue", 2977070660u, 59, 8, NULL);
-be_define_const_str(BS814_DAT, "BS814_DAT", 3620403837u, 0, 9, NULL);
-be_define_const_str(opt_add, "+", 772578730u, 0, 1, &be_const_str_A4988_ENA);
-be_define_const_str(A4988_ENA, "A4988_ENA", 1517502682u, 0, 9, &be_const_str_lv_point);
-be_define_const_str(lv_point, "lv_point", 4120221790u, 0, 8, NULL);
-be_define_const_str(delay, "delay", 1322381784u, 0, 5, &be_const_str_resp_cmnd_str);
-be_define_const_str(resp_cmnd_str, "resp_cmnd_str", 737845590u, 0, 13, NULL);
-be_define_const_str(iter, "iter", 3124256359u, 0, 4, NULL);
-be_define_const_str(fromstring, "fromstring", 610302344u, 0, 10, &be_const_str_lv_event_cb);
-be_define_const_str(lv_event_cb, "lv_event_cb", 2480731016u, 0, 11, NULL);
-be_define_const_str(CNTR1_NP, "CNTR1_NP", 4288381648u, 0, 8, NULL);
-be_define_const_str(tanh, "tanh", 153638352u, 0, 4, NULL);
-be_define_const_str(lv_objmask, "lv_objmask", 1311221665u, 0, 10, NULL);
-be_define_const_str(SOLAXX1_RX, "SOLAXX1_RX", 971867054u, 0, 10, NULL);
-be_define_const_str(HRE_CLOCK, "HRE_CLOCK", 2870559111u, 0, 9, &be_const_str_MAX31855CS);
-be_define_const_str(MAX31855CS, "MAX31855CS", 753620511u, 0, 10, &be_const_str_SDM630_TX);
-be_define_const_str(SDM630_TX, "SDM630_TX", 696213075u, 0, 9, &be_const_str_every_second);
-be_define_const_str(every_second, "every_second", 2075451465u, 0, 12, NULL);
-be_define_const_str(SYMBOL_AUDIO, "SYMBOL_AUDIO", 3056537956u, 0, 12, NULL);
-be_define_const_str(RC522_CS, "RC522_CS", 2639619996u, 0, 8, &be_const_str_def);
-be_define_const_str(def, "def", 3310976652u, 55, 3, NULL);
-be_define_const_str(REL1, "REL1", 3142397887u, 0, 4, &be_const_str_load_font);
-be_define_const_str(load_font, "load_font", 1875840019u, 0, 9, &be_const_str_real);
-be_define_const_str(real, "real", 3604983901u, 0, 4, &be_const_str_set);
-be_define_const_str(set, "set", 3324446467u, 0, 3, NULL);
-be_define_const_str(PZEM016_RX, "PZEM016_RX", 1004012055u, 0, 10, &be_const_str_SSPI_CS);
-be_define_const_str(SSPI_CS, "SSPI_CS", 977784795u, 0, 7, NULL);
-be_define_const_str(SYMBOL_TRASH, "SYMBOL_TRASH", 3169100368u, 0, 12, &be_const_str_wire);
+be_define_const_str(DDSU666_TX, "DDSU666_TX", 1880604150u, 0, 10, &be_const_str_PROJECTOR_CTRL_TX);
+be_define_const_str(PROJECTOR_CTRL_TX, "PROJECTOR_CTRL_TX", 535811130u, 0, 17, &be_const_str_lv_draw_mask_radius_param);
+be_define_const_str(lv_draw_mask_radius_param, "lv_draw_mask_radius_param", 3777679220u, 0, 25, NULL);
+be_define_const_str(sin, "sin", 3761252941u, 0, 3, NULL);
+be_define_const_str(ADC_LIGHT, "ADC_LIGHT", 3982461502u, 0, 9, NULL);
+be_define_const_str(ADC_RANGE, "ADC_RANGE", 3467329543u, 0, 9, &be_const_str_Driver);
+be_define_const_str(Driver, "Driver", 3576386303u, 0, 6, &be_const_str_srand);
+be_define_const_str(srand, "srand", 465518633u, 0, 5, NULL);
+be_define_const_str(SOLAXX1_RX, "SOLAXX1_RX", 971867054u, 0, 10, &be_const_str_wire);
 be_define_const_str(wire, "wire", 4082753944u, 0, 4, NULL);
-be_define_const_str(REL1_INV, "REL1_INV", 3733155371u, 0, 8, NULL);
-be_define_const_str(FTC532, "FTC532", 3182343438u, 0, 6, &be_const_str_OUTPUT_HI);
-be_define_const_str(OUTPUT_HI, "OUTPUT_HI", 3153592902u, 0, 9, &be_const_str_classof);
-be_define_const_str(classof, "classof", 1796577762u, 0, 7, &be_const_str_web_send_decimal);
-be_define_const_str(web_send_decimal, "web_send_decimal", 1407210204u, 0, 16, NULL);
-be_define_const_str(opt_neq, "!=", 2428715011u, 0, 2, &be_const_str_LED1_INV);
-be_define_const_str(LED1_INV, "LED1_INV", 2112045097u, 0, 8, &be_const_str_load);
-be_define_const_str(load, "load", 3859241449u, 0, 4, NULL);
-be_define_const_str(ADC_INPUT, "ADC_INPUT", 2207556878u, 0, 9, &be_const_str_SPI_CS);
-be_define_const_str(SPI_CS, "SPI_CS", 553701236u, 0, 6, &be_const_str_WEBCAM_RESET);
-be_define_const_str(WEBCAM_RESET, "WEBCAM_RESET", 2171221520u, 0, 12, &be_const_str_ceil);
-be_define_const_str(ceil, "ceil", 1659167240u, 0, 4, &be_const_str_clear);
-be_define_const_str(clear, "clear", 1550717474u, 0, 5, NULL);
-be_define_const_str(cmd, "cmd", 4136785899u, 0, 3, &be_const_str_response_append);
-be_define_const_str(response_append, "response_append", 450346371u, 0, 15, NULL);
-be_define_const_str(lv_btn, "lv_btn", 1612829968u, 0, 6, &be_const_str_lv_draw_line_dsc);
-be_define_const_str(lv_draw_line_dsc, "lv_draw_line_dsc", 2422805236u, 0, 16, NULL);
-be_define_const_str(gc, "gc", 1042313471u, 0, 2, NULL);
-be_define_const_str(WINDMETER_SPEED, "WINDMETER_SPEED", 1980822204u, 0, 15, &be_const_str_number);
-be_define_const_str(number, "number", 467038368u, 0, 6, &be_const_str_write_bit);
-be_define_const_str(write_bit, "write_bit", 2660990436u, 0, 9, NULL);
-be_define_const_str(WEBCAM_SIOC, "WEBCAM_SIOC", 218815147u, 0, 11, NULL);
-be_define_const_str(I2C_SCL, "I2C_SCL", 164217098u, 0, 7, &be_const_str_XPT2046_CS);
-be_define_const_str(XPT2046_CS, "XPT2046_CS", 4049231042u, 0, 10, &be_const_str_lv_calendar);
-be_define_const_str(lv_calendar, "lv_calendar", 3284396894u, 0, 11, NULL);
-be_define_const_str(RISING, "RISING", 1256404539u, 0, 6, &be_const_str_arg);
-be_define_const_str(arg, "arg", 1047474471u, 0, 3, NULL);
-be_define_const_str(_read, "_read", 346717030u, 0, 5, &be_const_str_rand);
-be_define_const_str(rand, "rand", 2711325910u, 0, 4, NULL);
-be_define_const_str(SYMBOL_SHUFFLE, "SYMBOL_SHUFFLE", 1123310147u, 0, 14, NULL);
-be_define_const_str(DDSU666_TX, "DDSU666_TX", 1880604150u, 0, 10, &be_const_str_web_add_button);
-be_define_const_str(web_add_button, "web_add_button", 3537875058u, 0, 14, &be_const_str_except);
-be_define_const_str(except, "except", 950914032u, 69, 6, NULL);
-be_define_const_str(RFRECV, "RFRECV", 354742801u, 0, 6, NULL);
-be_define_const_str(PZEM017_RX, "PZEM017_RX", 3227495894u, 0, 10, &be_const_str_RA8876_CS);
+be_define_const_str(TASMOTACLIENT_RST_INV, "TASMOTACLIENT_RST_INV", 2601785365u, 0, 21, NULL);
+be_define_const_str(SPI_CS, "SPI_CS", 553701236u, 0, 6, &be_const_str_lv_label);
+be_define_const_str(lv_label, "lv_label", 4199664246u, 0, 8, NULL);
 be_define_const_str(RA8876_CS, "RA8876_CS", 2529944108u, 0, 9, NULL);
-be_define_const_str(KEY1_INV, "KEY1_INV", 263542563u, 0, 8, &be_const_str___iterator__);
-be_define_const_str(__iterator__, "__iterator__", 3884039703u, 0, 12, &be_const_str_lv_draw_mask_map_param_cfg);
-be_define_const_str(lv_draw_mask_map_param_cfg, "lv_draw_mask_map_param_cfg", 3822900597u, 0, 26, &be_const_str_module);
-be_define_const_str(module, "module", 3617558685u, 0, 6, NULL);
-be_define_const_str(ADC_BUTTON, "ADC_BUTTON", 3393454690u, 0, 10, NULL);
-be_define_const_str(get_tasmota, "get_tasmota", 334356779u, 0, 11, &be_const_str_read24);
-be_define_const_str(read24, "read24", 1808533811u, 0, 6, &be_const_str_start);
-be_define_const_str(start, "start", 1697318111u, 0, 5, NULL);
-be_define_const_str(MIEL_HVAC_TX, "MIEL_HVAC_TX", 567403014u, 0, 12, &be_const_str_SYMBOL_DRIVE);
-be_define_const_str(SYMBOL_DRIVE, "SYMBOL_DRIVE", 567203502u, 0, 12, &be_const_str_SYMBOL_WARNING);
-be_define_const_str(SYMBOL_WARNING, "SYMBOL_WARNING", 4119913686u, 0, 14, &be_const_str_gamma8);
-be_define_const_str(gamma8, "gamma8", 3802843830u, 0, 6, &be_const_str_lv_draw_mask_line_param);
-be_define_const_str(lv_draw_mask_line_param, "lv_draw_mask_line_param", 2692990704u, 0, 23, &be_const_str_memory);
+be_define_const_str(lv_spinbox, "lv_spinbox", 2666096729u, 0, 10, NULL);
+be_define_const_str(ADC_BUTTON, "ADC_BUTTON", 3393454690u, 0, 10, &be_const_str_SYMBOL_OK);
+be_define_const_str(SYMBOL_OK, "SYMBOL_OK", 4033162940u, 0, 9, &be_const_str__read);
+be_define_const_str(_read, "_read", 346717030u, 0, 5, &be_const_str_lower);
+be_define_const_str(lower, "lower", 3038577850u, 0, 5, &be_const_str_lv_point);
+be_define_const_str(lv_point, "lv_point", 4120221790u, 0, 8, &be_const_str_pop);
+be_define_const_str(pop, "pop", 1362321360u, 0, 3, NULL);
+be_define_const_str(lv_slider, "lv_slider", 2274180781u, 0, 9, &be_const_str_read24);
+be_define_const_str(read24, "read24", 1808533811u, 0, 6, NULL);
+be_define_const_str(SYMBOL_BULLET, "SYMBOL_BULLET", 587181862u, 0, 13, NULL);
+be_define_const_str(get_option, "get_option", 2123730033u, 0, 10, NULL);
+be_define_const_str(ADC_PH, "ADC_PH", 3820290594u, 0, 6, &be_const_str_WINDMETER_SPEED);
+be_define_const_str(WINDMETER_SPEED, "WINDMETER_SPEED", 1980822204u, 0, 15, &be_const_str_seti);
+be_define_const_str(seti, "seti", 1500556254u, 0, 4, NULL);
+be_define_const_str(BS814_CLK, "BS814_CLK", 3002713336u, 0, 9, &be_const_str_try);
+be_define_const_str(try, "try", 2887626766u, 68, 3, NULL);
+be_define_const_str(BS814_DAT, "BS814_DAT", 3620403837u, 0, 9, &be_const_str_MCP39F5_TX);
+be_define_const_str(MCP39F5_TX, "MCP39F5_TX", 1332322047u, 0, 10, &be_const_str_SYMBOL_UPLOAD);
+be_define_const_str(SYMBOL_UPLOAD, "SYMBOL_UPLOAD", 3293679647u, 0, 13, &be_const_str_arg_size);
+be_define_const_str(arg_size, "arg_size", 3310243257u, 0, 8, &be_const_str_get_free_heap);
+be_define_const_str(get_free_heap, "get_free_heap", 625069757u, 0, 13, &be_const_str_sinh);
+be_define_const_str(sinh, "sinh", 282220607u, 0, 4, NULL);
+be_define_const_str(SYMBOL_LOOP, "SYMBOL_LOOP", 2762053208u, 0, 11, &be_const_str_WS2812);
+be_define_const_str(WS2812, "WS2812", 3539741218u, 0, 6, NULL);
+be_define_const_str(A4988_STP, "A4988_STP", 1622172049u, 0, 9, &be_const_str_lv_imgbtn);
+be_define_const_str(lv_imgbtn, "lv_imgbtn", 2402844429u, 0, 9, NULL);
+be_define_const_str(ZIGBEE_RX, "ZIGBEE_RX", 93215470u, 0, 9, &be_const_str_resp_cmnd_str);
+be_define_const_str(resp_cmnd_str, "resp_cmnd_str", 737845590u, 0, 13, NULL);
+be_define_const_str(SYMBOL_UP, "SYMBOL_UP", 3886401511u, 0, 9, NULL);
+be_define_const_str(WEBCAM_SIOD, "WEBCAM_SIOD", 302703242u, 0, 11, &be_const_str_setrange);
+be_define_const_str(setrange, "setrange", 3794019032u, 0, 8, NULL);
+be_define_const_str(PZEM017_RX, "PZEM017_RX", 3227495894u, 0, 10, &be_const_str_SPI_CLK);
+be_define_const_str(SPI_CLK, "SPI_CLK", 3943233814u, 0, 7, &be_const_str_SSPI_DC);
+be_define_const_str(SSPI_DC, "SSPI_DC", 1782271864u, 0, 7, NULL);
+be_define_const_str(ST7789_DC, "ST7789_DC", 2533509745u, 0, 9, &be_const_str_SYMBOL_LEFT);
+be_define_const_str(SYMBOL_LEFT, "SYMBOL_LEFT", 1563517575u, 0, 11, NULL);
+be_define_const_str(opt_call, "()", 685372826u, 0, 2, &be_const_str_OUTPUT_OPEN_DRAIN);
+be_define_const_str(OUTPUT_OPEN_DRAIN, "OUTPUT_OPEN_DRAIN", 2147249436u, 0, 17, NULL);
+be_define_const_str(setbits, "setbits", 2762408167u, 0, 7, NULL);
+be_define_const_str(SYMBOL_MINUS, "SYMBOL_MINUS", 1806749158u, 0, 12, &be_const_str_TASMOTACLIENT_RXD);
+be_define_const_str(TASMOTACLIENT_RXD, "TASMOTACLIENT_RXD", 72868318u, 0, 17, NULL);
+be_define_const_str(PMS5003_RX, "PMS5003_RX", 3934985650u, 0, 10, &be_const_str_PROJECTOR_CTRL_RX);
+be_define_const_str(PROJECTOR_CTRL_RX, "PROJECTOR_CTRL_RX", 1542762460u, 0, 17, &be_const_str_RF_SENSOR);
+be_define_const_str(RF_SENSOR, "RF_SENSOR", 2289628100u, 0, 9, &be_const_str_geti);
+be_define_const_str(geti, "geti", 2381006490u, 0, 4, &be_const_str_memory);
 be_define_const_str(memory, "memory", 2229924270u, 0, 6, NULL);
-be_define_const_str(SPI_MOSI, "SPI_MOSI", 2494218614u, 0, 8, &be_const_str_digital_read);
-be_define_const_str(digital_read, "digital_read", 3585496928u, 0, 12, &be_const_str_lv_design_cb);
-be_define_const_str(lv_design_cb, "lv_design_cb", 3822640502u, 0, 12, NULL);
-be_define_const_str(MD5, "MD5", 1935726387u, 0, 3, &be_const_str_get_option);
-be_define_const_str(get_option, "get_option", 2123730033u, 0, 10, &be_const_str_lv_checkbox);
-be_define_const_str(lv_checkbox, "lv_checkbox", 7454841u, 0, 11, NULL);
-be_define_const_str(PMS5003_RX, "PMS5003_RX", 3934985650u, 0, 10, &be_const_str_SYMBOL_BATTERY_2);
-be_define_const_str(SYMBOL_BATTERY_2, "SYMBOL_BATTERY_2", 645813682u, 0, 16, &be_const_str_read32);
-be_define_const_str(read32, "read32", 1741276240u, 0, 6, NULL);
-be_define_const_str(dump, "dump", 3663001223u, 0, 4, NULL);
-be_define_const_str(SYMBOL_EYE_CLOSE, "SYMBOL_EYE_CLOSE", 404721792u, 0, 16, NULL);
-be_define_const_str(SYMBOL_IMAGE, "SYMBOL_IMAGE", 815601151u, 0, 12, &be_const_str_abs);
-be_define_const_str(abs, "abs", 709362235u, 0, 3, &be_const_str_traceback);
-be_define_const_str(traceback, "traceback", 3385188109u, 0, 9, NULL);
-be_define_const_str(HPMA_RX, "HPMA_RX", 3462528998u, 0, 7, &be_const_str_SM16716_DAT);
-be_define_const_str(SM16716_DAT, "SM16716_DAT", 1905621806u, 0, 11, &be_const_str_SYMBOL_PAUSE);
-be_define_const_str(SYMBOL_PAUSE, "SYMBOL_PAUSE", 641998172u, 0, 12, &be_const_str_attrdump);
-be_define_const_str(attrdump, "attrdump", 1521571304u, 0, 8, &be_const_str_lv_draw_mask_fade_param);
-be_define_const_str(lv_draw_mask_fade_param, "lv_draw_mask_fade_param", 2743309964u, 0, 23, NULL);
-be_define_const_str(CC1101_GDO0, "CC1101_GDO0", 940611027u, 0, 11, NULL);
-be_define_const_str(super, "super", 4152230356u, 0, 5, &be_const_str_if);
-be_define_const_str(if, "if", 959999494u, 50, 2, NULL);
-be_define_const_str(TCP_RX, "TCP_RX", 3904354751u, 0, 6, &be_const_str_keys);
-be_define_const_str(keys, "keys", 4182378701u, 0, 4, &be_const_str_lv_led);
-be_define_const_str(lv_led, "lv_led", 3192184733u, 0, 6, &be_const_str_time_dump);
-be_define_const_str(time_dump, "time_dump", 3330410747u, 0, 9, NULL);
-be_define_const_str(HPMA_TX, "HPMA_TX", 173233104u, 0, 7, &be_const_str_PN532_TXD);
-be_define_const_str(PN532_TXD, "PN532_TXD", 3093418644u, 0, 9, &be_const_str_compile);
-be_define_const_str(compile, "compile", 1000265118u, 0, 7, NULL);
-be_define_const_str(TCP_TX, "TCP_TX", 2762594089u, 0, 6, &be_const_str_lv_gauge_format_cb);
+be_define_const_str(CSE7766_TX, "CSE7766_TX", 674624821u, 0, 10, &be_const_str_HRE_CLOCK);
+be_define_const_str(HRE_CLOCK, "HRE_CLOCK", 2870559111u, 0, 9, &be_const_str_WEBCAM_DATA);
+be_define_const_str(WEBCAM_DATA, "WEBCAM_DATA", 1476954421u, 0, 11, &be_const_str_true);
+be_define_const_str(true, "true", 1303515621u, 61, 4, NULL);
+be_define_const_str(reverse_gamma10, "reverse_gamma10", 739112262u, 0, 15, &be_const_str_write8);
+be_define_const_str(write8, "write8", 3133991532u, 0, 6, NULL);
+be_define_const_str(lv_led, "lv_led", 3192184733u, 0, 6, NULL);
+be_define_const_str(SSPI_SCLK, "SSPI_SCLK", 136688954u, 0, 9, &be_const_str_copy);
+be_define_const_str(copy, "copy", 3848464964u, 0, 4, NULL);
+be_define_const_str(lv_draw_mask_line_param_cfg, "lv_draw_mask_line_param_cfg", 2154874825u, 0, 27, NULL);
+be_define_const_str(SM16716_DAT, "SM16716_DAT", 1905621806u, 0, 11, &be_const_str_lv_event_cb);
+be_define_const_str(lv_event_cb, "lv_event_cb", 2480731016u, 0, 11, &be_const_str_write_bit);
+be_define_const_str(write_bit, "write_bit", 2660990436u, 0, 9, NULL);
+be_define_const_str(CC1101_GDO0, "CC1101_GDO0", 940611027u, 0, 11, &be_const_str_HJL_CF);
+be_define_const_str(HJL_CF, "HJL_CF", 786158487u, 0, 6, &be_const_str_SYMBOL_SHUFFLE);
+be_define_const_str(SYMBOL_SHUFFLE, "SYMBOL_SHUFFLE", 1123310147u, 0, 14, NULL);
+be_define_const_str(digital_read, "digital_read", 3585496928u, 0, 12, NULL);
 be_define_const_str(lv_gauge_format_cb, "lv_gauge_format_cb", 4073149249u, 0, 18, NULL);
-be_define_const_str(remove_rule, "remove_rule", 3456211328u, 0, 11, NULL);
-be_define_const_str(KEY1_TC, "KEY1_TC", 25685109u, 0, 7, &be_const_str_TASMOTACLIENT_RST);
-be_define_const_str(TASMOTACLIENT_RST, "TASMOTACLIENT_RST", 3326196213u, 0, 17, &be_const_str_tolower);
-be_define_const_str(tolower, "tolower", 1042520049u, 0, 7, &be_const_str_type);
-be_define_const_str(type, "type", 1361572173u, 0, 4, NULL);
-be_define_const_str(lv_cont, "lv_cont", 1391686552u, 0, 7, NULL);
-be_define_const_str(every_100ms, "every_100ms", 1546407804u, 0, 11, &be_const_str_lv_list);
-be_define_const_str(lv_list, "lv_list", 2876551248u, 0, 7, NULL);
-be_define_const_str(CSE7766_TX, "CSE7766_TX", 674624821u, 0, 10, &be_const_str__available);
-be_define_const_str(_available, "_available", 1306196581u, 0, 10, &be_const_str_display);
-be_define_const_str(display, "display", 1164572437u, 0, 7, &be_const_str_sin);
-be_define_const_str(sin, "sin", 3761252941u, 0, 3, NULL);
-be_define_const_str(SM2135_DAT, "SM2135_DAT", 2882726942u, 0, 10, &be_const_str_WEBCAM_SIOD);
-be_define_const_str(WEBCAM_SIOD, "WEBCAM_SIOD", 302703242u, 0, 11, &be_const_str_publish);
-be_define_const_str(publish, "publish", 264247304u, 0, 7, NULL);
-be_define_const_str(input, "input", 4191711099u, 0, 5, &be_const_str_map);
-be_define_const_str(map, "map", 3751997361u, 0, 3, NULL);
+be_define_const_str(read32, "read32", 1741276240u, 0, 6, NULL);
+be_define_const_str(P9813_CLK, "P9813_CLK", 2455391001u, 0, 9, &be_const_str_SYMBOL_REFRESH);
+be_define_const_str(SYMBOL_REFRESH, "SYMBOL_REFRESH", 1266229761u, 0, 14, &be_const_str_char);
+be_define_const_str(char, "char", 2823553821u, 0, 4, NULL);
 be_define_const_str(IRRECV, "IRRECV", 1743648982u, 0, 6, &be_const_str_SSD1351_CS);
-be_define_const_str(SSD1351_CS, "SSD1351_CS", 488746042u, 0, 10, &be_const_str_SYMBOL_PLAY);
-be_define_const_str(SYMBOL_PLAY, "SYMBOL_PLAY", 1750902100u, 0, 11, NULL);
-be_define_const_str(MGC3130_RESET, "MGC3130_RESET", 405013121u, 0, 13, &be_const_str_SYMBOL_SAVE);
-be_define_const_str(SYMBOL_SAVE, "SYMBOL_SAVE", 2439821015u, 0, 11, &be_const_str_lv_draw_mask_radius_param_cfg);
-be_define_const_str(lv_draw_mask_radius_param_cfg, "lv_draw_mask_radius_param_cfg", 3889386773u, 0, 29, NULL);
-be_define_const_str(resp_cmnd_failed, "resp_cmnd_failed", 2136281562u, 0, 16, NULL);
-be_define_const_str(ADC_RANGE, "ADC_RANGE", 3467329543u, 0, 9, NULL);
-be_define_const_str(PZEM0XX_TX, "PZEM0XX_TX", 944775704u, 0, 10, &be_const_str_SYMBOL_USB);
-be_define_const_str(SYMBOL_USB, "SYMBOL_USB", 1962656552u, 0, 10, &be_const_str_int);
-be_define_const_str(int, "int", 2515107422u, 0, 3, &be_const_str_time_str);
-be_define_const_str(time_str, "time_str", 2613827612u, 0, 8, NULL);
-be_define_const_str(LEDLNK_INV, "LEDLNK_INV", 3559015101u, 0, 10, &be_const_str_VL53L0X_XSHUT1);
-be_define_const_str(VL53L0X_XSHUT1, "VL53L0X_XSHUT1", 2341134183u, 0, 14, &be_const_str_set_power);
-be_define_const_str(set_power, "set_power", 549820893u, 0, 9, NULL);
-be_define_const_str(_end_transmission, "_end_transmission", 3237480400u, 0, 17, NULL);
-be_define_const_str(get, "get", 1410115415u, 0, 3, NULL);
-be_define_const_str(SPI_MISO, "SPI_MISO", 150818010u, 0, 8, &be_const_str_print);
-be_define_const_str(print, "print", 372738696u, 0, 5, NULL);
-be_define_const_str(format, "format", 3114108242u, 0, 6, NULL);
-be_define_const_str(MAX7219DIN, "MAX7219DIN", 380687049u, 0, 10, &be_const_str_lv_img);
-be_define_const_str(lv_img, "lv_img", 2474052327u, 0, 6, NULL);
-be_define_const_str(HM10_RX, "HM10_RX", 515085922u, 0, 7, &be_const_str_allocated);
-be_define_const_str(allocated, "allocated", 429986098u, 0, 9, &be_const_str_while);
-be_define_const_str(while, "while", 231090382u, 53, 5, NULL);
-be_define_const_str(getbits, "getbits", 3094168979u, 0, 7, &be_const_str_lv_spinner);
-be_define_const_str(lv_spinner, "lv_spinner", 3361501901u, 0, 10, &be_const_str_pow);
-be_define_const_str(pow, "pow", 1479764693u, 0, 3, NULL);
-be_define_const_str(A4988_MS1, "A4988_MS1", 1729976611u, 0, 9, &be_const_str_SYMBOL_KEYBOARD);
-be_define_const_str(SYMBOL_KEYBOARD, "SYMBOL_KEYBOARD", 1621492879u, 0, 15, &be_const_str_lv_slider);
-be_define_const_str(lv_slider, "lv_slider", 2274180781u, 0, 9, &be_const_str_read13);
-be_define_const_str(read13, "read13", 12887293u, 0, 6, NULL);
-be_define_const_str(NRF24_CS, "NRF24_CS", 555833194u, 0, 8, &be_const_str_PWM1);
-be_define_const_str(PWM1, "PWM1", 1353352426u, 0, 4, &be_const_str_SWT1);
-be_define_const_str(SWT1, "SWT1", 805224112u, 0, 4, NULL);
-be_define_const_str(SSD1331_DC, "SSD1331_DC", 3386560859u, 0, 10, NULL);
-be_define_const_str(PMS5003_TX, "PMS5003_TX", 3868169364u, 0, 10, &be_const_str_TM1638DIO);
-be_define_const_str(TM1638DIO, "TM1638DIO", 1408212414u, 0, 9, &be_const_str__cmd);
-be_define_const_str(_cmd, "_cmd", 3419822142u, 0, 4, &be_const_str_asin);
-be_define_const_str(asin, "asin", 4272848550u, 0, 4, &be_const_str_read12);
-be_define_const_str(read12, "read12", 4291076970u, 0, 6, &be_const_str_state);
+be_define_const_str(SSD1351_CS, "SSD1351_CS", 488746042u, 0, 10, &be_const_str_SWT1);
+be_define_const_str(SWT1, "SWT1", 805224112u, 0, 4, &be_const_str_classof);
+be_define_const_str(classof, "classof", 1796577762u, 0, 7, &be_const_str_lv_draw_label_dsc);
+be_define_const_str(lv_draw_label_dsc, "lv_draw_label_dsc", 265601842u, 0, 17, &be_const_str_pi);
+be_define_const_str(pi, "pi", 1213090802u, 0, 2, &be_const_str_web_add_handler);
+be_define_const_str(web_add_handler, "web_add_handler", 3990174962u, 0, 15, NULL);
+be_define_const_str(module, "module", 3617558685u, 0, 6, NULL);
+be_define_const_str(ROT1B_NP, "ROT1B_NP", 3710079736u, 0, 8, &be_const_str_SYMBOL_WARNING);
+be_define_const_str(SYMBOL_WARNING, "SYMBOL_WARNING", 4119913686u, 0, 14, NULL);
+be_define_const_str(SYMBOL_VOLUME_MID, "SYMBOL_VOLUME_MID", 158835057u, 0, 17, &be_const_str_TM1637CLK);
+be_define_const_str(TM1637CLK, "TM1637CLK", 2797300857u, 0, 9, &be_const_str_read8);
+be_define_const_str(read8, "read8", 2802788167u, 0, 5, NULL);
+be_define_const_str(lv_win, "lv_win", 780927558u, 0, 6, NULL);
+be_define_const_str(AZ_RXD, "AZ_RXD", 699914019u, 0, 6, &be_const_str_NRG_SEL_INV);
+be_define_const_str(NRG_SEL_INV, "NRG_SEL_INV", 3567431069u, 0, 11, NULL);
+be_define_const_str(SYMBOL_FILE, "SYMBOL_FILE", 237085260u, 0, 11, &be_const_str___lower__);
+be_define_const_str(__lower__, "__lower__", 123855590u, 0, 9, &be_const_str__end_transmission);
+be_define_const_str(_end_transmission, "_end_transmission", 3237480400u, 0, 17, &be_const_str_gamma8);
+be_define_const_str(gamma8, "gamma8", 3802843830u, 0, 6, &be_const_str_hex);
+be_define_const_str(hex, "hex", 4273249610u, 0, 3, NULL);
+be_define_const_str(PULLUP, "PULLUP", 3417628531u, 0, 6, &be_const_str_SYMBOL_PASTE);
+be_define_const_str(SYMBOL_PASTE, "SYMBOL_PASTE", 2281577421u, 0, 12, &be_const_str_content_stop);
+be_define_const_str(content_stop, "content_stop", 658554751u, 0, 12, NULL);
+be_define_const_str(SM2135_DAT, "SM2135_DAT", 2882726942u, 0, 10, &be_const_str_SYMBOL_EYE_CLOSE);
+be_define_const_str(SYMBOL_EYE_CLOSE, "SYMBOL_EYE_CLOSE", 404721792u, 0, 16, &be_const_str_SYMBOL_USB);
+be_define_const_str(SYMBOL_USB, "SYMBOL_USB", 1962656552u, 0, 10, &be_const_str_lv_canvas);
+be_define_const_str(lv_canvas, "lv_canvas", 142865412u, 0, 9, NULL);
+be_define_const_str(ILI9488_CS, "ILI9488_CS", 2363112073u, 0, 10, &be_const_str_SYMBOL_VIDEO);
+be_define_const_str(SYMBOL_VIDEO, "SYMBOL_VIDEO", 789726913u, 0, 12, NULL);
+be_define_const_str(count, "count", 967958004u, 0, 5, &be_const_str_imin);
+be_define_const_str(imin, "imin", 2714127864u, 0, 4, &be_const_str_json_append);
+be_define_const_str(json_append, "json_append", 3002019284u, 0, 11, NULL);
+be_define_const_str(SHELLY_DIMMER_BOOT0, "SHELLY_DIMMER_BOOT0", 2948777716u, 0, 19, &be_const_str_TM1638CLK);
+be_define_const_str(TM1638CLK, "TM1638CLK", 3045182446u, 0, 9, NULL);
+be_define_const_str(content_button, "content_button", 1956476087u, 0, 14, &be_const_str_upper);
+be_define_const_str(upper, "upper", 176974407u, 0, 5, NULL);
+be_define_const_str(CNTR1_NP, "CNTR1_NP", 4288381648u, 0, 8, &be_const_str_MAX31855DO);
+be_define_const_str(MAX31855DO, "MAX31855DO", 552730368u, 0, 10, &be_const_str_Tasmota);
+be_define_const_str(Tasmota, "Tasmota", 4047617668u, 0, 7, &be_const_str_web_add_button);
+be_define_const_str(web_add_button, "web_add_button", 3537875058u, 0, 14, NULL);
+be_define_const_str(KEY1_TC, "KEY1_TC", 25685109u, 0, 7, &be_const_str_SYMBOL_KEYBOARD);
+be_define_const_str(SYMBOL_KEYBOARD, "SYMBOL_KEYBOARD", 1621492879u, 0, 15, NULL);
 be_define_const_str(state, "state", 2016490230u, 0, 5, NULL);
-be_define_const_str(exec_cmd, "exec_cmd", 493567399u, 0, 8, NULL);
-be_define_const_str(HLW_CF, "HLW_CF", 3982619486u, 0, 6, NULL);
-be_define_const_str(SYMBOL_DIRECTORY, "SYMBOL_DIRECTORY", 1886053449u, 0, 16, &be_const_str_SYMBOL_PASTE);
-be_define_const_str(SYMBOL_PASTE, "SYMBOL_PASTE", 2281577421u, 0, 12, &be_const_str_resolvecmnd);
-be_define_const_str(resolvecmnd, "resolvecmnd", 993361485u, 0, 11, NULL);
-be_define_const_str(ST7789_CS, "ST7789_CS", 2937305434u, 0, 9, NULL);
-be_define_const_str(SYMBOL_BATTERY_FULL, "SYMBOL_BATTERY_FULL", 2638935545u, 0, 19, NULL);
-be_define_const_str(log10, "log10", 2346846000u, 0, 5, NULL);
-be_define_const_str(TXD, "TXD", 3614562079u, 0, 3, NULL);
-be_define_const_str(SYMBOL_EYE_OPEN, "SYMBOL_EYE_OPEN", 3449311676u, 0, 15, &be_const_str__buffer);
-be_define_const_str(_buffer, "_buffer", 2044888568u, 0, 7, NULL);
-be_define_const_str(EXS_ENABLE, "EXS_ENABLE", 1896914313u, 0, 10, &be_const_str_HJL_CF);
-be_define_const_str(HJL_CF, "HJL_CF", 786158487u, 0, 6, &be_const_str_lv_draw_mask_fade_param_cfg);
+be_define_const_str(deg, "deg", 3327754271u, 0, 3, &be_const_str_keys);
+be_define_const_str(keys, "keys", 4182378701u, 0, 4, NULL);
+be_define_const_str(SR04_TRIG, "SR04_TRIG", 68671263u, 0, 9, &be_const_str_TASMOTACLIENT_RST);
+be_define_const_str(TASMOTACLIENT_RST, "TASMOTACLIENT_RST", 3326196213u, 0, 17, NULL);
+be_define_const_str(EPAPER29_CS, "EPAPER29_CS", 3916373594u, 0, 11, &be_const_str_lv_draw_mask_map_param);
+be_define_const_str(lv_draw_mask_map_param, "lv_draw_mask_map_param", 1666886804u, 0, 22, &be_const_str_lv_line);
+be_define_const_str(lv_line, "lv_line", 2692732914u, 0, 7, NULL);
+be_define_const_str(DYP_RX, "DYP_RX", 2122310285u, 0, 6, &be_const_str_SDM72_RX);
+be_define_const_str(SDM72_RX, "SDM72_RX", 766750035u, 0, 8, &be_const_str_SYMBOL_HOME);
+be_define_const_str(SYMBOL_HOME, "SYMBOL_HOME", 730845525u, 0, 11, &be_const_str_TUYA_TX);
+be_define_const_str(TUYA_TX, "TUYA_TX", 1541301465u, 0, 7, NULL);
+be_define_const_str(RC522_CS, "RC522_CS", 2639619996u, 0, 8, NULL);
 be_define_const_str(lv_draw_mask_fade_param_cfg, "lv_draw_mask_fade_param_cfg", 4158595197u, 0, 27, NULL);
-be_define_const_str(PROJECTOR_CTRL_RX, "PROJECTOR_CTRL_RX", 1542762460u, 0, 17, NULL);
-be_define_const_str(SBR_TX, "SBR_TX", 3419096015u, 0, 6, &be_const_str_sqrt);
-be_define_const_str(sqrt, "sqrt", 2112764879u, 0, 4, NULL);
-be_define_const_str(MAX31855DO, "MAX31855DO", 552730368u, 0, 10, &be_const_str_SYMBOL_DOWN);
-be_define_const_str(SYMBOL_DOWN, "SYMBOL_DOWN", 1107513570u, 0, 11, &be_const_str_save_before_restart);
-be_define_const_str(save_before_restart, "save_before_restart", 1253239338u, 0, 19, &be_const_str_write8);
-be_define_const_str(write8, "write8", 3133991532u, 0, 6, NULL);
-be_define_const_str(byte, "byte", 1683620383u, 0, 4, NULL);
-be_define_const_str(write, "write", 3190202204u, 0, 5, NULL);
-be_define_const_str(GPS_TX, "GPS_TX", 4228740808u, 0, 6, NULL);
-be_define_const_str(ELECTRIQ_MOODL_TX, "ELECTRIQ_MOODL_TX", 31009247u, 0, 17, &be_const_str_SYMBOL_BATTERY_1);
-be_define_const_str(SYMBOL_BATTERY_1, "SYMBOL_BATTERY_1", 629036063u, 0, 16, &be_const_str_WE517_RX);
-be_define_const_str(WE517_RX, "WE517_RX", 4096577879u, 0, 8, &be_const_str_digital_write);
-be_define_const_str(digital_write, "digital_write", 3435877979u, 0, 13, &be_const_str_lv_spinbox);
-be_define_const_str(lv_spinbox, "lv_spinbox", 2666096729u, 0, 10, NULL);
-be_define_const_str(lv_switch, "lv_switch", 3407171508u, 0, 9, &be_const_str_pin);
-be_define_const_str(pin, "pin", 1866532500u, 0, 3, &be_const_str_pin_used);
+be_define_const_str(ADC_INPUT, "ADC_INPUT", 2207556878u, 0, 9, &be_const_str_check_privileged_access);
+be_define_const_str(check_privileged_access, "check_privileged_access", 3692933968u, 0, 23, NULL);
+be_define_const_str(LEDLNK, "LEDLNK", 2862810701u, 0, 6, &be_const_str_MGC3130_XFER);
+be_define_const_str(MGC3130_XFER, "MGC3130_XFER", 4178219131u, 0, 12, &be_const_str_RFSEND);
+be_define_const_str(RFSEND, "RFSEND", 1862630731u, 0, 6, &be_const_str_lv_area);
+be_define_const_str(lv_area, "lv_area", 2521150401u, 0, 7, &be_const_str_response_append);
+be_define_const_str(response_append, "response_append", 450346371u, 0, 15, NULL);
 be_define_const_str(pin_used, "pin_used", 4033854612u, 0, 8, NULL);
-be_define_const_str(SAIR_RX, "SAIR_RX", 1273688713u, 0, 7, &be_const_str_SI7021);
-be_define_const_str(SI7021, "SI7021", 864377911u, 0, 6, &be_const_str_WE517_TX);
-be_define_const_str(WE517_TX, "WE517_TX", 2954817217u, 0, 8, &be_const_str_lv_obj);
-be_define_const_str(lv_obj, "lv_obj", 4257833149u, 0, 6, NULL);
-be_define_const_str(SSPI_MAX31865_CS1, "SSPI_MAX31865_CS1", 1256578724u, 0, 17, NULL);
-be_define_const_str(DHT22, "DHT22", 215937903u, 0, 5, &be_const_str_arg_size);
-be_define_const_str(arg_size, "arg_size", 3310243257u, 0, 8, &be_const_str_millis);
-be_define_const_str(millis, "millis", 1214679063u, 0, 6, &be_const_str_remove);
-be_define_const_str(remove, "remove", 3683784189u, 0, 6, NULL);
-be_define_const_str(deinit, "deinit", 2345559592u, 0, 6, &be_const_str_wire2);
-be_define_const_str(wire2, "wire2", 3229499038u, 0, 5, NULL);
-be_define_const_str(SYMBOL_FILE, "SYMBOL_FILE", 237085260u, 0, 11, &be_const_str_lv_canvas);
-be_define_const_str(lv_canvas, "lv_canvas", 142865412u, 0, 9, NULL);
-be_define_const_str(ROT1A_NP, "ROT1A_NP", 2322706903u, 0, 8, &be_const_str_WEBCAM_DATA);
-be_define_const_str(WEBCAM_DATA, "WEBCAM_DATA", 1476954421u, 0, 11, NULL);
-be_define_const_str(IEM3000_RX, "IEM3000_RX", 1117811096u, 0, 10, &be_const_str_NEOPOOL_RX);
-be_define_const_str(NEOPOOL_RX, "NEOPOOL_RX", 1917974474u, 0, 10, &be_const_str_OUTPUT);
-be_define_const_str(OUTPUT, "OUTPUT", 1469629700u, 0, 6, &be_const_str_lv_msgbox);
-be_define_const_str(lv_msgbox, "lv_msgbox", 689085206u, 0, 9, NULL);
-be_define_const_str(has_arg, "has_arg", 424878688u, 0, 7, &be_const_str_lv_table);
-be_define_const_str(lv_table, "lv_table", 1675691020u, 0, 8, NULL);
-be_define_const_str(SSPI_MOSI, "SSPI_MOSI", 3745917497u, 0, 9, NULL);
-be_define_const_str(CSE7761_TX, "CSE7761_TX", 3354719142u, 0, 10, &be_const_str_P9813_DAT);
-be_define_const_str(P9813_DAT, "P9813_DAT", 778577052u, 0, 9, &be_const_str_WEBCAM_PWDN);
-be_define_const_str(WEBCAM_PWDN, "WEBCAM_PWDN", 2219597454u, 0, 11, &be_const_str_count);
-be_define_const_str(count, "count", 967958004u, 0, 5, NULL);
-be_define_const_str(LMT01, "LMT01", 2490623797u, 0, 5, &be_const_str_read8);
-be_define_const_str(read8, "read8", 2802788167u, 0, 5, NULL);
-be_define_const_str(PN532_RXD, "PN532_RXD", 1780093022u, 0, 9, &be_const_str_PZEM004_RX);
-be_define_const_str(PZEM004_RX, "PZEM004_RX", 3411153194u, 0, 10, &be_const_str__begin_transmission);
-be_define_const_str(_begin_transmission, "_begin_transmission", 2779461176u, 0, 19, &be_const_str_web_add_console_button);
-be_define_const_str(web_add_console_button, "web_add_console_button", 3481436192u, 0, 22, &be_const_str_web_add_handler);
-be_define_const_str(web_add_handler, "web_add_handler", 3990174962u, 0, 15, NULL);
-be_define_const_str(INPUT_PULLDOWN, "INPUT_PULLDOWN", 1172232591u, 0, 14, NULL);
-be_define_const_str(CSE7761_RX, "CSE7761_RX", 65423248u, 0, 10, &be_const_str_find);
-be_define_const_str(find, "find", 3186656602u, 0, 4, &be_const_str_break);
-be_define_const_str(break, "break", 3378807160u, 58, 5, NULL);
-be_define_const_str(NRG_SEL_INV, "NRG_SEL_INV", 3567431069u, 0, 11, NULL);
-be_define_const_str(ILI9488_CS, "ILI9488_CS", 2363112073u, 0, 10, &be_const_str_MCP39F5_RX);
-be_define_const_str(MCP39F5_RX, "MCP39F5_RX", 190458217u, 0, 10, &be_const_str_ROT1B);
-be_define_const_str(ROT1B, "ROT1B", 809932573u, 0, 5, NULL);
-be_define_const_str(opt_call, "()", 685372826u, 0, 2, &be_const_str_SOLAXX1_TX);
-be_define_const_str(SOLAXX1_TX, "SOLAXX1_TX", 903770840u, 0, 10, NULL);
-be_define_const_str(SHELLY_DIMMER_BOOT0, "SHELLY_DIMMER_BOOT0", 2948777716u, 0, 19, &be_const_str_WEBCAM_VSYNC);
-be_define_const_str(WEBCAM_VSYNC, "WEBCAM_VSYNC", 4032882166u, 0, 12, &be_const_str_tan);
-be_define_const_str(tan, "tan", 2633446552u, 0, 3, &be_const_str_web_send);
-be_define_const_str(web_send, "web_send", 2989941448u, 0, 8, NULL);
-be_define_const_str(LED1, "LED1", 21005825u, 0, 4, NULL);
-be_define_const_str(INPUT_PULLUP, "INPUT_PULLUP", 2912931654u, 0, 12, &be_const_str_chars_in_string);
-be_define_const_str(chars_in_string, "chars_in_string", 3148785132u, 0, 15, &be_const_str_else);
-be_define_const_str(else, "else", 3183434736u, 52, 4, &be_const_str_nil);
-be_define_const_str(nil, "nil", 228849900u, 63, 3, NULL);
-be_define_const_str(MAX31855CLK, "MAX31855CLK", 715977727u, 0, 11, NULL);
-be_define_const_str(SYMBOL_GPS, "SYMBOL_GPS", 3044165570u, 0, 10, &be_const_str_lv_draw_mask_map_param);
-be_define_const_str(lv_draw_mask_map_param, "lv_draw_mask_map_param", 1666886804u, 0, 22, NULL);
-be_define_const_str(SWT1_NP, "SWT1_NP", 4033043739u, 0, 7, &be_const_str_log);
-be_define_const_str(log, "log", 1062293841u, 0, 3, &be_const_str_read_bytes);
-be_define_const_str(read_bytes, "read_bytes", 3576733173u, 0, 10, NULL);
-be_define_const_str(dot_def, ".def", 4095748648u, 0, 4, &be_const_str_SYMBOL_CALL);
-be_define_const_str(SYMBOL_CALL, "SYMBOL_CALL", 1444504366u, 0, 11, NULL);
-be_define_const_str(DHT11, "DHT11", 367083569u, 0, 5, &be_const_str_NRG_CF1);
-be_define_const_str(NRG_CF1, "NRG_CF1", 3292534757u, 0, 7, &be_const_str_SYMBOL_MUTE);
-be_define_const_str(SYMBOL_MUTE, "SYMBOL_MUTE", 563116043u, 0, 11, NULL);
-be_define_const_str(ETH_PHY_POWER, "ETH_PHY_POWER", 487529454u, 0, 13, NULL);
-be_define_const_str(TFMINIPLUS_TX, "TFMINIPLUS_TX", 2527875337u, 0, 13, NULL);
-be_define_const_str(EPAPER29_CS, "EPAPER29_CS", 3916373594u, 0, 11, &be_const_str_lv_chart);
-be_define_const_str(lv_chart, "lv_chart", 2652494144u, 0, 8, &be_const_str_name);
+be_define_const_str(lv_tileview, "lv_tileview", 2419887973u, 0, 11, NULL);
+be_define_const_str(WEBCAM_HREF, "WEBCAM_HREF", 3161890024u, 0, 11, &be_const_str_fromstring);
+be_define_const_str(fromstring, "fromstring", 610302344u, 0, 10, NULL);
+be_define_const_str(DSB_OUT, "DSB_OUT", 732335085u, 0, 7, NULL);
+be_define_const_str(IEM3000_RX, "IEM3000_RX", 1117811096u, 0, 10, NULL);
+be_define_const_str(get_power, "get_power", 3009799377u, 0, 9, NULL);
+be_define_const_str(get_tasmota, "get_tasmota", 334356779u, 0, 11, &be_const_str_getbits);
+be_define_const_str(getbits, "getbits", 3094168979u, 0, 7, NULL);
+be_define_const_str(detect, "detect", 8884370u, 0, 6, NULL);
+be_define_const_str(lv_draw_mask_angle_param, "lv_draw_mask_angle_param", 4192166041u, 0, 24, NULL);
+be_define_const_str(SR04_ECHO, "SR04_ECHO", 1906909592u, 0, 9, &be_const_str_deinit);
+be_define_const_str(deinit, "deinit", 2345559592u, 0, 6, &be_const_str_name);
 be_define_const_str(name, "name", 2369371622u, 0, 4, NULL);
-be_define_const_str(event, "event", 4264611999u, 0, 5, NULL);
-be_define_const_str(ADC_JOY, "ADC_JOY", 1116943612u, 0, 7, &be_const_str_FALLING);
-be_define_const_str(FALLING, "FALLING", 2851701064u, 0, 7, &be_const_str_remove_cmd);
-be_define_const_str(remove_cmd, "remove_cmd", 3832315702u, 0, 10, NULL);
-be_define_const_str(CSE7766_RX, "CSE7766_RX", 1546766819u, 0, 10, &be_const_str_DYP_RX);
-be_define_const_str(DYP_RX, "DYP_RX", 2122310285u, 0, 6, &be_const_str_LEDLNK);
-be_define_const_str(LEDLNK, "LEDLNK", 2862810701u, 0, 6, NULL);
-be_define_const_str(IRSEND, "IRSEND", 184848336u, 0, 6, &be_const_str_lv_textarea);
+be_define_const_str(SAIR_RX, "SAIR_RX", 1273688713u, 0, 7, &be_const_str_lv_cb);
+be_define_const_str(lv_cb, "lv_cb", 1389787433u, 0, 5, &be_const_str_lv_linemeter);
+be_define_const_str(lv_linemeter, "lv_linemeter", 1413069363u, 0, 12, NULL);
+be_define_const_str(every_100ms, "every_100ms", 1546407804u, 0, 11, &be_const_str_stats);
+be_define_const_str(stats, "stats", 1781603564u, 0, 5, NULL);
+be_define_const_str(TFMINIPLUS_RX, "TFMINIPLUS_RX", 1522203935u, 0, 13, &be_const_str__drivers);
+be_define_const_str(_drivers, "_drivers", 3260328985u, 0, 8, &be_const_str__write);
+be_define_const_str(_write, "_write", 2215462825u, 0, 6, &be_const_str_abs);
+be_define_const_str(abs, "abs", 709362235u, 0, 3, NULL);
+be_define_const_str(KEY1_INV_NP, "KEY1_INV_NP", 3160558586u, 0, 11, NULL);
+be_define_const_str(display, "display", 1164572437u, 0, 7, NULL);
+be_define_const_str(OUTPUT_LO, "OUTPUT_LO", 3724620328u, 0, 9, &be_const_str_lv_draw_mask_common_dsc);
+be_define_const_str(lv_draw_mask_common_dsc, "lv_draw_mask_common_dsc", 1429224708u, 0, 23, NULL);
+be_define_const_str(AZ_TXD, "AZ_TXD", 850268709u, 0, 6, &be_const_str_lv_keyboard);
+be_define_const_str(lv_keyboard, "lv_keyboard", 197530229u, 0, 11, NULL);
+be_define_const_str(SYMBOL_PLAY, "SYMBOL_PLAY", 1750902100u, 0, 11, &be_const_str_for);
+be_define_const_str(for, "for", 2901640080u, 54, 3, NULL);
+be_define_const_str(SYMBOL_BATTERY_3, "SYMBOL_BATTERY_3", 662591301u, 0, 16, &be_const_str_bus);
+be_define_const_str(bus, "bus", 1607822841u, 0, 3, &be_const_str_lv_gauge);
+be_define_const_str(lv_gauge, "lv_gauge", 118613531u, 0, 8, &be_const_str_map);
+be_define_const_str(map, "map", 3751997361u, 0, 3, NULL);
+be_define_const_str(SYMBOL_PLUS, "SYMBOL_PLUS", 2860093262u, 0, 11, NULL);
+be_define_const_str(KEY1_INV, "KEY1_INV", 263542563u, 0, 8, &be_const_str_gamma10);
+be_define_const_str(gamma10, "gamma10", 3472052483u, 0, 7, &be_const_str_type);
+be_define_const_str(type, "type", 1361572173u, 0, 4, NULL);
+be_define_const_str(MIEL_HVAC_TX, "MIEL_HVAC_TX", 567403014u, 0, 12, &be_const_str_NRF24_CS);
+be_define_const_str(NRF24_CS, "NRF24_CS", 555833194u, 0, 8, &be_const_str_lv_textarea);
 be_define_const_str(lv_textarea, "lv_textarea", 2864635074u, 0, 11, NULL);
-be_define_const_str(RFSEND, "RFSEND", 1862630731u, 0, 6, &be_const_str_SSD1351_DC);
-be_define_const_str(SSD1351_DC, "SSD1351_DC", 84950353u, 0, 10, &be_const_str_SYMBOL_COPY);
-be_define_const_str(SYMBOL_COPY, "SYMBOL_COPY", 4193681815u, 0, 11, &be_const_str_SYMBOL_UP);
-be_define_const_str(SYMBOL_UP, "SYMBOL_UP", 3886401511u, 0, 9, NULL);
-be_define_const_str(TX2X_TXD_BLACK, "TX2X_TXD_BLACK", 956526176u, 0, 14, &be_const_str_json_append);
-be_define_const_str(json_append, "json_append", 3002019284u, 0, 11, NULL);
-be_define_const_str(TUYA_RX, "TUYA_RX", 1609397679u, 0, 7, NULL);
-be_define_const_str(HRE_DATA, "HRE_DATA", 1820377643u, 0, 8, NULL);
-be_define_const_str(DDSU666_RX, "DDSU666_RX", 1812507936u, 0, 10, &be_const_str_reverse_gamma10);
-be_define_const_str(reverse_gamma10, "reverse_gamma10", 739112262u, 0, 15, NULL);
-be_define_const_str(SM16716_SEL, "SM16716_SEL", 142377379u, 0, 11, &be_const_str_TASMOTACLIENT_RST_INV);
-be_define_const_str(TASMOTACLIENT_RST_INV, "TASMOTACLIENT_RST_INV", 2601785365u, 0, 21, &be_const_str_add_rule);
-be_define_const_str(add_rule, "add_rule", 596540743u, 0, 8, &be_const_str_resize);
-be_define_const_str(resize, "resize", 3514612129u, 0, 6, &be_const_str_resp_cmnd_error);
-be_define_const_str(resp_cmnd_error, "resp_cmnd_error", 2404088863u, 0, 15, NULL);
-be_define_const_str(ADC_BUTTON_INV, "ADC_BUTTON_INV", 2027625326u, 0, 14, &be_const_str_TASMOTACLIENT_TXD);
-be_define_const_str(TASMOTACLIENT_TXD, "TASMOTACLIENT_TXD", 1386193940u, 0, 17, NULL);
-be_define_const_str(MP3_DFR562, "MP3_DFR562", 2859952977u, 0, 10, &be_const_str_RC522_RST);
-be_define_const_str(RC522_RST, "RC522_RST", 720511443u, 0, 9, &be_const_str_SYMBOL_LEFT);
-be_define_const_str(SYMBOL_LEFT, "SYMBOL_LEFT", 1563517575u, 0, 11, NULL);
+be_define_const_str(CNTR1, "CNTR1", 510376965u, 0, 5, &be_const_str_SYMBOL_BATTERY_FULL);
+be_define_const_str(SYMBOL_BATTERY_FULL, "SYMBOL_BATTERY_FULL", 2638935545u, 0, 19, &be_const_str_content_flush);
+be_define_const_str(content_flush, "content_flush", 214922475u, 0, 13, &be_const_str_lv_objmask);
+be_define_const_str(lv_objmask, "lv_objmask", 1311221665u, 0, 10, NULL);
+be_define_const_str(TX2X_TXD_BLACK, "TX2X_TXD_BLACK", 956526176u, 0, 14, &be_const_str_WEBCAM_VSYNC);
+be_define_const_str(WEBCAM_VSYNC, "WEBCAM_VSYNC", 4032882166u, 0, 12, &be_const_str__timers);
+be_define_const_str(_timers, "_timers", 2600100916u, 0, 7, &be_const_str_button_pressed);
+be_define_const_str(button_pressed, "button_pressed", 1694209616u, 0, 14, &be_const_str_else);
+be_define_const_str(else, "else", 3183434736u, 52, 4, NULL);
+be_define_const_str(LMT01, "LMT01", 2490623797u, 0, 5, &be_const_str_WEBCAM_SIOC);
+be_define_const_str(WEBCAM_SIOC, "WEBCAM_SIOC", 218815147u, 0, 11, &be_const_str_lv_page);
+be_define_const_str(lv_page, "lv_page", 2373170067u, 0, 7, NULL);
+be_define_const_str(lv_btn, "lv_btn", 1612829968u, 0, 6, &be_const_str_rad);
 be_define_const_str(rad, "rad", 1358899048u, 0, 3, NULL);
-be_define_const_str(ARIRFSEL, "ARIRFSEL", 233874443u, 0, 8, &be_const_str_MHZ_TXD);
-be_define_const_str(MHZ_TXD, "MHZ_TXD", 3310158233u, 0, 7, &be_const_str_SAIR_TX);
-be_define_const_str(SAIR_TX, "SAIR_TX", 268017311u, 0, 7, &be_const_str_sinh);
-be_define_const_str(sinh, "sinh", 282220607u, 0, 4, NULL);
-be_define_const_str(lv_group_focus_cb, "lv_group_focus_cb", 4288873836u, 0, 17, NULL);
-be_define_const_str(SENSOR_END, "SENSOR_END", 3512542657u, 0, 10, &be_const_str_assert);
-be_define_const_str(assert, "assert", 2774883451u, 0, 6, &be_const_str_reverse);
-be_define_const_str(reverse, "reverse", 558918661u, 0, 7, NULL);
+be_define_const_str(iter, "iter", 3124256359u, 0, 4, &be_const_str_lv_draw_mask_saved);
+be_define_const_str(lv_draw_mask_saved, "lv_draw_mask_saved", 2063709159u, 0, 18, &be_const_str_lv_group);
+be_define_const_str(lv_group, "lv_group", 3852039019u, 0, 8, &be_const_str_lv_style);
+be_define_const_str(lv_style, "lv_style", 4151611549u, 0, 8, NULL);
+be_define_const_str(, "", 2166136261u, 0, 0, &be_const_str__events);
+be_define_const_str(_events, "_events", 4233070251u, 0, 7, &be_const_str_log);
+be_define_const_str(log, "log", 1062293841u, 0, 3, &be_const_str_real);
+be_define_const_str(real, "real", 3604983901u, 0, 4, NULL);
+be_define_const_str(OUTPUT_HI, "OUTPUT_HI", 3153592902u, 0, 9, &be_const_str_SYMBOL_BLUETOOTH);
+be_define_const_str(SYMBOL_BLUETOOTH, "SYMBOL_BLUETOOTH", 679376572u, 0, 16, &be_const_str__cmd);
+be_define_const_str(_cmd, "_cmd", 3419822142u, 0, 4, &be_const_str_web_add_console_button);
+be_define_const_str(web_add_console_button, "web_add_console_button", 3481436192u, 0, 22, NULL);
+be_define_const_str(__iterator__, "__iterator__", 3884039703u, 0, 12, NULL);
+be_define_const_str(DSB, "DSB", 98073254u, 0, 3, &be_const_str_size);
+be_define_const_str(size, "size", 597743964u, 0, 4, NULL);
+be_define_const_str(DEEPSLEEP, "DEEPSLEEP", 189922226u, 0, 9, &be_const_str_PULLDOWN);
+be_define_const_str(PULLDOWN, "PULLDOWN", 1853074086u, 0, 8, &be_const_str_codedump);
 be_define_const_str(codedump, "codedump", 1786337906u, 0, 8, NULL);
-be_define_const_str(CNTR1, "CNTR1", 510376965u, 0, 5, &be_const_str_lv_draw_mask_saved);
-be_define_const_str(lv_draw_mask_saved, "lv_draw_mask_saved", 2063709159u, 0, 18, &be_const_str_read);
+be_define_const_str(MCP39F5_RX, "MCP39F5_RX", 190458217u, 0, 10, &be_const_str_add_cron);
+be_define_const_str(add_cron, "add_cron", 2475327477u, 0, 8, NULL);
+be_define_const_str(ETH_PHY_MDIO, "ETH_PHY_MDIO", 3261871568u, 0, 12, &be_const_str_RDM6300_RX);
+be_define_const_str(RDM6300_RX, "RDM6300_RX", 1522345628u, 0, 10, &be_const_str_classname);
+be_define_const_str(classname, "classname", 1998589948u, 0, 9, NULL);
+be_define_const_str(SDM630_RX, "SDM630_RX", 1971606309u, 0, 9, &be_const_str_WE517_RX);
+be_define_const_str(WE517_RX, "WE517_RX", 4096577879u, 0, 8, &be_const_str_digital_write);
+be_define_const_str(digital_write, "digital_write", 3435877979u, 0, 13, NULL);
+be_define_const_str(TASMOTACLIENT_TXD, "TASMOTACLIENT_TXD", 1386193940u, 0, 17, &be_const_str_end);
+be_define_const_str(end, "end", 1787721130u, 56, 3, NULL);
+be_define_const_str(ZIGBEE_RST, "ZIGBEE_RST", 721588661u, 0, 10, &be_const_str__available);
+be_define_const_str(_available, "_available", 1306196581u, 0, 10, NULL);
+be_define_const_str(SYMBOL_MUTE, "SYMBOL_MUTE", 563116043u, 0, 11, &be_const_str___upper__);
+be_define_const_str(__upper__, "__upper__", 3612202883u, 0, 9, &be_const_str_resp_cmnd_error);
+be_define_const_str(resp_cmnd_error, "resp_cmnd_error", 2404088863u, 0, 15, NULL);
+be_define_const_str(lv_arc, "lv_arc", 4170125384u, 0, 6, &be_const_str_scale_uint);
+be_define_const_str(scale_uint, "scale_uint", 3090811094u, 0, 10, NULL);
+be_define_const_str(SYMBOL_SAVE, "SYMBOL_SAVE", 2439821015u, 0, 11, &be_const_str_WEBCAM_XCLK);
+be_define_const_str(WEBCAM_XCLK, "WEBCAM_XCLK", 536207425u, 0, 11, NULL);
+be_define_const_str(WEBCAM_PSCLK, "WEBCAM_PSCLK", 3150007456u, 0, 12, &be_const_str_resp_cmnd);
+be_define_const_str(resp_cmnd, "resp_cmnd", 2869459626u, 0, 9, NULL);
+be_define_const_str(REL1, "REL1", 3142397887u, 0, 4, &be_const_str_push);
+be_define_const_str(push, "push", 2272264157u, 0, 4, NULL);
+be_define_const_str(GPS_TX, "GPS_TX", 4228740808u, 0, 6, &be_const_str_HPMA_RX);
+be_define_const_str(HPMA_RX, "HPMA_RX", 3462528998u, 0, 7, &be_const_str_number);
+be_define_const_str(number, "number", 467038368u, 0, 6, NULL);
+be_define_const_str(CSE7766_RX, "CSE7766_RX", 1546766819u, 0, 10, &be_const_str_SYMBOL_DIRECTORY);
+be_define_const_str(SYMBOL_DIRECTORY, "SYMBOL_DIRECTORY", 1886053449u, 0, 16, NULL);
+be_define_const_str(HX711_DAT, "HX711_DAT", 2935118250u, 0, 9, &be_const_str_WEBCAM_RESET);
+be_define_const_str(WEBCAM_RESET, "WEBCAM_RESET", 2171221520u, 0, 12, &be_const_str_WIEGAND_D1);
+be_define_const_str(WIEGAND_D1, "WIEGAND_D1", 4175558140u, 0, 10, &be_const_str_ceil);
+be_define_const_str(ceil, "ceil", 1659167240u, 0, 4, NULL);
+be_define_const_str(SM2135_CLK, "SM2135_CLK", 2383410011u, 0, 10, &be_const_str_TM1637DIO);
+be_define_const_str(TM1637DIO, "TM1637DIO", 1574659381u, 0, 9, &be_const_str_floor);
+be_define_const_str(floor, "floor", 3102149661u, 0, 5, NULL);
+be_define_const_str(chars_in_string, "chars_in_string", 3148785132u, 0, 15, &be_const_str_lv_design_cb);
+be_define_const_str(lv_design_cb, "lv_design_cb", 3822640502u, 0, 12, NULL);
+be_define_const_str(SDS0X1_TX, "SDS0X1_TX", 165045983u, 0, 9, &be_const_str_SSD1351_DC);
+be_define_const_str(SSD1351_DC, "SSD1351_DC", 84950353u, 0, 10, NULL);
+be_define_const_str(cos, "cos", 4220379804u, 0, 3, NULL);
+be_define_const_str(get, "get", 1410115415u, 0, 3, NULL);
+be_define_const_str(KEY1_NP, "KEY1_NP", 709918726u, 0, 7, NULL);
+be_define_const_str(_cb, "_cb", 4043300367u, 0, 3, &be_const_str_lv_draw_mask_map_param_cfg);
+be_define_const_str(lv_draw_mask_map_param_cfg, "lv_draw_mask_map_param_cfg", 3822900597u, 0, 26, NULL);
+be_define_const_str(dot_def, ".def", 4095748648u, 0, 4, &be_const_str_SYMBOL_TRASH);
+be_define_const_str(SYMBOL_TRASH, "SYMBOL_TRASH", 3169100368u, 0, 12, &be_const_str_has_arg);
+be_define_const_str(has_arg, "has_arg", 424878688u, 0, 7, &be_const_str_web_send);
+be_define_const_str(web_send, "web_send", 2989941448u, 0, 8, NULL);
+be_define_const_str(TUYA_RX, "TUYA_RX", 1609397679u, 0, 7, &be_const_str_lv_btnmatrix);
+be_define_const_str(lv_btnmatrix, "lv_btnmatrix", 626248489u, 0, 12, NULL);
+be_define_const_str(DCKI, "DCKI", 3846847480u, 0, 4, &be_const_str_SYMBOL_DOWN);
+be_define_const_str(SYMBOL_DOWN, "SYMBOL_DOWN", 1107513570u, 0, 11, &be_const_str_asin);
+be_define_const_str(asin, "asin", 4272848550u, 0, 4, &be_const_str_pin_mode);
+be_define_const_str(pin_mode, "pin_mode", 3258314030u, 0, 8, NULL);
+be_define_const_str(lv_cpicker, "lv_cpicker", 1935129251u, 0, 10, &be_const_str_reverse);
+be_define_const_str(reverse, "reverse", 558918661u, 0, 7, NULL);
+be_define_const_str(find, "find", 3186656602u, 0, 4, NULL);
+be_define_const_str(EXS_ENABLE, "EXS_ENABLE", 1896914313u, 0, 10, &be_const_str_step);
+be_define_const_str(step, "step", 3343129103u, 0, 4, NULL);
+be_define_const_str(NEOPOOL_RX, "NEOPOOL_RX", 1917974474u, 0, 10, &be_const_str_clear);
+be_define_const_str(clear, "clear", 1550717474u, 0, 5, &be_const_str_montserrat_font);
+be_define_const_str(montserrat_font, "montserrat_font", 1819065874u, 0, 15, NULL);
+be_define_const_str(KEY1, "KEY1", 6715975u, 0, 4, NULL);
+be_define_const_str(rtc, "rtc", 1070575216u, 0, 3, &be_const_str_toupper);
+be_define_const_str(toupper, "toupper", 3691983576u, 0, 7, NULL);
+be_define_const_str(WE517_TX, "WE517_TX", 2954817217u, 0, 8, NULL);
+be_define_const_str(SSD1331_CS, "SSD1331_CS", 4191047928u, 0, 10, NULL);
+be_define_const_str(LE01MR_RX, "LE01MR_RX", 1521590809u, 0, 9, NULL);
+be_define_const_str(opt_add, "+", 772578730u, 0, 1, &be_const_str_IEM3000_TX);
+be_define_const_str(IEM3000_TX, "IEM3000_TX", 1185907310u, 0, 10, &be_const_str_PWM1_INV);
+be_define_const_str(PWM1_INV, "PWM1_INV", 3939021030u, 0, 8, &be_const_str_add);
+be_define_const_str(add, "add", 993596020u, 0, 3, NULL);
+be_define_const_str(ETH_PHY_MDC, "ETH_PHY_MDC", 1519379581u, 0, 11, &be_const_str_ILI9341_CS);
+be_define_const_str(ILI9341_CS, "ILI9341_CS", 3519318851u, 0, 10, &be_const_str_INPUT_PULLDOWN);
+be_define_const_str(INPUT_PULLDOWN, "INPUT_PULLDOWN", 1172232591u, 0, 14, &be_const_str_SYMBOL_IMAGE);
+be_define_const_str(SYMBOL_IMAGE, "SYMBOL_IMAGE", 815601151u, 0, 12, NULL);
+be_define_const_str(format, "format", 3114108242u, 0, 6, &be_const_str_lv_cont);
+be_define_const_str(lv_cont, "lv_cont", 1391686552u, 0, 7, &be_const_str_save);
+be_define_const_str(save, "save", 3439296072u, 0, 4, NULL);
+be_define_const_str(RC522_RST, "RC522_RST", 720511443u, 0, 9, NULL);
+be_define_const_str(HPMA_TX, "HPMA_TX", 173233104u, 0, 7, &be_const_str_SYMBOL_SD_CARD);
+be_define_const_str(SYMBOL_SD_CARD, "SYMBOL_SD_CARD", 2542376484u, 0, 14, &be_const_str_WEBCAM_HSD);
+be_define_const_str(WEBCAM_HSD, "WEBCAM_HSD", 2648502504u, 0, 10, NULL);
+be_define_const_str(NRG_SEL, "NRG_SEL", 1771358125u, 0, 7, NULL);
+be_define_const_str(insert, "insert", 3332609576u, 0, 6, &be_const_str_scan);
+be_define_const_str(scan, "scan", 3974641896u, 0, 4, &be_const_str_setitem);
+be_define_const_str(setitem, "setitem", 1554834596u, 0, 7, &be_const_str_super);
+be_define_const_str(super, "super", 4152230356u, 0, 5, NULL);
+be_define_const_str(time_dump, "time_dump", 3330410747u, 0, 9, NULL);
+be_define_const_str(dot_p, ".p", 1171526419u, 0, 2, &be_const_str_ADC_CT_POWER);
+be_define_const_str(ADC_CT_POWER, "ADC_CT_POWER", 3382284599u, 0, 12, &be_const_str_NONE);
+be_define_const_str(NONE, "NONE", 1932136219u, 0, 4, &be_const_str_resize);
+be_define_const_str(resize, "resize", 3514612129u, 0, 6, &be_const_str_wire1);
+be_define_const_str(wire1, "wire1", 3212721419u, 0, 5, NULL);
+be_define_const_str(nil, "nil", 228849900u, 63, 3, NULL);
+be_define_const_str(add_driver, "add_driver", 1654458371u, 0, 10, NULL);
+be_define_const_str(HM10_RX, "HM10_RX", 515085922u, 0, 7, NULL);
+be_define_const_str(SM16716_CLK, "SM16716_CLK", 3037641483u, 0, 11, &be_const_str_byte);
+be_define_const_str(byte, "byte", 1683620383u, 0, 4, &be_const_str_pow);
+be_define_const_str(pow, "pow", 1479764693u, 0, 3, NULL);
+be_define_const_str(SPI_MOSI, "SPI_MOSI", 2494218614u, 0, 8, NULL);
+be_define_const_str(OLED_RESET, "OLED_RESET", 4048987655u, 0, 10, &be_const_str_SSPI_CS);
+be_define_const_str(SSPI_CS, "SSPI_CS", 977784795u, 0, 7, NULL);
+be_define_const_str(SYMBOL_CALL, "SYMBOL_CALL", 1444504366u, 0, 11, &be_const_str_lv_msgbox);
+be_define_const_str(lv_msgbox, "lv_msgbox", 689085206u, 0, 9, NULL);
+be_define_const_str(SYMBOL_POWER, "SYMBOL_POWER", 1125993627u, 0, 12, &be_const_str_content_send_style);
+be_define_const_str(content_send_style, "content_send_style", 1087907647u, 0, 18, NULL);
+be_define_const_str(I2C_Driver, "I2C_Driver", 1714501658u, 0, 10, &be_const_str_addr);
+be_define_const_str(addr, "addr", 1087856498u, 0, 4, NULL);
+be_define_const_str(SWT1_NP, "SWT1_NP", 4033043739u, 0, 7, &be_const_str_atan);
+be_define_const_str(atan, "atan", 108579519u, 0, 4, &be_const_str_lv_bar);
+be_define_const_str(lv_bar, "lv_bar", 1582673229u, 0, 6, &be_const_str_read);
 be_define_const_str(read, "read", 3470762949u, 0, 4, NULL);
-be_define_const_str(DDS2382_TX, "DDS2382_TX", 1438117864u, 0, 10, &be_const_str_ROT1B_NP);
-be_define_const_str(ROT1B_NP, "ROT1B_NP", 3710079736u, 0, 8, NULL);
-be_define_const_str(SSPI_MISO, "SSPI_MISO", 2485347173u, 0, 9, &be_const_str___upper__);
-be_define_const_str(__upper__, "__upper__", 3612202883u, 0, 9, NULL);
-be_define_const_str(pop, "pop", 1362321360u, 0, 3, NULL);
-be_define_const_str(SDCARD_CS, "SDCARD_CS", 3348952003u, 0, 9, &be_const_str__write);
-be_define_const_str(_write, "_write", 2215462825u, 0, 6, &be_const_str_lv_draw_mask_line_param_cfg);
-be_define_const_str(lv_draw_mask_line_param_cfg, "lv_draw_mask_line_param_cfg", 2154874825u, 0, 27, &be_const_str_setmember);
+be_define_const_str(ADC_TEMP, "ADC_TEMP", 3771053440u, 0, 8, NULL);
+be_define_const_str(SPI_DC, "SPI_DC", 553259951u, 0, 6, &be_const_str_gc);
+be_define_const_str(gc, "gc", 1042313471u, 0, 2, &be_const_str_lv_spinner);
+be_define_const_str(lv_spinner, "lv_spinner", 3361501901u, 0, 10, &be_const_str_setmember);
 be_define_const_str(setmember, "setmember", 1432909441u, 0, 9, NULL);
-be_define_const_str(I2C_Driver, "I2C_Driver", 1714501658u, 0, 10, &be_const_str_addr);
-be_define_const_str(addr, "addr", 1087856498u, 0, 4, &be_const_str_find_key_i);
-be_define_const_str(find_key_i, "find_key_i", 850136726u, 0, 10, NULL);
-be_define_const_str(BOILER_OT_TX, "BOILER_OT_TX", 671743623u, 0, 12, &be_const_str_P9813_CLK);
-be_define_const_str(P9813_CLK, "P9813_CLK", 2455391001u, 0, 9, &be_const_str_lv_area);
-be_define_const_str(lv_area, "lv_area", 2521150401u, 0, 7, &be_const_str_split);
-be_define_const_str(split, "split", 2276994531u, 0, 5, NULL);
-be_define_const_str(CHANGE, "CHANGE", 4280911421u, 0, 6, &be_const_str_SM2135_CLK);
-be_define_const_str(SM2135_CLK, "SM2135_CLK", 2383410011u, 0, 10, &be_const_str_ZEROCROSS);
-be_define_const_str(ZEROCROSS, "ZEROCROSS", 1747596785u, 0, 9, &be_const_str_i2c_enabled);
-be_define_const_str(i2c_enabled, "i2c_enabled", 218388101u, 0, 11, &be_const_str_lv_color);
-be_define_const_str(lv_color, "lv_color", 1419148319u, 0, 8, &be_const_str_wire1);
-be_define_const_str(wire1, "wire1", 3212721419u, 0, 5, NULL);
-be_define_const_str(lv_draw_rect_dsc, "lv_draw_rect_dsc", 3246772488u, 0, 16, &be_const_str_seti);
-be_define_const_str(seti, "seti", 1500556254u, 0, 4, NULL);
-be_define_const_str(ST7789_DC, "ST7789_DC", 2533509745u, 0, 9, NULL);
+be_define_const_str(MCP39F5_RST, "MCP39F5_RST", 3657125652u, 0, 11, &be_const_str_exec_rules);
+be_define_const_str(exec_rules, "exec_rules", 1445221092u, 0, 10, &be_const_str_load_freetype_font);
+be_define_const_str(load_freetype_font, "load_freetype_font", 2368447592u, 0, 18, &be_const_str_web_sensor);
+be_define_const_str(web_sensor, "web_sensor", 2900096972u, 0, 10, NULL);
+be_define_const_str(NEOPOOL_TX, "NEOPOOL_TX", 2924925804u, 0, 10, &be_const_str_attrdump);
+be_define_const_str(attrdump, "attrdump", 1521571304u, 0, 8, NULL);
+be_define_const_str(opt_connect, "..", 2748622605u, 0, 2, NULL);
+be_define_const_str(find_key_i, "find_key_i", 850136726u, 0, 10, &be_const_str_var);
 be_define_const_str(var, "var", 2317739966u, 64, 3, NULL);
-be_define_const_str(MCP39F5_TX, "MCP39F5_TX", 1332322047u, 0, 10, &be_const_str__ccmd);
-be_define_const_str(_ccmd, "_ccmd", 2163421413u, 0, 5, NULL);
-be_define_const_str(AS608_TX, "AS608_TX", 48630934u, 0, 8, &be_const_str_TM1638CLK);
-be_define_const_str(TM1638CLK, "TM1638CLK", 3045182446u, 0, 9, NULL);
-be_define_const_str(get_free_heap, "get_free_heap", 625069757u, 0, 13, &be_const_str_lv_keyboard);
-be_define_const_str(lv_keyboard, "lv_keyboard", 197530229u, 0, 11, &be_const_str_elif);
-be_define_const_str(elif, "elif", 3232090307u, 51, 4, NULL);
-be_define_const_str(KEY1, "KEY1", 6715975u, 0, 4, &be_const_str_LE01MR_TX);
-be_define_const_str(LE01MR_TX, "LE01MR_TX", 1589687023u, 0, 9, &be_const_str_lv_tileview);
-be_define_const_str(lv_tileview, "lv_tileview", 2419887973u, 0, 11, &be_const_str_class);
-be_define_const_str(class, "class", 2872970239u, 57, 5, NULL);
-be_define_const_str(BUZZER_INV, "BUZZER_INV", 3274564335u, 0, 10, NULL);
-be_define_const_str(lv_roller, "lv_roller", 661902064u, 0, 9, NULL);
-be_define_const_str(ADC_CT_POWER, "ADC_CT_POWER", 3382284599u, 0, 12, NULL);
-be_define_const_str(asstring, "asstring", 1298225088u, 0, 8, &be_const_str_lv_draw_mask_angle_param_cfg);
-be_define_const_str(lv_draw_mask_angle_param_cfg, "lv_draw_mask_angle_param_cfg", 3599767368u, 0, 28, &be_const_str_save);
-be_define_const_str(save, "save", 3439296072u, 0, 4, &be_const_str_size);
-be_define_const_str(size, "size", 597743964u, 0, 4, NULL);
-be_define_const_str(NONE, "NONE", 1932136219u, 0, 4, NULL);
-be_define_const_str(exp, "exp", 1923516200u, 0, 3, &be_const_str_on);
-be_define_const_str(on, "on", 1630810064u, 0, 2, NULL);
-be_define_const_str(BL0940_RX, "BL0940_RX", 2908993179u, 0, 9, &be_const_str_WIEGAND_D0);
-be_define_const_str(WIEGAND_D0, "WIEGAND_D0", 4192335759u, 0, 10, NULL);
-be_define_const_str(check_privileged_access, "check_privileged_access", 3692933968u, 0, 23, &be_const_str_lv_indev);
-be_define_const_str(lv_indev, "lv_indev", 225602374u, 0, 8, NULL);
-be_define_const_str(opt_eq, "==", 2431966415u, 0, 2, &be_const_str_TFMINIPLUS_RX);
-be_define_const_str(TFMINIPLUS_RX, "TFMINIPLUS_RX", 1522203935u, 0, 13, NULL);
-be_define_const_str(PULLDOWN, "PULLDOWN", 1853074086u, 0, 8, NULL);
-be_define_const_str(, "", 2166136261u, 0, 0, &be_const_str_arg_name);
-be_define_const_str(arg_name, "arg_name", 1345046155u, 0, 8, &be_const_str_screenshot);
-be_define_const_str(screenshot, "screenshot", 3894592561u, 0, 10, &be_const_str_setbits);
-be_define_const_str(setbits, "setbits", 2762408167u, 0, 7, NULL);
-be_define_const_str(SYMBOL_LOOP, "SYMBOL_LOOP", 2762053208u, 0, 11, NULL);
-be_define_const_str(MHZ_RXD, "MHZ_RXD", 328619727u, 0, 7, &be_const_str_get_power);
-be_define_const_str(get_power, "get_power", 3009799377u, 0, 9, &be_const_str_lv_font);
-be_define_const_str(lv_font, "lv_font", 1550958453u, 0, 7, NULL);
-be_define_const_str(BACKLIGHT, "BACKLIGHT", 3147761926u, 0, 9, &be_const_str_BS814_CLK);
-be_define_const_str(BS814_CLK, "BS814_CLK", 3002713336u, 0, 9, NULL);
-be_define_const_str(PULLUP, "PULLUP", 3417628531u, 0, 6, &be_const_str_TM1637DIO);
-be_define_const_str(TM1637DIO, "TM1637DIO", 1574659381u, 0, 9, &be_const_str_lv_btnmatrix);
-be_define_const_str(lv_btnmatrix, "lv_btnmatrix", 626248489u, 0, 12, NULL);
-be_define_const_str(SR04_ECHO, "SR04_ECHO", 1906909592u, 0, 9, NULL);
-be_define_const_str(ADE7953_IRQ, "ADE7953_IRQ", 2329185922u, 0, 11, &be_const_str_classname);
-be_define_const_str(classname, "classname", 1998589948u, 0, 9, &be_const_str_str);
+be_define_const_str(_bec_valid, "_bec_valid", 1607346137u, 0, 10, NULL);
+be_define_const_str(save_before_restart, "save_before_restart", 1253239338u, 0, 19, NULL);
+be_define_const_str(DHT11, "DHT11", 367083569u, 0, 5, NULL);
+be_define_const_str(import, "import", 288002260u, 66, 6, NULL);
+be_define_const_str(opt_neq, "!=", 2428715011u, 0, 2, NULL);
+be_define_const_str(PN532_RXD, "PN532_RXD", 1780093022u, 0, 9, &be_const_str_SYMBOL_EDIT);
+be_define_const_str(SYMBOL_EDIT, "SYMBOL_EDIT", 1396182822u, 0, 11, &be_const_str_str);
 be_define_const_str(str, "str", 3259748752u, 0, 3, NULL);
-be_define_const_str(SYMBOL_PREV, "SYMBOL_PREV", 2952615023u, 0, 11, &be_const_str_add_driver);
-be_define_const_str(add_driver, "add_driver", 1654458371u, 0, 10, &be_const_str_content_button);
-be_define_const_str(content_button, "content_button", 1956476087u, 0, 14, NULL);
-be_define_const_str(HX711_DAT, "HX711_DAT", 2935118250u, 0, 9, NULL);
-be_define_const_str(dot_p, ".p", 1171526419u, 0, 2, &be_const_str_content_stop);
-be_define_const_str(content_stop, "content_stop", 658554751u, 0, 12, NULL);
-be_define_const_str(GPS_RX, "GPS_RX", 1075637342u, 0, 6, &be_const_str_HX711_SCK);
-be_define_const_str(HX711_SCK, "HX711_SCK", 3785979404u, 0, 9, &be_const_str_RDM6300_RX);
-be_define_const_str(RDM6300_RX, "RDM6300_RX", 1522345628u, 0, 10, NULL);
-be_define_const_str(AZ_RXD, "AZ_RXD", 699914019u, 0, 6, NULL);
-be_define_const_str(Tasmota, "Tasmota", 4047617668u, 0, 7, &be_const_str_ZIGBEE_RX);
-be_define_const_str(ZIGBEE_RX, "ZIGBEE_RX", 93215470u, 0, 9, &be_const_str_imax);
-be_define_const_str(imax, "imax", 3084515410u, 0, 4, &be_const_str_montserrat_font);
-be_define_const_str(montserrat_font, "montserrat_font", 1819065874u, 0, 15, NULL);
-be_define_const_str(srand, "srand", 465518633u, 0, 5, &be_const_str_time_reached);
-be_define_const_str(time_reached, "time_reached", 2075136773u, 0, 12, &be_const_str_try_rule);
-be_define_const_str(try_rule, "try_rule", 1986449405u, 0, 8, NULL);
-be_define_const_str(LOW, "LOW", 3526092385u, 0, 3, &be_const_str_SDM120_TX);
-be_define_const_str(SDM120_TX, "SDM120_TX", 2509332415u, 0, 9, &be_const_str_SYMBOL_BELL);
-be_define_const_str(SYMBOL_BELL, "SYMBOL_BELL", 1736196487u, 0, 11, &be_const_str_tostring);
-be_define_const_str(tostring, "tostring", 2299708645u, 0, 8, NULL);
-be_define_const_str(DDS2382_RX, "DDS2382_RX", 432446462u, 0, 10, &be_const_str_HRXL_RX);
-be_define_const_str(HRXL_RX, "HRXL_RX", 92702006u, 0, 7, &be_const_str_button_pressed);
-be_define_const_str(button_pressed, "button_pressed", 1694209616u, 0, 14, &be_const_str_lv_arc);
-be_define_const_str(lv_arc, "lv_arc", 4170125384u, 0, 6, NULL);
-be_define_const_str(SDM120_RX, "SDM120_RX", 1367571753u, 0, 9, &be_const_str_SYMBOL_POWER);
-be_define_const_str(SYMBOL_POWER, "SYMBOL_POWER", 1125993627u, 0, 12, &be_const_str_list);
-be_define_const_str(list, "list", 217798785u, 0, 4, &be_const_str_lv_bar);
-be_define_const_str(lv_bar, "lv_bar", 1582673229u, 0, 6, &be_const_str_lv_linemeter);
-be_define_const_str(lv_linemeter, "lv_linemeter", 1413069363u, 0, 12, &be_const_str_lv_page);
-be_define_const_str(lv_page, "lv_page", 2373170067u, 0, 7, &be_const_str_upper);
-be_define_const_str(upper, "upper", 176974407u, 0, 5, NULL);
-be_define_const_str(wire_scan, "wire_scan", 2671275880u, 0, 9, NULL);
-be_define_const_str(SBR_RX, "SBR_RX", 3350999801u, 0, 6, &be_const_str_gamma10);
-be_define_const_str(gamma10, "gamma10", 3472052483u, 0, 7, NULL);
-be_define_const_str(PWM1_INV, "PWM1_INV", 3939021030u, 0, 8, &be_const_str_exec_rules);
-be_define_const_str(exec_rules, "exec_rules", 1445221092u, 0, 10, NULL);
-be_define_const_str(ETH_PHY_MDC, "ETH_PHY_MDC", 1519379581u, 0, 11, &be_const_str_content_send_style);
-be_define_const_str(content_send_style, "content_send_style", 1087907647u, 0, 18, NULL);
+be_define_const_str(incremental, "incremental", 1052946483u, 0, 11, &be_const_str_millis);
+be_define_const_str(millis, "millis", 1214679063u, 0, 6, NULL);
+be_define_const_str(PZEM0XX_TX, "PZEM0XX_TX", 944775704u, 0, 10, &be_const_str_web_add_main_button);
+be_define_const_str(web_add_main_button, "web_add_main_button", 3960367664u, 0, 19, &be_const_str_if);
+be_define_const_str(if, "if", 959999494u, 50, 2, NULL);
+be_define_const_str(IBEACON_RX, "IBEACON_RX", 2466155575u, 0, 10, &be_const_str_LOW);
+be_define_const_str(LOW, "LOW", 3526092385u, 0, 3, &be_const_str_PZEM016_RX);
+be_define_const_str(PZEM016_RX, "PZEM016_RX", 1004012055u, 0, 10, &be_const_str_arg_name);
+be_define_const_str(arg_name, "arg_name", 1345046155u, 0, 8, &be_const_str_collect);
+be_define_const_str(collect, "collect", 2399039025u, 0, 7, &be_const_str_web_add_config_button);
+be_define_const_str(web_add_config_button, "web_add_config_button", 639674325u, 0, 21, NULL);
 be_define_const_str(run_deferred, "run_deferred", 371594696u, 0, 12, NULL);
-be_define_const_str(SYMBOL_REFRESH, "SYMBOL_REFRESH", 1266229761u, 0, 14, NULL);
-be_define_const_str(TASMOTACLIENT_RXD, "TASMOTACLIENT_RXD", 72868318u, 0, 17, &be_const_str_WS2812);
-be_define_const_str(WS2812, "WS2812", 3539741218u, 0, 6, NULL);
-be_define_const_str(PROJECTOR_CTRL_TX, "PROJECTOR_CTRL_TX", 535811130u, 0, 17, &be_const_str_lv_line);
-be_define_const_str(lv_line, "lv_line", 2692732914u, 0, 7, NULL);
-be_define_const_str(SYMBOL_VOLUME_MAX, "SYMBOL_VOLUME_MAX", 3582646093u, 0, 17, NULL);
-be_define_const_str(MAX7219CLK, "MAX7219CLK", 963568838u, 0, 10, &be_const_str_RF_SENSOR);
-be_define_const_str(RF_SENSOR, "RF_SENSOR", 2289628100u, 0, 9, NULL);
-be_define_const_str(WEBCAM_PCLK, "WEBCAM_PCLK", 3813770649u, 0, 11, &be_const_str_lv_imgbtn);
-be_define_const_str(lv_imgbtn, "lv_imgbtn", 2402844429u, 0, 9, NULL);
-be_define_const_str(try, "try", 2887626766u, 68, 3, NULL);
-be_define_const_str(EPD_DATA, "EPD_DATA", 3799141097u, 0, 8, &be_const_str_cb_dispatch);
-be_define_const_str(cb_dispatch, "cb_dispatch", 1741510499u, 0, 11, NULL);
-be_define_const_str(ADC_PH, "ADC_PH", 3820290594u, 0, 6, &be_const_str_DHT11_OUT);
-be_define_const_str(DHT11_OUT, "DHT11_OUT", 1645300734u, 0, 9, &be_const_str_SYMBOL_RIGHT);
-be_define_const_str(SYMBOL_RIGHT, "SYMBOL_RIGHT", 2984010648u, 0, 12, NULL);
-be_define_const_str(IBEACON_TX, "IBEACON_TX", 3471826977u, 0, 10, &be_const_str_gen_cb);
-be_define_const_str(gen_cb, "gen_cb", 3245227551u, 0, 6, &be_const_str_open);
+be_define_const_str(MAX31855CLK, "MAX31855CLK", 715977727u, 0, 11, &be_const_str_TFMINIPLUS_TX);
+be_define_const_str(TFMINIPLUS_TX, "TFMINIPLUS_TX", 2527875337u, 0, 13, NULL);
+be_define_const_str(I2C_SCL, "I2C_SCL", 164217098u, 0, 7, &be_const_str_MAX7219CLK);
+be_define_const_str(MAX7219CLK, "MAX7219CLK", 963568838u, 0, 10, &be_const_str_lv_list);
+be_define_const_str(lv_list, "lv_list", 2876551248u, 0, 7, NULL);
+be_define_const_str(add_cmd, "add_cmd", 3361630879u, 0, 7, &be_const_str_issubclass);
+be_define_const_str(issubclass, "issubclass", 4078395519u, 0, 10, &be_const_str_sqrt);
+be_define_const_str(sqrt, "sqrt", 2112764879u, 0, 4, NULL);
+be_define_const_str(pin, "pin", 1866532500u, 0, 3, NULL);
+be_define_const_str(DDS2382_RX, "DDS2382_RX", 432446462u, 0, 10, &be_const_str_HM10_TX);
+be_define_const_str(HM10_TX, "HM10_TX", 1522037252u, 0, 7, &be_const_str_tanh);
+be_define_const_str(tanh, "tanh", 153638352u, 0, 4, NULL);
+be_define_const_str(SYMBOL_BATTERY_1, "SYMBOL_BATTERY_1", 629036063u, 0, 16, &be_const_str_SYMBOL_PREV);
+be_define_const_str(SYMBOL_PREV, "SYMBOL_PREV", 2952615023u, 0, 11, &be_const_str_time_reached);
+be_define_const_str(time_reached, "time_reached", 2075136773u, 0, 12, NULL);
+be_define_const_str(lv_indev, "lv_indev", 225602374u, 0, 8, NULL);
+be_define_const_str(SYMBOL_SETTINGS, "SYMBOL_SETTINGS", 339656335u, 0, 15, NULL);
+be_define_const_str(INPUT, "INPUT", 1638025307u, 0, 5, &be_const_str_open);
 be_define_const_str(open, "open", 3546203337u, 0, 4, NULL);
-be_define_const_str(OLED_RESET, "OLED_RESET", 4048987655u, 0, 10, &be_const_str_lv_cpicker);
-be_define_const_str(lv_cpicker, "lv_cpicker", 1935129251u, 0, 10, NULL);
-be_define_const_str(scan, "scan", 3974641896u, 0, 4, &be_const_str_toupper);
-be_define_const_str(toupper, "toupper", 3691983576u, 0, 7, NULL);
-be_define_const_str(SDS0X1_RX, "SDS0X1_RX", 1170717385u, 0, 9, &be_const_str_content_send);
-be_define_const_str(content_send, "content_send", 1673733649u, 0, 12, &be_const_str_lv_group);
-be_define_const_str(lv_group, "lv_group", 3852039019u, 0, 8, NULL);
-be_define_const_str(AS608_RX, "AS608_RX", 4275502016u, 0, 8, &be_const_str_SYMBOL_CHARGE);
-be_define_const_str(SYMBOL_CHARGE, "SYMBOL_CHARGE", 2106391946u, 0, 13, &be_const_str_get_light);
-be_define_const_str(get_light, "get_light", 381930476u, 0, 9, &be_const_str_load_freetype_font);
-be_define_const_str(load_freetype_font, "load_freetype_font", 2368447592u, 0, 18, &be_const_str_setitem);
-be_define_const_str(setitem, "setitem", 1554834596u, 0, 7, NULL);
-be_define_const_str(opt_connect, "..", 2748622605u, 0, 2, &be_const_str_SDM72_TX);
-be_define_const_str(SDM72_TX, "SDM72_TX", 2042143269u, 0, 8, &be_const_str_SYMBOL_VOLUME_MID);
-be_define_const_str(SYMBOL_VOLUME_MID, "SYMBOL_VOLUME_MID", 158835057u, 0, 17, &be_const_str_TELEINFO_ENABLE);
-be_define_const_str(TELEINFO_ENABLE, "TELEINFO_ENABLE", 1600974501u, 0, 15, &be_const_str_collect);
-be_define_const_str(collect, "collect", 2399039025u, 0, 7, NULL);
-be_define_const_str(_timers, "_timers", 2600100916u, 0, 7, &be_const_str_add);
-be_define_const_str(add, "add", 993596020u, 0, 3, &be_const_str_isinstance);
-be_define_const_str(isinstance, "isinstance", 3669352738u, 0, 10, &be_const_str_rtc);
-be_define_const_str(rtc, "rtc", 1070575216u, 0, 3, NULL);
-be_define_const_str(lv_draw_img_dsc, "lv_draw_img_dsc", 999847907u, 0, 15, NULL);
-be_define_const_str(HIGH, "HIGH", 2066738941u, 0, 4, &be_const_str_add_cmd);
-be_define_const_str(add_cmd, "add_cmd", 3361630879u, 0, 7, &be_const_str_erase);
-be_define_const_str(erase, "erase", 1010949589u, 0, 5, &be_const_str_as);
-be_define_const_str(as, "as", 1579491469u, 67, 2, NULL);
-be_define_const_str(DSB, "DSB", 98073254u, 0, 3, &be_const_str_KEY1_INV_NP);
-be_define_const_str(KEY1_INV_NP, "KEY1_INV_NP", 3160558586u, 0, 11, &be_const_str___lower__);
-be_define_const_str(__lower__, "__lower__", 123855590u, 0, 9, &be_const_str_set_light);
-be_define_const_str(set_light, "set_light", 3176076152u, 0, 9, NULL);
-be_define_const_str(ARIRFRCV, "ARIRFRCV", 1120816444u, 0, 8, &be_const_str_KEY1_NP);
-be_define_const_str(KEY1_NP, "KEY1_NP", 709918726u, 0, 7, &be_const_str_WIEGAND_D1);
-be_define_const_str(WIEGAND_D1, "WIEGAND_D1", 4175558140u, 0, 10, &be_const_str_find_op);
-be_define_const_str(find_op, "find_op", 3766713376u, 0, 7, NULL);
-be_define_const_str(NRF24_DC, "NRF24_DC", 688921313u, 0, 8, &be_const_str_content_start);
-be_define_const_str(content_start, "content_start", 2937509069u, 0, 13, NULL);
-be_define_const_str(SYMBOL_STOP, "SYMBOL_STOP", 2836505202u, 0, 11, &be_const_str_lv_win);
-be_define_const_str(lv_win, "lv_win", 780927558u, 0, 6, &be_const_str_false);
-be_define_const_str(false, "false", 184981848u, 62, 5, NULL);
-be_define_const_str(A4988_STP, "A4988_STP", 1622172049u, 0, 9, &be_const_str_SYMBOL_NEXT);
-be_define_const_str(SYMBOL_NEXT, "SYMBOL_NEXT", 1102844455u, 0, 11, &be_const_str_WEBCAM_XCLK);
-be_define_const_str(WEBCAM_XCLK, "WEBCAM_XCLK", 536207425u, 0, 11, NULL);
-be_define_const_str(WEBCAM_PSRCS, "WEBCAM_PSRCS", 624464864u, 0, 12, &be_const_str_scale_uint);
-be_define_const_str(scale_uint, "scale_uint", 3090811094u, 0, 10, &be_const_str_do);
-be_define_const_str(do, "do", 1646057492u, 65, 2, NULL);
-be_define_const_str(OUTPUT_LO, "OUTPUT_LO", 3724620328u, 0, 9, &be_const_str_SSPI_DC);
-be_define_const_str(SSPI_DC, "SSPI_DC", 1782271864u, 0, 7, &be_const_str_import);
-be_define_const_str(import, "import", 288002260u, 66, 6, NULL);
-be_define_const_str(push, "push", 2272264157u, 0, 4, NULL);
-be_define_const_str(cos, "cos", 4220379804u, 0, 3, &be_const_str_lv_tabview);
-be_define_const_str(lv_tabview, "lv_tabview", 2109024786u, 0, 10, NULL);
-be_define_const_str(set_timer, "set_timer", 2135414533u, 0, 9, NULL);
-be_define_const_str(DEEPSLEEP, "DEEPSLEEP", 189922226u, 0, 9, &be_const_str_ILI9341_DC);
-be_define_const_str(ILI9341_DC, "ILI9341_DC", 28838624u, 0, 10, &be_const_str_yield);
-be_define_const_str(yield, "yield", 1821831854u, 0, 5, NULL);
-be_define_const_str(SDM630_RX, "SDM630_RX", 1971606309u, 0, 9, NULL);
-be_define_const_str(DI, "DI", 1070498734u, 0, 2, &be_const_str_SYMBOL_BLUETOOTH);
-be_define_const_str(SYMBOL_BLUETOOTH, "SYMBOL_BLUETOOTH", 679376572u, 0, 16, &be_const_str_lv_draw_label_dsc);
-be_define_const_str(lv_draw_label_dsc, "lv_draw_label_dsc", 265601842u, 0, 17, &be_const_str_update);
-be_define_const_str(update, "update", 672109684u, 0, 6, NULL);
-be_define_const_str(INPUT, "INPUT", 1638025307u, 0, 5, &be_const_str_SYMBOL_NEW_LINE);
-be_define_const_str(SYMBOL_NEW_LINE, "SYMBOL_NEW_LINE", 2014334315u, 0, 15, &be_const_str_ZIGBEE_RST);
-be_define_const_str(ZIGBEE_RST, "ZIGBEE_RST", 721588661u, 0, 10, NULL);
-be_define_const_str(SYMBOL_SD_CARD, "SYMBOL_SD_CARD", 2542376484u, 0, 14, NULL);
-be_define_const_str(CC1101_GDO2, "CC1101_GDO2", 974166265u, 0, 11, &be_const_str_MGC3130_XFER);
-be_define_const_str(MGC3130_XFER, "MGC3130_XFER", 4178219131u, 0, 12, &be_const_str__drivers);
-be_define_const_str(_drivers, "_drivers", 3260328985u, 0, 8, NULL);
-be_define_const_str(copy, "copy", 3848464964u, 0, 4, &be_const_str_detect);
-be_define_const_str(detect, "detect", 8884370u, 0, 6, NULL);
-be_define_const_str(SR04_TRIG, "SR04_TRIG", 68671263u, 0, 9, &be_const_str_TUYA_TX);
-be_define_const_str(TUYA_TX, "TUYA_TX", 1541301465u, 0, 7, &be_const_str__cb);
-be_define_const_str(_cb, "_cb", 4043300367u, 0, 3, NULL);
-be_define_const_str(HALLEFFECT, "HALLEFFECT", 3334305407u, 0, 10, &be_const_str_RXD);
+be_define_const_str(MIEL_HVAC_RX, "MIEL_HVAC_RX", 3720609648u, 0, 12, NULL);
 be_define_const_str(RXD, "RXD", 2311579049u, 0, 3, NULL);
-be_define_const_str(imin, "imin", 2714127864u, 0, 4, NULL);
-be_define_const_str(SYMBOL_VIDEO, "SYMBOL_VIDEO", 789726913u, 0, 12, NULL);
-be_define_const_str(SYMBOL_LIST, "SYMBOL_LIST", 70793990u, 0, 11, &be_const_str_calldepth);
-be_define_const_str(calldepth, "calldepth", 3122364302u, 0, 9, NULL);
-be_define_const_str(AZ_TXD, "AZ_TXD", 850268709u, 0, 6, &be_const_str_DSB_OUT);
-be_define_const_str(DSB_OUT, "DSB_OUT", 732335085u, 0, 7, NULL);
-be_define_const_str(end, "end", 1787721130u, 56, 3, NULL);
-be_define_const_str(SYMBOL_BATTERY_EMPTY, "SYMBOL_BATTERY_EMPTY", 3945064277u, 0, 20, &be_const_str_lv_gauge);
-be_define_const_str(lv_gauge, "lv_gauge", 118613531u, 0, 8, NULL);
-be_define_const_str(for, "for", 2901640080u, 54, 3, NULL);
-be_define_const_str(BUZZER, "BUZZER", 1550039611u, 0, 6, &be_const_str_member);
+be_define_const_str(rand, "rand", 2711325910u, 0, 4, NULL);
+be_define_const_str(RFRECV, "RFRECV", 354742801u, 0, 6, &be_const_str_SYMBOL_BACKSPACE);
+be_define_const_str(SYMBOL_BACKSPACE, "SYMBOL_BACKSPACE", 1997168681u, 0, 16, NULL);
+be_define_const_str(XPT2046_CS, "XPT2046_CS", 4049231042u, 0, 10, &be_const_str_except);
+be_define_const_str(except, "except", 950914032u, 69, 6, NULL);
+be_define_const_str(MAX7219CS, "MAX7219CS", 2593198244u, 0, 9, &be_const_str_on);
+be_define_const_str(on, "on", 1630810064u, 0, 2, NULL);
+be_define_const_str(SDM630_TX, "SDM630_TX", 696213075u, 0, 9, &be_const_str_SYMBOL_NEW_LINE);
+be_define_const_str(SYMBOL_NEW_LINE, "SYMBOL_NEW_LINE", 2014334315u, 0, 15, NULL);
+be_define_const_str(HLW_CF, "HLW_CF", 3982619486u, 0, 6, NULL);
+be_define_const_str(MHZ_RXD, "MHZ_RXD", 328619727u, 0, 7, &be_const_str_return);
+be_define_const_str(return, "return", 2246981567u, 60, 6, NULL);
+be_define_const_str(lv_draw_rect_dsc, "lv_draw_rect_dsc", 3246772488u, 0, 16, &be_const_str_false);
+be_define_const_str(false, "false", 184981848u, 62, 5, NULL);
+be_define_const_str(cmd, "cmd", 4136785899u, 0, 3, &be_const_str_lv_obj);
+be_define_const_str(lv_obj, "lv_obj", 4257833149u, 0, 6, &be_const_str_traceback);
+be_define_const_str(traceback, "traceback", 3385188109u, 0, 9, NULL);
+be_define_const_str(OPTION_A, "OPTION_A", 1133299440u, 0, 8, NULL);
+be_define_const_str(split, "split", 2276994531u, 0, 5, NULL);
+be_define_const_str(CSE7761_TX, "CSE7761_TX", 3354719142u, 0, 10, NULL);
+be_define_const_str(LE01MR_TX, "LE01MR_TX", 1589687023u, 0, 9, &be_const_str_pool);
+be_define_const_str(pool, "pool", 2447210883u, 0, 4, NULL);
+be_define_const_str(ETH_PHY_POWER, "ETH_PHY_POWER", 487529454u, 0, 13, &be_const_str_publish);
+be_define_const_str(publish, "publish", 264247304u, 0, 7, NULL);
+be_define_const_str(_rules, "_rules", 4266217105u, 0, 6, NULL);
+be_define_const_str(ROT1A, "ROT1A", 759599716u, 0, 5, NULL);
+be_define_const_str(MD5, "MD5", 1935726387u, 0, 3, NULL);
+be_define_const_str(compile, "compile", 1000265118u, 0, 7, NULL);
+be_define_const_str(TXD, "TXD", 3614562079u, 0, 3, &be_const_str_seg7_font);
+be_define_const_str(seg7_font, "seg7_font", 4099690689u, 0, 9, NULL);
+be_define_const_str(register_button_encoder, "register_button_encoder", 2811301550u, 0, 23, NULL);
+be_define_const_str(CHANGE, "CHANGE", 4280911421u, 0, 6, &be_const_str_EPAPER42_CS);
+be_define_const_str(EPAPER42_CS, "EPAPER42_CS", 3274717451u, 0, 11, &be_const_str_REL1_INV);
+be_define_const_str(REL1_INV, "REL1_INV", 3733155371u, 0, 8, &be_const_str_member);
 be_define_const_str(member, "member", 719708611u, 0, 6, NULL);
-be_define_const_str(SSPI_SCLK, "SSPI_SCLK", 136688954u, 0, 9, &be_const_str_lv_draw_mask_radius_param);
-be_define_const_str(lv_draw_mask_radius_param, "lv_draw_mask_radius_param", 3777679220u, 0, 25, &be_const_str_range);
-be_define_const_str(range, "range", 4208725202u, 0, 5, NULL);
-be_define_const_str(issubclass, "issubclass", 4078395519u, 0, 10, NULL);
-be_define_const_str(WEBCAM_HREF, "WEBCAM_HREF", 3161890024u, 0, 11, &be_const_str_bytes);
-be_define_const_str(bytes, "bytes", 1706151940u, 0, 5, &be_const_str_lv_signal_cb);
-be_define_const_str(lv_signal_cb, "lv_signal_cb", 3295792564u, 0, 12, NULL);
-be_define_const_str(Driver, "Driver", 3576386303u, 0, 6, NULL);
-be_define_const_str(OPTION_A, "OPTION_A", 1133299440u, 0, 8, &be_const_str_SYMBOL_DUMMY);
-be_define_const_str(SYMBOL_DUMMY, "SYMBOL_DUMMY", 3621732138u, 0, 12, &be_const_str_WEBCAM_HSD);
-be_define_const_str(WEBCAM_HSD, "WEBCAM_HSD", 2648502504u, 0, 10, NULL);
-be_define_const_str(IBEACON_RX, "IBEACON_RX", 2466155575u, 0, 10, &be_const_str_SYMBOL_WIFI);
-be_define_const_str(SYMBOL_WIFI, "SYMBOL_WIFI", 682141303u, 0, 11, NULL);
-be_define_const_str(HM10_TX, "HM10_TX", 1522037252u, 0, 7, NULL);
-be_define_const_str(BOILER_OT_RX, "BOILER_OT_RX", 603647409u, 0, 12, &be_const_str_SM16716_CLK);
-be_define_const_str(SM16716_CLK, "SM16716_CLK", 3037641483u, 0, 11, &be_const_str_SYMBOL_EJECT);
+be_define_const_str(write_bytes, "write_bytes", 1227543792u, 0, 11, NULL);
+be_define_const_str(ARIRFSEL, "ARIRFSEL", 233874443u, 0, 8, NULL);
+be_define_const_str(FALLING, "FALLING", 2851701064u, 0, 7, &be_const_str_PMS5003_TX);
+be_define_const_str(PMS5003_TX, "PMS5003_TX", 3868169364u, 0, 10, &be_const_str_TM1638DIO);
+be_define_const_str(TM1638DIO, "TM1638DIO", 1408212414u, 0, 9, &be_const_str_delay);
+be_define_const_str(delay, "delay", 1322381784u, 0, 5, &be_const_str_lv_calendar);
+be_define_const_str(lv_calendar, "lv_calendar", 3284396894u, 0, 11, NULL);
+be_define_const_str(SDM120_TX, "SDM120_TX", 2509332415u, 0, 9, &be_const_str_SDS0X1_RX);
+be_define_const_str(SDS0X1_RX, "SDS0X1_RX", 1170717385u, 0, 9, &be_const_str_init);
+be_define_const_str(init, "init", 380752755u, 0, 4, NULL);
+be_define_const_str(SYMBOL_CLOSE, "SYMBOL_CLOSE", 2654402806u, 0, 12, &be_const_str_web_add_management_button);
+be_define_const_str(web_add_management_button, "web_add_management_button", 2738877186u, 0, 25, NULL);
+be_define_const_str(LED1_INV, "LED1_INV", 2112045097u, 0, 8, NULL);
+be_define_const_str(BOILER_OT_RX, "BOILER_OT_RX", 603647409u, 0, 12, &be_const_str_content_start);
+be_define_const_str(content_start, "content_start", 2937509069u, 0, 13, &be_const_str_erase);
+be_define_const_str(erase, "erase", 1010949589u, 0, 5, &be_const_str_input);
+be_define_const_str(input, "input", 4191711099u, 0, 5, NULL);
+be_define_const_str(SPI_MISO, "SPI_MISO", 150818010u, 0, 8, &be_const_str_SYMBOL_LIST);
+be_define_const_str(SYMBOL_LIST, "SYMBOL_LIST", 70793990u, 0, 11, &be_const_str_imax);
+be_define_const_str(imax, "imax", 3084515410u, 0, 4, NULL);
+be_define_const_str(A4988_MS1, "A4988_MS1", 1729976611u, 0, 9, &be_const_str_start);
+be_define_const_str(start, "start", 1697318111u, 0, 5, NULL);
+be_define_const_str(SYMBOL_DRIVE, "SYMBOL_DRIVE", 567203502u, 0, 12, &be_const_str_remove_cmd);
+be_define_const_str(remove_cmd, "remove_cmd", 3832315702u, 0, 10, NULL);
+be_define_const_str(ROT1B, "ROT1B", 809932573u, 0, 5, NULL);
+be_define_const_str(DHT11_OUT, "DHT11_OUT", 1645300734u, 0, 9, &be_const_str_DI);
+be_define_const_str(DI, "DI", 1070498734u, 0, 2, &be_const_str_INPUT_PULLUP);
+be_define_const_str(INPUT_PULLUP, "INPUT_PULLUP", 2912931654u, 0, 12, &be_const_str_lv_chart);
+be_define_const_str(lv_chart, "lv_chart", 2652494144u, 0, 8, NULL);
+be_define_const_str(LED1, "LED1", 21005825u, 0, 4, &be_const_str_every_second);
+be_define_const_str(every_second, "every_second", 2075451465u, 0, 12, &be_const_str_list);
+be_define_const_str(list, "list", 217798785u, 0, 4, NULL);
+be_define_const_str(BACKLIGHT, "BACKLIGHT", 3147761926u, 0, 9, &be_const_str_HRXL_RX);
+be_define_const_str(HRXL_RX, "HRXL_RX", 92702006u, 0, 7, &be_const_str_SYMBOL_CHARGE);
+be_define_const_str(SYMBOL_CHARGE, "SYMBOL_CHARGE", 2106391946u, 0, 13, NULL);
 be_define_const_str(SYMBOL_EJECT, "SYMBOL_EJECT", 873760647u, 0, 12, NULL);
+be_define_const_str(CSE7761_RX, "CSE7761_RX", 65423248u, 0, 10, &be_const_str__buffer);
+be_define_const_str(_buffer, "_buffer", 2044888568u, 0, 7, &be_const_str_isinstance);
+be_define_const_str(isinstance, "isinstance", 3669352738u, 0, 10, NULL);
+be_define_const_str(MAX7219DIN, "MAX7219DIN", 380687049u, 0, 10, &be_const_str_WIEGAND_D0);
+be_define_const_str(WIEGAND_D0, "WIEGAND_D0", 4192335759u, 0, 10, NULL);
+be_define_const_str(continue, "continue", 2977070660u, 59, 8, NULL);
+be_define_const_str(TCP_RX, "TCP_RX", 3904354751u, 0, 6, &be_const_str_call);
+be_define_const_str(call, "call", 3018949801u, 0, 4, &be_const_str_i2c_enabled);
+be_define_const_str(i2c_enabled, "i2c_enabled", 218388101u, 0, 11, NULL);
+be_define_const_str(int, "int", 2515107422u, 0, 3, NULL);
+be_define_const_str(VL53L0X_XSHUT1, "VL53L0X_XSHUT1", 2341134183u, 0, 14, &be_const_str__ccmd);
+be_define_const_str(_ccmd, "_ccmd", 2163421413u, 0, 5, NULL);
+be_define_const_str(SSPI_MAX31865_CS1, "SSPI_MAX31865_CS1", 1256578724u, 0, 17, &be_const_str_counters);
+be_define_const_str(counters, "counters", 4095866864u, 0, 8, &be_const_str_update);
+be_define_const_str(update, "update", 672109684u, 0, 6, &be_const_str_web_send_decimal);
+be_define_const_str(web_send_decimal, "web_send_decimal", 1407210204u, 0, 16, NULL);
+be_define_const_str(BUZZER_INV, "BUZZER_INV", 3274564335u, 0, 10, &be_const_str_SYMBOL_NEXT);
+be_define_const_str(SYMBOL_NEXT, "SYMBOL_NEXT", 1102844455u, 0, 11, &be_const_str_acos);
+be_define_const_str(acos, "acos", 1006755615u, 0, 4, &be_const_str_resp_cmnd_done);
+be_define_const_str(resp_cmnd_done, "resp_cmnd_done", 2601874875u, 0, 14, NULL);
+be_define_const_str(TELEINFO_RX, "TELEINFO_RX", 1195717356u, 0, 11, &be_const_str_lv_draw_line_dsc);
+be_define_const_str(lv_draw_line_dsc, "lv_draw_line_dsc", 2422805236u, 0, 16, &be_const_str_lv_tabview);
+be_define_const_str(lv_tabview, "lv_tabview", 2109024786u, 0, 10, NULL);
+be_define_const_str(MP3_DFR562, "MP3_DFR562", 2859952977u, 0, 10, &be_const_str_SENSOR_END);
+be_define_const_str(SENSOR_END, "SENSOR_END", 3512542657u, 0, 10, &be_const_str_elif);
+be_define_const_str(elif, "elif", 3232090307u, 51, 4, NULL);
+be_define_const_str(as, "as", 1579491469u, 67, 2, NULL);
+be_define_const_str(read12, "read12", 4291076970u, 0, 6, NULL);
+be_define_const_str(BUZZER, "BUZZER", 1550039611u, 0, 6, &be_const_str_SBR_RX);
+be_define_const_str(SBR_RX, "SBR_RX", 3350999801u, 0, 6, NULL);
+be_define_const_str(SYMBOL_STOP, "SYMBOL_STOP", 2836505202u, 0, 11, NULL);
+be_define_const_str(MHZ_TXD, "MHZ_TXD", 3310158233u, 0, 7, &be_const_str_SDM120_RX);
+be_define_const_str(SDM120_RX, "SDM120_RX", 1367571753u, 0, 9, &be_const_str_ctypes_bytes);
+be_define_const_str(ctypes_bytes, "ctypes_bytes", 3879019703u, 0, 12, &be_const_str_lv_font);
+be_define_const_str(lv_font, "lv_font", 1550958453u, 0, 7, &be_const_str_set_power);
+be_define_const_str(set_power, "set_power", 549820893u, 0, 9, NULL);
+be_define_const_str(HX711_SCK, "HX711_SCK", 3785979404u, 0, 9, &be_const_str_WEBCAM_PSRCS);
+be_define_const_str(WEBCAM_PSRCS, "WEBCAM_PSRCS", 624464864u, 0, 12, &be_const_str_WEBCAM_PWDN);
+be_define_const_str(WEBCAM_PWDN, "WEBCAM_PWDN", 2219597454u, 0, 11, &be_const_str_lv_draw_mask_line_param);
+be_define_const_str(lv_draw_mask_line_param, "lv_draw_mask_line_param", 2692990704u, 0, 23, NULL);
+be_define_const_str(remove_timer, "remove_timer", 4141472215u, 0, 12, NULL);
+be_define_const_str(DDSU666_RX, "DDSU666_RX", 1812507936u, 0, 10, &be_const_str__begin_transmission);
+be_define_const_str(_begin_transmission, "_begin_transmission", 2779461176u, 0, 19, &be_const_str_get_light);
+be_define_const_str(get_light, "get_light", 381930476u, 0, 9, NULL);
+be_define_const_str(SYMBOL_BATTERY_EMPTY, "SYMBOL_BATTERY_EMPTY", 3945064277u, 0, 20, &be_const_str_concat);
+be_define_const_str(concat, "concat", 4124019837u, 0, 6, NULL);
+be_define_const_str(SYMBOL_RIGHT, "SYMBOL_RIGHT", 2984010648u, 0, 12, &be_const_str_finish);
+be_define_const_str(finish, "finish", 1494643858u, 0, 6, &be_const_str_lv_draw_mask_angle_param_cfg);
+be_define_const_str(lv_draw_mask_angle_param_cfg, "lv_draw_mask_angle_param_cfg", 3599767368u, 0, 28, &be_const_str_remove_rule);
+be_define_const_str(remove_rule, "remove_rule", 3456211328u, 0, 11, NULL);
+be_define_const_str(cb_dispatch, "cb_dispatch", 1741510499u, 0, 11, &be_const_str_content_send);
+be_define_const_str(content_send, "content_send", 1673733649u, 0, 12, &be_const_str_lv_color);
+be_define_const_str(lv_color, "lv_color", 1419148319u, 0, 8, &be_const_str_remove);
+be_define_const_str(remove, "remove", 3683784189u, 0, 6, NULL);
+be_define_const_str(SOLAXX1_TX, "SOLAXX1_TX", 903770840u, 0, 10, NULL);
+be_define_const_str(HIGH, "HIGH", 2066738941u, 0, 4, &be_const_str_screenshot);
+be_define_const_str(screenshot, "screenshot", 3894592561u, 0, 10, NULL);
+be_define_const_str(A4988_DIR, "A4988_DIR", 2223595843u, 0, 9, &be_const_str_NRF24_DC);
+be_define_const_str(NRF24_DC, "NRF24_DC", 688921313u, 0, 8, &be_const_str_SYMBOL_WIFI);
+be_define_const_str(SYMBOL_WIFI, "SYMBOL_WIFI", 682141303u, 0, 11, &be_const_str_TM1638STB);
+be_define_const_str(TM1638STB, "TM1638STB", 823674593u, 0, 9, NULL);
+be_define_const_str(ILI9341_DC, "ILI9341_DC", 28838624u, 0, 10, &be_const_str_PN532_TXD);
+be_define_const_str(PN532_TXD, "PN532_TXD", 3093418644u, 0, 9, &be_const_str_ST7789_CS);
+be_define_const_str(ST7789_CS, "ST7789_CS", 2937305434u, 0, 9, NULL);
+be_define_const_str(CC1101_GDO2, "CC1101_GDO2", 974166265u, 0, 11, NULL);
 be_define_const_str(item, "item", 2671260646u, 0, 4, NULL);
-be_define_const_str(SDS0X1_TX, "SDS0X1_TX", 165045983u, 0, 9, &be_const_str_deg);
-be_define_const_str(deg, "deg", 3327754271u, 0, 3, NULL);
-be_define_const_str(OPEN_DRAIN, "OPEN_DRAIN", 677872608u, 0, 10, &be_const_str_SYMBOL_DOWNLOAD);
-be_define_const_str(SYMBOL_DOWNLOAD, "SYMBOL_DOWNLOAD", 2607324090u, 0, 15, &be_const_str_SYMBOL_EDIT);
-be_define_const_str(SYMBOL_EDIT, "SYMBOL_EDIT", 1396182822u, 0, 11, &be_const_str_geti);
-be_define_const_str(geti, "geti", 2381006490u, 0, 4, &be_const_str_lv_label);
-be_define_const_str(lv_label, "lv_label", 4199664246u, 0, 8, NULL);
-be_define_const_str(_rules, "_rules", 4266217105u, 0, 6, NULL);
-be_define_const_str(insert, "insert", 3332609576u, 0, 6, &be_const_str_register_button_encoder);
-be_define_const_str(register_button_encoder, "register_button_encoder", 2811301550u, 0, 23, NULL);
-be_define_const_str(web_add_config_button, "web_add_config_button", 639674325u, 0, 21, &be_const_str_true);
-be_define_const_str(true, "true", 1303515621u, 61, 4, NULL);
-be_define_const_str(SYMBOL_BULLET, "SYMBOL_BULLET", 587181862u, 0, 13, &be_const_str_SYMBOL_CLOSE);
-be_define_const_str(SYMBOL_CLOSE, "SYMBOL_CLOSE", 2654402806u, 0, 12, &be_const_str_SYMBOL_CUT);
-be_define_const_str(SYMBOL_CUT, "SYMBOL_CUT", 3455112394u, 0, 10, &be_const_str__request_from);
-be_define_const_str(_request_from, "_request_from", 3965148604u, 0, 13, &be_const_str_lower);
-be_define_const_str(lower, "lower", 3038577850u, 0, 5, NULL);
-be_define_const_str(SYMBOL_UPLOAD, "SYMBOL_UPLOAD", 3293679647u, 0, 13, &be_const_str_ctypes_bytes);
-be_define_const_str(ctypes_bytes, "ctypes_bytes", 3879019703u, 0, 12, NULL);
-be_define_const_str(lv_draw_mask_common_dsc, "lv_draw_mask_common_dsc", 1429224708u, 0, 23, NULL);
-be_define_const_str(LE01MR_RX, "LE01MR_RX", 1521590809u, 0, 9, NULL);
-be_define_const_str(web_add_main_button, "web_add_main_button", 3960367664u, 0, 19, NULL);
-be_define_const_str(floor, "floor", 3102149661u, 0, 5, &be_const_str_seg7_font);
-be_define_const_str(seg7_font, "seg7_font", 4099690689u, 0, 9, NULL);
-be_define_const_str(DCKI, "DCKI", 3846847480u, 0, 4, &be_const_str_I2C_SDA);
-be_define_const_str(I2C_SDA, "I2C_SDA", 1052592262u, 0, 7, NULL);
-be_define_const_str(ILI9341_CS, "ILI9341_CS", 3519318851u, 0, 10, &be_const_str_lv_cb);
-be_define_const_str(lv_cb, "lv_cb", 1389787433u, 0, 5, NULL);
+be_define_const_str(ELECTRIQ_MOODL_TX, "ELECTRIQ_MOODL_TX", 31009247u, 0, 17, &be_const_str_SSPI_MOSI);
+be_define_const_str(SSPI_MOSI, "SSPI_MOSI", 3745917497u, 0, 9, &be_const_str_SYMBOL_BELL);
+be_define_const_str(SYMBOL_BELL, "SYMBOL_BELL", 1736196487u, 0, 11, &be_const_str_lv_draw_img_dsc);
+be_define_const_str(lv_draw_img_dsc, "lv_draw_img_dsc", 999847907u, 0, 15, NULL);
+be_define_const_str(OPEN_DRAIN, "OPEN_DRAIN", 677872608u, 0, 10, &be_const_str_lv_switch);
+be_define_const_str(lv_switch, "lv_switch", 3407171508u, 0, 9, &be_const_str_wire2);
+be_define_const_str(wire2, "wire2", 3229499038u, 0, 5, NULL);
+be_define_const_str(TCP_TX, "TCP_TX", 2762594089u, 0, 6, &be_const_str_load_font);
+be_define_const_str(load_font, "load_font", 1875840019u, 0, 9, NULL);
+be_define_const_str(SI7021, "SI7021", 864377911u, 0, 6, NULL);
+be_define_const_str(SYMBOL_PAUSE, "SYMBOL_PAUSE", 641998172u, 0, 12, &be_const_str__get_cb);
+be_define_const_str(_get_cb, "_get_cb", 1448849122u, 0, 7, &be_const_str_resp_cmnd_failed);
+be_define_const_str(resp_cmnd_failed, "resp_cmnd_failed", 2136281562u, 0, 16, &be_const_str_def);
+be_define_const_str(def, "def", 3310976652u, 55, 3, &be_const_str_while);
+be_define_const_str(while, "while", 231090382u, 53, 5, NULL);
+be_define_const_str(SYMBOL_CUT, "SYMBOL_CUT", 3455112394u, 0, 10, &be_const_str_write);
+be_define_const_str(write, "write", 3190202204u, 0, 5, NULL);
+be_define_const_str(SYMBOL_COPY, "SYMBOL_COPY", 4193681815u, 0, 11, NULL);
+be_define_const_str(ADC_BUTTON_INV, "ADC_BUTTON_INV", 2027625326u, 0, 14, &be_const_str_SYMBOL_AUDIO);
+be_define_const_str(SYMBOL_AUDIO, "SYMBOL_AUDIO", 3056537956u, 0, 12, &be_const_str_SYMBOL_EYE_OPEN);
+be_define_const_str(SYMBOL_EYE_OPEN, "SYMBOL_EYE_OPEN", 3449311676u, 0, 15, &be_const_str_ZIGBEE_TX);
+be_define_const_str(ZIGBEE_TX, "ZIGBEE_TX", 25119256u, 0, 9, NULL);
+be_define_const_str(EPD_DATA, "EPD_DATA", 3799141097u, 0, 8, &be_const_str_IBEACON_TX);
+be_define_const_str(IBEACON_TX, "IBEACON_TX", 3471826977u, 0, 10, &be_const_str_NRG_CF1);
+be_define_const_str(NRG_CF1, "NRG_CF1", 3292534757u, 0, 7, &be_const_str_set);
+be_define_const_str(set, "set", 3324446467u, 0, 3, NULL);
+be_define_const_str(asstring, "asstring", 1298225088u, 0, 8, NULL);
+be_define_const_str(RISING, "RISING", 1256404539u, 0, 6, &be_const_str_SM16716_SEL);
+be_define_const_str(SM16716_SEL, "SM16716_SEL", 142377379u, 0, 11, &be_const_str_SSD1331_DC);
+be_define_const_str(SSD1331_DC, "SSD1331_DC", 3386560859u, 0, 10, NULL);
+be_define_const_str(SYMBOL_DOWNLOAD, "SYMBOL_DOWNLOAD", 2607324090u, 0, 15, NULL);
+be_define_const_str(LEDLNK_INV, "LEDLNK_INV", 3559015101u, 0, 10, &be_const_str_TELEINFO_ENABLE);
+be_define_const_str(TELEINFO_ENABLE, "TELEINFO_ENABLE", 1600974501u, 0, 15, &be_const_str_lv_checkbox);
+be_define_const_str(lv_checkbox, "lv_checkbox", 7454841u, 0, 11, &be_const_str_lv_dropdown);
+be_define_const_str(lv_dropdown, "lv_dropdown", 2797165301u, 0, 11, NULL);
+be_define_const_str(GPS_RX, "GPS_RX", 1075637342u, 0, 6, &be_const_str_P9813_DAT);
+be_define_const_str(P9813_DAT, "P9813_DAT", 778577052u, 0, 9, &be_const_str_tan);
+be_define_const_str(tan, "tan", 2633446552u, 0, 3, &be_const_str_do);
+be_define_const_str(do, "do", 1646057492u, 65, 2, NULL);
+be_define_const_str(DHT22, "DHT22", 215937903u, 0, 5, &be_const_str_SYMBOL_VOLUME_MAX);
+be_define_const_str(SYMBOL_VOLUME_MAX, "SYMBOL_VOLUME_MAX", 3582646093u, 0, 17, NULL);
+be_define_const_str(DDS2382_TX, "DDS2382_TX", 1438117864u, 0, 10, &be_const_str_cosh);
+be_define_const_str(cosh, "cosh", 4099687964u, 0, 4, NULL);
+be_define_const_str(resolvecmnd, "resolvecmnd", 993361485u, 0, 11, &be_const_str_raise);
+be_define_const_str(raise, "raise", 1593437475u, 70, 5, NULL);
+be_define_const_str(lv_group_focus_cb, "lv_group_focus_cb", 4288873836u, 0, 17, &be_const_str_print);
+be_define_const_str(print, "print", 372738696u, 0, 5, NULL);
+be_define_const_str(HALLEFFECT, "HALLEFFECT", 3334305407u, 0, 10, NULL);
+be_define_const_str(SYMBOL_DUMMY, "SYMBOL_DUMMY", 3621732138u, 0, 12, NULL);
+be_define_const_str(event, "event", 4264611999u, 0, 5, &be_const_str_exec_cmd);
+be_define_const_str(exec_cmd, "exec_cmd", 493567399u, 0, 8, &be_const_str_tolower);
+be_define_const_str(tolower, "tolower", 1042520049u, 0, 7, NULL);
+be_define_const_str(lv_table, "lv_table", 1675691020u, 0, 8, NULL);
+be_define_const_str(MAX31855CS, "MAX31855CS", 753620511u, 0, 10, &be_const_str_arg);
+be_define_const_str(arg, "arg", 1047474471u, 0, 3, NULL);
+be_define_const_str(ADC_JOY, "ADC_JOY", 1116943612u, 0, 7, &be_const_str_I2C_SDA);
+be_define_const_str(I2C_SDA, "I2C_SDA", 1052592262u, 0, 7, &be_const_str_calldepth);
+be_define_const_str(calldepth, "calldepth", 3122364302u, 0, 9, &be_const_str_range);
+be_define_const_str(range, "range", 4208725202u, 0, 5, NULL);
+be_define_const_str(BOILER_OT_TX, "BOILER_OT_TX", 671743623u, 0, 12, &be_const_str_ROT1A_NP);
+be_define_const_str(ROT1A_NP, "ROT1A_NP", 2322706903u, 0, 8, &be_const_str_read13);
+be_define_const_str(read13, "read13", 12887293u, 0, 6, NULL);
+be_define_const_str(ARIRFRCV, "ARIRFRCV", 1120816444u, 0, 8, &be_const_str_lv_signal_cb);
+be_define_const_str(lv_signal_cb, "lv_signal_cb", 3295792564u, 0, 12, NULL);
+be_define_const_str(AS3935, "AS3935", 603621745u, 0, 6, NULL);
+be_define_const_str(allocated, "allocated", 429986098u, 0, 9, NULL);
+be_define_const_str(SDM72_TX, "SDM72_TX", 2042143269u, 0, 8, &be_const_str_class);
+be_define_const_str(class, "class", 2872970239u, 57, 5, NULL);
+be_define_const_str(SYMBOL_GPS, "SYMBOL_GPS", 3044165570u, 0, 10, &be_const_str_bytes);
+be_define_const_str(bytes, "bytes", 1706151940u, 0, 5, &be_const_str_break);
+be_define_const_str(break, "break", 3378807160u, 58, 5, NULL);
+be_define_const_str(MGC3130_RESET, "MGC3130_RESET", 405013121u, 0, 13, &be_const_str_assert);
+be_define_const_str(assert, "assert", 2774883451u, 0, 6, &be_const_str_redirect);
+be_define_const_str(redirect, "redirect", 389758641u, 0, 8, NULL);
+be_define_const_str(A4988_ENA, "A4988_ENA", 1517502682u, 0, 9, &be_const_str_SYMBOL_BATTERY_2);
+be_define_const_str(SYMBOL_BATTERY_2, "SYMBOL_BATTERY_2", 645813682u, 0, 16, &be_const_str_set_light);
+be_define_const_str(set_light, "set_light", 3176076152u, 0, 9, NULL);
+be_define_const_str(HRE_DATA, "HRE_DATA", 1820377643u, 0, 8, &be_const_str_SHELLY_DIMMER_RST_INV);
+be_define_const_str(SHELLY_DIMMER_RST_INV, "SHELLY_DIMMER_RST_INV", 2366759773u, 0, 21, &be_const_str_SSPI_MISO);
+be_define_const_str(SSPI_MISO, "SSPI_MISO", 2485347173u, 0, 9, &be_const_str_lv_draw_mask_radius_param_cfg);
+be_define_const_str(lv_draw_mask_radius_param_cfg, "lv_draw_mask_radius_param_cfg", 3889386773u, 0, 29, &be_const_str_read_bytes);
+be_define_const_str(read_bytes, "read_bytes", 3576733173u, 0, 10, NULL);
+be_define_const_str(_request_from, "_request_from", 3965148604u, 0, 13, &be_const_str_lv_roller);
+be_define_const_str(lv_roller, "lv_roller", 661902064u, 0, 9, &be_const_str_yield);
+be_define_const_str(yield, "yield", 1821831854u, 0, 5, NULL);
+be_define_const_str(opt_eq, "==", 2431966415u, 0, 2, &be_const_str_lv_sqrt_res);
+be_define_const_str(lv_sqrt_res, "lv_sqrt_res", 2904473995u, 0, 11, NULL);
+be_define_const_str(IRSEND, "IRSEND", 184848336u, 0, 6, &be_const_str_Wire);
+be_define_const_str(Wire, "Wire", 1938276536u, 0, 4, NULL);
+be_define_const_str(lv_img, "lv_img", 2474052327u, 0, 6, NULL);
+be_define_const_str(BL0940_RX, "BL0940_RX", 2908993179u, 0, 9, &be_const_str_WEBCAM_PCLK);
+be_define_const_str(WEBCAM_PCLK, "WEBCAM_PCLK", 3813770649u, 0, 11, &be_const_str_load);
+be_define_const_str(load, "load", 3859241449u, 0, 4, NULL);
+be_define_const_str(OUTPUT, "OUTPUT", 1469629700u, 0, 6, &be_const_str_exp);
+be_define_const_str(exp, "exp", 1923516200u, 0, 3, &be_const_str_log10);
+be_define_const_str(log10, "log10", 2346846000u, 0, 5, &be_const_str_wire_scan);
+be_define_const_str(wire_scan, "wire_scan", 2671275880u, 0, 9, NULL);
+be_define_const_str(SAIR_TX, "SAIR_TX", 268017311u, 0, 7, &be_const_str_gen_cb);
+be_define_const_str(gen_cb, "gen_cb", 3245227551u, 0, 6, NULL);
+be_define_const_str(ADE7953_IRQ, "ADE7953_IRQ", 2329185922u, 0, 11, &be_const_str_time_str);
+be_define_const_str(time_str, "time_str", 2613827612u, 0, 8, NULL);
+be_define_const_str(SDCARD_CS, "SDCARD_CS", 3348952003u, 0, 9, &be_const_str_add_rule);
+be_define_const_str(add_rule, "add_rule", 596540743u, 0, 8, &be_const_str_dump);
+be_define_const_str(dump, "dump", 3663001223u, 0, 4, &be_const_str_set_timer);
+be_define_const_str(set_timer, "set_timer", 2135414533u, 0, 9, NULL);
+be_define_const_str(AS608_TX, "AS608_TX", 48630934u, 0, 8, &be_const_str_PZEM004_RX);
+be_define_const_str(PZEM004_RX, "PZEM004_RX", 3411153194u, 0, 10, &be_const_str_lv_draw_mask_fade_param);
+be_define_const_str(lv_draw_mask_fade_param, "lv_draw_mask_fade_param", 2743309964u, 0, 23, NULL);
+be_define_const_str(SBR_TX, "SBR_TX", 3419096015u, 0, 6, &be_const_str_ZEROCROSS);
+be_define_const_str(ZEROCROSS, "ZEROCROSS", 1747596785u, 0, 9, &be_const_str_tostring);
+be_define_const_str(tostring, "tostring", 2299708645u, 0, 8, NULL);
+be_define_const_str(AS608_RX, "AS608_RX", 4275502016u, 0, 8, &be_const_str_PWM1);
+be_define_const_str(PWM1, "PWM1", 1353352426u, 0, 4, NULL);
+be_define_const_str(FTC532, "FTC532", 3182343438u, 0, 6, &be_const_str_remove_driver);
+be_define_const_str(remove_driver, "remove_driver", 1030243768u, 0, 13, &be_const_str_top);
+be_define_const_str(top, "top", 2802900028u, 0, 3, NULL);
 
 static const bstring* const m_string_table[] = {
-    NULL,
-    (const bstring *)&be_const_str_lv_style,
-    (const bstring *)&be_const_str_ETH_PHY_MDIO,
-    (const bstring *)&be_const_str_bus,
-    (const bstring *)&be_const_str_ROT1A,
-    (const bstring *)&be_const_str_EPAPER42_CS,
-    (const bstring *)&be_const_str_MCP39F5_RST,
-    (const bstring *)&be_const_str_SYMBOL_SETTINGS,
-    (const bstring *)&be_const_str_pi,
-    (const bstring *)&be_const_str_acos,
-    NULL,
-    (const bstring *)&be_const_str_SYMBOL_BACKSPACE,
-    (const bstring *)&be_const_str_resp_cmnd,
-    (const bstring *)&be_const_str_NRG_SEL,
-    (const bstring *)&be_const_str_SYMBOL_OK,
-    (const bstring *)&be_const_str_SYMBOL_BATTERY_3,
-    (const bstring *)&be_const_str_ADC_TEMP,
-    (const bstring *)&be_const_str_SPI_DC,
-    (const bstring *)&be_const_str_MIEL_HVAC_RX,
-    (const bstring *)&be_const_str_SHELLY_DIMMER_RST_INV,
-    (const bstring *)&be_const_str_MAX7219CS,
-    (const bstring *)&be_const_str_SDM72_RX,
+    (const bstring *)&be_const_str_DDSU666_TX,
+    (const bstring *)&be_const_str_sin,
     (const bstring *)&be_const_str_ADC_LIGHT,
-    (const bstring *)&be_const_str_lv_dropdown,
-    NULL,
-    (const bstring *)&be_const_str_A4988_DIR,
-    (const bstring *)&be_const_str_IEM3000_TX,
-    (const bstring *)&be_const_str_BS814_DAT,
-    (const bstring *)&be_const_str_opt_add,
-    NULL,
-    (const bstring *)&be_const_str_delay,
-    (const bstring *)&be_const_str_iter,
-    (const bstring *)&be_const_str_fromstring,
-    NULL,
-    (const bstring *)&be_const_str_CNTR1_NP,
-    NULL,
-    (const bstring *)&be_const_str_tanh,
-    (const bstring *)&be_const_str_lv_objmask,
+    (const bstring *)&be_const_str_ADC_RANGE,
     (const bstring *)&be_const_str_SOLAXX1_RX,
-    (const bstring *)&be_const_str_HRE_CLOCK,
-    (const bstring *)&be_const_str_SYMBOL_AUDIO,
+    (const bstring *)&be_const_str_TASMOTACLIENT_RST_INV,
+    (const bstring *)&be_const_str_SPI_CS,
     NULL,
-    (const bstring *)&be_const_str_RC522_CS,
-    (const bstring *)&be_const_str_REL1,
+    (const bstring *)&be_const_str_RA8876_CS,
+    (const bstring *)&be_const_str_lv_spinbox,
+    (const bstring *)&be_const_str_ADC_BUTTON,
+    (const bstring *)&be_const_str_lv_slider,
+    (const bstring *)&be_const_str_SYMBOL_BULLET,
+    (const bstring *)&be_const_str_get_option,
+    (const bstring *)&be_const_str_ADC_PH,
+    NULL,
+    (const bstring *)&be_const_str_BS814_CLK,
+    (const bstring *)&be_const_str_BS814_DAT,
+    (const bstring *)&be_const_str_SYMBOL_LOOP,
+    (const bstring *)&be_const_str_A4988_STP,
+    (const bstring *)&be_const_str_ZIGBEE_RX,
+    (const bstring *)&be_const_str_SYMBOL_UP,
+    (const bstring *)&be_const_str_WEBCAM_SIOD,
     NULL,
-    (const bstring *)&be_const_str_PZEM016_RX,
-    (const bstring *)&be_const_str_SYMBOL_TRASH,
-    (const bstring *)&be_const_str_REL1_INV,
-    (const bstring *)&be_const_str_FTC532,
-    (const bstring *)&be_const_str_opt_neq,
-    (const bstring *)&be_const_str_ADC_INPUT,
-    (const bstring *)&be_const_str_cmd,
-    (const bstring *)&be_const_str_lv_btn,
-    (const bstring *)&be_const_str_gc,
-    (const bstring *)&be_const_str_WINDMETER_SPEED,
-    (const bstring *)&be_const_str_WEBCAM_SIOC,
-    (const bstring *)&be_const_str_I2C_SCL,
-    (const bstring *)&be_const_str_RISING,
-    (const bstring *)&be_const_str__read,
-    (const bstring *)&be_const_str_SYMBOL_SHUFFLE,
-    (const bstring *)&be_const_str_DDSU666_TX,
-    (const bstring *)&be_const_str_RFRECV,
     (const bstring *)&be_const_str_PZEM017_RX,
-    (const bstring *)&be_const_str_KEY1_INV,
-    (const bstring *)&be_const_str_ADC_BUTTON,
-    (const bstring *)&be_const_str_get_tasmota,
-    (const bstring *)&be_const_str_MIEL_HVAC_TX,
+    (const bstring *)&be_const_str_ST7789_DC,
+    (const bstring *)&be_const_str_opt_call,
+    (const bstring *)&be_const_str_setbits,
+    (const bstring *)&be_const_str_SYMBOL_MINUS,
     NULL,
-    (const bstring *)&be_const_str_SPI_MOSI,
-    (const bstring *)&be_const_str_MD5,
     (const bstring *)&be_const_str_PMS5003_RX,
-    (const bstring *)&be_const_str_dump,
-    (const bstring *)&be_const_str_SYMBOL_EYE_CLOSE,
-    (const bstring *)&be_const_str_SYMBOL_IMAGE,
-    (const bstring *)&be_const_str_HPMA_RX,
-    (const bstring *)&be_const_str_CC1101_GDO0,
-    (const bstring *)&be_const_str_super,
-    (const bstring *)&be_const_str_TCP_RX,
-    (const bstring *)&be_const_str_HPMA_TX,
-    (const bstring *)&be_const_str_TCP_TX,
-    (const bstring *)&be_const_str_remove_rule,
-    (const bstring *)&be_const_str_KEY1_TC,
-    (const bstring *)&be_const_str_lv_cont,
-    NULL,
-    (const bstring *)&be_const_str_every_100ms,
     (const bstring *)&be_const_str_CSE7766_TX,
-    (const bstring *)&be_const_str_SM2135_DAT,
-    (const bstring *)&be_const_str_input,
+    (const bstring *)&be_const_str_reverse_gamma10,
+    (const bstring *)&be_const_str_lv_led,
+    (const bstring *)&be_const_str_SSPI_SCLK,
+    (const bstring *)&be_const_str_lv_draw_mask_line_param_cfg,
+    (const bstring *)&be_const_str_SM16716_DAT,
+    (const bstring *)&be_const_str_CC1101_GDO0,
+    (const bstring *)&be_const_str_digital_read,
+    (const bstring *)&be_const_str_lv_gauge_format_cb,
+    (const bstring *)&be_const_str_read32,
+    (const bstring *)&be_const_str_P9813_CLK,
     (const bstring *)&be_const_str_IRRECV,
-    (const bstring *)&be_const_str_MGC3130_RESET,
-    (const bstring *)&be_const_str_resp_cmnd_failed,
-    (const bstring *)&be_const_str_ADC_RANGE,
-    (const bstring *)&be_const_str_PZEM0XX_TX,
-    (const bstring *)&be_const_str_LEDLNK_INV,
-    (const bstring *)&be_const_str__end_transmission,
-    (const bstring *)&be_const_str_get,
-    (const bstring *)&be_const_str_SPI_MISO,
     NULL,
-    (const bstring *)&be_const_str_format,
-    (const bstring *)&be_const_str_MAX7219DIN,
-    (const bstring *)&be_const_str_HM10_RX,
-    (const bstring *)&be_const_str_getbits,
     NULL,
-    (const bstring *)&be_const_str_A4988_MS1,
+    (const bstring *)&be_const_str_module,
+    (const bstring *)&be_const_str_ROT1B_NP,
+    (const bstring *)&be_const_str_SYMBOL_VOLUME_MID,
+    (const bstring *)&be_const_str_lv_win,
+    (const bstring *)&be_const_str_AZ_RXD,
+    (const bstring *)&be_const_str_SYMBOL_FILE,
+    (const bstring *)&be_const_str_PULLUP,
+    (const bstring *)&be_const_str_SM2135_DAT,
+    (const bstring *)&be_const_str_ILI9488_CS,
+    (const bstring *)&be_const_str_count,
     NULL,
+    (const bstring *)&be_const_str_SHELLY_DIMMER_BOOT0,
+    (const bstring *)&be_const_str_content_button,
+    (const bstring *)&be_const_str_CNTR1_NP,
+    (const bstring *)&be_const_str_KEY1_TC,
+    (const bstring *)&be_const_str_state,
+    (const bstring *)&be_const_str_deg,
     NULL,
-    (const bstring *)&be_const_str_NRF24_CS,
-    (const bstring *)&be_const_str_SSD1331_DC,
-    (const bstring *)&be_const_str_PMS5003_TX,
-    (const bstring *)&be_const_str_exec_cmd,
-    (const bstring *)&be_const_str_HLW_CF,
-    (const bstring *)&be_const_str_SYMBOL_DIRECTORY,
-    (const bstring *)&be_const_str_ST7789_CS,
-    (const bstring *)&be_const_str_SYMBOL_BATTERY_FULL,
-    (const bstring *)&be_const_str_log10,
-    (const bstring *)&be_const_str_TXD,
-    (const bstring *)&be_const_str_SYMBOL_EYE_OPEN,
-    (const bstring *)&be_const_str_EXS_ENABLE,
-    (const bstring *)&be_const_str_PROJECTOR_CTRL_RX,
-    (const bstring *)&be_const_str_SBR_TX,
-    (const bstring *)&be_const_str_MAX31855DO,
-    (const bstring *)&be_const_str_byte,
-    (const bstring *)&be_const_str_write,
+    (const bstring *)&be_const_str_SR04_TRIG,
+    (const bstring *)&be_const_str_EPAPER29_CS,
+    (const bstring *)&be_const_str_DYP_RX,
+    (const bstring *)&be_const_str_RC522_CS,
+    (const bstring *)&be_const_str_lv_draw_mask_fade_param_cfg,
+    (const bstring *)&be_const_str_ADC_INPUT,
     NULL,
-    (const bstring *)&be_const_str_GPS_TX,
-    (const bstring *)&be_const_str_ELECTRIQ_MOODL_TX,
-    (const bstring *)&be_const_str_lv_switch,
-    (const bstring *)&be_const_str_SAIR_RX,
-    (const bstring *)&be_const_str_SSPI_MAX31865_CS1,
-    (const bstring *)&be_const_str_DHT22,
-    (const bstring *)&be_const_str_deinit,
     NULL,
-    (const bstring *)&be_const_str_SYMBOL_FILE,
-    (const bstring *)&be_const_str_ROT1A_NP,
+    (const bstring *)&be_const_str_LEDLNK,
+    (const bstring *)&be_const_str_pin_used,
+    (const bstring *)&be_const_str_lv_tileview,
+    (const bstring *)&be_const_str_WEBCAM_HREF,
+    (const bstring *)&be_const_str_DSB_OUT,
     (const bstring *)&be_const_str_IEM3000_RX,
+    (const bstring *)&be_const_str_get_power,
     NULL,
-    (const bstring *)&be_const_str_has_arg,
-    (const bstring *)&be_const_str_SSPI_MOSI,
-    (const bstring *)&be_const_str_CSE7761_TX,
+    (const bstring *)&be_const_str_get_tasmota,
+    (const bstring *)&be_const_str_detect,
+    (const bstring *)&be_const_str_lv_draw_mask_angle_param,
+    (const bstring *)&be_const_str_SR04_ECHO,
+    (const bstring *)&be_const_str_SAIR_RX,
+    (const bstring *)&be_const_str_every_100ms,
+    (const bstring *)&be_const_str_TFMINIPLUS_RX,
+    (const bstring *)&be_const_str_KEY1_INV_NP,
+    (const bstring *)&be_const_str_display,
+    (const bstring *)&be_const_str_OUTPUT_LO,
+    (const bstring *)&be_const_str_AZ_TXD,
+    (const bstring *)&be_const_str_SYMBOL_PLAY,
+    (const bstring *)&be_const_str_SYMBOL_BATTERY_3,
+    (const bstring *)&be_const_str_SYMBOL_PLUS,
+    (const bstring *)&be_const_str_KEY1_INV,
+    (const bstring *)&be_const_str_MIEL_HVAC_TX,
+    (const bstring *)&be_const_str_CNTR1,
+    (const bstring *)&be_const_str_TX2X_TXD_BLACK,
     (const bstring *)&be_const_str_LMT01,
-    (const bstring *)&be_const_str_PN532_RXD,
-    (const bstring *)&be_const_str_INPUT_PULLDOWN,
-    (const bstring *)&be_const_str_CSE7761_RX,
-    (const bstring *)&be_const_str_NRG_SEL_INV,
+    (const bstring *)&be_const_str_lv_btn,
+    (const bstring *)&be_const_str_iter,
     NULL,
-    (const bstring *)&be_const_str_ILI9488_CS,
-    (const bstring *)&be_const_str_opt_call,
+    (const bstring *)&be_const_str_,
+    (const bstring *)&be_const_str_OUTPUT_HI,
+    (const bstring *)&be_const_str___iterator__,
+    (const bstring *)&be_const_str_DSB,
     NULL,
-    (const bstring *)&be_const_str_SHELLY_DIMMER_BOOT0,
-    (const bstring *)&be_const_str_LED1,
-    (const bstring *)&be_const_str_INPUT_PULLUP,
-    (const bstring *)&be_const_str_MAX31855CLK,
-    (const bstring *)&be_const_str_SYMBOL_GPS,
-    (const bstring *)&be_const_str_SWT1_NP,
-    (const bstring *)&be_const_str_dot_def,
-    (const bstring *)&be_const_str_DHT11,
-    (const bstring *)&be_const_str_ETH_PHY_POWER,
-    (const bstring *)&be_const_str_TFMINIPLUS_TX,
-    (const bstring *)&be_const_str_EPAPER29_CS,
-    (const bstring *)&be_const_str_event,
-    (const bstring *)&be_const_str_ADC_JOY,
+    (const bstring *)&be_const_str_DEEPSLEEP,
+    (const bstring *)&be_const_str_MCP39F5_RX,
+    (const bstring *)&be_const_str_ETH_PHY_MDIO,
+    (const bstring *)&be_const_str_SDM630_RX,
+    (const bstring *)&be_const_str_TASMOTACLIENT_TXD,
+    (const bstring *)&be_const_str_ZIGBEE_RST,
+    NULL,
+    (const bstring *)&be_const_str_SYMBOL_MUTE,
+    (const bstring *)&be_const_str_lv_arc,
+    (const bstring *)&be_const_str_SYMBOL_SAVE,
+    (const bstring *)&be_const_str_WEBCAM_PSCLK,
+    (const bstring *)&be_const_str_REL1,
+    (const bstring *)&be_const_str_GPS_TX,
     (const bstring *)&be_const_str_CSE7766_RX,
-    (const bstring *)&be_const_str_IRSEND,
-    (const bstring *)&be_const_str_RFSEND,
-    (const bstring *)&be_const_str_TX2X_TXD_BLACK,
+    (const bstring *)&be_const_str_HX711_DAT,
+    (const bstring *)&be_const_str_SM2135_CLK,
+    (const bstring *)&be_const_str_chars_in_string,
+    (const bstring *)&be_const_str_SDS0X1_TX,
+    (const bstring *)&be_const_str_cos,
+    (const bstring *)&be_const_str_get,
+    (const bstring *)&be_const_str_KEY1_NP,
+    (const bstring *)&be_const_str__cb,
+    (const bstring *)&be_const_str_dot_def,
     (const bstring *)&be_const_str_TUYA_RX,
+    (const bstring *)&be_const_str_DCKI,
+    (const bstring *)&be_const_str_lv_cpicker,
+    (const bstring *)&be_const_str_find,
+    (const bstring *)&be_const_str_EXS_ENABLE,
+    (const bstring *)&be_const_str_NEOPOOL_RX,
+    (const bstring *)&be_const_str_KEY1,
+    (const bstring *)&be_const_str_rtc,
+    (const bstring *)&be_const_str_WE517_TX,
+    (const bstring *)&be_const_str_SSD1331_CS,
+    (const bstring *)&be_const_str_LE01MR_RX,
+    (const bstring *)&be_const_str_opt_add,
+    (const bstring *)&be_const_str_ETH_PHY_MDC,
+    (const bstring *)&be_const_str_format,
+    (const bstring *)&be_const_str_RC522_RST,
+    (const bstring *)&be_const_str_HPMA_TX,
+    (const bstring *)&be_const_str_NRG_SEL,
+    (const bstring *)&be_const_str_insert,
+    (const bstring *)&be_const_str_time_dump,
     NULL,
-    (const bstring *)&be_const_str_HRE_DATA,
-    (const bstring *)&be_const_str_DDSU666_RX,
-    (const bstring *)&be_const_str_SM16716_SEL,
-    (const bstring *)&be_const_str_ADC_BUTTON_INV,
-    (const bstring *)&be_const_str_MP3_DFR562,
-    (const bstring *)&be_const_str_rad,
-    (const bstring *)&be_const_str_ARIRFSEL,
-    (const bstring *)&be_const_str_lv_group_focus_cb,
-    (const bstring *)&be_const_str_SENSOR_END,
-    (const bstring *)&be_const_str_codedump,
-    (const bstring *)&be_const_str_CNTR1,
-    (const bstring *)&be_const_str_DDS2382_TX,
-    (const bstring *)&be_const_str_SSPI_MISO,
-    (const bstring *)&be_const_str_pop,
-    (const bstring *)&be_const_str_SDCARD_CS,
+    (const bstring *)&be_const_str_dot_p,
+    (const bstring *)&be_const_str_nil,
+    (const bstring *)&be_const_str_add_driver,
+    (const bstring *)&be_const_str_HM10_RX,
+    (const bstring *)&be_const_str_SM16716_CLK,
+    (const bstring *)&be_const_str_SPI_MOSI,
+    (const bstring *)&be_const_str_OLED_RESET,
+    (const bstring *)&be_const_str_SYMBOL_CALL,
+    (const bstring *)&be_const_str_SYMBOL_POWER,
     (const bstring *)&be_const_str_I2C_Driver,
-    (const bstring *)&be_const_str_BOILER_OT_TX,
+    (const bstring *)&be_const_str_SWT1_NP,
+    (const bstring *)&be_const_str_ADC_TEMP,
+    (const bstring *)&be_const_str_SPI_DC,
+    (const bstring *)&be_const_str_MCP39F5_RST,
     NULL,
-    (const bstring *)&be_const_str_CHANGE,
-    (const bstring *)&be_const_str_lv_draw_rect_dsc,
-    (const bstring *)&be_const_str_ST7789_DC,
-    (const bstring *)&be_const_str_var,
-    (const bstring *)&be_const_str_MCP39F5_TX,
-    (const bstring *)&be_const_str_AS608_TX,
-    (const bstring *)&be_const_str_get_free_heap,
+    (const bstring *)&be_const_str_NEOPOOL_TX,
+    (const bstring *)&be_const_str_opt_connect,
+    (const bstring *)&be_const_str_find_key_i,
+    (const bstring *)&be_const_str__bec_valid,
+    (const bstring *)&be_const_str_save_before_restart,
+    (const bstring *)&be_const_str_DHT11,
+    (const bstring *)&be_const_str_import,
+    (const bstring *)&be_const_str_opt_neq,
+    (const bstring *)&be_const_str_PN532_RXD,
+    (const bstring *)&be_const_str_incremental,
+    (const bstring *)&be_const_str_PZEM0XX_TX,
+    (const bstring *)&be_const_str_IBEACON_RX,
+    (const bstring *)&be_const_str_run_deferred,
+    (const bstring *)&be_const_str_MAX31855CLK,
+    (const bstring *)&be_const_str_I2C_SCL,
+    (const bstring *)&be_const_str_add_cmd,
+    (const bstring *)&be_const_str_pin,
     NULL,
-    (const bstring *)&be_const_str_KEY1,
+    (const bstring *)&be_const_str_DDS2382_RX,
+    (const bstring *)&be_const_str_SYMBOL_BATTERY_1,
+    (const bstring *)&be_const_str_lv_indev,
+    (const bstring *)&be_const_str_SYMBOL_SETTINGS,
     NULL,
-    (const bstring *)&be_const_str_BUZZER_INV,
-    (const bstring *)&be_const_str_lv_roller,
-    (const bstring *)&be_const_str_ADC_CT_POWER,
-    (const bstring *)&be_const_str_asstring,
-    (const bstring *)&be_const_str_NONE,
-    (const bstring *)&be_const_str_exp,
-    (const bstring *)&be_const_str_BL0940_RX,
-    (const bstring *)&be_const_str_check_privileged_access,
-    (const bstring *)&be_const_str_opt_eq,
-    (const bstring *)&be_const_str_PULLDOWN,
-    (const bstring *)&be_const_str_,
-    (const bstring *)&be_const_str_SYMBOL_LOOP,
+    (const bstring *)&be_const_str_INPUT,
+    (const bstring *)&be_const_str_MIEL_HVAC_RX,
+    (const bstring *)&be_const_str_RXD,
+    (const bstring *)&be_const_str_rand,
+    (const bstring *)&be_const_str_RFRECV,
+    (const bstring *)&be_const_str_XPT2046_CS,
+    NULL,
+    (const bstring *)&be_const_str_MAX7219CS,
+    (const bstring *)&be_const_str_SDM630_TX,
+    (const bstring *)&be_const_str_HLW_CF,
     (const bstring *)&be_const_str_MHZ_RXD,
-    (const bstring *)&be_const_str_BACKLIGHT,
+    (const bstring *)&be_const_str_lv_draw_rect_dsc,
+    (const bstring *)&be_const_str_cmd,
+    (const bstring *)&be_const_str_OPTION_A,
+    (const bstring *)&be_const_str_split,
+    (const bstring *)&be_const_str_CSE7761_TX,
+    (const bstring *)&be_const_str_LE01MR_TX,
+    (const bstring *)&be_const_str_ETH_PHY_POWER,
+    (const bstring *)&be_const_str__rules,
+    (const bstring *)&be_const_str_ROT1A,
+    (const bstring *)&be_const_str_MD5,
+    (const bstring *)&be_const_str_compile,
+    (const bstring *)&be_const_str_TXD,
+    (const bstring *)&be_const_str_register_button_encoder,
+    (const bstring *)&be_const_str_CHANGE,
+    (const bstring *)&be_const_str_write_bytes,
+    (const bstring *)&be_const_str_ARIRFSEL,
+    (const bstring *)&be_const_str_FALLING,
+    (const bstring *)&be_const_str_SDM120_TX,
+    (const bstring *)&be_const_str_SYMBOL_CLOSE,
+    (const bstring *)&be_const_str_LED1_INV,
     NULL,
+    (const bstring *)&be_const_str_BOILER_OT_RX,
+    (const bstring *)&be_const_str_SPI_MISO,
+    (const bstring *)&be_const_str_A4988_MS1,
+    (const bstring *)&be_const_str_SYMBOL_DRIVE,
+    (const bstring *)&be_const_str_ROT1B,
+    (const bstring *)&be_const_str_DHT11_OUT,
+    (const bstring *)&be_const_str_LED1,
+    (const bstring *)&be_const_str_BACKLIGHT,
+    (const bstring *)&be_const_str_SYMBOL_EJECT,
+    (const bstring *)&be_const_str_CSE7761_RX,
+    (const bstring *)&be_const_str_MAX7219DIN,
+    (const bstring *)&be_const_str_continue,
+    (const bstring *)&be_const_str_TCP_RX,
+    (const bstring *)&be_const_str_int,
+    (const bstring *)&be_const_str_VL53L0X_XSHUT1,
+    (const bstring *)&be_const_str_SSPI_MAX31865_CS1,
+    (const bstring *)&be_const_str_BUZZER_INV,
+    (const bstring *)&be_const_str_TELEINFO_RX,
+    (const bstring *)&be_const_str_MP3_DFR562,
     NULL,
-    (const bstring *)&be_const_str_PULLUP,
-    (const bstring *)&be_const_str_SR04_ECHO,
+    (const bstring *)&be_const_str_as,
+    (const bstring *)&be_const_str_read12,
+    (const bstring *)&be_const_str_BUZZER,
+    (const bstring *)&be_const_str_SYMBOL_STOP,
+    (const bstring *)&be_const_str_MHZ_TXD,
+    (const bstring *)&be_const_str_HX711_SCK,
+    (const bstring *)&be_const_str_remove_timer,
+    (const bstring *)&be_const_str_DDSU666_RX,
+    (const bstring *)&be_const_str_SYMBOL_BATTERY_EMPTY,
+    (const bstring *)&be_const_str_SYMBOL_RIGHT,
+    (const bstring *)&be_const_str_cb_dispatch,
+    (const bstring *)&be_const_str_SOLAXX1_TX,
+    (const bstring *)&be_const_str_HIGH,
     NULL,
-    (const bstring *)&be_const_str_ADE7953_IRQ,
-    (const bstring *)&be_const_str_SYMBOL_PREV,
-    (const bstring *)&be_const_str_HX711_DAT,
-    (const bstring *)&be_const_str_dot_p,
-    (const bstring *)&be_const_str_GPS_RX,
-    (const bstring *)&be_const_str_AZ_RXD,
-    (const bstring *)&be_const_str_Tasmota,
-    (const bstring *)&be_const_str_srand,
+    (const bstring *)&be_const_str_A4988_DIR,
+    (const bstring *)&be_const_str_ILI9341_DC,
+    (const bstring *)&be_const_str_CC1101_GDO2,
+    (const bstring *)&be_const_str_item,
+    (const bstring *)&be_const_str_ELECTRIQ_MOODL_TX,
+    (const bstring *)&be_const_str_OPEN_DRAIN,
+    (const bstring *)&be_const_str_TCP_TX,
     NULL,
-    (const bstring *)&be_const_str_LOW,
-    (const bstring *)&be_const_str_DDS2382_RX,
-    (const bstring *)&be_const_str_SDM120_RX,
-    (const bstring *)&be_const_str_wire_scan,
-    (const bstring *)&be_const_str_SBR_RX,
-    (const bstring *)&be_const_str_PWM1_INV,
-    (const bstring *)&be_const_str_ETH_PHY_MDC,
-    (const bstring *)&be_const_str_run_deferred,
-    (const bstring *)&be_const_str_SYMBOL_REFRESH,
-    (const bstring *)&be_const_str_TASMOTACLIENT_RXD,
+    (const bstring *)&be_const_str_SI7021,
+    (const bstring *)&be_const_str_SYMBOL_PAUSE,
     NULL,
-    (const bstring *)&be_const_str_PROJECTOR_CTRL_TX,
-    (const bstring *)&be_const_str_SYMBOL_VOLUME_MAX,
-    (const bstring *)&be_const_str_MAX7219CLK,
-    (const bstring *)&be_const_str_WEBCAM_PCLK,
-    (const bstring *)&be_const_str_try,
+    (const bstring *)&be_const_str_SYMBOL_CUT,
+    (const bstring *)&be_const_str_SYMBOL_COPY,
+    (const bstring *)&be_const_str_ADC_BUTTON_INV,
     (const bstring *)&be_const_str_EPD_DATA,
-    (const bstring *)&be_const_str_ADC_PH,
+    (const bstring *)&be_const_str_asstring,
+    (const bstring *)&be_const_str_RISING,
+    (const bstring *)&be_const_str_SYMBOL_DOWNLOAD,
+    (const bstring *)&be_const_str_LEDLNK_INV,
+    (const bstring *)&be_const_str_GPS_RX,
+    (const bstring *)&be_const_str_DHT22,
+    (const bstring *)&be_const_str_DDS2382_TX,
+    (const bstring *)&be_const_str_resolvecmnd,
+    (const bstring *)&be_const_str_lv_group_focus_cb,
+    (const bstring *)&be_const_str_HALLEFFECT,
+    (const bstring *)&be_const_str_SYMBOL_DUMMY,
+    (const bstring *)&be_const_str_event,
+    (const bstring *)&be_const_str_lv_table,
+    (const bstring *)&be_const_str_MAX31855CS,
+    (const bstring *)&be_const_str_ADC_JOY,
+    (const bstring *)&be_const_str_BOILER_OT_TX,
+    (const bstring *)&be_const_str_ARIRFRCV,
+    (const bstring *)&be_const_str_AS3935,
     NULL,
     NULL,
-    (const bstring *)&be_const_str_IBEACON_TX,
+    (const bstring *)&be_const_str_allocated,
+    (const bstring *)&be_const_str_SDM72_TX,
+    (const bstring *)&be_const_str_SYMBOL_GPS,
+    (const bstring *)&be_const_str_MGC3130_RESET,
+    (const bstring *)&be_const_str_A4988_ENA,
+    (const bstring *)&be_const_str_HRE_DATA,
+    (const bstring *)&be_const_str__request_from,
+    (const bstring *)&be_const_str_opt_eq,
+    (const bstring *)&be_const_str_IRSEND,
+    (const bstring *)&be_const_str_lv_img,
     NULL,
-    (const bstring *)&be_const_str_OLED_RESET,
-    (const bstring *)&be_const_str_scan,
-    (const bstring *)&be_const_str_SDS0X1_RX,
+    (const bstring *)&be_const_str_BL0940_RX,
+    (const bstring *)&be_const_str_OUTPUT,
+    (const bstring *)&be_const_str_SAIR_TX,
+    (const bstring *)&be_const_str_ADE7953_IRQ,
+    (const bstring *)&be_const_str_SDCARD_CS,
+    (const bstring *)&be_const_str_AS608_TX,
+    (const bstring *)&be_const_str_SBR_TX,
     (const bstring *)&be_const_str_AS608_RX,
-    (const bstring *)&be_const_str_opt_connect,
-    (const bstring *)&be_const_str__timers,
-    (const bstring *)&be_const_str_lv_draw_img_dsc,
-    NULL,
-    (const bstring *)&be_const_str_HIGH,
-    (const bstring *)&be_const_str_DSB,
-    NULL,
-    (const bstring *)&be_const_str_ARIRFRCV,
-    (const bstring *)&be_const_str_NRF24_DC,
-    (const bstring *)&be_const_str_SYMBOL_STOP,
-    (const bstring *)&be_const_str_A4988_STP,
-    (const bstring *)&be_const_str_WEBCAM_PSRCS,
-    NULL,
-    (const bstring *)&be_const_str_OUTPUT_LO,
-    (const bstring *)&be_const_str_push,
-    (const bstring *)&be_const_str_cos,
-    (const bstring *)&be_const_str_set_timer,
-    (const bstring *)&be_const_str_DEEPSLEEP,
-    (const bstring *)&be_const_str_SDM630_RX,
-    (const bstring *)&be_const_str_DI,
-    (const bstring *)&be_const_str_INPUT,
-    (const bstring *)&be_const_str_SYMBOL_SD_CARD,
-    (const bstring *)&be_const_str_CC1101_GDO2,
-    (const bstring *)&be_const_str_copy,
-    (const bstring *)&be_const_str_SR04_TRIG,
     NULL,
-    (const bstring *)&be_const_str_HALLEFFECT,
-    (const bstring *)&be_const_str_imin,
-    (const bstring *)&be_const_str_SYMBOL_VIDEO,
-    (const bstring *)&be_const_str_SYMBOL_LIST,
-    (const bstring *)&be_const_str_AZ_TXD,
-    (const bstring *)&be_const_str_end,
-    (const bstring *)&be_const_str_SYMBOL_BATTERY_EMPTY,
-    (const bstring *)&be_const_str_for,
-    (const bstring *)&be_const_str_BUZZER,
-    (const bstring *)&be_const_str_SSPI_SCLK,
-    (const bstring *)&be_const_str_issubclass,
-    (const bstring *)&be_const_str_WEBCAM_HREF,
-    (const bstring *)&be_const_str_Driver,
-    (const bstring *)&be_const_str_OPTION_A,
-    (const bstring *)&be_const_str_IBEACON_RX,
-    (const bstring *)&be_const_str_HM10_TX,
-    (const bstring *)&be_const_str_BOILER_OT_RX,
-    (const bstring *)&be_const_str_item,
-    (const bstring *)&be_const_str_SDS0X1_TX,
-    (const bstring *)&be_const_str_OPEN_DRAIN,
-    (const bstring *)&be_const_str__rules,
-    (const bstring *)&be_const_str_insert,
-    (const bstring *)&be_const_str_web_add_config_button,
-    (const bstring *)&be_const_str_SYMBOL_BULLET,
-    (const bstring *)&be_const_str_SYMBOL_UPLOAD,
-    (const bstring *)&be_const_str_lv_draw_mask_common_dsc,
-    (const bstring *)&be_const_str_LE01MR_RX,
-    (const bstring *)&be_const_str_web_add_main_button,
-    (const bstring *)&be_const_str_floor,
-    (const bstring *)&be_const_str_DCKI,
-    (const bstring *)&be_const_str_ILI9341_CS
+    (const bstring *)&be_const_str_FTC532,
+    NULL
 };
 
 static const struct bconststrtab m_const_string_table = {
-    .size = 306,
-    .count = 612,
+    .size = 310,
+    .count = 620,
     .table = m_string_table
 };
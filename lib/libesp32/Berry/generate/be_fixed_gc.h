@@ -1,13 +1,17 @@
 #include "be_constobj.h"
 
 static be_define_const_map_slots(m_libgc_map) {
+    { be_const_key(pool, -1), be_const_func(m_pool) },
+    { be_const_key(incremental, 0), be_const_func(m_incremental) },
+    { be_const_key(stats, -1), be_const_func(m_stats) },
+    { be_const_key(collect, 1), be_const_func(m_collect) },
     { be_const_key(allocated, -1), be_const_func(m_allocated) },
-    { be_const_key(collect, -1), be_const_func(m_collect) },
+    { be_const_key(step, -1), be_const_func(m_step) },
 };
 
 static be_define_const_map(
     m_libgc_map,
-    2
+    6
 );
 
 static be_define_const_module(
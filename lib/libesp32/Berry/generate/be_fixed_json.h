@@ -1,13 +1,14 @@
 #include "be_constobj.h"
 
 static be_define_const_map_slots(m_libjson_map) {
-    { be_const_key(dump, -1), be_const_func(m_json_dump) },
+    { be_const_key(find, -1), be_const_func(m_json_find) },
     { be_const_key(load, 0), be_const_func(m_json_load) },
+    { be_const_key(dump, -1), be_const_func(m_json_dump) },
 };
 
 static be_define_const_map(
     m_libjson_map,
-    2
+    3
 );
 
 static be_define_const_module(
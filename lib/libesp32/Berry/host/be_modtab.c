@@ -0,0 +1,76 @@
+/********************************************************************
+** Copyright (c) 2018-2020 Guan Wenliang
+** This file is part of the Berry default interpreter.
+** skiars@qq.com, https://github.com/Skiars/berry
+** See Copyright Notice in the LICENSE file or at
+** https://github.com/Skiars/berry/blob/master/LICENSE
+********************************************************************/
+/* Native modules of the host build used by `make bench`, the modules
+ * of the core library only.
+ **/
+#include "berry.h"
+#include <time.h>
+
+#if !BE_USE_TIME_MODULE
+/* the precompiled time module is not generated for Tasmota, the scripts
+ * only need time.clock() to measure the run time */
+static int m_clock(bvm *vm)
+{
+    be_pushreal(vm, clock() / (breal)CLOCKS_PER_SEC);
+    be_return(vm);
+}
+
+be_native_module_attr_table(time) {
+    be_native_module_function("clock", m_clock)
+};
+
+static be_define_native_module(time, NULL);
+#endif
+
+/* default modules declare */
+be_extern_native_module(string);
+be_extern_native_module(json);
+be_extern_native_module(math);
+#if BE_USE_TIME_MODULE
+be_extern_native_module(time);
+#endif
+be_extern_native_module(os);
+be_extern_native_module(global);
+be_extern_native_module(sys);
+be_extern_native_module(debug);
+be_extern_native_module(gc);
+be_extern_native_module(solidify);
+
+/* module list declaration */
+BERRY_LOCAL const bntvmodule* const be_module_table[] = {
+/* default modules register */
+#if BE_USE_STRING_MODULE
+    &be_native_module(string),
+#endif
+#if BE_USE_JSON_MODULE
+    &be_native_module(json),
+#endif
+#if BE_USE_MATH_MODULE
+    &be_native_module(math),
+#endif
+    &be_native_module(time),
+#if BE_USE_OS_MODULE
+    &be_native_module(os),
+#endif
+#if BE_USE_GLOBAL_MODULE
+    &be_native_module(global),
+#endif
+#if BE_USE_SYS_MODULE
+    &be_native_module(sys),
+#endif
+#if BE_USE_DEBUG_MODULE
+    &be_native_module(debug),
+#endif
+#if BE_USE_GC_MODULE
+    &be_native_module(gc),
+#endif
+#if BE_USE_SOLIDIFY_MODULE
+    &be_native_module(solidify),
+#endif
+    NULL /* do not remove */
+};
@@ -0,0 +1,72 @@
+/********************************************************************
+** Copyright (c) 2018-2020 Guan Wenliang
+** This file is part of the Berry default interpreter.
+** skiars@qq.com, https://github.com/Skiars/berry
+** See Copyright Notice in the LICENSE file or at
+** https://github.com/Skiars/berry/blob/master/LICENSE
+********************************************************************/
+/* Host port used by `make bench`: standard C file and console I/O
+ * instead of the Tasmota file system and logs of default/be_port.cpp.
+ **/
+#include "berry.h"
+#include "be_sys.h"
+#include <stdio.h>
+
+BERRY_API void be_writebuffer(const char *buffer, size_t length)
+{
+    fwrite(buffer, 1, length, stdout);
+}
+
+BERRY_API char* be_readstring(char *buffer, size_t size)
+{
+    return fgets(buffer, (int)size, stdin);
+}
+
+void* be_fopen(const char *filename, const char *modes)
+{
+    return fopen(filename, modes);
+}
+
+int be_fclose(void *hfile)
+{
+    return fclose(hfile);
+}
+
+size_t be_fwrite(void *hfile, const void *buffer, size_t length)
+{
+    return fwrite(buffer, 1, length, hfile);
+}
+
+size_t be_fread(void *hfile, void *buffer, size_t length)
+{
+    return fread(buffer, 1, length, hfile);
+}
+
+char* be_fgets(void *hfile, void *buffer, int size)
+{
+    return fgets(buffer, size, hfile);
+}
+
+int be_fseek(void *hfile, long offset)
+{
+    return fseek(hfile, offset, SEEK_SET);
+}
+
+long int be_ftell(void *hfile)
+{
+    return ftell(hfile);
+}
+
+long int be_fflush(void *hfile)
+{
+    return fflush(hfile);
+}
+
+size_t be_fsize(void *hfile)
+{
+    long int size, offset = ftell(hfile);
+    fseek(hfile, 0L, SEEK_END);
+    size = ftell(hfile);
+    fseek(hfile, offset, SEEK_SET);
+    return size;
+}
@@ -0,0 +1,46 @@
+/********************************************************************
+** Copyright (c) 2018-2020 Guan Wenliang
+** This file is part of the Berry default interpreter.
+** skiars@qq.com, https://github.com/Skiars/berry
+** See Copyright Notice in the LICENSE file or at
+** https://github.com/Skiars/berry/blob/master/LICENSE
+********************************************************************/
+/* Host interpreter used by `make bench`: runs the script given as first
+ * argument, the script and the following arguments are in `_argv`.
+ **/
+#include "berry.h"
+#include <stdio.h>
+
+static void push_args(bvm *vm, int argc, char *argv[])
+{
+    be_newobject(vm, "list");
+    while (argc--) {
+        be_pushstring(vm, *argv++);
+        be_data_push(vm, -2);
+        be_pop(vm, 1);
+    }
+    be_pop(vm, 1);
+    be_setglobal(vm, "_argv");
+    be_pop(vm, 1);
+}
+
+int main(int argc, char *argv[])
+{
+    int res = 1;
+    bvm *vm;
+    if (argc < 2) {
+        fprintf(stderr, "Usage: %s script.be [args]\n", argv[0]);
+        return res;
+    }
+    vm = be_vm_new();
+    push_args(vm, argc - 1, argv + 1);
+    res = be_loadfile(vm, argv[1]);
+    if (res == BE_OK) {
+        res = be_pcall(vm, 0);
+    }
+    if (res != BE_OK) {
+        be_dumpexcept(vm);
+    }
+    be_vm_delete(vm);
+    return res == BE_OK ? 0 : 1;
+}
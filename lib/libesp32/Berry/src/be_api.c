@@ -337,6 +337,21 @@ BERRY_API void be_pushnstring(bvm *vm, const char *str, size_t n)
     var_setstr(reg, s);
 }
 
+/* the string is created once and kept until the VM is deleted, natives
+ * push their keys with be_pushintern() without hashing them again */
+BERRY_API bstring* be_intern(bvm *vm, const char *str)
+{
+    bstring *s = be_newstr(vm, str);
+    be_gc_fix(vm, gc_object(s));
+    return s;
+}
+
+BERRY_API void be_pushintern(bvm *vm, bstring *s)
+{
+    bvalue *reg = be_incrtop(vm);
+    var_setstr(reg, s);
+}
+
 BERRY_API const char* be_pushfstring(bvm *vm, const char *format, ...)
 {
     const char* s;
@@ -615,6 +630,7 @@ BERRY_API bbool be_setmember(bvm *vm, int index, const char *k)
         bvalue *v = be_module_bind(vm, mod, key);
         if (v) {
             *v = *be_indexof(vm, -1);
+            be_gc_barrier(vm, v);
             return btrue;
         }
     }
@@ -724,6 +740,7 @@ BERRY_API bbool be_setindex(bvm *vm, int index)
     }
     if (dst) {
         var_setval(dst, v);
+        be_gc_barrier(vm, v);
         return btrue;
     }
     return bfalse;
@@ -754,6 +771,7 @@ BERRY_API bbool be_setupval(bvm *vm, int index, int pos)
         be_assert(pos >= 0 && pos < nf->nupvals);
         uv = be_ntvclos_upval(nf, pos)->value;
         var_setval(uv, v);
+        be_gc_barrier(vm, v);
         return btrue;
     }
     return bfalse;
@@ -23,7 +23,8 @@
 #define MAGIC_NUMBER1       0xBE
 #define MAGIC_NUMBER2       0xCD
 #define MAGIC_NUMBER3       0xFE
-#define BYTECODE_VERSION    1
+#define BYTECODE_VERSION    2
+#define HEADER_SIZE         8   /* the source stamp follows since version 2 */
 
 #define USE_64BIT_INT       (BE_INTGER_TYPE == 2 \
     || BE_INTGER_TYPE == 1 && LONG_MAX == 9223372036854775807L)
@@ -44,6 +45,26 @@ static uint8_t vm_sizeinfo(void)
     res |= (sizeof(breal) == 8) << 1;
     return res;
 }
+
+/* FNV-1a hash of the content of a source file, stamped in the bytecode
+ * saved from it. Returns 0 (not stamped) when the file can't be read. */
+static uint32_t source_hash(const char *path)
+{
+    uint32_t hash = 2166136261u;
+    uint8_t buffer[64];
+    size_t i, size;
+    void *fp = be_fopen(path, "rb");
+    if (fp == NULL) {
+        return 0;
+    }
+    while ((size = be_fread(fp, buffer, sizeof(buffer))) > 0) {
+        for (i = 0; i < size; ++i) {
+            hash = (hash ^ buffer[i]) * 16777619u;
+        }
+    }
+    be_fclose(fp);
+    return hash ? hash : 1;
+}
 #endif
 
 #if BE_USE_BYTECODE_SAVER
@@ -81,6 +102,7 @@ static void save_header(void *fp)
     buffer[3] = BYTECODE_VERSION;
     buffer[4] = vm_sizeinfo();
     be_fwrite(fp, buffer, sizeof(buffer));
+    save_long(fp, 0); /* source stamp, written when the file is complete */
 }
 
 static void save_int(void *fp, bint i)
@@ -184,7 +206,7 @@ static void save_bytecode(void *fp, bproto *proto)
     binstruction *code = proto->code, *end;
     save_long(fp, (uint32_t)proto->codesize);
     for (end = code + proto->codesize; code < end; ++code) {
-        save_long(fp, (uint32_t)*code);
+        save_long(fp, (uint32_t)be_vm_unfuse(*code)); /* save plain instructions */
     }
 }
 
@@ -267,6 +289,10 @@ void be_bytecode_save(bvm *vm, const char *filename, bproto *proto)
         save_header(fp);
         save_global_info(vm, fp);
         save_proto(vm, fp, proto);
+        /* stamp last so that an incomplete file is never up to date */
+        if (proto->source && be_fseek(fp, HEADER_SIZE) == 0) {
+            save_long(fp, source_hash(str(proto->source)));
+        }
         be_fclose(fp);
     }
 }
@@ -305,17 +331,21 @@ static uint32_t load_long(void *fp)
     return 0;
 }
 
-static int load_head(void *fp)
+/* returns the version of the bytecode file, 0 if it can't be loaded,
+ * and its source stamp (0 before version 2) */
+static int load_head(void *fp, uint32_t *stamp)
 {
-    int res;
-    uint8_t buffer[8] = { 0 };
+    uint8_t buffer[HEADER_SIZE] = { 0 };
     be_fread(fp, buffer, sizeof(buffer));
-    res = buffer[0] == MAGIC_NUMBER1 &&
-          buffer[1] == MAGIC_NUMBER2 &&
-          buffer[2] == MAGIC_NUMBER3 &&
-          buffer[3] == BYTECODE_VERSION &&
-          buffer[4] == vm_sizeinfo();
-    return res;
+    if (buffer[0] == MAGIC_NUMBER1 &&
+        buffer[1] == MAGIC_NUMBER2 &&
+        buffer[2] == MAGIC_NUMBER3 &&
+        buffer[3] >= 1 && buffer[3] <= BYTECODE_VERSION &&
+        buffer[4] == vm_sizeinfo()) {
+        *stamp = buffer[3] >= 2 ? load_long(fp) : 0;
+        return buffer[3];
+    }
+    return 0;
 }
 
 bbool be_bytecode_check(const char *path)
@@ -334,6 +364,25 @@ bbool be_bytecode_check(const char *path)
     return bfalse;
 }
 
+/* the bytecode file was saved from the current content of the source
+ * file with the same builtins, it can be loaded instead of compiling
+ * the source again */
+bbool be_bytecode_current(bvm *vm, const char *path, const char *source)
+{
+    bbool res = bfalse;
+    void *fp = be_fopen(path, "rb");
+    if (fp) {
+        uint32_t stamp;
+        if (load_head(fp, &stamp) == BYTECODE_VERSION) {
+            int bcnt = (int)load_long(fp); /* builtin count */
+            res = stamp != 0 && bcnt == be_builtin_count(vm)
+                && stamp == source_hash(source);
+        }
+        be_fclose(fp);
+    }
+    return res;
+}
+
 static bint load_int(void *fp)
 {
 #if USE_64BIT_INT
@@ -446,6 +495,7 @@ static void load_bytecode(bvm *vm, void *fp, bproto *proto, int info)
             }
             *code = ins;
         }
+        be_vm_fuse(proto->code, size); /* create superinstructions */
     }
 }
 
@@ -526,11 +576,12 @@ void load_global_info(bvm *vm, void *fp)
 
 bclosure* be_bytecode_load(bvm *vm, const char *filename)
 {
+    uint32_t stamp;
     void *fp = be_fopen(filename, "rb");
     if (fp == NULL) {
         bytecode_error(vm, be_pushfstring(vm,
             "can not open file '%s'.", filename));
-    } else if (load_head(fp)) {
+    } else if (load_head(fp, &stamp)) {
         bclosure *cl = be_newclosure(vm, 0);
         var_setclosure(vm->top, cl);
         be_stackpush(vm);
@@ -13,5 +13,6 @@
 void be_bytecode_save(bvm *vm, const char *filename, bproto *proto);
 bclosure* be_bytecode_load(bvm *vm, const char *filename);
 bbool be_bytecode_check(const char *path);
+bbool be_bytecode_current(bvm *vm, const char *path, const char *source);
 
 #endif
@@ -59,6 +59,7 @@ int be_class_attribute(bvm *vm, bclass *c, bstring *attr)
 void be_member_bind(bvm *vm, bclass *c, bstring *name)
 {
     bvalue *attr;
+    be_vm_flush_mbrcache(vm); /* the class shape changes */
     set_fixed(name);
     check_members(vm, c);
     attr = be_map_insertstr(vm, c->members, name, NULL);
@@ -71,6 +72,7 @@ void be_method_bind(bvm *vm, bclass *c, bstring *name, bproto *p)
 {
     bclosure *cl;
     bvalue *attr;
+    be_vm_flush_mbrcache(vm); /* the class shape changes */
     set_fixed(name);
     check_members(vm, c);
     attr = be_map_insertstr(vm, c->members, name, NULL);
@@ -84,6 +86,7 @@ void be_method_bind(bvm *vm, bclass *c, bstring *name, bproto *p)
 void be_prim_method_bind(bvm *vm, bclass *c, bstring *name, bntvfunc f)
 {
     bvalue *attr;
+    be_vm_flush_mbrcache(vm); /* the class shape changes */
     set_fixed(name);
     check_members(vm, c);
     attr = be_map_insertstr(vm, c->members, name, NULL);
@@ -95,10 +98,12 @@ void be_prim_method_bind(bvm *vm, bclass *c, bstring *name, bntvfunc f)
 void be_closure_method_bind(bvm *vm, bclass *c, bstring *name, bclosure *cl)
 {
     bvalue *attr;
+    be_vm_flush_mbrcache(vm); /* the class shape changes */
     check_members(vm, c);
     attr = be_map_insertstr(vm, c->members, name, NULL);
     attr->v.gc = (bgcobject*) cl;
     attr->type = MT_METHOD;
+    be_gc_barrier(vm, attr);
 }
 
 /* get the closure method count that need upvalues */
@@ -135,6 +140,46 @@ static binstance* instance_member(bvm *vm,
     return NULL;
 }
 
+/* same as instance_member(), the result is remembered in the cache
+ * entry for the class of 'obj' */
+static binstance* instance_member_cached(bvm *vm,
+    binstance *obj, bstring *name, bvalue *dst, bmembercache *mc)
+{
+    int depth = 0;
+    binstance *o;
+    if (mc->klass == obj->_class && mc->name == name) {
+#if BE_USE_PERF_COUNTERS
+        vm->counter_mbr_hit++;
+#endif
+        for (depth = mc->depth; depth > 0; --depth) {
+            obj = obj->super;
+        }
+        *dst = mc->value;
+        return obj;
+    }
+#if BE_USE_PERF_COUNTERS
+    vm->counter_mbr_miss++;
+#endif
+    for (o = obj; o; o = o->super, ++depth) {
+        bmap *members = o->_class->members;
+        if (members) {
+            bvalue *v = be_map_findstr(vm, members, name);
+            if (v) {
+                *dst = *v;
+                if (name->slen != 255) { /* long strings are not unique */
+                    mc->klass = obj->_class;
+                    mc->name = name;
+                    mc->value = *v;
+                    mc->depth = depth;
+                }
+                return o;
+            }
+        }
+    }
+    var_setnil(dst);
+    return NULL;
+}
+
 void be_class_upvalue_init(bvm *vm, bclass *c)
 {
     bmap *mbr = c->members;
@@ -164,6 +209,7 @@ static binstance* newobjself(bvm *vm, bclass *c)
         bvalue *v = obj->members, *end = v + c->nvar;
         while (v < end) { var_setnil(v); ++v; }
         obj->_class = c;
+        obj->nvar = (uint16_t)c->nvar;
         obj->super = NULL;
         obj->sub = NULL;
     }
@@ -208,10 +254,17 @@ bbool be_class_newobj(bvm *vm, bclass *c, bvalue *reg, int argc, int mode)
 }
 
 int be_instance_member(bvm *vm, binstance *obj, bstring *name, bvalue *dst)
+{
+    return be_instance_member_cached(vm, obj, name, dst, NULL);
+}
+
+int be_instance_member_cached(bvm *vm,
+    binstance *obj, bstring *name, bvalue *dst, bmembercache *mc)
 {
     int type;
     be_assert(name != NULL);
-    obj = instance_member(vm, obj, name, dst);
+    obj = mc ? instance_member_cached(vm, obj, name, dst, mc)
+             : instance_member(vm, obj, name, dst);
     type = var_type(dst);
     if (obj && type == MT_VARIABLE) {
         *dst = obj->members[dst->v.i];
@@ -220,12 +273,20 @@ int be_instance_member(bvm *vm, binstance *obj, bstring *name, bvalue *dst)
 }
 
 bbool be_instance_setmember(bvm *vm, binstance *o, bstring *name, bvalue *src)
+{
+    return be_instance_setmember_cached(vm, o, name, src, NULL);
+}
+
+bbool be_instance_setmember_cached(bvm *vm,
+    binstance *o, bstring *name, bvalue *src, bmembercache *mc)
 {
     bvalue v;
     be_assert(name != NULL);
-    binstance * obj = instance_member(vm, o, name, &v);
+    binstance * obj = mc ? instance_member_cached(vm, o, name, &v, mc)
+                         : instance_member(vm, o, name, &v);
     if (obj && var_istype(&v, MT_VARIABLE)) {
         obj->members[var_toint(&v)] = *src;
+        be_gc_barrier(vm, src);
         return btrue;
     } else {
         obj = instance_member(vm, o, str_literal(vm, "setmember"), &v);
@@ -26,6 +26,8 @@
 #define be_instance_super(obj)          ((obj)->super)
 #define be_instance_sub(obj)            ((obj)->sub)
 
+struct bmembercache;
+
 struct bclass {
     bcommon_header;
     uint16_t nvar; /* members variable data field count */
@@ -42,6 +44,7 @@ struct bclass {
 
 struct binstance {
     bcommon_header;
+    uint16_t nvar; /* count of members, the class may be freed first */
     struct binstance *super;
     struct binstance *sub;
     bclass *_class;
@@ -61,5 +64,9 @@ void be_class_upvalue_init(bvm *vm, bclass *c);
 bbool be_class_newobj(bvm *vm, bclass *c, bvalue *argv, int argc, int mode);
 int be_instance_member(bvm *vm, binstance *obj, bstring *name, bvalue *dst);
 bbool be_instance_setmember(bvm *vm, binstance *obj, bstring *name, bvalue *src);
+int be_instance_member_cached(bvm *vm,
+    binstance *obj, bstring *name, bvalue *dst, struct bmembercache *mc);
+bbool be_instance_setmember_cached(bvm *vm,
+    binstance *obj, bstring *name, bvalue *src, struct bmembercache *mc);
 
 #endif
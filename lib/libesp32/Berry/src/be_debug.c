@@ -53,7 +53,7 @@ void be_print_inst(binstruction ins, int pc)
 
     logbuf("  %.4X  ", pc);
     be_writestring(__lbuf);
-    switch (op) {
+    switch (IGET_OP(be_vm_unfuse(ins))) { /* superinstructions use the format of their first instruction */
     case OP_ADD: case OP_SUB: case OP_MUL: case OP_DIV:
     case OP_MOD: case OP_LT: case OP_LE: case OP_EQ:
     case OP_NE:  case OP_GT:  case OP_GE: case OP_CONNECT:
@@ -117,6 +117,29 @@ static int m_calldepth(bvm *vm)
     be_return(vm);
 }
 
+/* returns nil if BE_USE_PERF_COUNTERS is disabled */
+static int m_counters(bvm *vm)
+{
+#if BE_USE_PERF_COUNTERS
+    be_newobject(vm, "map");
+    be_pushstring(vm, "instruction");
+    be_pushint(vm, vm->counter_ins);
+    be_data_insert(vm, -3);
+    be_pop(vm, 2);
+    be_pushstring(vm, "mbr_hit");
+    be_pushint(vm, vm->counter_mbr_hit);
+    be_data_insert(vm, -3);
+    be_pop(vm, 2);
+    be_pushstring(vm, "mbr_miss");
+    be_pushint(vm, vm->counter_mbr_miss);
+    be_data_insert(vm, -3);
+    be_pop(vm, 3);
+    be_return(vm);
+#else
+    be_return_nil(vm);
+#endif
+}
+
 #if BE_DEBUG_VAR_INFO
 static int v_getname(bvm *vm, bbool(*getter)(bvm *vm, int, int))
 {
@@ -159,6 +182,7 @@ be_native_module_attr_table(debug) {
 #endif
     be_native_module_function("calldepth", m_calldepth),
     be_native_module_function("top", m_top),
+    be_native_module_function("counters", m_counters),
 #if BE_DEBUG_VAR_INFO
     be_native_module_function("varname", m_varname),
     be_native_module_function("upvname", m_upvname)
@@ -175,6 +199,7 @@ module debug (scope: global, depend: BE_USE_DEBUG_MODULE) {
     sethook, func(m_sethook), BE_USE_DEBUG_HOOK
     calldepth, func(m_calldepth)
     top, func(m_top)
+    counters, func(m_counters)
     varname, func(m_varname), BE_DEBUG_VAR_INFO
     upvname, func(m_upvname), BE_DEBUG_VAR_INFO
 }
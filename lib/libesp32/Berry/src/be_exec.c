@@ -10,6 +10,7 @@
 #include "be_vm.h"
 #include "be_vector.h"
 #include "be_mem.h"
+#include "be_gc.h"
 #include "be_sys.h"
 #include "be_debug.h"
 #include "be_bytecode.h"
@@ -144,6 +145,20 @@ static void vm_state_restore(bvm *vm, const struct vmstate *state, int res)
     }
 }
 
+#if BE_USE_SCRIPT_COMPILER || BE_USE_BYTECODE_LOADER
+/* the parser and the bytecode loader build objects without write
+ * barriers, so the GC does not run incremental steps while loading */
+static int load_atomic(bvm *vm, bpfunc f, void *data)
+{
+    int res;
+    bbool stepped = be_gc_isincremental(vm);
+    be_gc_incremental(vm, bfalse);
+    res = be_execprotected(vm, f, data);
+    be_gc_incremental(vm, stepped);
+    return res;
+}
+#endif
+
 #if BE_USE_SCRIPT_COMPILER
 static void m_parser(bvm *vm, void *data)
 {
@@ -165,7 +180,7 @@ int be_protectedparser(bvm *vm,
     s.data = data;
     s.islocal = (bbyte)(islocal != 0);
     vm_state_save(vm, &state);
-    res = be_execprotected(vm, m_parser, &s);
+    res = load_atomic(vm, m_parser, &s);
     if (res) { /* restore call stack */
         vm_state_restore(vm, &state, res);
     }
@@ -235,7 +250,7 @@ static int load_bytecode(bvm *vm, const char *name)
     if (be_bytecode_check(name)) {
         struct vmstate state;
         vm_state_save(vm, &state);
-        res = be_execprotected(vm, bytecode_loader, (void*)name);
+        res = load_atomic(vm, bytecode_loader, (void*)name);
         if (res) { /* restore call stack */
             vm_state_restore(vm, &state, res);
         }
@@ -286,6 +301,17 @@ BERRY_API int be_savecode(bvm *vm, const char *name)
 }
 #endif
 
+/* is the bytecode file saved from the current content of the source file */
+BERRY_API bbool be_checkcode(bvm *vm, const char *name, const char *source)
+{
+#if BE_USE_BYTECODE_LOADER
+    return be_bytecode_current(vm, name, source);
+#else
+    (void)vm; (void)name; (void)source;
+    return bfalse;
+#endif
+}
+
 static void m_pcall(bvm *vm, void *data)
 {
     struct pcall *p = cast(struct pcall*, data);
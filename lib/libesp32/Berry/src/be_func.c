@@ -63,6 +63,7 @@ void be_upvals_close(bvm *vm, bvalue *level)
             } else {
                 node->u.value = *node->value; /* move value to upvalue slot */
                 node->value = &node->u.value;
+                be_gc_barrier(vm, node->value);
             }
             *prev = next;   /* remove from linked list */
         } else {
@@ -18,10 +18,20 @@
 #include "be_module.h"
 #include "be_exec.h"
 #include "be_debug.h"
+#include <limits.h>
 
 #define GC_PAUSE    (1 << 0) /* GC will not be executed automatically */
 #define GC_HALT     (1 << 1) /* GC completely stopped */
 #define GC_ALLOC    (1 << 2) /* GC in alloc */
+#define GC_STEPPED  (1 << 3) /* GC runs in incremental steps */
+
+#define GC_ALLOC_WORK   100 /* work of the steps made by allocations */
+
+#ifdef BE_EXPLICIT_CLOCK
+  #define gc_clock()        ((uint32_t)BE_EXPLICIT_CLOCK())
+#else
+  #define gc_clock()        0
+#endif
 
 #define gc_try(expr)        be_assert(expr); if (expr)
 #define gc_setdark_safe(o)  if (o) gc_setdark(o)
@@ -343,8 +353,12 @@ static void free_object(bvm *vm, bgcobject *obj)
 {
     switch (obj->type) {
     case BE_STRING: free_lstring(vm, obj); break; /* long string */
-    case BE_CLASS: be_free(vm, obj, sizeof(bclass)); break;
-    case BE_INSTANCE: be_free(vm, obj, sizeof(binstance)); break;
+    case BE_CLASS:
+        be_vm_flush_mbrcache(vm); /* the address may be reused */
+        be_free(vm, obj, sizeof(bclass));
+        break;
+    case BE_INSTANCE: be_free(vm, obj, sizeof(binstance)
+            + sizeof(bvalue) * (((binstance*)obj)->nvar - 1)); break;
     case BE_MAP: be_map_delete(vm, cast_map(obj)); break;
     case BE_LIST: be_list_delete(vm, cast_list(obj)); break;
     case BE_CLOSURE: free_closure(vm, obj); break;
@@ -419,25 +433,69 @@ static void premark_fixed(bvm *vm)
     }
 }
 
+static void premark_new(bvm *vm)
+{
+    /* objects allocated while marking were not followed by the write
+     * barrier, they are scanned with their current content */
+    bgcobject *node = vm->gc.list;
+    for (; node != vm->gc.markstart; node = node->next) {
+        if (gc_iswhite(node)) {
+            mark_gray(vm, node);
+        }
+    }
+}
+
+static void premark_roots(bvm *vm)
+{
+    premark_internal(vm); /* object internal the VM */
+    premark_global(vm); /* global objects */
+    premark_stack(vm); /* stack objects */
+    premark_tracestack(vm); /* trace stack objects */
+    premark_fixed(vm); /* fixed objects */
+}
+
+/* scan a gray object, returns the work done */
+static int mark_object(bvm *vm, bgcobject *obj)
+{
+    gc_setdark(obj);
+    switch (var_type(obj)) {
+    case BE_CLASS: mark_class(vm, obj); return 1;
+    case BE_PROTO:
+        mark_proto(vm, obj);
+        return 1 + cast_proto(obj)->nconst + cast_proto(obj)->nproto;
+    case BE_INSTANCE:
+        mark_instance(vm, obj);
+        return 1 + be_instance_member_count(cast_instance(obj));
+    case BE_MAP: mark_map(vm, obj); return 1 + be_map_size(cast_map(obj));
+    case BE_LIST: mark_list(vm, obj); return 1 + be_list_count(cast_list(obj));
+    case BE_CLOSURE: mark_closure(vm, obj); return 1 + cast_closure(obj)->nupvals;
+    case BE_NTVCLOS: mark_ntvclos(vm, obj); return 1 + cast_ntvclos(obj)->nupvals;
+    case BE_MODULE: mark_module(vm, obj); return 1;
+    default:
+        be_assert(0); /* error */
+        return 1;
+    }
+}
+
+/* scan gray objects until the work is done, returns btrue when
+ * there are no gray objects left */
+static bbool mark_step(bvm *vm, int work)
+{
+    while (vm->gc.gray && work > 0) {
+        bgcobject *obj = vm->gc.gray;
+        if (obj && !gc_isdark(obj) && !gc_isconst(obj)) {
+            work -= mark_object(vm, obj);
+        }
+    }
+    return vm->gc.gray == NULL;
+}
+
 static void mark_unscanned(bvm *vm)
 {
     while (vm->gc.gray) {
         bgcobject *obj = vm->gc.gray;
         if (obj && !gc_isdark(obj) && !gc_isconst(obj)) {
-            gc_setdark(obj);
-            switch (var_type(obj)) {
-            case BE_CLASS: mark_class(vm, obj); break;
-            case BE_PROTO: mark_proto(vm, obj); break;
-            case BE_INSTANCE: mark_instance(vm, obj); break;
-            case BE_MAP: mark_map(vm, obj); break;
-            case BE_LIST: mark_list(vm, obj); break;
-            case BE_CLOSURE: mark_closure(vm, obj); break;
-            case BE_NTVCLOS: mark_ntvclos(vm, obj); break;
-            case BE_MODULE: mark_module(vm, obj); break;
-            default:
-                be_assert(0); /* error */
-                break;
-            }
+            mark_object(vm, obj);
         }
     }
 }
@@ -474,24 +532,23 @@ static void destruct_white(bvm *vm)
     vm->gc.status &= ~GC_HALT; /* reset GC halt flag */
 }
 
-static void delete_white(bvm *vm)
+/* free white objects and reset the others to white until the work is
+ * done, returns btrue when the whole list is swept */
+static bbool sweep_step(bvm *vm, int work)
 {
-    bgcobject *node, *prev, *next;
-    for (node = vm->gc.list, prev = node; node; node = next) {
-        next = node->next;
+    bgcobject **p = vm->gc.sweep;
+    while (*p && work-- > 0) {
+        bgcobject *node = *p;
         if (gc_iswhite(node)) {
-            if (node == vm->gc.list) { /* first node */
-                vm->gc.list = node->next;
-                prev = node->next;
-            } else { /* not first node */
-                prev->next = next;
-            }
+            *p = node->next; /* unlink node */
             free_object(vm, node);
         } else {
             gc_setwhite(node);
-            prev = node;
+            p = &node->next;
         }
     }
+    vm->gc.sweep = p;
+    return *p == NULL;
 }
 
 static void reset_fixedlist(bvm *vm)
@@ -504,6 +561,68 @@ static void reset_fixedlist(bvm *vm)
     }
 }
 
+static void gc_begin(bvm *vm)
+{
+#if BE_USE_OBSERVABILITY_HOOK
+    if (vm->obshook != NULL)
+        (*vm->obshook)(vm, BE_OBS_GC_START, vm->gc.usage);
+#endif
+    vm->gc.markstart = vm->gc.list;
+    vm->gc.stat.pause_cycle = 0;
+    vm->gc.phase = GC_PHASE_MARK;
+}
+
+/* finish the marking in one go, destruct unreachable objects and
+ * start the sweep */
+static void gc_atomic(bvm *vm)
+{
+    /* step 1: set root-set reference objects to unscanned */
+    premark_roots(vm);
+    premark_new(vm);
+    /* step 2: set unscanned objects to black */
+    mark_unscanned(vm);
+    vm->gc.phase = GC_PHASE_SWEEP;
+    /* step 3: destruct unreachable objects, delete unreachable strings */
+    destruct_white(vm);
+    be_gcstrtab(vm);
+    /* sweep the list head now: objects allocated later are inserted
+     * before the sweep position and survive this cycle */
+    vm->gc.sweep = &vm->gc.list;
+    while (*vm->gc.sweep && gc_iswhite(*vm->gc.sweep)) {
+        sweep_step(vm, 1);
+    }
+    sweep_step(vm, 1);
+}
+
+static void gc_end(bvm *vm)
+{
+    /* step 4: reset the fixed objects */
+    reset_fixedlist(vm);
+    /* step 5: calculate the next GC threshold */
+    vm->gc.threshold = next_threshold(vm->gc);
+    vm->gc.phase = GC_PHASE_IDLE;
+    vm->gc.stat.cycles++;
+#if BE_USE_POOL_ALLOC
+    be_pool_trim(vm); /* release the pages emptied by the cycle */
+#endif
+#if BE_USE_OBSERVABILITY_HOOK
+    if (vm->obshook != NULL)
+        (*vm->obshook)(vm, BE_OBS_GC_END, vm->gc.usage, vm->gc.stat.pause_cycle);
+#endif
+}
+
+static void gc_pause(bvm *vm, uint32_t start)
+{
+    bgcstat *stat = &vm->gc.stat;
+    stat->pause_last = gc_clock() - start;
+    if (stat->pause_last > stat->pause_max) {
+        stat->pause_max = stat->pause_last;
+    }
+    if (stat->pause_last > stat->pause_cycle) {
+        stat->pause_cycle = stat->pause_last;
+    }
+}
+
 void be_gc_auto(bvm *vm)
 {
 #if BE_USE_DEBUG_GC
@@ -512,7 +631,11 @@ void be_gc_auto(bvm *vm)
     }
 #else
     if (vm->gc.status & GC_PAUSE && vm->gc.usage > vm->gc.threshold) {
-        be_gc_collect(vm);
+        if (vm->gc.status & GC_STEPPED) {
+            be_gc_step(vm, GC_ALLOC_WORK);
+        } else {
+            be_gc_collect(vm);
+        }
     }
 #endif
 }
@@ -522,33 +645,72 @@ size_t be_gc_memcount(bvm *vm)
     return vm->gc.usage;
 }
 
+void be_gc_barrier_obj(bvm *vm, bgcobject *obj)
+{
+    mark_gray(vm, obj);
+}
+
 void be_gc_collect(bvm *vm)
 {
+    uint32_t start;
     if (vm->gc.status & GC_HALT) {
         return; /* the GC cannot run for some reason */
     }
-#if BE_USE_OBSERVABILITY_HOOK
-    if (vm->obshook != NULL)
-        (*vm->obshook)(vm, BE_OBS_GC_START, vm->gc.usage);
-#endif
-    /* step 1: set root-set reference objects to unscanned */
-    premark_internal(vm); /* object internal the VM */
-    premark_global(vm); /* global objects */
-    premark_stack(vm); /* stack objects */
-    premark_tracestack(vm); /* trace stack objects */
-    premark_fixed(vm); /* fixed objects */
-    /* step 2: set unscanned objects to black */
-    mark_unscanned(vm);
-    /* step 3: destruct and delete unreachable objects */
-    destruct_white(vm);
-    delete_white(vm);
-    be_gcstrtab(vm);
-    /* step 4: reset the fixed objects */
-    reset_fixedlist(vm);
-    /* step 5: calculate the next GC threshold */
-    vm->gc.threshold = next_threshold(vm->gc);
-#if BE_USE_OBSERVABILITY_HOOK
-    if (vm->obshook != NULL)
-        (*vm->obshook)(vm, BE_OBS_GC_END, vm->gc.usage);
-#endif
+    start = gc_clock();
+    if (vm->gc.phase != GC_PHASE_IDLE) { /* complete the current cycle */
+        if (vm->gc.phase == GC_PHASE_MARK) {
+            gc_atomic(vm);
+        }
+        sweep_step(vm, INT_MAX);
+        gc_end(vm);
+    }
+    gc_begin(vm);
+    gc_atomic(vm);
+    sweep_step(vm, INT_MAX);
+    gc_pause(vm, start);
+    gc_end(vm);
+}
+
+BERRY_API void be_gc_incremental(bvm *vm, bbool enable)
+{
+    if (enable) {
+        vm->gc.status |= GC_STEPPED;
+    } else {
+        vm->gc.status &= ~GC_STEPPED;
+    }
+}
+
+bbool be_gc_isincremental(bvm *vm)
+{
+    return (vm->gc.status & GC_STEPPED) != 0;
+}
+
+BERRY_API bbool be_gc_step(bvm *vm, int work)
+{
+    uint32_t start = gc_clock();
+    if (vm->gc.status & GC_HALT) {
+        return vm->gc.phase == GC_PHASE_IDLE;
+    }
+    if (vm->gc.phase == GC_PHASE_IDLE) {
+        if (vm->gc.usage <= vm->gc.threshold) {
+            return btrue; /* nothing to collect yet */
+        }
+        gc_begin(vm);
+        premark_roots(vm);
+    }
+    vm->gc.stat.steps++;
+    if (vm->gc.phase == GC_PHASE_MARK) {
+        if (mark_step(vm, work)) {
+            gc_atomic(vm);
+        }
+    }
+    /* sweep in the same step: when no object survived, the sweep position
+     * is still the list head and must not see the objects allocated later */
+    if (vm->gc.phase == GC_PHASE_SWEEP && sweep_step(vm, work)) {
+        gc_pause(vm, start);
+        gc_end(vm);
+        return btrue;
+    }
+    gc_pause(vm, start);
+    return bfalse;
 }
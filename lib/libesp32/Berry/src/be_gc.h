@@ -62,6 +62,22 @@ typedef enum {
     GC_CONST = 0x08  /* constant object mark */
 } bgcmark;
 
+/* phases of an incremental collection, see be_gc_step() */
+typedef enum {
+    GC_PHASE_IDLE = 0, /* no collection in progress */
+    GC_PHASE_MARK, /* marking, the write barrier is active */
+    GC_PHASE_SWEEP /* freeing unreachable objects */
+} bgcphase;
+
+/* write barrier: a value stored into an existing object is marked
+ * while a collection is marking, so that a scanned object never
+ * refers to an unmarked one. */
+#define be_gc_barrier(vm, v) do { \
+    if ((vm)->gc.phase == GC_PHASE_MARK && be_isgcobj(v)) { \
+        be_gc_barrier_obj((vm), var_togc(v)); \
+    } \
+} while (0)
+
 void be_gc_init(bvm *vm);
 void be_gc_deleteall(bvm *vm);
 void be_gc_setsteprate(bvm *vm, int rate);
@@ -74,5 +90,7 @@ void be_gc_unfix(bvm *vm, bgcobject *obj);
 bbool be_gc_fix_set(bvm *vm, bgcobject *obj, bbool fix);
 void be_gc_collect(bvm *vm);
 void be_gc_auto(bvm *vm);
+void be_gc_barrier_obj(bvm *vm, bgcobject *obj);
+bbool be_gc_isincremental(bvm *vm);
 
 #endif
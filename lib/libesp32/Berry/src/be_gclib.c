@@ -7,6 +7,7 @@
 ********************************************************************/
 #include "be_object.h"
 #include "be_gc.h"
+#include "be_vm.h"
 
 #if BE_USE_GC_MODULE
 
@@ -27,10 +28,105 @@ static int m_collect(bvm *vm)
     be_return_nil(vm);
 }
 
+static int m_incremental(bvm *vm)
+{
+    if (be_top(vm) >= 1) {
+        be_gc_incremental(vm, be_tobool(vm, 1));
+    }
+    be_pushbool(vm, be_gc_isincremental(vm));
+    be_return(vm);
+}
+
+static int m_step(bvm *vm)
+{
+    int work = be_top(vm) >= 1 && be_isint(vm, 1) ? be_toint(vm, 1) : 100;
+    be_pushbool(vm, be_gc_step(vm, work));
+    be_return(vm);
+}
+
+static void map_insert_int(bvm *vm, const char *key, bint value)
+{
+    be_pushstring(vm, key);
+    be_pushint(vm, value);
+    be_data_insert(vm, -3);
+    be_pop(vm, 2);
+}
+
+static int m_stats(bvm *vm)
+{
+    static const char *phases[] = { "idle", "mark", "sweep" };
+    bgcstat *stat = &vm->gc.stat;
+    be_newobject(vm, "map");
+    map_insert_int(vm, "cycles", stat->cycles);
+    map_insert_int(vm, "steps", stat->steps);
+    map_insert_int(vm, "pause_last", stat->pause_last);
+    map_insert_int(vm, "pause_max", stat->pause_max);
+    be_pushstring(vm, "phase");
+    be_pushstring(vm, phases[vm->gc.phase]);
+    be_data_insert(vm, -3);
+    be_pop(vm, 3);
+    be_return(vm);
+}
+
+#if BE_USE_POOL_ALLOC
+static void list_push_int(bvm *vm, bint value)
+{
+    be_pushint(vm, value);
+    be_data_push(vm, -2);
+    be_pop(vm, 1);
+}
+#endif
+
+/* `gc.pool()` returns the usage of the small block pool or nil if the
+ * pool is not enabled, `classes` lists [size, blocks used, blocks free] */
+static int m_pool(bvm *vm)
+{
+#if BE_USE_POOL_ALLOC
+    size_t pages = 0, used = 0, nfree = 0;
+    int c;
+    be_newobject(vm, "map");
+    be_pushstring(vm, "classes");
+    be_newobject(vm, "list");
+    for (c = 0; c < BE_POOL_CLASSES; ++c) {
+        bpoolclass *pc = &vm->pool.classes[c];
+        size_t size = (c + 1) * BE_POOL_ALIGN;
+        be_newobject(vm, "list");
+        list_push_int(vm, (bint)size);
+        list_push_int(vm, (bint)pc->used);
+        list_push_int(vm, (bint)pc->nfree);
+        be_pop(vm, 1);
+        be_data_push(vm, -2);
+        be_pop(vm, 1);
+        pages += pc->npages;
+        used += pc->used * size;
+        nfree += pc->nfree * size;
+    }
+    be_pop(vm, 1);
+    be_data_insert(vm, -3);
+    be_pop(vm, 2);
+    map_insert_int(vm, "page_size", BE_POOL_PAGE_SIZE);
+    map_insert_int(vm, "pages", (bint)pages);
+    map_insert_int(vm, "used", (bint)used);
+    map_insert_int(vm, "free", (bint)nfree);
+    /* percentage of the pages not holding blocks in use */
+    map_insert_int(vm, "fragmentation", pages ? (bint)(100 - used * 100 / (pages * BE_POOL_PAGE_SIZE)) : 0);
+    map_insert_int(vm, "allocs", (bint)vm->pool.allocs);
+    map_insert_int(vm, "frees", (bint)vm->pool.frees);
+    be_pop(vm, 1);
+    be_return(vm);
+#else
+    be_return_nil(vm);
+#endif
+}
+
 #if !BE_USE_PRECOMPILED_OBJECT
 be_native_module_attr_table(gc){
     be_native_module_function("allocated", m_allocated),
-    be_native_module_function("collect", m_collect)
+    be_native_module_function("collect", m_collect),
+    be_native_module_function("incremental", m_incremental),
+    be_native_module_function("step", m_step),
+    be_native_module_function("stats", m_stats),
+    be_native_module_function("pool", m_pool)
 };
 
 be_define_native_module(gc, NULL);
@@ -39,6 +135,10 @@ be_define_native_module(gc, NULL);
 module gc (scope: global, depend: BE_USE_GC_MODULE) {
     allocated, func(m_allocated)
     collect, func(m_collect)
+    incremental, func(m_incremental)
+    step, func(m_step)
+    stats, func(m_stats)
+    pool, func(m_pool)
 }
 @const_object_info_end */
 #include "../generate/be_fixed_gc.h"
@@ -8,6 +8,7 @@
 #include "be_object.h"
 #include "be_mem.h"
 #include <string.h>
+#include <stdlib.h>
 
 #if BE_USE_JSON_MODULE
 
@@ -299,6 +300,122 @@ static int m_json_load(bvm *vm)
     be_return_nil(vm);
 }
 
+/* skip a string, the first character is '"' */
+static const char* skip_string(const char *json)
+{
+    int len = json_strlen(json);
+    return len > -1 ? json + len + 2 : NULL;
+}
+
+/* skip a value without building it, the skipped text is
+ * only checked for balanced brackets and strings */
+static const char* skip_value(const char *json)
+{
+    int depth = 0;
+    json = skip_space(json);
+    do {
+        switch (*json) {
+        case '{': case '[':
+            ++depth, ++json;
+            break;
+        case '}': case ']':
+            if (--depth < 0) {
+                return NULL;
+            }
+            ++json;
+            break;
+        case '"':
+            json = skip_string(json);
+            if (json == NULL) {
+                return NULL;
+            }
+            break;
+        case ',': case ':':
+            if (depth == 0) {
+                return NULL;
+            }
+            ++json;
+            break;
+        case '\0':
+            return NULL;
+        default: /* number, true, false or null */
+            while (*json && !strchr("{}[]\",: \t\r\n", *json)) {
+                ++json;
+            }
+        }
+        json = skip_space(json);
+    } while (depth > 0);
+    return json;
+}
+
+/* find the value of `key` in the object at `json`, keys
+ * are compared to the raw text so escapes are not decoded */
+static const char* find_field(const char *json, const char *key, size_t len)
+{
+    json = match_char(json, '{');
+    while (json && *json == '"') {
+        const char *k = json + 1;
+        json = skip_string(json);
+        if (json == NULL || (json = match_char(json, ':')) == NULL) {
+            return NULL;
+        }
+        if ((size_t)(json - k) > len && k[len] == '"' && !strncmp(k, key, len)) {
+            return json;
+        }
+        json = skip_value(json);
+        json = json ? match_char(json, ',') : NULL;
+    }
+    return NULL;
+}
+
+/* find the element `index` of the array at `json` */
+static const char* find_element(const char *json, int index)
+{
+    json = match_char(json, '[');
+    if (json == NULL || *json == ']') {
+        return NULL;
+    }
+    while (index-- > 0) {
+        json = skip_value(json);
+        json = json ? match_char(json, ',') : NULL;
+        if (json == NULL) {
+            return NULL;
+        }
+    }
+    return json;
+}
+
+/* `json.find(text, path [, default])` returns the value at `path`,
+ * keys and array indexes separated by '#' i.e. "StatusSNS#ENERGY#Power".
+ * Only the value found is built, the rest of the text is skipped */
+static int m_json_find(bvm *vm)
+{
+    int top = be_top(vm);
+    if (top >= 2 && be_isstring(vm, 1) && be_isstring(vm, 2)) {
+        const char *json = skip_space(be_tostring(vm, 1));
+        const char *path = be_tostring(vm, 2);
+        while (json && *path) {
+            const char *sep = strchr(path, '#');
+            size_t len = sep ? (size_t)(sep - path) : strlen(path);
+            if (*json == '[' && len && strspn(path, "0123456789") >= len) {
+                json = find_element(json, atoi(path));
+            } else {
+                json = find_field(json, path, len);
+            }
+            path += sep ? len + 1 : len;
+        }
+        if (json && parser_value(vm, json)) {
+            be_return(vm);
+        }
+        be_pop(vm, be_top(vm) - top);
+    }
+    if (top >= 3) {
+        be_pushvalue(vm, 3);
+        be_return(vm);
+    }
+    be_return_nil(vm);
+}
+
 static void make_indent(bvm *vm, int stridx, int indent)
 {
     if (indent) {
@@ -420,6 +537,7 @@ static int m_json_dump(bvm *vm)
 #if !BE_USE_PRECOMPILED_OBJECT
 be_native_module_attr_table(json) {
     be_native_module_function("load", m_json_load),
+    be_native_module_function("find", m_json_find),
     be_native_module_function("dump", m_json_dump)
 };
 
@@ -428,6 +546,7 @@ be_define_native_module(json, NULL);
 /* @const_object_info_begin
 module json (scope: global, depend: BE_USE_JSON_MODULE) {
     load, func(m_json_load)
+    find, func(m_json_find)
     dump, func(m_json_dump)
 }
 @const_object_info_end */
@@ -76,6 +76,7 @@ bvalue* be_list_push(bvm *vm, blist *list, bvalue *value)
     slot = list->data + list->count++;
     if (value != NULL) {
         *slot = *value;
+        be_gc_barrier(vm, value);
     }
     return slot;
 }
@@ -103,6 +104,7 @@ bvalue* be_list_insert(bvm *vm, blist *list, int index, bvalue *value)
     data = list->data + index;
     if (value != NULL) {
         *data = *value;
+        be_gc_barrier(vm, value);
     }
     return data;
 }
@@ -159,6 +161,12 @@ void be_list_merge(bvm *vm, blist *list, const blist *other)
         }
         memcpy(list->data + dst_len, other->data, src_len * sizeof(bvalue));
         list->count = length;
+        if (vm->gc.phase == GC_PHASE_MARK) {
+            bvalue *v = list->data + dst_len, *end = v + src_len;
+            for (; v < end; ++v) {
+                be_gc_barrier(vm, v);
+            }
+        }
     }
 }
 
@@ -193,6 +201,7 @@ int be_list_pool_alloc(bvm *vm, blist *list, bvalue *src)
         node = be_list_push(vm, list, NULL);
     }
     *node = *src;
+    be_gc_barrier(vm, src);
     return id;
 }
 
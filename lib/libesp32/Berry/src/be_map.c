@@ -260,9 +260,11 @@ bvalue* be_map_insert(bvm *vm, bmap *map, bvalue *key, bvalue *value)
         }
         entry = insert(vm, map, key, hash);
         ++map->count;
+        be_gc_barrier(vm, key);
     }
     if (value) {
         entry->value = *value;
+        be_gc_barrier(vm, value);
     }
     return value(entry);
 }
@@ -41,11 +41,208 @@ BERRY_API void* be_os_realloc(void *ptr, size_t size)
     return realloc(ptr, size);
 }
 
-static void* _realloc(void *ptr, size_t old_size, size_t new_size)
+#if BE_USE_POOL_ALLOC
+/* blocks of BE_POOL_ALIGN to BE_POOL_MAX_SIZE bytes are allocated from
+ * pages split in blocks of the same size class, a free block holds the
+ * next free block of its class */
+#define pool_class(size)    (((size) - 1) / BE_POOL_ALIGN)
+#define pool_blocksize(c)   (((c) + 1) * BE_POOL_ALIGN)
+#define pool_fits(size)     ((size) && (size) <= BE_POOL_MAX_SIZE)
+#define page_header         ((sizeof(bpoolpage) + BE_POOL_ALIGN - 1) & ~(BE_POOL_ALIGN - 1))
+#define page_blocks(c)      ((BE_POOL_PAGE_SIZE - page_header) / pool_blocksize(c))
+#define page_first(page)    ((char*)(page) + page_header)
+
+struct bpoolpage {
+    bpoolpage *next;
+    size_t nfree; /* free blocks, only valid while trimming */
+};
+
+static bbool pool_newpage(bpoolclass *pc, int c)
+{
+    size_t size = pool_blocksize(c), n = page_blocks(c);
+    bpoolpage *page = malloc(BE_POOL_PAGE_SIZE);
+    char *block;
+    if (page == NULL) {
+        return bfalse;
+    }
+    page->next = pc->pages;
+    pc->pages = page;
+    pc->npages++;
+    pc->nfree += n;
+    /* link the blocks in address order */
+    for (block = page_first(page) + (n - 1) * size; block >= page_first(page); block -= size) {
+        *(void**)block = pc->free;
+        pc->free = block;
+    }
+    return btrue;
+}
+
+static void* pool_alloc(bvm *vm, size_t size)
+{
+    bpoolclass *pc = &vm->pool.classes[pool_class(size)];
+    void *block;
+    if (pc->free == NULL && !pool_newpage(pc, pool_class(size))) {
+        return NULL;
+    }
+    block = pc->free;
+    pc->free = *(void**)block;
+    pc->used++;
+    pc->nfree--;
+    vm->pool.allocs++;
+    return block;
+}
+
+static void pool_free(bvm *vm, void *ptr, size_t size)
+{
+    bpoolclass *pc = &vm->pool.classes[pool_class(size)];
+#if BE_USE_DEBUG_GC
+    memset(ptr, 0xFF, pool_blocksize(pool_class(size)));
+#endif
+    *(void**)ptr = pc->free;
+    pc->free = ptr;
+    pc->used--;
+    pc->nfree++;
+    vm->pool.frees++;
+}
+
+/* sort a list linked through the first word of its nodes in address
+ * order, bottom-up merge sort so that no recursion nor memory is needed */
+static void* pool_sort(void *list)
+{
+    size_t width = 1, merges;
+    do {
+        void *p = list, *head = NULL, **tail = &head;
+        merges = 0;
+        while (p) { /* merge the runs of width nodes at p and q */
+            void *q = p, *e;
+            size_t psize = 0, qsize = width;
+            merges++;
+            while (q && psize < width) {
+                psize++;
+                q = *(void**)q;
+            }
+            while (psize || (qsize && q)) {
+                if (psize && (!qsize || !q || (char*)p < (char*)q)) {
+                    e = p;
+                    p = *(void**)p;
+                    psize--;
+                } else {
+                    e = q;
+                    q = *(void**)q;
+                    qsize--;
+                }
+                *tail = e;
+                tail = (void**)e;
+            }
+            p = q;
+        }
+        *tail = NULL;
+        list = head;
+        width <<= 1;
+    } while (merges > 1);
+    return list;
+}
+
+/* page of a block, the pages and the blocks after it are in address order */
+#define pool_nextpage(page, block) \
+    while ((char*)(block) >= (char*)(page) + BE_POOL_PAGE_SIZE) { (page) = (page)->next; }
+
+/* release the pages with no block in use, called at the end of a GC cycle */
+void be_pool_trim(bvm *vm)
+{
+    int c;
+    for (c = 0; c < BE_POOL_CLASSES; ++c) {
+        bpoolclass *pc = &vm->pool.classes[c];
+        size_t n = page_blocks(c);
+        bpoolpage *page, **pp;
+        void **fp;
+        if (pc->nfree < n) {
+            continue; /* less than a page of free blocks */
+        }
+        /* with both lists in address order the free blocks are counted
+         * per page in a single pass */
+        pc->pages = pool_sort(pc->pages);
+        pc->free = pool_sort(pc->free);
+        for (page = pc->pages; page; page = page->next) {
+            page->nfree = 0;
+        }
+        page = pc->pages;
+        for (fp = pc->free; fp; fp = *fp) {
+            pool_nextpage(page, fp);
+            page->nfree++;
+        }
+        /* unlink the free blocks of empty pages, then the pages */
+        page = pc->pages;
+        for (fp = (void**)&pc->free; *fp;) {
+            pool_nextpage(page, *fp);
+            if (page->nfree == n) {
+                *fp = *(void**)*fp;
+            } else {
+                fp = *fp;
+            }
+        }
+        for (pp = &pc->pages; *pp;) {
+            page = *pp;
+            if (page->nfree == n) {
+                *pp = page->next;
+                pc->npages--;
+                pc->nfree -= n;
+                free(page);
+            } else {
+                pp = &page->next;
+            }
+        }
+    }
+}
+
+void be_pool_deinit(bvm *vm)
+{
+    int c;
+    for (c = 0; c < BE_POOL_CLASSES; ++c) {
+        bpoolpage *page = vm->pool.classes[c].pages;
+        while (page) {
+            bpoolpage *next = page->next;
+            free(page);
+            page = next;
+        }
+    }
+    memset(&vm->pool, 0, sizeof(bmempool));
+}
+#endif
+
+static void* _realloc(bvm *vm, void *ptr, size_t old_size, size_t new_size)
 {
     if (old_size == new_size) { /* the block unchanged */
         return ptr;
     }
+#if BE_USE_POOL_ALLOC
+    if (pool_fits(old_size) || pool_fits(new_size)) {
+        void *block = NULL;
+        if (pool_fits(old_size) && pool_fits(new_size)
+            && pool_class(old_size) == pool_class(new_size)) {
+            return ptr; /* same size class */
+        }
+        if (new_size) {
+            block = pool_fits(new_size) ? pool_alloc(vm, new_size) : malloc(new_size);
+            if (block == NULL) {
+                return NULL; /* the old block is kept */
+            }
+            if (ptr) {
+                memcpy(block, ptr, old_size < new_size ? old_size : new_size);
+            }
+        }
+        if (ptr) {
+            if (pool_fits(old_size)) {
+                pool_free(vm, ptr, old_size);
+            } else {
+                free(ptr);
+            }
+        }
+        return block;
+    }
+#else
+    (void)vm;
+#endif
     if (ptr && new_size) { /* realloc block */
         return realloc(ptr, new_size);
     }
@@ -64,12 +261,12 @@ static void* _realloc(void *ptr, size_t old_size, size_t new_size)
 
 BERRY_API void* be_realloc(bvm *vm, void *ptr, size_t old_size, size_t new_size)
 {
-    void *block = _realloc(ptr, old_size, new_size);
+    void *block = _realloc(vm, ptr, old_size, new_size);
     if (!block && new_size) { /* allocation failure */
         vm->gc.status |= GC_ALLOC;
         be_gc_collect(vm); /* try to allocate again after GC */
         vm->gc.status &= ~GC_ALLOC;
-        block = _realloc(ptr, old_size, new_size);
+        block = _realloc(vm, ptr, old_size, new_size);
         if (!block) { /* lack of heap space */
             be_throw(vm, BE_MALLOC_FAIL);
         }
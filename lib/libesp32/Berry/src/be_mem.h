@@ -17,11 +17,36 @@ extern "C" {
 #define be_malloc(vm, size)         be_realloc((vm), NULL, 0, (size))
 #define be_free(vm, ptr, size)      be_realloc((vm), (ptr), (size), 0)
 
+#if BE_USE_POOL_ALLOC
+#define BE_POOL_CLASSES             (BE_POOL_MAX_SIZE / BE_POOL_ALIGN)
+
+typedef struct bpoolpage bpoolpage;
+
+typedef struct {
+    void *free; /* list of the free blocks */
+    bpoolpage *pages; /* pages split in blocks of this class */
+    size_t npages;
+    size_t used; /* count of blocks in use */
+    size_t nfree; /* count of free blocks */
+} bpoolclass;
+
+typedef struct {
+    bpoolclass classes[BE_POOL_CLASSES];
+    size_t allocs; /* count of blocks allocated from the pool */
+    size_t frees; /* count of blocks returned to the pool */
+} bmempool;
+#endif
+
 BERRY_API void* be_os_malloc(size_t size);
 BERRY_API void be_os_free(void *ptr);
 BERRY_API void* be_os_realloc(void *ptr, size_t size);
 BERRY_API void* be_realloc(bvm *vm, void *ptr, size_t old_size, size_t new_size);
 
+#if BE_USE_POOL_ALLOC
+void be_pool_trim(bvm *vm);
+void be_pool_deinit(bvm *vm);
+#endif
+
 #ifdef __cplusplus
 }
 #endif
@@ -250,6 +250,7 @@ static void cache_module(bvm *vm, bstring *name)
     }
     v = be_map_insertstr(vm, vm->module.loaded, name, NULL);
     *v = vm->top[-1];
+    be_gc_barrier(vm, v);
 }
 
 /* load module to vm->top */
@@ -52,4 +52,9 @@ OPCODE(IMPORT),     /*  A, B, C  |   IF (A == C) import module name as RK(B) to
 OPCODE(EXBLK),      /*  A, Bx    |   ... */
 OPCODE(CATCH),      /*  A, B, C  |   ... */
 OPCODE(RAISE),      /*  A, B, C  |   ... */
-OPCODE(CLASS)       /*  Bx       |   init class in K[Bx] */
+OPCODE(CLASS),      /*  Bx       |   init class in K[Bx] */
+/* superinstructions, created in memory by be_vm_fuse() and never saved */
+OPCODE(GETMET_CALL),/*  A, B, C  |   GETMET followed by CALL */
+OPCODE(MOVE_CALL),  /*  A, B, C  |   MOVE followed by CALL */
+OPCODE(EQ_JMPF),    /*  A, B, C  |   EQ followed by JMPF */
+OPCODE(GETMBR_JMPF) /*  A, B, C  |   GETMBR followed by JMPF */
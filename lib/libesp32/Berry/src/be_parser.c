@@ -293,6 +293,7 @@ static void end_func(bparser *parser)
     setupvals(finfo);
     proto->code = be_vector_release(vm, &finfo->code);
     proto->codesize = finfo->pc;
+    be_vm_fuse(proto->code, proto->codesize); /* create superinstructions */
     proto->ktab = be_vector_release(vm, &finfo->kvec);
     proto->nconst = be_vector_count(&finfo->kvec);
     proto->ptab = be_vector_release(vm, &finfo->pvec);
@@ -16,6 +16,12 @@
 #define lstr(_s)    cast(char*, cast(blstring*, _s) + 1)
 #define cstr(_s)    (cast(bcstring*, _s)->s)
 
+#if BE_USE_STR_HASH_CACHE
+#define sstr_hasheq(_s, _h) (cast(bsstring*, _s)->hash == (_h))
+#else
+#define sstr_hasheq(_s, _h) 1
+#endif
+
 #define be_define_const_str(_name, _s, _hash, _extra, _len, _next) \
     BERRY_LOCAL const bcstring be_const_str_##_name = {            \
         .next = (bgcobject *)_next,                                \
@@ -38,6 +44,18 @@ struct bconststrtab {
 #include "../generate/be_const_strtab_def.h"
 #endif
 
+/* hash of a short string when it is stored, otherwise 0 */
+static uint32_t short_hash(const bstring *s)
+{
+#if !BE_USE_STR_HASH_CACHE
+    if (!gc_isconst(s)) {
+        return 0;
+    }
+#endif
+    /* bsstring and bcstring hold the hash at the same offset */
+    return cast(const bcstring*, s)->hash;
+}
+
 int be_eqstr(bstring *s1, bstring *s2)
 {
     int slen;
@@ -58,8 +76,9 @@ int be_eqstr(bstring *s1, bstring *s2)
     // TODO one is long const and the other is long string
     /* const short strings */
     if (gc_isconst(s1) || gc_isconst(s2)) { /* one of the two string is short const */
-        if (cast(bcstring*, s1)->hash && cast(bcstring*, s2)->hash) {
-            return 0; /* if they both have a hash, then we know they are different */
+        uint32_t h1 = short_hash(s1), h2 = short_hash(s2);
+        if (h1 && h2 && h1 != h2) {
+            return 0; /* different hashes, different strings */
         }
         return !strcmp(str(s1), str(s2));
     }
@@ -156,13 +175,12 @@ static bstring* createstrobj(bvm *vm, size_t len, int islong)
 }
 
 #if BE_USE_PRECOMPILED_OBJECT
-static bstring* find_conststr(const char *str, size_t len)
+static bstring* find_conststr(const char *str, size_t len, uint32_t hash)
 {
     const struct bconststrtab *tab = &m_const_string_table;
-    uint32_t hash = str_hash(str, len);
     bcstring *s = (bcstring*)tab->table[hash % tab->size];
     for (; s != NULL; s = next(s)) {
-        if (len == s->slen && !strncmp(str, s->s, len)) {
+        if (s->hash == hash && len == s->slen && !strncmp(str, s->s, len)) {
             return (bstring*)s;
         }
     }
@@ -170,20 +188,22 @@ static bstring* find_conststr(const char *str, size_t len)
 }
 #endif
 
-static bstring* newshortstr(bvm *vm, const char *str, size_t len)
+static bstring* newshortstr(bvm *vm, const char *str, size_t len, uint32_t hash)
 {
     bstring *s;
     int size = vm->strtab.size;
-    uint32_t hash = str_hash(str, len);
     bstring **list = vm->strtab.table + (hash & (size - 1));
 
     for (s = *list; s != NULL; s = next(s)) {
-        if (len == s->slen && !strncmp(str, sstr(s), len)) {
+        if (sstr_hasheq(s, hash) && len == s->slen && !strncmp(str, sstr(s), len)) {
             return s;
         }
     }
     s = createstrobj(vm, len, 0);
     if (s) {
+        /* the allocation may run a gc step which shrinks the string table */
+        size = vm->strtab.size;
+        list = vm->strtab.table + (hash & (size - 1));
         memcpy(cast(char *, sstr(s)), str, len);
         s->extra = 0;
         s->next = cast(void*, *list);
@@ -221,11 +241,12 @@ bstring* be_newstr(bvm *vm, const char *str)
 bstring *be_newstrn(bvm *vm, const char *str, size_t len)
 {
     if (len <= SHORT_STR_MAX_LEN) {
+        uint32_t hash = str_hash(str, len); /* hashed once for both tables */
 #if BE_USE_PRECOMPILED_OBJECT
-        bstring *s = find_conststr(str, len);
-        return s ? s : newshortstr(vm, str, len);
+        bstring *s = find_conststr(str, len, hash);
+        return s ? s : newshortstr(vm, str, len, hash);
 #else
-        return newshortstr(vm, str, len);
+        return newshortstr(vm, str, len, hash);
 #endif
     }
     return be_newlongstr(vm, str, len); /* long string */
@@ -47,10 +47,59 @@
   #define DEBUG_HOOK()
 #endif
 
-#define vm_exec_loop() \
+#if BE_USE_PERF_COUNTERS
+  #define COUNTER_HOOK()    vm->counter_ins++
+#else
+  #define COUNTER_HOOK()
+#endif
+
+/* member cache entry of the current instruction */
+#if BE_USE_INLINE_CACHE
+  #define mbrcache(vm) (&(vm)->mbrcache[((size_t)(vm)->ip / sizeof(binstruction)) \
+                                        & (BE_INLINE_CACHE_SIZE - 1)])
+#else
+  #define mbrcache(vm) NULL
+#endif
+
+/* threaded code needs the GCC "labels as values" extension */
+#if BE_USE_COMPUTED_GOTO && defined(__GNUC__)
+  #define VM_THREADED_CODE  1
+#else
+  #define VM_THREADED_CODE  0
+#endif
+
+#if VM_THREADED_CODE
+  #define vm_exec_loop() \
+    dispatch();
+  #define opcase(opcode)    L_##opcode
+  #define optarget(opcode)  /* opcase() already defines the label */
+  #define dispatch() do { \
+        DEBUG_HOOK(); \
+        COUNTER_HOOK(); \
+        ins = *vm->ip++; \
+        goto *disptab[IGET_OP(ins)]; \
+    } while (0)
+#else
+  #define vm_exec_loop() \
     loop: \
         DEBUG_HOOK(); \
+        COUNTER_HOOK(); \
         switch (IGET_OP(ins = *vm->ip++))
+  #define opcase(opcode)    case OP_##opcode
+  #define optarget(opcode)  L_##opcode: /* entry of a superinstruction tail */
+  #define dispatch()        goto loop
+#endif
+
+/* end of the first instruction of a pair, if the current instruction is
+ * the superinstruction then run the next one without dispatch */
+#define dispatch_fused(fused, next) \
+    if (IGET_OP(ins) == OP_##fused) { \
+        DEBUG_HOOK(); \
+        COUNTER_HOOK(); \
+        ins = *vm->ip++; \
+        goto L_##next; \
+    } \
+    dispatch()
 
 #if BE_USE_SINGLE_FLOAT
   #define mathfunc(func)    func##f
@@ -58,8 +107,6 @@
   #define mathfunc(func)    func
 #endif
 
-#define opcase(opcode)      case OP_##opcode
-#define dispatch()          goto loop
 
 #define equal_rule(op, iseq) \
     bbool res; \
@@ -272,7 +319,7 @@ static int obj_attribute(bvm *vm, bvalue *o, bvalue *c, bvalue *dst)
     bvalue instance = *o; /* save instance to send it later to member */
     bstring *attr = var_tostr(c);
     binstance *obj = var_toobj(o);
-    int type = be_instance_member(vm, obj, attr, dst);
+    int type = be_instance_member_cached(vm, obj, attr, dst, mbrcache(vm));
     if (basetype(type) == BE_NIL) { /* if no method found, try virtual */
         /* get method 'member' */
         int type2 = be_instance_member(vm, obj, str_literal(vm, "member"), vm->top);
@@ -374,6 +421,60 @@ bbool be_vm_isge(bvm *vm, bvalue *a, bvalue *b)
     relop_rule(>=);
 }
 
+/* superinstructions: pairs of instructions executed with a single dispatch,
+ * chosen from the most frequent pairs of the solidified Tasmota code */
+static const bbyte fused_tab[][3] = {
+    /* first     next       superinstruction */
+    { OP_GETMET, OP_CALL,   OP_GETMET_CALL },
+    { OP_MOVE,   OP_CALL,   OP_MOVE_CALL },
+    { OP_EQ,     OP_JMPF,   OP_EQ_JMPF },
+    { OP_GETMBR, OP_JMPF,   OP_GETMBR_JMPF }
+};
+
+/* replace the first instruction of known pairs by the superinstruction,
+ * the second instruction is kept so jumping to it is still valid */
+void be_vm_fuse(binstruction *code, int size)
+{
+#if BE_USE_SUPERINSTRUCTIONS
+    int pc;
+    size_t i;
+    for (pc = 0; pc < size - 1; ++pc) {
+        bopcode op = IGET_OP(code[pc]), next = IGET_OP(code[pc + 1]);
+        for (i = 0; i < array_count(fused_tab); ++i) {
+            if (op == fused_tab[i][0] && next == fused_tab[i][1]) {
+                code[pc] = (code[pc] & ~IOP_MASK) | ISET_OP(fused_tab[i][2]);
+                break;
+            }
+        }
+    }
+#else
+    (void)code;
+    (void)size;
+#endif
+}
+
+/* get the plain instruction of a superinstruction, used for saved code */
+binstruction be_vm_unfuse(binstruction ins)
+{
+    size_t i;
+    bopcode op = IGET_OP(ins);
+    for (i = 0; i < array_count(fused_tab); ++i) {
+        if (op == fused_tab[i][2]) {
+            return (ins & ~IOP_MASK) | ISET_OP(fused_tab[i][0]);
+        }
+    }
+    return ins;
+}
+
+#if BE_USE_INLINE_CACHE
+/* forget all cached member lookups, called when a class is
+ * changed or freed */
+void be_vm_flush_mbrcache(bvm *vm)
+{
+    memset(vm->mbrcache, 0, sizeof(vm->mbrcache));
+}
+#endif
+
 static void make_range(bvm *vm, bvalue lower, bvalue upper)
 {
     /* get method 'item' (possible GC) */
@@ -423,6 +524,11 @@ BERRY_API bvm* be_vm_new(void)
     be_loadlibs(vm);
 #if BE_USE_OBSERVABILITY_HOOK
     vm->obshook = NULL;
+#endif
+#if BE_USE_PERF_COUNTERS
+    vm->counter_ins = 0;
+    vm->counter_mbr_hit = 0;
+    vm->counter_mbr_miss = 0;
 #endif
     return vm;
 }
@@ -441,16 +547,30 @@ BERRY_API void be_vm_delete(bvm *vm)
     /* free native hook */
     if (var_istype(&vm->hook, BE_COMPTR))
         be_free(vm, var_toobj(&vm->hook), sizeof(struct bhookblock));
+#endif
+#if BE_USE_POOL_ALLOC
+    be_pool_deinit(vm);
 #endif
     /* free VM structure */
     be_os_free(vm);
 }
 
+#if VM_THREADED_CODE
+  #pragma GCC diagnostic push
+  #pragma GCC diagnostic ignored "-Wpedantic" /* labels as values */
+#endif
 static void vm_exec(bvm *vm)
 {
     bclosure *clos;
     bvalue *ktab, *reg;
     binstruction ins;
+#if VM_THREADED_CODE
+    static const void *const disptab[] = {
+        #define OPCODE(opc) &&L_##opc
+        #include "be_opcodes.h"
+        #undef OPCODE
+    };
+#endif
     vm->cf->status |= BASE_FRAME;
 newframe: /* a new call frame */
     be_assert(var_isclosure(vm->cf->func));
@@ -504,12 +624,13 @@ newframe: /* a new call frame */
             int idx = IGET_Bx(ins);
             be_assert(*clos->upvals != NULL);
             *clos->upvals[idx]->value = *v;
+            be_gc_barrier(vm, v);
             dispatch();
         }
-        opcase(MOVE): {
+        opcase(MOVE): opcase(MOVE_CALL): {
             bvalue *dst = RA();
             *dst = *RKB();
-            dispatch();
+            dispatch_fused(MOVE_CALL, CALL);
         }
         opcase(ADD): {
             bvalue *dst = RA(), *a = RKB(), *b = RKC();
@@ -609,13 +730,13 @@ newframe: /* a new call frame */
             var_setbool(dst, res);
             dispatch();
         }
-        opcase(EQ): {
+        opcase(EQ): opcase(EQ_JMPF): {
             bbool res = be_vm_iseq(vm, RKB(), RKC());
             bvalue *dst;
             reg = vm->reg;
             dst = RA();
             var_setbool(dst, res);
-            dispatch();
+            dispatch_fused(EQ_JMPF, JMPF);
         }
         opcase(NE): {
             bbool res = be_vm_isneq(vm, RKB(), RKC());
@@ -714,7 +835,7 @@ newframe: /* a new call frame */
             }
             dispatch();
         }
-        opcase(JMPF): {
+        opcase(JMPF): optarget(JMPF) {
             if (!be_value2bool(vm, RA())) {
                 vm->ip += IGET_sBx(ins);
             }
@@ -736,7 +857,7 @@ newframe: /* a new call frame */
             be_class_upvalue_init(vm, c);
             dispatch();
         }
-        opcase(GETMBR): {
+        opcase(GETMBR): opcase(GETMBR_JMPF): {
             bvalue *a = RA(), *b = RKB(), *c = RKC();
             if (var_isinstance(b) && var_isstr(c)) {
                 obj_attribute(vm, b, c, a);
@@ -768,9 +889,9 @@ newframe: /* a new call frame */
             } else {
                 attribute_error(vm, "attribute", b, c);
             }
-            dispatch();
+            dispatch_fused(GETMBR_JMPF, JMPF);
         }
-        opcase(GETMET): {
+        opcase(GETMET): opcase(GETMET_CALL): {
             bvalue *a = RA(), *b = RKB(), *c = RKC();
             if (var_isinstance(b) && var_isstr(c)) {
                 bvalue self = *b;
@@ -819,14 +940,14 @@ newframe: /* a new call frame */
             } else {
                 attribute_error(vm, "method", b, c);
             }
-            dispatch();
+            dispatch_fused(GETMET_CALL, CALL);
         }
         opcase(SETMBR): {
             bvalue *a = RA(), *b = RKB(), *c = RKC();
             if (var_isinstance(a) && var_isstr(b)) {
                 binstance *obj = var_toobj(a);
                 bstring *attr = var_tostr(b);
-                if (!be_instance_setmember(vm, obj, attr, c)) {
+                if (!be_instance_setmember_cached(vm, obj, attr, c, mbrcache(vm))) {
                     vm_error(vm, "attribute_error",
                         "class '%s' cannot assign to attribute '%s'",
                         str(be_instance_name(obj)), str(attr));
@@ -840,6 +961,7 @@ newframe: /* a new call frame */
                 bvalue *v = be_module_bind(vm, obj, attr);
                 if (v != NULL) {
                     *v = tmp;
+                    be_gc_barrier(vm, v);
                     dispatch();
                 }
                 /* if it failed, try 'setmeemner' */
@@ -907,6 +1029,7 @@ newframe: /* a new call frame */
             if (var_isclass(a) && var_isclass(b)) {
                 bclass *obj = var_toobj(a);
                 be_class_setsuper(obj, var_toobj(b));
+                be_gc_barrier(vm, b);
             } else {
                 vm_error(vm, "type_error",
                     "value '%s' does not support set super",
@@ -985,7 +1108,7 @@ newframe: /* a new call frame */
             }
             dispatch();
         }
-        opcase(CALL): {
+        opcase(CALL): optarget(CALL) {
             bvalue *var = RA();
             int mode = 0, argc = IGET_RKB(ins);
         recall: /* goto: instantiation class and call constructor */
@@ -1083,6 +1206,9 @@ newframe: /* a new call frame */
         }
     }
 }
+#if VM_THREADED_CODE
+  #pragma GCC diagnostic pop
+#endif
 
 static void do_closure(bvm *vm, bvalue *reg, int argc)
 {
@@ -9,6 +9,15 @@
 #define BE_VM_H
 
 #include "be_object.h"
+#include "be_mem.h"
+
+/* member lookup cache entry, see BE_USE_INLINE_CACHE */
+typedef struct bmembercache {
+    bclass *klass; /* class of the instance, NULL if unused */
+    bstring *name; /* member name */
+    bvalue value; /* member variable index or method */
+    int depth; /* superinstance holding the member */
+} bmembercache;
 
 typedef struct {
     struct {
@@ -32,14 +41,26 @@ typedef struct {
     int status;
 } bcallframe;
 
+typedef struct {
+    uint32_t cycles; /* completed collections */
+    uint32_t steps; /* incremental steps */
+    uint32_t pause_last; /* last pause (microseconds) */
+    uint32_t pause_max; /* longest pause */
+    uint32_t pause_cycle; /* longest pause of the current cycle */
+} bgcstat;
+
 struct bgc {
     bgcobject *list; /* the GC-object list */
     bgcobject *gray; /* the gray object list */
     bgcobject *fixed; /* the fixed objecct list  */
+    bgcobject *markstart; /* first object allocated before the cycle */
+    bgcobject **sweep; /* next object to sweep */
     size_t usage; /* the count of bytes currently allocated */
     size_t threshold; /* he threshold of allocation for the next GC */
+    bgcstat stat;
     bbyte steprate; /* the rate of increase in the distribution between two GCs (percentage) */
     bbyte status;
+    bbyte phase; /* incremental collection phase */
 };
 
 struct bstringtable {
@@ -86,6 +107,9 @@ struct bvm {
     bmap *ntvclass; /* native class table */
     blist *registry; /* registry list */
     struct bgc gc;
+#if BE_USE_POOL_ALLOC
+    bmempool pool;
+#endif
 #if BE_USE_OBSERVABILITY_HOOK
     bobshook obshook;
 #endif
@@ -93,6 +117,14 @@ struct bvm {
     bvalue hook;
     bbyte hookmask;
 #endif
+#if BE_USE_INLINE_CACHE
+    bmembercache mbrcache[BE_INLINE_CACHE_SIZE];
+#endif
+#if BE_USE_PERF_COUNTERS
+    uint32_t counter_ins; /* number of instructions executed */
+    uint32_t counter_mbr_hit; /* member cache hits */
+    uint32_t counter_mbr_miss; /* member cache misses */
+#endif
 };
 
 #define NONE_FLAG           0
@@ -107,5 +139,12 @@ bbool be_vm_islt(bvm *vm, bvalue *a, bvalue *b);
 bbool be_vm_isle(bvm *vm, bvalue *a, bvalue *b);
 bbool be_vm_isgt(bvm *vm, bvalue *a, bvalue *b);
 bbool be_vm_isge(bvm *vm, bvalue *a, bvalue *b);
+void be_vm_fuse(binstruction *code, int size);
+binstruction be_vm_unfuse(binstruction ins);
+#if BE_USE_INLINE_CACHE
+void be_vm_flush_mbrcache(bvm *vm);
+#else
+#define be_vm_flush_mbrcache(vm)
+#endif
 
 #endif
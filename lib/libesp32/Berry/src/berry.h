@@ -121,6 +121,7 @@ enum berrorcode {
 typedef struct bvm bvm;        /* virtual machine structure */
 typedef int (*bntvfunc)(bvm*); /* native function pointer */
 struct bclass;
+struct bstring;
 
 /* native function information */
 typedef struct {
@@ -259,7 +260,7 @@ typedef struct bntvmodule {
         .marked = GC_CONST,                               \
         .extra = 0,                                       \
         .slen = _len,                                     \
-        .hash = 0,                                        \
+        .hash = (uint32_t)(_hash),                        \
         .s = _s                                           \
     }
 
@@ -271,7 +272,7 @@ typedef struct bntvmodule {
         .marked = GC_CONST,                   \
         .extra = 0,                           \
         .slen = _len,                         \
-        .hash = 0,                            \
+        .hash = (uint32_t)(_hash),            \
         .s = _s                               \
     }
 
@@ -404,7 +405,7 @@ typedef void(*bntvhook)(bvm *vm, bhookinfo *info);
 typedef void(*bobshook)(bvm *vm, int event, ...);
 enum beobshookevents {
   BE_OBS_GC_START,        // start of GC, arg = allocated size
-  BE_OBS_GC_END,          // end of GC, arg = allocated size
+  BE_OBS_GC_END,          // end of GC, arg = allocated size, longest pause of the cycle in us
 };
 
 /* FFI functions */
@@ -469,6 +470,8 @@ BERRY_API void be_pushint(bvm *vm, bint i);
 BERRY_API void be_pushreal(bvm *vm, breal r);
 BERRY_API void be_pushstring(bvm *vm, const char *str);
 BERRY_API void be_pushnstring(bvm *vm, const char *str, size_t n);
+BERRY_API struct bstring* be_intern(bvm *vm, const char *str);
+BERRY_API void be_pushintern(bvm *vm, struct bstring *s);
 BERRY_API const char* be_pushfstring(bvm *vm, const char *format, ...);
 BERRY_API void* be_pushbuffer(bvm *vm, size_t size);
 BERRY_API void be_pushvalue(bvm *vm, int index);
@@ -546,12 +549,17 @@ BERRY_API void be_vm_delete(bvm *vm);
 /* Observability hook */
 BERRY_API void be_set_obs_hook(bvm *vm, bobshook hook);
 
+/* incremental GC APIs */
+BERRY_API void be_gc_incremental(bvm *vm, bbool enable);
+BERRY_API bbool be_gc_step(bvm *vm, int work);
+
 /* code load APIs */
 BERRY_API int be_loadbuffer(bvm *vm,
     const char *name, const char *buffer, size_t length);
 BERRY_API int be_loadmode(bvm *vm, const char *name, bbool islocal);
 BERRY_API int be_loadlib(bvm *vm, const char *path);
 BERRY_API int be_savecode(bvm *vm, const char *name);
+BERRY_API bbool be_checkcode(bvm *vm, const char *name, const char *source);
 
 /* module path list APIs */
 BERRY_API void be_module_path(bvm *vm);
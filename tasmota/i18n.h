@@ -221,6 +221,7 @@
 
 #define D_RSLT_ENERGY "ENERGY"
 #define D_RSLT_HASS_STATE "HASS_STATE"
+#define D_RSLT_HISTORY "HISTORY"
 #define D_RSLT_INFO "INFO"
 #define D_RSLT_MARGINS "MARGINS"
 #define D_RSLT_POWER "POWER"
@@ -250,6 +251,7 @@
   #define D_STATUS11_STATUS "STS"
   #define D_STATUS12_STATUS "STK"
   #define D_STATUS13_SHUTTER "SHT"
+  #define D_STATUS14_DISPATCH "DSP"
 #define D_CMND_STATE "State"
 #define D_CMND_POWER "Power"
 #define D_CMND_FANSPEED "FanSpeed"
@@ -260,6 +262,7 @@
 #define D_CMND_SETSENSOR "SetSensor"
 #define D_CMND_SENSOR "Sensor"
 #define D_CMND_DRIVER "Driver"
+#define D_CMND_PROFILE "Profile"
 #define D_CMND_SAVEDATA "SaveData"
 #define D_CMND_SETOPTION "SetOption"
 #define D_CMND_SO "SO"
@@ -428,6 +431,7 @@
 #define D_CMND_CURRENTLOW "CurrentLow"
 #define D_CMND_CURRENTHIGH "CurrentHigh"
 #define D_CMND_ENERGYRESET "EnergyReset"
+#define D_CMND_ENERGYHISTORY "EnergyHistory"
 #define D_CMND_POWERSET "PowerSet"
 #define D_CMND_VOLTAGESET "VoltageSet"
 #define D_CMND_CURRENTSET "CurrentSet"
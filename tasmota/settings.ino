@@ -412,6 +412,7 @@ bool SettingsConfigRestore(void) {
   if (valid_settings) {
     SettingsDefaultSet2();
     memcpy((char*)Settings +16, settings_buffer +16, config_len -16);
+    SettingsTextIndexInvalidate();
     Settings->version = buffer_version;  // Restore version and auto upgrade after restart
   }
 
@@ -424,12 +425,42 @@ bool SettingsConfigRestore(void) {
  * Config Settings->text char array support
 \*********************************************************************************************/
 
-uint32_t GetSettingsTextLen(void) {
+/*
+ * RAM side offset table into Settings->text_pool allowing constant time access.
+ * It is rebuilt lazily after Settings->text_pool has been changed in bulk (load, restore or defaults)
+ * and updated on every SettingsUpdateText().
+ */
+uint16_t settings_text_offset[SET_MAX +1];  // Offset of each text in Settings->text_pool plus total used length
+TSettings* settings_text_indexed = nullptr; // Settings for which the offset table is valid
+
+void SettingsTextIndexInvalidate(void) {
+  settings_text_indexed = nullptr;
+}
+
+void SettingsTextIndexBuild(void) {
   char* position = Settings->text_pool;
-  for (uint32_t size = 0; size < SET_MAX; size++) {
+  for (uint32_t index = 0; index < SET_MAX; index++) {
+    settings_text_offset[index] = position - Settings->text_pool;
     while (*position++ != '\0') { }
   }
-  return position - Settings->text_pool;
+  settings_text_offset[SET_MAX] = position - Settings->text_pool;
+  settings_text_indexed = Settings;
+}
+
+uint32_t SettingsTextOffset(uint32_t index) {
+  if (settings_text_indexed != Settings) {
+    SettingsTextIndexBuild();
+  }
+  uint32_t offset = settings_text_offset[index];
+  if (offset && (Settings->text_pool[offset -1] != '\0')) {  // Pool changed without invalidating the index
+    SettingsTextIndexBuild();
+    offset = settings_text_offset[index];
+  }
+  return offset;
+}
+
+uint32_t GetSettingsTextLen(void) {
+  return SettingsTextOffset(SET_MAX);
 }
 
 bool settings_text_mutex = false;
@@ -456,20 +487,9 @@ bool SettingsUpdateText(uint32_t index, const char* replace_me) {
   memcpy_P(replace, replace_me, sizeof(replace));
   uint32_t index_save = index;
 
-  uint32_t start_pos = 0;
-  uint32_t end_pos = 0;
-  char* position = Settings->text_pool;
-  for (uint32_t size = 0; size < SET_MAX; size++) {
-    while (*position++ != '\0') { }
-    if (1 == index) {
-      start_pos = position - Settings->text_pool;
-    }
-    else if (0 == index) {
-      end_pos = position - Settings->text_pool -1;
-    }
-    index--;
-  }
-  uint32_t char_len = position - Settings->text_pool;
+  uint32_t start_pos = SettingsTextOffset(index);
+  uint32_t end_pos = settings_text_offset[index +1] -1;
+  uint32_t char_len = settings_text_offset[SET_MAX];
 
   uint32_t current_len = end_pos - start_pos;
   int diff = replace_len - current_len;
@@ -491,6 +511,10 @@ bool SettingsUpdateText(uint32_t index, const char* replace_me) {
     if (diff != 0) {
       // Shift Settings->text up or down
       memmove_P(Settings->text_pool + start_pos + replace_len, Settings->text_pool + end_pos, char_len - end_pos);
+      // Shift offsets of following texts
+      for (uint32_t i = index +1; i <= SET_MAX; i++) {
+        settings_text_offset[i] += diff;
+      }
     }
     // Replace text
     memmove_P(Settings->text_pool + start_pos, replace, replace_len);
@@ -516,9 +540,7 @@ char* SettingsText(uint32_t index) {
     position += settings_text_size -1;  // Setting not supported - internal error - return empty string
   } else {
     SettingsUpdateFinished();
-    for (;index > 0; index--) {
-      while (*position++ != '\0') { }
-    }
+    position += SettingsTextOffset(index);
   }
   return position;
 }
@@ -654,6 +676,7 @@ void SettingsLoad(void) {
   if (source) { settings_location = 1; }
   AddLog(LOG_LEVEL_NONE, PSTR(D_LOG_CONFIG "Loaded from %s, " D_COUNT " %lu"), (source)?"File":"Nvm", Settings->save_flag);
 #endif  // ESP32
+  SettingsTextIndexInvalidate();
 
 #ifndef FIRMWARE_MINIMAL
   if ((0 == settings_location) || (Settings->cfg_holder != (uint16_t)CFG_HOLDER)) {  // Init defaults if cfg_holder differs from user settings in my_user_config.h
@@ -751,6 +774,7 @@ void SettingsDefault(void) {
 
 void SettingsDefaultSet1(void) {
   memset(Settings, 0x00, sizeof(TSettings));
+  SettingsTextIndexInvalidate();
 
   Settings->cfg_holder = (uint16_t)CFG_HOLDER;
   Settings->cfg_size = sizeof(TSettings);
@@ -766,6 +790,7 @@ const uint8_t default_fingerprint2[] PROGMEM = { MQTT_FINGERPRINT2 };
 
 void SettingsDefaultSet2(void) {
   memset((char*)Settings +16, 0x00, sizeof(TSettings) -16);
+  SettingsTextIndexInvalidate();
 
   // this little trick allows GCC to optimize the assignment by grouping values and doing only ORs
   SOBitfield   flag = { 0 };
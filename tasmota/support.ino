@@ -894,31 +894,32 @@ int GetCommandCode(char* destination, size_t destination_size, const char* needl
 {
   // Returns -1 of not found
   // Returns index and command if found
+  // Commands are compared in place, only the found command (or the last if not found) is copied
   int result = -1;
   const char* read = haystack;
-  char* write = destination;
+  const char* command;
+  char ch;
 
-  while (true) {
+  do {
     result++;
-    size_t size = destination_size -1;
-    write = destination;
-    char ch = '.';
-    while ((ch != '\0') && (ch != '|')) {
+    command = read;
+    const char* compare = needle;
+    ch = pgm_read_byte(read++);
+    while (ch && (ch != '|') && (tolower((uint8_t)ch) == tolower((uint8_t)*compare))) {
+      compare++;
       ch = pgm_read_byte(read++);
-      if (size && (ch != '|'))  {
-        *write++ = ch;
-        size--;
-      }
     }
-    *write = '\0';
-    if (!strcasecmp(needle, destination)) {
-      break;
+    if (((0 == ch) || ('|' == ch)) && (0 == *compare)) {
+      break;                                                // Found
+    }
+    while (ch && (ch != '|')) {                             // Skip rest of command
+      ch = pgm_read_byte(read++);
     }
     if (0 == ch) {
       result = -1;
-      break;
     }
-  }
+  } while (ch);
+  GetTextIndexed(destination, destination_size, 0, command);
   return result;
 }
 
@@ -927,14 +928,12 @@ bool DecodeCommand(const char* haystack, void (* const MyCommand[])(void), const
   GetTextIndexed(XdrvMailbox.command, CMDSZ, 0, haystack);  // Get prefix if available
   int prefix_length = strlen(XdrvMailbox.command);
   if (prefix_length) {
-    char prefix[prefix_length +1];
-    snprintf_P(prefix, sizeof(prefix), XdrvMailbox.topic);  // Copy prefix part only
-    if (strcasecmp(prefix, XdrvMailbox.command)) {
+    if (strncasecmp(XdrvMailbox.topic, XdrvMailbox.command, prefix_length)) {
       return false;                                         // Prefix not in command
     }
   }
+  int command_code = GetCommandCode(XdrvMailbox.command + prefix_length, CMDSZ - prefix_length, XdrvMailbox.topic + prefix_length, haystack);
   size_t syn_count = synonyms ? pgm_read_byte(synonyms) : 0;
-  int command_code = GetCommandCode(XdrvMailbox.command + prefix_length, CMDSZ, XdrvMailbox.topic + prefix_length, haystack);
   if (command_code > 0) {                                   // Skip prefix
     if (command_code > syn_count) {
       // We passed the synonyms zone, it's a regular command
@@ -1185,6 +1184,33 @@ char* ResponseGetTime(uint32_t format, char* time_str)
   return time_str;
 }
 
+#ifdef MQTT_DATA_STRING
+char* ResponseString::Grow(void* ctx, size_t len) {
+  // Called by ext_vsnprintf_grow_P when the result does not fit, returns the buffer to format into
+  ResponseString* response = (ResponseString*)ctx;
+  uint32_t mlen = response->length();
+  uint32_t size = response->capacity() + (response->capacity() >> 1);  // Grow by 50% to limit regrowth
+  if (size < mlen + len) { size = mlen + len; }
+  if (!response->reserve(size)) { return nullptr; }
+  return response->wbuffer() + mlen;
+}
+
+int32_t ResponseString::AppendVP(const char* format, va_list args) {
+  // Format straight into the String buffer and only grow it if the result does not fit
+  uint32_t mlen = length();
+  if (!reserve(mlen +1)) { return mlen; }  // Make sure there is a valid buffer
+
+  int32_t len = ext_vsnprintf_grow_P(wbuffer() + mlen, capacity() - mlen +1, ResponseString::Grow, this, format, args);
+  if (len < 0) { len = 0; }
+  if (mlen + len > capacity()) {           // Buffer could not grow
+    wbuffer()[mlen] = '\0';                // Remove truncated result
+    return mlen;
+  }
+  setLen(mlen + len);
+  return mlen + len;
+}
+#endif  // MQTT_DATA_STRING
+
 uint32_t ResponseSize(void) {
 #ifdef MQTT_DATA_STRING
   return MAX_LOGSZ;                            // Arbitratry max length satisfying full log entry
@@ -1201,6 +1227,15 @@ uint32_t ResponseLength(void) {
 #endif
 }
 
+char* ResponseData(void) {
+  // Writable response buffer, for example to parse the response in place
+#ifdef MQTT_DATA_STRING
+  return (char*)TasmotaGlobal.mqtt_data.c_str();
+#else
+  return TasmotaGlobal.mqtt_data;
+#endif
+}
+
 void ResponseClear(void) {
   // Reset string length to zero
 #ifdef MQTT_DATA_STRING
@@ -1211,6 +1246,13 @@ void ResponseClear(void) {
 #endif
 }
 
+void ResponseReserve(uint32_t size) {
+  // Pre-size response buffer to avoid regrowth while appending
+#ifdef MQTT_DATA_STRING
+  TasmotaGlobal.mqtt_data.reserve(size);
+#endif
+}
+
 void ResponseJsonStart(void) {
   // Insert a JSON start bracket {
 #ifdef MQTT_DATA_STRING
@@ -1224,17 +1266,12 @@ int Response_P(const char* format, ...)        // Content send snprintf_P char d
 {
   // This uses char strings. Be aware of sending %% if % is needed
 #ifdef MQTT_DATA_STRING
+  ResponseClear();
   va_list arg;
   va_start(arg, format);
-  char* mqtt_data = ext_vsnprintf_malloc_P(format, arg);
+  int len = TasmotaGlobal.mqtt_data.AppendVP(format, arg);
   va_end(arg);
-  if (mqtt_data != nullptr) {
-    TasmotaGlobal.mqtt_data = mqtt_data;
-    free(mqtt_data);
-  } else {
-    TasmotaGlobal.mqtt_data = "";
-  }
-  return TasmotaGlobal.mqtt_data.length();
+  return len;
 #else
   va_list args;
   va_start(args, format);
@@ -1253,13 +1290,9 @@ int ResponseTime_P(const char* format, ...)    // Content send snprintf_P char d
 
   va_list arg;
   va_start(arg, format);
-  char* mqtt_data = ext_vsnprintf_malloc_P(format, arg);
+  int len = TasmotaGlobal.mqtt_data.AppendVP(format, arg);
   va_end(arg);
-  if (mqtt_data != nullptr) {
-    TasmotaGlobal.mqtt_data += mqtt_data;
-    free(mqtt_data);
-  }
-  return TasmotaGlobal.mqtt_data.length();
+  return len;
 #else
   va_list args;
   va_start(args, format);
@@ -1279,13 +1312,9 @@ int ResponseAppend_P(const char* format, ...)  // Content send snprintf_P char d
 #ifdef MQTT_DATA_STRING
   va_list arg;
   va_start(arg, format);
-  char* mqtt_data = ext_vsnprintf_malloc_P(format, arg);
+  int len = TasmotaGlobal.mqtt_data.AppendVP(format, arg);
   va_end(arg);
-  if (mqtt_data != nullptr) {
-    TasmotaGlobal.mqtt_data += mqtt_data;
-    free(mqtt_data);
-  }
-  return TasmotaGlobal.mqtt_data.length();
+  return len;
 #else
   va_list args;
   va_start(args, format);
@@ -1903,6 +1932,15 @@ void SetNextTimeInterval(uint32_t& timer, const uint32_t step)
   timer = millis() + (step - passed);
 }
 
+void SetWakeupDeadline(uint32_t deadline)
+{
+  // Shorten the sleep of the main loop to run again at deadline (millis), the earliest deadline of a loop is kept.
+  if (0 == deadline) { deadline++; }    // 0 means no deadline
+  if (!TasmotaGlobal.wakeup_deadline || (TimeDifference(TasmotaGlobal.wakeup_deadline, deadline) < 0)) {
+    TasmotaGlobal.wakeup_deadline = deadline;
+  }
+}
+
 int32_t TimePassedSinceUsec(uint32_t timestamp)
 {
   return TimeDifference(timestamp, micros());
@@ -2293,6 +2331,46 @@ void SyslogAsync(bool refresh) {
   }
 }
 
+/*********************************************************************************************\
+ * Log buffer
+ *
+ * TasmotaGlobal.log_buffer is used as a circular byte arena holding log lines as
+ * [mxtime][log data]['\1']. A log line never wraps around the end of the arena.
+ * TasLog.index is a ring of LOG_INDEX_SIZE entries, one per stored log line, ordered
+ * by sequence id (1..255) starting at TasLog.oldest. This allows O(1) append and
+ * O(1) lookup by sequence id while readers can skip lines by level without
+ * touching the arena.
+\*********************************************************************************************/
+
+struct {
+  struct {
+    uint32_t offset : 13;                  // Offset of log line in log_buffer
+    uint32_t length : 13;                  // Length of log line including terminating '\1'
+    uint32_t loglevel : 4;                 // Log level of log line
+  } index[LOG_INDEX_SIZE];
+  uint16_t head;                           // Index position of oldest log line
+  uint16_t count;                          // Number of log lines in log_buffer
+  uint16_t write;                          // Offset in log_buffer for next log line
+  uint16_t used;                           // Number of characters used by log lines
+  uint8_t oldest;                          // Sequence id of oldest log line
+} TasLog;
+
+int32_t LogIndexPosition(uint32_t index) {
+  // Return position in TasLog.index of sequence id index or -1 if not (or no longer) available
+  if (!TasLog.count || !index || (index > 255)) { return -1; }
+  uint32_t distance = (index >= TasLog.oldest) ? index - TasLog.oldest : index + 255 - TasLog.oldest;  // Skip 0 as it is not allowed
+  if (distance >= TasLog.count) { return -1; }
+  return (TasLog.head + distance) % LOG_INDEX_SIZE;
+}
+
+void LogIndexRemoveOldest(void) {
+  TasLog.used -= TasLog.index[TasLog.head].length;
+  TasLog.head = (TasLog.head + 1) % LOG_INDEX_SIZE;
+  TasLog.count--;
+  TasLog.oldest++;
+  if (!TasLog.oldest) { TasLog.oldest++; }  // Skip 0 as it is not allowed
+}
+
 bool NeedLogRefresh(uint32_t req_loglevel, uint32_t index) {
   if (!TasmotaGlobal.log_buffer) { return false; }  // Leave now if there is no buffer available
 
@@ -2303,12 +2381,16 @@ bool NeedLogRefresh(uint32_t req_loglevel, uint32_t index) {
 #endif  // ESP32
 
   // Skip initial buffer fill
-  if (strlen(TasmotaGlobal.log_buffer) < LOG_BUFFER_SIZE / 2) { return false; }
+  if (TasLog.used < LOG_BUFFER_SIZE / 2) { return false; }
 
   char* line;
   size_t len;
   if (!GetLog(req_loglevel, &index, &line, &len)) { return false; }
-  return ((line - TasmotaGlobal.log_buffer) < LOG_BUFFER_SIZE / 4);
+  // Refresh if the next line to be read is amongst the first to be overwritten
+  uint32_t tail = TasLog.index[TasLog.head].offset;
+  uint32_t offset = line - TasmotaGlobal.log_buffer;
+  uint32_t distance = (offset >= tail) ? offset - tail : offset + LOG_BUFFER_SIZE - tail;
+  return (distance < LOG_BUFFER_SIZE / 4);
 }
 
 bool GetLog(uint32_t req_loglevel, uint32_t* index_p, char** entry_pp, size_t* len_p) {
@@ -2324,39 +2406,29 @@ bool GetLog(uint32_t req_loglevel, uint32_t* index_p, char** entry_pp, size_t* l
   TasAutoMutex mutex(&TasmotaGlobal.log_buffer_mutex);
 #endif  // ESP32
 
-  if (!index) {                            // Dump all
-    index = TasmotaGlobal.log_buffer[0];
+  int32_t position = LogIndexPosition(index);
+  if (position < 0) {                      // Dump all or requested entry is no longer available
+    if (!TasLog.count) {
+      *index_p = TasmotaGlobal.log_buffer_pointer;
+      return false;
+    }
+    index = TasLog.oldest;
+    position = TasLog.head;
   }
 
-  do {
-    size_t len = 0;
-    uint32_t loglevel = 0;
-    char* entry_p = TasmotaGlobal.log_buffer;
-    do {
-      uint32_t cur_idx = *entry_p;
-      entry_p++;
-      size_t tmp = strchrspn(entry_p, '\1');
-      tmp++;                               // Skip terminating '\1'
-      if (cur_idx == index) {              // Found the requested entry
-        loglevel = *entry_p - '0';
-        entry_p++;                         // Skip loglevel
-        len = tmp -1;
-        break;
-      }
-      entry_p += tmp;
-    } while (entry_p < TasmotaGlobal.log_buffer + LOG_BUFFER_SIZE && *entry_p != '\0');
+  while (index != TasmotaGlobal.log_buffer_pointer) {
+    uint32_t loglevel = TasLog.index[position].loglevel;
     index++;
     if (index > 255) { index = 1; }        // Skip 0 as it is not allowed
     *index_p = index;
-    if ((len > 0) &&
-        (loglevel <= req_loglevel) &&
+    if ((loglevel <= req_loglevel) &&
         (TasmotaGlobal.masterlog_level <= req_loglevel)) {
-      *entry_pp = entry_p;
-      *len_p = len;
+      *entry_pp = TasmotaGlobal.log_buffer + TasLog.index[position].offset;
+      *len_p = TasLog.index[position].length;
       return true;
     }
-    delay(0);
-  } while (index != TasmotaGlobal.log_buffer_pointer);
+    position = (position + 1) % LOG_INDEX_SIZE;
+  }
   return false;
 }
 
@@ -2370,7 +2442,7 @@ void AddLogData(uint32_t loglevel, const char* log_data, const char* log_data_pa
   TasAutoMutex mutex(&TasmotaGlobal.log_buffer_mutex);
 #endif  // ESP32
 
-  char mxtime[14];  // "13:45:21.999 "
+  char mxtime[24];  // "13:45:21.999 ", sized for any uint32_t millis
   snprintf_P(mxtime, sizeof(mxtime), PSTR("%02d" D_HOUR_MINUTE_SEPARATOR "%02d" D_MINUTE_SECOND_SEPARATOR "%02d.%03d "), RtcTime.hour, RtcTime.minute, RtcTime.second, RtcMillis());
 
   char empty[2] = { 0 };
@@ -2392,35 +2464,56 @@ void AddLogData(uint32_t loglevel, const char* log_data, const char* log_data_pa
 
   if ((loglevel <= highest_loglevel) &&    // Log only when needed
       (TasmotaGlobal.masterlog_level <= highest_loglevel)) {
-    // Delimited, zero-terminated buffer of log lines.
-    // Each entry has this format: [index][loglevel][log data]['\1']
-
     // Truncate log messages longer than MAX_LOGSZ which is the log buffer size minus 64 spare
     uint32_t log_data_len = strlen(log_data) + strlen(log_data_payload) + strlen(log_data_retained);
     char too_long[TOPSZ];
     if (log_data_len > MAX_LOGSZ) {
       snprintf_P(too_long, sizeof(too_long) - 20, PSTR("%s%s"), log_data, log_data_payload);   // 20 = strlen("... 123456 truncated")
-      snprintf_P(too_long, sizeof(too_long), PSTR("%s... %d truncated"), too_long, log_data_len);
+      uint32_t too_long_len = strlen(too_long);
+      snprintf_P(too_long + too_long_len, sizeof(too_long) - too_long_len, PSTR("... %d truncated"), log_data_len);
       log_data = too_long;
       log_data_payload = empty;
       log_data_retained = empty;
+      log_data_len = strlen(too_long);
     }
+    uint32_t length = strlen(mxtime) + log_data_len +1;  // 1 = '\1'
+    uint32_t needed = length +1;           // 1 = '\0' added by snprintf and overwritten by next log line
 
     TasmotaGlobal.log_buffer_pointer &= 0xFF;
     if (!TasmotaGlobal.log_buffer_pointer) {
       TasmotaGlobal.log_buffer_pointer++;  // Index 0 is not allowed as it is the end of char string
     }
-    while (TasmotaGlobal.log_buffer_pointer == TasmotaGlobal.log_buffer[0] ||  // If log already holds the next index, remove it
-           strlen(TasmotaGlobal.log_buffer) + strlen(log_data) + strlen(log_data_payload) + strlen(log_data_retained) + strlen(mxtime) + 4 > LOG_BUFFER_SIZE)  // 4 = log_buffer_pointer + '\1' + '\0'
-    {
-      char* it = TasmotaGlobal.log_buffer;
-      it++;                                // Skip log_buffer_pointer
-      it += strchrspn(it, '\1');           // Skip log line
-      it++;                                // Skip delimiting "\1"
-      memmove(TasmotaGlobal.log_buffer, it, LOG_BUFFER_SIZE -(it-TasmotaGlobal.log_buffer));  // Move buffer forward to remove oldest log line
+    if (TasLog.count >= LOG_INDEX_SIZE) {
+      LogIndexRemoveOldest();              // Index full so remove oldest log line
+    }
+    while (true) {                         // Make room by removing oldest log lines
+      if (!TasLog.count) {
+        TasLog.write = 0;
+        break;
+      }
+      uint32_t tail = TasLog.index[TasLog.head].offset;
+      if (tail < TasLog.write) {           // Log lines occupy tail up to write
+        if (TasLog.write + needed <= LOG_BUFFER_SIZE) { break; }
+        TasLog.write = 0;                  // Log line does not fit at end so wrap around
+      }
+      if (TasLog.write + needed <= tail) { break; }  // Free space from write up to tail
+      LogIndexRemoveOldest();
+    }
+    if (!TasLog.count) {
+      TasLog.oldest = TasmotaGlobal.log_buffer_pointer;
     }
-    snprintf_P(TasmotaGlobal.log_buffer, LOG_BUFFER_SIZE, PSTR("%s%c%c%s%s%s%s\1"),
-      TasmotaGlobal.log_buffer, TasmotaGlobal.log_buffer_pointer++, '0'+loglevel, mxtime, log_data, log_data_payload, log_data_retained);
+
+    snprintf_P(TasmotaGlobal.log_buffer + TasLog.write, needed, PSTR("%s%s%s%s\1"),
+      mxtime, log_data, log_data_payload, log_data_retained);
+    uint32_t position = (TasLog.head + TasLog.count) % LOG_INDEX_SIZE;
+    TasLog.index[position].offset = TasLog.write;
+    TasLog.index[position].length = length;
+    TasLog.index[position].loglevel = loglevel;
+    TasLog.count++;
+    TasLog.used += length;
+    TasLog.write += length;
+
+    TasmotaGlobal.log_buffer_pointer++;
     TasmotaGlobal.log_buffer_pointer &= 0xFF;
     if (!TasmotaGlobal.log_buffer_pointer) {
       TasmotaGlobal.log_buffer_pointer++;  // Index 0 is not allowed as it is the end of char string
@@ -42,7 +42,7 @@ const char kTasmotaCommands[] PROGMEM = "|"  // No prefix
 #endif  // USE_DEVICE_GROUPS_SEND
   D_CMND_DEVGROUP_SHARE "|" D_CMND_DEVGROUPSTATUS "|" D_CMND_DEVGROUP_TIE "|"
 #endif  // USE_DEVICE_GROUPS
-  D_CMND_SETSENSOR "|" D_CMND_SENSOR "|" D_CMND_DRIVER
+  D_CMND_SETSENSOR "|" D_CMND_SENSOR "|" D_CMND_DRIVER "|" D_CMND_PROFILE
 #ifdef ESP32
    "|Info|" D_CMND_TOUCH_CAL "|" D_CMND_TOUCH_THRES "|" D_CMND_TOUCH_NUM "|" D_CMND_CPU_FREQUENCY
 #endif  // ESP32
@@ -74,7 +74,7 @@ void (* const TasmotaCommand[])(void) PROGMEM = {
 #endif  // USE_DEVICE_GROUPS_SEND
   &CmndDevGroupShare, &CmndDevGroupStatus, &CmndDevGroupTie,
 #endif  // USE_DEVICE_GROUPS
-  &CmndSetSensor, &CmndSensor, &CmndDriver
+  &CmndSetSensor, &CmndSensor, &CmndDriver, &CmndProfile
 #ifdef ESP32
   , &CmndInfo, &CmndTouchCal, &CmndTouchThres, &CmndTouchNum, &CmndCpuFrequency
 #endif  // ESP32
@@ -660,6 +660,11 @@ void CmndStatus(void)
   }
 #endif
 
+  if (14 == payload) {  // Not part of Status 0
+    XFuncShowStats();
+    CmndStatusResponse(14);
+  }
+
   CmndStatusResponse(99);
 
   ResponseClear();
@@ -2291,6 +2296,26 @@ void CmndDriver(void)
   XdrvCall(FUNC_COMMAND_DRIVER);
 }
 
+void CmndProfile(void)
+{
+  // Profile   - Show drivers using most cycles
+  // Profile 0 - Stop profiling and release memory
+  // Profile 1 - Start profiling
+  // Profile 2 - Reset profile counters
+  switch (XdrvMailbox.payload) {
+    case 0:
+      ProfileStop();
+      break;
+    case 1:
+      ProfileStart();
+      break;
+    case 2:
+      ProfileReset();
+      break;
+  }
+  ProfileShow();
+}
+
 #ifdef ESP32
 
 void CmndInfo(void) {
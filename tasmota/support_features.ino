@@ -749,8 +749,10 @@ void ResponseAppendFeatures(void)
 #if defined(USE_I2C) && defined(USE_T67XX)
     feature8 |= 0x00000080;
 #endif
+#if defined(USE_ENERGY_SENSOR) && defined(USE_ENERGY_HISTORY)
+    feature8 |= 0x00000100;  // xdrv_03_energy_history.ino
+#endif
 
-//    feature8 |= 0x00000100;
 //    feature8 |= 0x00000200;
 //    feature8 |= 0x00000400;
 //    feature8 |= 0x00000800;
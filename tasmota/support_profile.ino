@@ -0,0 +1,145 @@
+/*
+  support_profile.ino - driver call profiler for Tasmota
+
+  Copyright (C) 2021  Theo Arends
+
+  This program is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+/*********************************************************************************************\
+ * Driver call profiler
+ *
+ * Collects calls, total and maximum cycles and a latency histogram per dispatcher, driver and
+ * function. Command Profile 1 allocates the table and starts profiling, Profile 0 stops it and
+ * releases the memory. Without table the dispatchers only pay one pointer test per call.
+\*********************************************************************************************/
+
+const uint16_t PROFILE_MAX_ENTRIES = 128;      // Power of two
+const uint8_t PROFILE_BUCKETS = 5;             // Latency histogram buckets
+const uint8_t PROFILE_SHOW_TOP = 10;           // Entries shown by command Profile
+
+enum ProfileSources { PROFILE_XDRV, PROFILE_XSNS, PROFILE_XNRG, PROFILE_XLGT };
+const char kProfileSources[] PROGMEM = "Drv|Sns|Nrg|Lgt";
+
+const uint16_t kProfileBucketUs[PROFILE_BUCKETS -1] = { 10, 100, 1000, 10000 };  // Bucket upper bounds in microseconds
+
+typedef struct PROFILE_ENTRY {
+  uint64_t cycles;                             // Total cycles
+  uint32_t calls;
+  uint32_t max_cycles;
+  uint32_t histogram[PROFILE_BUCKETS];         // Call counts per latency bucket, summing up to calls
+  uint16_t key;                                // 0x8000 | source << 13 | slot << 6 | function or 0 if unused
+} PROFILE_ENTRY;
+
+struct PROFILE {
+  PROFILE_ENTRY* table = nullptr;
+  uint32_t bucket_cycles[PROFILE_BUCKETS -1];  // Bucket upper bounds in cycles
+  uint32_t cycles_per_us;
+  uint32_t dropped;                            // Calls not recorded as table is full
+  uint32_t start;                              // Uptime at last reset
+} Profile;
+
+void ProfileReset(void) {
+  if (!Profile.table) { return; }
+  memset(Profile.table, 0, PROFILE_MAX_ENTRIES * sizeof(PROFILE_ENTRY));
+  Profile.cycles_per_us = ESP.getCpuFreqMHz();
+  for (uint32_t i = 0; i < PROFILE_BUCKETS -1; i++) {
+    Profile.bucket_cycles[i] = kProfileBucketUs[i] * Profile.cycles_per_us;
+  }
+  Profile.dropped = 0;
+  Profile.start = TasmotaGlobal.uptime;
+}
+
+void ProfileStart(void) {
+  if (!Profile.table) {
+    Profile.table = (PROFILE_ENTRY*)malloc(PROFILE_MAX_ENTRIES * sizeof(PROFILE_ENTRY));
+  }
+  ProfileReset();
+}
+
+void ProfileStop(void) {
+  PROFILE_ENTRY* table = Profile.table;
+  Profile.table = nullptr;
+  free(table);
+}
+
+void ProfileAdd(uint32_t source, uint32_t slot, uint32_t function, uint32_t start_cycles) {
+  // Called by dispatchers only if Profile.table is allocated
+  uint32_t cycles = ESP.getCycleCount() - start_cycles;
+  uint32_t key = 0x8000 | (source << 13) | ((slot & 0x7F) << 6) | (function & 0x3F);
+  uint32_t index = ((key * 2654435761UL) >> 16) & (PROFILE_MAX_ENTRIES -1);
+  for (uint32_t probe = 0; probe < PROFILE_MAX_ENTRIES; probe++) {
+    PROFILE_ENTRY &entry = Profile.table[index];
+    if (0 == entry.key) { entry.key = key; }
+    if (key == entry.key) {
+      entry.calls++;
+      entry.cycles += cycles;
+      if (cycles > entry.max_cycles) { entry.max_cycles = cycles; }
+      uint32_t bucket = 0;
+      while ((bucket < PROFILE_BUCKETS -1) && (cycles >= Profile.bucket_cycles[bucket])) { bucket++; }
+      entry.histogram[bucket]++;
+      return;
+    }
+    index = (index +1) & (PROFILE_MAX_ENTRIES -1);
+  }
+  Profile.dropped++;
+}
+
+uint32_t ProfileDriverId(uint32_t key) {
+  uint32_t slot = (key >> 6) & 0x7F;
+  switch ((key >> 13) & 0x03) {
+    case PROFILE_XDRV: return XdrvId(slot);
+    case PROFILE_XSNS: return XsnsId(slot);
+  }
+  return slot +1;                              // Energy and light dispatchers have no id list
+}
+
+void ProfileShow(void) {
+  // {"Profile":{"State":"ON","Seconds":120,"Entries":34,"Dropped":0,
+  //  "Top":[{"Drv":1,"Fn":5,"Calls":2400,"CyclesAvg":1200,"Max":40000,"mS":18,"Hist":[2000,380,20,0,0]},...]}}
+  Response_P(PSTR("{\"" D_CMND_PROFILE "\":{\"" D_CMND_STATE "\":\"%s\""), GetStateText(Profile.table != nullptr));
+  if (Profile.table) {
+    uint32_t entries = 0;
+    for (uint32_t i = 0; i < PROFILE_MAX_ENTRIES; i++) {
+      if (Profile.table[i].key) { entries++; }
+    }
+    ResponseAppend_P(PSTR(",\"Seconds\":%u,\"Entries\":%u,\"Dropped\":%u,\"Top\":["),
+      TasmotaGlobal.uptime - Profile.start, entries, Profile.dropped);
+
+    // Show entries by decreasing total cycles
+    uint64_t below = UINT64_MAX;
+    int32_t below_index = -1;
+    for (uint32_t shown = 0; shown < PROFILE_SHOW_TOP; shown++) {
+      int32_t top = -1;
+      for (int32_t i = 0; i < PROFILE_MAX_ENTRIES; i++) {
+        const PROFILE_ENTRY &entry = Profile.table[i];
+        if (!entry.key) { continue; }
+        if ((entry.cycles > below) || ((entry.cycles == below) && (i <= below_index))) { continue; }  // Already shown
+        if ((top < 0) || (entry.cycles > Profile.table[top].cycles)) { top = i; }
+      }
+      if (top < 0) { break; }
+      const PROFILE_ENTRY &entry = Profile.table[top];
+      below = entry.cycles;
+      below_index = top;
+      char source[4];
+      ResponseAppend_P(PSTR("%s{\"%s\":%u,\"Fn\":%u,\"Calls\":%u,\"CyclesAvg\":%u,\"Max\":%u,\"mS\":%u,\"Hist\":[%u,%u,%u,%u,%u]}"),
+        (shown) ? "," : "", GetTextIndexed(source, sizeof(source), (entry.key >> 13) & 0x03, kProfileSources),
+        ProfileDriverId(entry.key), entry.key & 0x3F, entry.calls, (uint32_t)(entry.cycles / entry.calls), entry.max_cycles,
+        (uint32_t)(entry.cycles / (Profile.cycles_per_us * 1000)),
+        entry.histogram[0], entry.histogram[1], entry.histogram[2], entry.histogram[3], entry.histogram[4]);
+    }
+    ResponseAppend_P(PSTR("]"));
+  }
+  ResponseJsonEndEnd();
+}
@@ -822,6 +822,10 @@ String GetSwitchText(uint32_t i) {
 
 bool MqttShowSensor(void)
 {
+  static uint32_t sensor_response_size = 0;  // Size of previous sensor response used to pre-size buffer
+
+  uint32_t response_start = ResponseLength();
+  ResponseReserve(response_start + sensor_response_size);
   ResponseAppendTime();
 
   int json_data_start = ResponseLength();
@@ -878,6 +882,7 @@ bool MqttShowSensor(void)
     ResponseAppend_P(PSTR(",\"" D_JSON_SPEED_UNIT "\":\"%s\""), SpeedUnit().c_str());
   }
   ResponseJsonEnd();
+  sensor_response_size = ResponseLength() - response_start;
 
   if (json_data_available) { XdrvCall(FUNC_SHOW_SENSOR); }
   return json_data_available;
@@ -177,6 +177,8 @@ const uint16_t LOG_BUFFER_SIZE = 4096;      // Max number of characters in logbu
 const uint16_t LOG_BUFFER_SIZE = 6096;      // Max number of characters in logbuffer used by weblog, syslog and mqttlog
 #endif  // ESP8266
 
+const uint16_t LOG_INDEX_SIZE = 128;        // Max number of log lines tracked in logbuffer index (max 254 as sequence ids are 1..255)
+
 #ifdef MQTT_DATA_STRING
 const uint16_t MAX_LOGSZ = LOG_BUFFER_SIZE -96;  // Max number of characters in log line - may be overruled which will truncate log entry
 #else
@@ -192,7 +194,7 @@ const uint32_t SOFT_BAUDRATE = 9600;        // Default software serial baudrate
 const uint32_t APP_BAUDRATE = 115200;       // Default serial baudrate
 const uint32_t SERIAL_POLLING = 100;        // Serial receive polling in ms
 const uint32_t ZIGBEE_POLLING = 100;        // Serial receive polling in ms
-const uint8_t MAX_STATUS = 13;              // Max number of status lines
+const uint8_t MAX_STATUS = 14;              // Max number of status lines
 
 const uint32_t START_VALID_TIME = 1451602800;  // Time is synced and after 2016-01-01
 
@@ -331,8 +333,19 @@ enum XsnsFunctions {FUNC_SETTINGS_OVERRIDE, FUNC_PIN_STATE, FUNC_MODULE_INIT, FU
                     FUNC_WEB_ADD_HANDLER, FUNC_SET_CHANNELS, FUNC_SET_SCHEME, FUNC_HOTPLUG_SCAN,
                     FUNC_DEVICE_GROUP_ITEM };
 
+// Periodic functions FUNC_LOOP to FUNC_EVERY_SECOND are only dispatched to subscribed drivers and sensors
+#define XFUNC_TICK(f)  (1 << ((f) - FUNC_LOOP))
+const uint8_t XFUNC_TICKS = FUNC_EVERY_SECOND - FUNC_LOOP +1;
+const uint8_t XFUNC_TICK_ALL = (1 << XFUNC_TICKS) -1;
+
 enum AddressConfigSteps { ADDR_IDLE, ADDR_RECEIVE, ADDR_SEND };
 
+enum MetricTypes { METRIC_GAUGE, METRIC_COUNTER };
+enum MetricFormats { METRIC_FLOAT, METRIC_INT32, METRIC_UINT32 };
+// Metric float resolution 0 to 7 is a fixed number of decimals, the others follow the Settings
+enum MetricResolutions { METRIC_RES_TEMPERATURE = 8, METRIC_RES_HUMIDITY, METRIC_RES_PRESSURE, METRIC_RES_ENERGY,
+                         METRIC_RES_WATTAGE, METRIC_RES_VOLTAGE, METRIC_RES_CURRENT, METRIC_RES_FREQUENCY };
+
 enum SettingsTextIndex { SET_OTAURL,
                          SET_MQTTPREFIX1, SET_MQTTPREFIX2, SET_MQTTPREFIX3,  // MAX_MQTT_PREFIXES
                          SET_STASSID1, SET_STASSID2,  // MAX_SSIDS
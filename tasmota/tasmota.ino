@@ -99,6 +99,7 @@ struct {
   uint32_t zc_offset;                       // Zero cross moment offset due to monitoring chip processing (microseconds)
   uint32_t zc_code_offset;                  // Zero cross moment offset due to executing power code (microseconds)
   uint32_t zc_interval;                     // Zero cross interval around 8333 (60Hz) or 10000 (50Hz) (microseconds)
+  uint32_t wakeup_deadline;                 // Earliest millis() a driver needs the next loop, 0 if none (see SetWakeupDeadline)
   GpioOptionABits gpio_optiona;             // GPIO Option_A flags
   void *log_buffer_mutex;                   // Control access to log buffer
 
@@ -181,7 +182,7 @@ struct {
 #endif
 
 #ifdef MQTT_DATA_STRING
-  String mqtt_data;                         // Buffer filled by Response functions
+  ResponseString mqtt_data;                 // Buffer filled by Response functions
 #else
   char mqtt_data[MESSZ];                    // MQTT publish buffer
 #endif
@@ -521,16 +522,23 @@ void Scheduler(void) {
 void loop(void) {
   uint32_t my_sleep = millis();
 
+  TasmotaGlobal.wakeup_deadline = 0;
   Scheduler();
 
   uint32_t my_activity = millis() - my_sleep;
 
+  uint32_t max_sleep = TasmotaGlobal.sleep;        // Wake up in time for the next deadline of a driver
+  if (TasmotaGlobal.wakeup_deadline) {
+    int32_t wakeup = -TimePassedSince(TasmotaGlobal.wakeup_deadline);
+    max_sleep = (wakeup <= 0) ? 0 : tmin(max_sleep, (uint32_t)wakeup);
+  }
+
   if (Settings->flag3.sleep_normal) {               // SetOption60 - Enable normal sleep instead of dynamic sleep
     //  yield();                                   // yield == delay(0), delay contains yield, auto yield in loop
-    SleepDelay(TasmotaGlobal.sleep);               // https://github.com/esp8266/Arduino/issues/2021
+    SleepDelay(max_sleep);                         // https://github.com/esp8266/Arduino/issues/2021
   } else {
     if (my_activity < (uint32_t)TasmotaGlobal.sleep) {
-      SleepDelay((uint32_t)TasmotaGlobal.sleep - my_activity);  // Provide time for background tasks like wifi
+      SleepDelay(tmin((uint32_t)TasmotaGlobal.sleep - my_activity, max_sleep));  // Provide time for background tasks like wifi
     } else {
       if (TasmotaGlobal.global_state.network_down) {
         SleepDelay(my_activity /2);                // If wifi down and my_activity > setoption36 then force loop delay to 1/3 of my_activity period
@@ -226,6 +226,8 @@ String EthernetMacAddress(void);
 #define TASM_FILE_TLSKEY            "/tlskey"          // TLS private key
 #define TASM_FILE_ZIGBEE            "/zb"              // Zigbee devices information blob
 #define TASM_FILE_ZIGBEE_DATA       "/zbdata"          // Zigbee last known values of devices
+#define TASM_FILE_ZIGBEE_JOURNAL    "/zbjournal"       // Zigbee devices changes since the last full save
+#define TASM_FILE_ENERGY_HISTORY    "/energyhist"      // Energy history of minutes, quarters and hours
 #define TASM_FILE_AUTOEXEC          "/autoexec.bat"    // Commands executed after restart
 #define TASM_FILE_CONFIG            "/config.sys"      // Settings executed after restart
 
@@ -508,6 +510,23 @@ bool first_device_group_is_local = true;
 
 #define SO_SYNONYMS(N,...) const static uint8_t __syn_array_len_ ## N[] = { __VA_ARGS__ }; /* this first array will not be kept by linker, just used for sizeof() */ const static uint8_t N[] PROGMEM = { sizeof(__syn_array_len_ ## N), __VA_ARGS__ };
 
+/*********************************************************************************************\
+ * Response buffer
+ *
+ * String formatting straight into its own buffer without intermediate heap allocation.
+ * Capacity is kept between responses and grown by 50% when needed to limit regrowth.
+\*********************************************************************************************/
+
+#ifdef MQTT_DATA_STRING
+class ResponseString : public String {
+public:
+  using String::operator=;
+  int32_t AppendVP(const char* format, va_list args);
+private:
+  static char* Grow(void* ctx, size_t len);
+};
+#endif  // MQTT_DATA_STRING
+
 /*********************************************************************************************/
 
 #endif  // _TASMOTA_GLOBALS_H_
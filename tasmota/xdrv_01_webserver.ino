@@ -3273,6 +3273,10 @@ bool Xdrv01(uint8_t function)
 {
   bool result = false;
 
+  if (FUNC_PRE_INIT == function) {
+    XdrvSubscribe(XDRV_01, XFUNC_TICK(FUNC_LOOP) | XFUNC_TICK(FUNC_EVERY_SECOND));
+  }
+
   switch (function) {
     case FUNC_LOOP:
       PollDnsWebserver();
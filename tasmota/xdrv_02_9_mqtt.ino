@@ -1822,6 +1822,9 @@ bool Xdrv02(uint8_t function)
 {
   bool result = false;
 
+  if (FUNC_PRE_INIT == function) {
+    XdrvSubscribe(XDRV_02, XFUNC_TICK(FUNC_EVERY_50_MSECOND));
+  }
   if (Settings->flag.mqtt_enabled) {  // SetOption3 - Enable MQTT
     switch (function) {
       case FUNC_EVERY_50_MSECOND:  // https://github.com/knolleary/pubsubclient/issues/556
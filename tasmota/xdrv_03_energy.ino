@@ -56,6 +56,9 @@ const char kEnergyCommands[] PROGMEM = "|"  // No prefix
   D_CMND_SAFEPOWER "|" D_CMND_SAFEPOWERHOLD "|"  D_CMND_SAFEPOWERWINDOW "|"
 #endif  // USE_ENERGY_POWER_LIMIT
 #endif  // USE_ENERGY_MARGIN_DETECTION
+#ifdef USE_ENERGY_HISTORY
+  D_CMND_ENERGYHISTORY "|"
+#endif  // USE_ENERGY_HISTORY
   D_CMND_ENERGYRESET "|" D_CMND_TARIFF;
 
 void (* const EnergyCommand[])(void) PROGMEM = {
@@ -69,6 +72,9 @@ void (* const EnergyCommand[])(void) PROGMEM = {
   &CmndSafePower, &CmndSafePowerHold, &CmndSafePowerWindow,
 #endif  // USE_ENERGY_POWER_LIMIT
 #endif  // USE_ENERGY_MARGIN_DETECTION
+#ifdef USE_ENERGY_HISTORY
+  &CmndEnergyHistory,
+#endif  // USE_ENERGY_HISTORY
   &CmndEnergyReset, &CmndTariff};
 
 const char kEnergyPhases[] PROGMEM = "|%s / %s|%s / %s / %s||[%s,%s]|[%s,%s,%s]";
@@ -291,6 +297,9 @@ void Energy200ms(void)
         Energy.max_energy_state  = 0;
       }
 #endif  // USE_ENERGY_POWER_LIMIT
+#ifdef USE_ENERGY_HISTORY
+      EnergyHistoryRequestSample();               // Every second with a valid time
+#endif  // USE_ENERGY_HISTORY
 
     }
   }
@@ -306,6 +315,10 @@ void EnergySaveState(void)
   Settings->energy_kWhtotal = RtcSettings.energy_kWhtotal;
 
   Settings->energy_usage = RtcSettings.energy_usage;
+
+#ifdef USE_ENERGY_HISTORY
+  EnergyHistorySave();
+#endif  // USE_ENERGY_HISTORY
 }
 
 #ifdef USE_ENERGY_MARGIN_DETECTION
@@ -543,6 +556,9 @@ void EnergyEverySecond(void)
 #ifdef USE_ENERGY_MARGIN_DETECTION
   EnergyMarginCheck();
 #endif  // USE_ENERGY_MARGIN_DETECTION
+#ifdef USE_ENERGY_HISTORY
+  EnergyHistoryEverySecond();
+#endif  // USE_ENERGY_HISTORY
 }
 
 /*********************************************************************************************\
@@ -905,11 +921,38 @@ void EnergyDrvInit(void) {
   XnrgCall(FUNC_PRE_INIT);  // Find first energy driver
 }
 
+#ifdef USE_PROMETHEUS
+void EnergyMetricsAdd(void)
+{
+  MetricsAdd(D_RSLT_ENERGY, PSTR(D_JSON_TOTAL), &Energy.total, METRIC_FLOAT, METRIC_COUNTER, METRIC_RES_ENERGY);
+  MetricsAdd(D_RSLT_ENERGY, PSTR(D_JSON_TODAY), &Energy.daily, METRIC_FLOAT, METRIC_GAUGE, METRIC_RES_ENERGY);
+  if (Energy.phase_count > 1) { return; }  // Phase values are arrays in JSON and not exported
+  MetricsAdd(D_RSLT_ENERGY, PSTR(D_JSON_POWERUSAGE), &Energy.active_power[0], METRIC_FLOAT, METRIC_GAUGE, METRIC_RES_WATTAGE);
+  if (!Energy.type_dc) {
+    if (Energy.current_available && Energy.voltage_available) {
+      MetricsAdd(D_RSLT_ENERGY, PSTR(D_JSON_APPARENT_POWERUSAGE), &Energy.apparent_power[0], METRIC_FLOAT, METRIC_GAUGE, METRIC_RES_WATTAGE);
+      MetricsAdd(D_RSLT_ENERGY, PSTR(D_JSON_REACTIVE_POWERUSAGE), &Energy.reactive_power[0], METRIC_FLOAT, METRIC_GAUGE, METRIC_RES_WATTAGE);
+      MetricsAdd(D_RSLT_ENERGY, PSTR(D_JSON_POWERFACTOR), &Energy.power_factor[0], METRIC_FLOAT, METRIC_GAUGE, 2);
+    }
+    MetricsAdd(D_RSLT_ENERGY, PSTR(D_JSON_FREQUENCY), &Energy.frequency[0], METRIC_FLOAT, METRIC_GAUGE, METRIC_RES_FREQUENCY);
+  }
+  if (Energy.voltage_available) {
+    MetricsAdd(D_RSLT_ENERGY, PSTR(D_JSON_VOLTAGE), &Energy.voltage[0], METRIC_FLOAT, METRIC_GAUGE, METRIC_RES_VOLTAGE);
+  }
+  if (Energy.current_available) {
+    MetricsAdd(D_RSLT_ENERGY, PSTR(D_JSON_CURRENT), &Energy.current[0], METRIC_FLOAT, METRIC_GAUGE, METRIC_RES_CURRENT);
+  }
+}
+#endif  // USE_PROMETHEUS
+
 void EnergySnsInit(void)
 {
   XnrgCall(FUNC_INIT);
 
   if (TasmotaGlobal.energy_driver) {
+#ifdef USE_PROMETHEUS
+    EnergyMetricsAdd();
+#endif  // USE_PROMETHEUS
 //    Energy.kWhtoday_offset = 0;
     // Do not use at Power On as Rtc was invalid (but has been restored from Settings already)
     if ((ResetReason() != REASON_DEFAULT_RST) && RtcSettingsValid()) {
@@ -1196,6 +1239,7 @@ bool Xdrv03(uint8_t function)
   bool result = false;
 
   if (FUNC_PRE_INIT == function) {
+    XdrvSubscribe(XDRV_03, XFUNC_TICK(FUNC_LOOP) | XFUNC_TICK(FUNC_EVERY_200_MSECOND) | XFUNC_TICK(FUNC_EVERY_250_MSECOND) | XFUNC_TICK(FUNC_EVERY_SECOND));
     EnergyDrvInit();
   }
   else if (TasmotaGlobal.energy_driver) {
@@ -1207,6 +1251,10 @@ bool Xdrv03(uint8_t function)
         if (TasmotaGlobal.uptime > 4) {
           XnrgCall(FUNC_EVERY_250_MSECOND);
         }
+#ifdef USE_ENERGY_HISTORY
+        EnergyHistorySample();
+        EnergyHistoryBackfill();
+#endif  // USE_ENERGY_HISTORY
         break;
       case FUNC_EVERY_SECOND:
         XnrgCall(FUNC_EVERY_SECOND);
@@ -1222,6 +1270,16 @@ bool Xdrv03(uint8_t function)
       case FUNC_COMMAND:
         result = DecodeCommand(kEnergyCommands, EnergyCommand);
         break;
+#ifdef USE_ENERGY_HISTORY
+      case FUNC_MQTT_INIT:
+        EnergyHistoryMqttConnected();
+        break;
+#ifdef USE_WEBSERVER
+      case FUNC_WEB_ADD_HANDLER:
+        WebServer_on(PSTR("/energy/history"), HandleEnergyHistory);
+        break;
+#endif  // USE_WEBSERVER
+#endif  // USE_ENERGY_HISTORY
     }
   }
   return result;
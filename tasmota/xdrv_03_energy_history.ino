@@ -0,0 +1,551 @@
+/*
+  xdrv_03_energy_history.ino - Energy history support for Tasmota
+
+  Copyright (C) 2021  Theo Arends
+
+  This program is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifdef USE_ENERGY_SENSOR
+#ifdef USE_ENERGY_HISTORY
+/*********************************************************************************************\
+ * Energy history
+ *
+ * Active power, voltage and energy of each phase are sampled every second, as flagged by Energy200ms(), and
+ * kept in ring buffers at 1 second, 1 minute, 15 minutes and 1 hour resolution. Each record holds
+ * the minimum, average and maximum power and voltage and the energy over its interval, energy
+ * being the integral of the active power. Intervals are aligned on UTC, samples are only taken
+ * when the time is valid, and intervals without sample (restart, power loss) are empty records.
+ *
+ * Minutes, quarters and hours are saved to the file system every quarter and before restart.
+ *
+ * http://<ip>/energy/history?res=<s|m|q|h>&fmt=<csv|bin>&from=<utc>
+ *   Streams the records of one resolution (default m) from UTC time <from> (default all) as CSV
+ *   (default) or binary
+ *
+ * EnergyHistory                  - Show the number of records of each resolution
+ * EnergyHistory <res>,<from>     - Publish records of resolution 1..4 (1s, 1m, 15m, 1h) from UTC time <from> to tele/<topic>/HISTORY
+ * EnergyHistory 0                - Stop publishing
+ *
+ * After an MQTT outage of more than one minute the records since the outage are published from
+ * the finest resolution still holding them, also if the device restarted during the outage.
+ *
+ * Binary format, little endian, for each resolution (one in http, minutes to hours in file):
+ *   uint32_t interval             - Seconds
+ *   uint32_t last                 - Interval number (UTC / interval) of the newest record
+ *   uint16_t count                - Number of records, oldest first
+ *   uint8_t  phases
+ *   uint8_t  version              - ENERGY_HISTORY_VERSION
+ *   count * phases records of 16 bytes:
+ *     int16_t  power min, avg, max     - W, avg is -32768 for an empty record
+ *     uint16_t voltage min, avg, max   - 0.1 V
+ *     int32_t  energy                  - 0.01 Wh, negative if exported
+ * The file starts with uint32_t ENERGY_HISTORY_MAGIC and the UTC time MQTT was lost.
+\*********************************************************************************************/
+
+#ifndef ENERGY_HISTORY_SECONDS
+#define ENERGY_HISTORY_SECONDS   60             // Records at 1 second resolution
+#endif
+#ifdef ESP8266
+#ifndef ENERGY_HISTORY_MINUTES
+#define ENERGY_HISTORY_MINUTES   30             // Records at 1 minute resolution
+#endif
+#ifndef ENERGY_HISTORY_QUARTERS
+#define ENERGY_HISTORY_QUARTERS  48             // Records at 15 minutes resolution
+#endif
+#ifndef ENERGY_HISTORY_HOURS
+#define ENERGY_HISTORY_HOURS     72             // Records at 1 hour resolution
+#endif
+#else   // ESP32
+#ifndef ENERGY_HISTORY_MINUTES
+#define ENERGY_HISTORY_MINUTES   60
+#endif
+#ifndef ENERGY_HISTORY_QUARTERS
+#define ENERGY_HISTORY_QUARTERS  96
+#endif
+#ifndef ENERGY_HISTORY_HOURS
+#define ENERGY_HISTORY_HOURS     168
+#endif
+#endif  // ESP8266
+
+#define ENERGY_HISTORY_RINGS     4
+#define ENERGY_HISTORY_NONE      -32768         // Power avg of an empty record
+#define ENERGY_HISTORY_MAGIC     0x31534845     // 'EHS1'
+#define ENERGY_HISTORY_VERSION   1
+#define ENERGY_HISTORY_BACKFILL  2              // Records published every 250 mSec
+#define ENERGY_HISTORY_MAX_GAP   60             // Seconds of energy integrated at most by one sample
+
+const uint16_t kEnergyHistoryInterval[ENERGY_HISTORY_RINGS] PROGMEM = { 1, 60, 900, 3600 };
+const uint16_t kEnergyHistorySize[ENERGY_HISTORY_RINGS] PROGMEM = {
+  ENERGY_HISTORY_SECONDS, ENERGY_HISTORY_MINUTES, ENERGY_HISTORY_QUARTERS, ENERGY_HISTORY_HOURS };
+const char kEnergyHistoryRes[] PROGMEM = "s|m|q|h";
+
+struct EnergyHistoryRecord {                    // One phase over one interval
+  int16_t power_min;                            // W
+  int16_t power_avg;                            // W, ENERGY_HISTORY_NONE if no sample
+  int16_t power_max;                            // W
+  uint16_t voltage_min;                         // 0.1 V
+  uint16_t voltage_avg;                         // 0.1 V
+  uint16_t voltage_max;                         // 0.1 V
+  int32_t energy;                               // 0.01 Wh
+};
+
+struct EnergyHistoryHeader {
+  uint32_t interval;
+  uint32_t last;
+  uint16_t count;
+  uint8_t phases;
+  uint8_t version;
+};
+
+struct EnergyHistoryRing {
+  EnergyHistoryRecord *records;                 // records[index * phases + phase]
+  uint32_t last;                                // Interval number of the newest record
+  uint16_t newest;                              // Index of the newest record
+  uint16_t count;                               // Number of records
+};
+
+struct EnergyHistorySum {                       // One phase over the interval being aggregated
+  int32_t power_sum;
+  uint32_t voltage_sum;
+  int32_t energy;
+  int16_t power_min;
+  int16_t power_max;
+  uint16_t voltage_min;
+  uint16_t voltage_max;
+};
+
+struct ENERGYHISTORY {
+  EnergyHistoryRing ring[ENERGY_HISTORY_RINGS];
+  EnergyHistorySum sum[ENERGY_HISTORY_RINGS -1][ENERGY_MAX_PHASES];  // Minutes, quarters and hours being aggregated
+  uint32_t sum_interval[ENERGY_HISTORY_RINGS -1];  // Interval number being aggregated
+  uint16_t sum_samples[ENERGY_HISTORY_RINGS -1];
+  float energy_fraction[ENERGY_MAX_PHASES];     // 0.01 Wh not yet counted
+  uint32_t mqtt_lost;                           // UTC time MQTT was lost, 0 if not lost
+  uint32_t backfill_next;                       // Interval number of the next record to publish
+  volatile uint32_t sample_time;                // UTC time of the second to sample, set by the Energy200ms() ticker
+  uint32_t sampled_time;                        // UTC time of the last second sampled by the loop
+  uint8_t backfill_ring;                        // Ring being published +1, 0 if none
+  uint8_t phases;                               // 0 until the rings are allocated
+  bool mqtt_seen;                               // MQTT was connected since restart
+  bool save;                                    // A quarter was added, save the rings
+} EnergyHistory;
+
+/********************************************************************************************/
+
+uint32_t EnergyHistoryInterval(uint32_t r) {
+  return pgm_read_word(kEnergyHistoryInterval + r);
+}
+
+uint32_t EnergyHistorySize(uint32_t r) {
+  return pgm_read_word(kEnergyHistorySize + r);
+}
+
+// Number of records of ring r from interval number from, and index of the first one
+uint32_t EnergyHistoryFrom(uint32_t r, uint32_t from, uint32_t *index) {
+  EnergyHistoryRing &ring = EnergyHistory.ring[r];
+  uint32_t count = ring.count;
+  if (from > ring.last) {
+    count = 0;
+  } else if (ring.last - from < count) {
+    count = ring.last - from +1;
+  }
+  uint32_t size = EnergyHistorySize(r);
+  *index = (ring.newest + size +1 - count) % size;
+  return count;
+}
+
+// Interval number of the record at index of ring r
+uint32_t EnergyHistoryIntervalAt(uint32_t r, uint32_t index) {
+  EnergyHistoryRing &ring = EnergyHistory.ring[r];
+  uint32_t size = EnergyHistorySize(r);
+  return ring.last - ((ring.newest + size - index) % size);
+}
+
+void EnergyHistoryPush(uint32_t r, const EnergyHistoryRecord *values);
+void EnergyHistoryPush(uint32_t r, const EnergyHistoryRecord *values) {
+  EnergyHistoryRing &ring = EnergyHistory.ring[r];
+  uint32_t size = EnergyHistorySize(r);
+  ring.newest = (ring.newest +1) % size;
+  if (ring.count < size) { ring.count++; }
+  EnergyHistoryRecord *record = &ring.records[ring.newest * EnergyHistory.phases];
+  if (values) {
+    memcpy(record, values, EnergyHistory.phases * sizeof(EnergyHistoryRecord));
+  } else {
+    memset(record, 0, EnergyHistory.phases * sizeof(EnergyHistoryRecord));
+    for (uint32_t i = 0; i < EnergyHistory.phases; i++) {
+      record[i].power_avg = ENERGY_HISTORY_NONE;
+    }
+  }
+}
+
+void EnergyHistoryAdd(uint32_t r, uint32_t interval, const EnergyHistoryRecord *values);
+void EnergyHistoryAdd(uint32_t r, uint32_t interval, const EnergyHistoryRecord *values) {
+  EnergyHistoryRing &ring = EnergyHistory.ring[r];
+  if (ring.count) {
+    if (interval <= ring.last) { return; }      // Time went backwards
+    if (interval - ring.last > EnergyHistorySize(r)) {
+      ring.count = 0;                           // Gap longer than the ring
+    } else {
+      for (uint32_t i = ring.last +1; i < interval; i++) {
+        EnergyHistoryPush(r, nullptr);          // Intervals without sample
+      }
+    }
+  }
+  EnergyHistoryPush(r, values);
+  ring.last = interval;
+}
+
+/*********************************************************************************************\
+ * Persistence
+\*********************************************************************************************/
+
+#ifdef USE_UFILESYS
+extern FS *ffsp;
+#endif  // USE_UFILESYS
+
+void EnergyHistoryLoad(void) {
+#ifdef USE_UFILESYS
+  if (!ffsp || !TfsFileExists(TASM_FILE_ENERGY_HISTORY)) { return; }
+  File file = ffsp->open(TASM_FILE_ENERGY_HISTORY, "r");
+  if (!file) { return; }
+
+  uint32_t head[2] = { 0 };
+  file.read((uint8_t*)head, sizeof(head));
+  if (ENERGY_HISTORY_MAGIC == head[0]) {
+    EnergyHistory.mqtt_lost = head[1];
+    uint32_t record_size = EnergyHistory.phases * sizeof(EnergyHistoryRecord);
+    for (uint32_t r = 1; r < ENERGY_HISTORY_RINGS; r++) {
+      EnergyHistoryHeader header;
+      if ((file.read((uint8_t*)&header, sizeof(header)) != sizeof(header)) ||
+          (header.interval != EnergyHistoryInterval(r)) || (header.phases != EnergyHistory.phases)) {
+        AddLog(LOG_LEVEL_DEBUG, PSTR("NRG: History file does not match"));
+        break;
+      }
+      // Keep the newest records if the ring is smaller than when saved
+      uint32_t count = header.count;
+      uint32_t size = EnergyHistorySize(r);
+      if (count > size) {
+        file.seek((count - size) * record_size, SeekCur);
+        count = size;
+      }
+      EnergyHistoryRing &ring = EnergyHistory.ring[r];
+      file.read((uint8_t*)ring.records, count * record_size);
+      ring.count = count;
+      ring.newest = (count) ? count -1 : size -1;
+      ring.last = header.last;
+    }
+  }
+  file.close();
+  AddLog(LOG_LEVEL_DEBUG, PSTR("NRG: History loaded %d minutes, %d quarters, %d hours"),
+    EnergyHistory.ring[1].count, EnergyHistory.ring[2].count, EnergyHistory.ring[3].count);
+#endif  // USE_UFILESYS
+}
+
+void EnergyHistorySave(void) {
+  EnergyHistory.save = false;
+#ifdef USE_UFILESYS
+  if (!EnergyHistory.phases || !ffsp) { return; }
+  File file = ffsp->open(TASM_FILE_ENERGY_HISTORY, "w");
+  if (!file) {
+    AddLog(LOG_LEVEL_INFO, PSTR("NRG: History save failed"));
+    return;
+  }
+
+  uint32_t head[2] = { ENERGY_HISTORY_MAGIC, EnergyHistory.mqtt_lost };
+  file.write((uint8_t*)head, sizeof(head));
+  uint32_t record_size = EnergyHistory.phases * sizeof(EnergyHistoryRecord);
+  for (uint32_t r = 1; r < ENERGY_HISTORY_RINGS; r++) {
+    EnergyHistoryRing &ring = EnergyHistory.ring[r];
+    EnergyHistoryHeader header = { EnergyHistoryInterval(r), ring.last, ring.count, EnergyHistory.phases, ENERGY_HISTORY_VERSION };
+    file.write((uint8_t*)&header, sizeof(header));
+    uint32_t index;
+    uint32_t count = EnergyHistoryFrom(r, 0, &index);
+    uint32_t first = tmin(count, EnergyHistorySize(r) - index);  // Records up to the end of the ring, then from its start
+    file.write((uint8_t*)&ring.records[index * EnergyHistory.phases], first * record_size);
+    file.write((uint8_t*)ring.records, (count - first) * record_size);
+  }
+  file.close();
+#endif  // USE_UFILESYS
+}
+
+/*********************************************************************************************\
+ * Sampling
+\*********************************************************************************************/
+
+bool EnergyHistoryInit(void) {
+  uint32_t records = 0;
+  for (uint32_t r = 0; r < ENERGY_HISTORY_RINGS; r++) {
+    records += EnergyHistorySize(r);
+  }
+  uint32_t phases = Energy.phase_count;
+  EnergyHistoryRecord *buffer = (EnergyHistoryRecord*)calloc(records * phases, sizeof(EnergyHistoryRecord));
+  if (!buffer) {
+    AddLog(LOG_LEVEL_INFO, PSTR("NRG: Not enough memory for history"));
+    return false;
+  }
+  for (uint32_t r = 0; r < ENERGY_HISTORY_RINGS; r++) {
+    EnergyHistory.ring[r].records = buffer;
+    EnergyHistory.ring[r].newest = EnergyHistorySize(r) -1;
+    buffer += EnergyHistorySize(r) * phases;
+  }
+  EnergyHistory.phases = phases;
+  EnergyHistoryLoad();
+  return true;
+}
+
+// Energy200ms() runs from a Ticker, on ESP32 in another task than the loop, so it only flags the second
+void EnergyHistoryRequestSample(void) {
+  EnergyHistory.sample_time = UtcTime();
+}
+
+// Called every 250 mSec from the loop, samples the second flagged by Energy200ms()
+// Seconds flagged while the loop was stalled are missed, their energy is added to this sample
+void EnergyHistorySample(void) {
+  uint32_t now = EnergyHistory.sample_time;
+  if (now == EnergyHistory.sampled_time) { return; }
+  uint32_t elapsed = now - EnergyHistory.sampled_time;
+  if (!EnergyHistory.sampled_time || (now < EnergyHistory.sampled_time)) {
+    elapsed = 1;                                // First sample or time set back
+  }
+  if (elapsed > ENERGY_HISTORY_MAX_GAP) { elapsed = ENERGY_HISTORY_MAX_GAP; }
+  EnergyHistory.sampled_time = now;
+  if (!EnergyHistory.phases) { return; }        // Allocated by EnergyHistoryEverySecond()
+
+  EnergyHistoryRecord sample[ENERGY_MAX_PHASES];
+  for (uint32_t i = 0; i < EnergyHistory.phases; i++) {
+    float power = Energy.active_power[i];
+    float voltage = (Energy.voltage_available) ? Energy.voltage[(Energy.voltage_common) ? 0 : i] * 10 : 0;
+    int32_t power_w = (power < 0) ? power - 0.5f : power + 0.5f;
+    uint32_t voltage_dv = (voltage > 0) ? voltage + 0.5f : 0;
+    sample[i].power_avg = sample[i].power_min = sample[i].power_max = (power_w > 32767) ? 32767 : (power_w < -32767) ? -32767 : power_w;
+    sample[i].voltage_avg = sample[i].voltage_min = sample[i].voltage_max = tmin(voltage_dv, 65535);
+    EnergyHistory.energy_fraction[i] += power * elapsed / 36;  // Elapsed seconds in 0.01 Wh
+    sample[i].energy = EnergyHistory.energy_fraction[i];
+    EnergyHistory.energy_fraction[i] -= sample[i].energy;
+  }
+  EnergyHistoryAdd(0, now, sample);
+
+  for (uint32_t r = 1; r < ENERGY_HISTORY_RINGS; r++) {
+    uint32_t interval = now / EnergyHistoryInterval(r);
+    uint32_t samples = EnergyHistory.sum_samples[r -1];
+    EnergyHistorySum *sum = EnergyHistory.sum[r -1];
+    if (interval != EnergyHistory.sum_interval[r -1]) {
+      if (samples) {
+        EnergyHistoryRecord record[ENERGY_MAX_PHASES];
+        for (uint32_t i = 0; i < EnergyHistory.phases; i++) {
+          int32_t half = (sum[i].power_sum < 0) ? -(int32_t)(samples / 2) : samples / 2;
+          record[i].power_min = sum[i].power_min;
+          record[i].power_avg = (sum[i].power_sum + half) / (int32_t)samples;
+          record[i].power_max = sum[i].power_max;
+          record[i].voltage_min = sum[i].voltage_min;
+          record[i].voltage_avg = (sum[i].voltage_sum + samples / 2) / samples;
+          record[i].voltage_max = sum[i].voltage_max;
+          record[i].energy = sum[i].energy;
+        }
+        EnergyHistoryAdd(r, EnergyHistory.sum_interval[r -1], record);
+        if (2 == r) { EnergyHistory.save = true; }
+      }
+      EnergyHistory.sum_interval[r -1] = interval;
+      EnergyHistory.sum_samples[r -1] = 0;
+      samples = 0;
+    }
+    for (uint32_t i = 0; i < EnergyHistory.phases; i++) {
+      if (!samples) {
+        sum[i].power_sum = 0;
+        sum[i].voltage_sum = 0;
+        sum[i].energy = 0;
+        sum[i].power_min = sum[i].power_max = sample[i].power_avg;
+        sum[i].voltage_min = sum[i].voltage_max = sample[i].voltage_avg;
+      }
+      sum[i].power_sum += sample[i].power_avg;
+      sum[i].voltage_sum += sample[i].voltage_avg;
+      sum[i].energy += sample[i].energy;
+      if (sample[i].power_avg < sum[i].power_min) { sum[i].power_min = sample[i].power_avg; }
+      if (sample[i].power_avg > sum[i].power_max) { sum[i].power_max = sample[i].power_avg; }
+      if (sample[i].voltage_avg < sum[i].voltage_min) { sum[i].voltage_min = sample[i].voltage_avg; }
+      if (sample[i].voltage_avg > sum[i].voltage_max) { sum[i].voltage_max = sample[i].voltage_avg; }
+    }
+    EnergyHistory.sum_samples[r -1]++;
+  }
+
+  if (MqttIsConnected()) {
+    EnergyHistory.mqtt_seen = true;
+  } else if (EnergyHistory.mqtt_seen && !EnergyHistory.mqtt_lost) {
+    EnergyHistory.mqtt_lost = now;
+  }
+}
+
+void EnergyHistoryEverySecond(void) {
+  if (!EnergyHistory.phases) {
+    if (!RtcTime.valid || !Energy.phase_count || !EnergyHistoryInit()) { return; }
+  }
+  if (EnergyHistory.save) {
+    EnergyHistorySave();
+  }
+}
+
+/*********************************************************************************************\
+ * MQTT backfill
+\*********************************************************************************************/
+
+void EnergyHistoryMqttConnected(void) {
+  if (!EnergyHistory.phases || !RtcTime.valid) { return; }
+  uint32_t lost = EnergyHistory.mqtt_lost;
+  EnergyHistory.mqtt_lost = 0;
+  if (!lost || (UtcTime() - lost < 60)) { return; }
+
+  // Finest of minutes, quarters and hours still holding the start of the outage
+  uint32_t r;
+  for (r = 1; r < ENERGY_HISTORY_RINGS -1; r++) {
+    uint32_t index;
+    if (EnergyHistoryFrom(r, 0, &index) && (EnergyHistoryIntervalAt(r, index) <= lost / EnergyHistoryInterval(r))) { break; }
+  }
+  EnergyHistory.backfill_ring = r +1;
+  EnergyHistory.backfill_next = lost / EnergyHistoryInterval(r);
+  AddLog(LOG_LEVEL_INFO, PSTR("NRG: Publish history since %s"), GetDT(lost).c_str());
+}
+
+void EnergyHistoryResponseRecord(uint32_t r, uint32_t index) {
+  uint32_t interval = EnergyHistoryInterval(r);
+  uint32_t time = EnergyHistoryIntervalAt(r, index) * interval;
+  EnergyHistoryRecord *record = &EnergyHistory.ring[r].records[index * EnergyHistory.phases];
+
+  Response_P(PSTR("{\"" D_JSON_TIME "\":\"%s\",\"" D_CMND_ENERGYHISTORY "\":{\"Utc\":%u,\"Interval\":%u,\"Power\":["),
+    GetDT(time + LocalTime() - UtcTime()).c_str(), time, interval);
+  for (uint32_t i = 0; i < EnergyHistory.phases; i++) {
+    ResponseAppend_P(PSTR("%s[%d,%d,%d]"), (i) ? "," : "", record[i].power_min, record[i].power_avg, record[i].power_max);
+  }
+  ResponseAppend_P(PSTR("],\"Voltage\":["));
+  for (uint32_t i = 0; i < EnergyHistory.phases; i++) {
+    float voltage[3] = { (float)record[i].voltage_min / 10, (float)record[i].voltage_avg / 10, (float)record[i].voltage_max / 10 };
+    ResponseAppend_P(PSTR("%s[%1_f,%1_f,%1_f]"), (i) ? "," : "", &voltage[0], &voltage[1], &voltage[2]);
+  }
+  ResponseAppend_P(PSTR("],\"Energy\":["));
+  for (uint32_t i = 0; i < EnergyHistory.phases; i++) {
+    float energy = (float)record[i].energy / 100;
+    ResponseAppend_P(PSTR("%s%2_f"), (i) ? "," : "", &energy);
+  }
+  ResponseAppend_P(PSTR("]}}"));
+}
+
+// Publish the next records of the backfill, skipping empty records
+void EnergyHistoryBackfill(void) {
+  if (!EnergyHistory.backfill_ring || !MqttIsConnected()) { return; }
+
+  uint32_t r = EnergyHistory.backfill_ring -1;
+  uint32_t size = EnergyHistorySize(r);
+  for (uint32_t published = 0; published < ENERGY_HISTORY_BACKFILL; published++) {
+    uint32_t index;
+    uint32_t count = EnergyHistoryFrom(r, EnergyHistory.backfill_next, &index);
+    EnergyHistoryRecord *records = EnergyHistory.ring[r].records;
+    while (count && (ENERGY_HISTORY_NONE == records[index * EnergyHistory.phases].power_avg)) {
+      index = (index +1) % size;
+      count--;
+    }
+    if (!count) {
+      EnergyHistory.backfill_ring = 0;
+      return;
+    }
+    EnergyHistory.backfill_next = EnergyHistoryIntervalAt(r, index) +1;
+    EnergyHistoryResponseRecord(r, index);
+    MqttPublishPrefixTopic_P(TELE, PSTR(D_RSLT_HISTORY));
+  }
+}
+
+/*********************************************************************************************\
+ * Commands
+\*********************************************************************************************/
+
+void CmndEnergyHistory(void) {
+  if (XdrvMailbox.data_len > 0) {
+    uint32_t values[2] = { 0 };
+    ParseParameters(2, values);
+    if (EnergyHistory.phases && (values[0] > 0) && (values[0] <= ENERGY_HISTORY_RINGS)) {
+      EnergyHistory.backfill_ring = values[0];
+      EnergyHistory.backfill_next = values[1] / EnergyHistoryInterval(values[0] -1);
+    } else {
+      EnergyHistory.backfill_ring = 0;
+    }
+  }
+  Response_P(PSTR("{\"%s\":{\"Seconds\":%d,\"Minutes\":%d,\"Quarters\":%d,\"Hours\":%d,\"Publish\":%d}}"), XdrvMailbox.command,
+    EnergyHistory.ring[0].count, EnergyHistory.ring[1].count, EnergyHistory.ring[2].count, EnergyHistory.ring[3].count,
+    EnergyHistory.backfill_ring);
+}
+
+/*********************************************************************************************\
+ * Web
+\*********************************************************************************************/
+
+#ifdef USE_WEBSERVER
+
+void HandleEnergyHistory(void) {
+  if (!HttpCheckPriviledgedAccess()) { return; }
+
+  AddLog(LOG_LEVEL_DEBUG, PSTR(D_LOG_HTTP "Energy history"));
+
+  char tmp[16];
+  char res[2];
+  WebGetArg(PSTR("res"), tmp, sizeof(tmp));
+  int r = GetCommandCode(res, sizeof(res), tmp, kEnergyHistoryRes);
+  if (r < 0) { r = 1; }                         // Minutes
+  WebGetArg(PSTR("from"), tmp, sizeof(tmp));
+  uint32_t from = strtoul(tmp, nullptr, 0) / EnergyHistoryInterval(r);
+  WebGetArg(PSTR("fmt"), tmp, sizeof(tmp));
+  bool binary = !strcasecmp_P(tmp, PSTR("bin"));
+
+  uint32_t index = 0;
+  uint32_t count = (EnergyHistory.phases) ? EnergyHistoryFrom(r, from, &index) : 0;
+  uint32_t size = EnergyHistorySize(r);
+  EnergyHistoryRecord *records = EnergyHistory.ring[r].records;
+
+  if (binary) {
+    WSContentBegin(200, CT_APP_STREAM);
+    EnergyHistoryHeader header = { EnergyHistoryInterval(r), EnergyHistory.ring[r].last, (uint16_t)count, EnergyHistory.phases, ENERGY_HISTORY_VERSION };
+    _WSContentSend((const char*)&header, sizeof(header));
+    uint32_t record_size = EnergyHistory.phases * sizeof(EnergyHistoryRecord);
+    uint32_t first = tmin(count, size - index);  // Records up to the end of the ring, then from its start
+    if (first) { _WSContentSend((const char*)&records[index * EnergyHistory.phases], first * record_size); }
+    if (count > first) { _WSContentSend((const char*)records, (count - first) * record_size); }
+    WSContentEnd();
+    return;
+  }
+
+  WSContentBegin(200, CT_PLAIN);
+  WSContentSend_P(PSTR("utc,time"));
+  for (uint32_t i = 1; i <= EnergyHistory.phases; i++) {
+    WSContentSend_P(PSTR(",power%d_min,power%d_avg,power%d_max,voltage%d_min,voltage%d_avg,voltage%d_max,energy%d"), i, i, i, i, i, i, i);
+  }
+  WSContentSend_P(PSTR("\n"));
+  int32_t timezone = LocalTime() - UtcTime();
+  for (; count; count--, index = (index +1) % size) {
+    EnergyHistoryRecord *record = &records[index * EnergyHistory.phases];
+    if (ENERGY_HISTORY_NONE == record->power_avg) { continue; }
+    uint32_t time = EnergyHistoryIntervalAt(r, index) * EnergyHistoryInterval(r);
+    WSContentSend_P(PSTR("%u,%s"), time, GetDT(time + timezone).c_str());
+    for (uint32_t i = 0; i < EnergyHistory.phases; i++) {
+      float voltage[3] = { (float)record[i].voltage_min / 10, (float)record[i].voltage_avg / 10, (float)record[i].voltage_max / 10 };
+      float energy = (float)record[i].energy / 100;
+      WSContentSend_P(PSTR(",%d,%d,%d,%1_f,%1_f,%1_f,%2_f"), record[i].power_min, record[i].power_avg, record[i].power_max,
+        &voltage[0], &voltage[1], &voltage[2], &energy);
+    }
+    WSContentSend_P(PSTR("\n"));
+  }
+  WSContentEnd();
+}
+
+#endif  // USE_WEBSERVER
+
+#endif  // USE_ENERGY_HISTORY
+#endif  // USE_ENERGY_SENSOR
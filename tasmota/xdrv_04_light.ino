@@ -249,6 +249,9 @@ struct LIGHT {
   uint16_t fade_start_10[LST_MAX] = {0,0,0,0,0};
   uint16_t fade_cur_10[LST_MAX];
   uint16_t fade_end_10[LST_MAX];         // 10 bits resolution target channel values
+  uint16_t fade_start_rev[LST_MAX];      // fade_start_10 and fade_end_10 with reverse Gamma, computed when the fade starts
+  uint16_t fade_end_rev[LST_MAX];
+  uint8_t  fade_gamma = 0;               // channels with Gamma correction during the fade, bit per channel
   uint16_t fade_duration = 0;            // duration of fade in milliseconds
   uint32_t fade_start = 0;               // fade start time in milliseconds, compared to millis()
   bool     fade_once_enabled = false;    // override fade a single time
@@ -258,6 +261,8 @@ struct LIGHT {
 
   uint16_t pwm_min = 0;                  // minimum value for PWM, from DimmerRange, 0..1023
   uint16_t pwm_max = 1023;               // maxumum value for PWM, from DimmerRange, 0..1023
+  uint16_t * pwm_table = nullptr;        // PWM values 0..pwm_range scaled to pwm_min..pwm_max, nullptr if DimmerRange is the full range
+  uint16_t pwm_table_range = 0;          // pwm_range used to compute pwm_min, pwm_max and pwm_table
 
   // Virtual CT
   uint16_t vct_ct[CT_PIVOTS];            // CT value for each segment
@@ -1099,6 +1104,22 @@ void LightCalcPWMRange(void) {
 
   Light.pwm_min = pwm_min;
   Light.pwm_max = pwm_max;
+
+  // precompute the DimmerRange scaling done by LightSetOutputs() at each animation step
+  if (Light.pwm_table) {
+    free(Light.pwm_table);
+    Light.pwm_table = nullptr;
+  }
+  Light.pwm_table_range = Settings->pwm_range;
+  if ((pwm_min != 0) || (pwm_max != Settings->pwm_range)) {   // no table needed for the full range
+    Light.pwm_table = (uint16_t*) malloc((Settings->pwm_range + 1) * sizeof(uint16_t));
+    if (Light.pwm_table) {
+      Light.pwm_table[0] = 0;
+      for (uint32_t v = 1; v <= Settings->pwm_range; v++) {
+        Light.pwm_table[v] = changeUIntScale(v, 0, Settings->pwm_range, pwm_min, pwm_max);
+      }
+    }
+  }
   //AddLog(LOG_LEVEL_DEBUG_MORE, PSTR("LightCalcPWMRange %d %d - %d %d"), Settings->dimmer_hw_min, Settings->dimmer_hw_max, Light.pwm_min, Light.pwm_max);
 }
 
@@ -1136,6 +1157,7 @@ void LightInit(void)
     // if RGBW or RGBCW, and SetOption37 >= 128, we manage RGB and W separately
     Light.device--;   // we take the last two devices as lights
   }
+  ledGammaInitTable(Settings->light_correction);
   LightCalcPWMRange();
 #ifdef DEBUG_LIGHT
   AddLog(LOG_LEVEL_DEBUG_MORE, "LightInit Light.pwm_multi_channels=%d Light.subtype=%d Light.device=%d TasmotaGlobal.devices_present=%d",
@@ -1907,10 +1929,17 @@ bool LightApplyFade(void) {   // did the value chanegd and needs to be applied
   // Check if we need to calculate the duration
   if (0 == Light.fade_duration) {
     Light.fade_start = now;
+    // start and end values with reverse Gamma don't change during the fade
+    Light.fade_gamma = 0;
+    for (uint32_t i = 0; i < Light.subtype; i++) {
+      if (isChannelGammaCorrected(i)) { Light.fade_gamma |= (1 << i); }
+      Light.fade_start_rev[i] = fadeGammaReverse(i, Light.fade_start_10[i]);
+      Light.fade_end_rev[i] = fadeGammaReverse(i, Light.fade_end_10[i]);
+    }
     // compute the distance between start and and color (max of distance for each channel)
     uint32_t distance = 0;
     for (uint32_t i = 0; i < Light.subtype; i++) {
-      int32_t channel_distance = fadeGammaReverse(i, Light.fade_end_10[i]) - fadeGammaReverse(i, Light.fade_start_10[i]);
+      int32_t channel_distance = Light.fade_end_rev[i] - Light.fade_start_rev[i];
       if (channel_distance < 0) { channel_distance = - channel_distance; }
       if (channel_distance > distance) { distance = channel_distance; }
     }
@@ -1940,12 +1969,13 @@ bool LightApplyFade(void) {   // did the value chanegd and needs to be applied
   uint16_t fade_current = now - Light.fade_start;   // number of milliseconds since start of fade
   if (fade_current <= Light.fade_duration) {    // fade not finished
     //Serial.printf("Fade: %d / %d - ", fade_current, Light.fade_duration);
+    uint16_t fade_current_rev = leddGammaReverseFast(fade_current);    // same for all channels with Gamma
     for (uint32_t i = 0; i < Light.subtype; i++) {
-      Light.fade_cur_10[i] = fadeGamma(i,
-                                changeUIntScale(fadeGammaReverse(i, fade_current),
-                                             0, Light.fade_duration,
-                                             fadeGammaReverse(i, Light.fade_start_10[i]),
-                                             fadeGammaReverse(i, Light.fade_end_10[i])));
+      bool gamma = bitRead(Light.fade_gamma, i);
+      uint16_t fade_cur = changeUIntScale(gamma ? fade_current_rev : fade_current,
+                                          0, Light.fade_duration,
+                                          Light.fade_start_rev[i], Light.fade_end_rev[i]);
+      Light.fade_cur_10[i] = gamma ? ledGammaFast(fade_cur) : fade_cur;
       // Light.fade_cur_10[i] = changeUIntScale(fade_current,
       //                                        0, Light.fade_duration,
       //                                        Light.fade_start_10[i], Light.fade_end_10[i]);
@@ -1997,6 +2027,15 @@ void LightApplyPower(uint8_t new_color[LST_MAX], power_t power) {
   }
 }
 
+// Scale a PWM value 0..pwm_range to pwm_min..pwm_max (DimmerRange), zero stays zero
+uint16_t LightScalePWM(uint16_t v) {
+  if ((Light.pwm_table_range == Settings->pwm_range) && (v <= Settings->pwm_range)) {
+    if (Light.pwm_table) { return Light.pwm_table[v]; }                                 // precomputed by LightCalcPWMRange()
+    if ((0 == Light.pwm_min) && (Light.pwm_max == Settings->pwm_range)) { return v; }  // full range
+  }
+  return v > 0 ? changeUIntScale(v, 0, Settings->pwm_range, Light.pwm_min, Light.pwm_max) : 0;
+}
+
 void LightSetOutputs(const uint16_t *cur_col_10) {
   // now apply the actual PWM values, adjusted and remapped 10-bits range
   if (TasmotaGlobal.light_type < LT_PWM6) {   // only for direct PWM lights, not for Tuya, Armtronix...
@@ -2005,7 +2044,7 @@ void LightSetOutputs(const uint16_t *cur_col_10) {
         //AddLog(LOG_LEVEL_DEBUG, PSTR(D_LOG_APPLICATION "Cur_Col%d 10 bits %d"), i, cur_col_10[i]);
         uint16_t cur_col = cur_col_10[i + Light.pwm_offset];
         if (!isChannelCT(i)) {   // if CT don't use pwm_min and pwm_max
-          cur_col = cur_col > 0 ? changeUIntScale(cur_col, 0, Settings->pwm_range, Light.pwm_min, Light.pwm_max) : 0;   // shrink to the range of pwm_min..pwm_max
+          cur_col = LightScalePWM(cur_col);   // shrink to the range of pwm_min..pwm_max
         }
         if (!Settings->flag4.zerocross_dimmer) {
           analogWrite(Pin(GPIO_PWM1, i), bitRead(TasmotaGlobal.pwm_inverted, i) ? Settings->pwm_range - cur_col : cur_col);
@@ -2876,6 +2915,7 @@ void CmndLedTable(void)
       Settings->light_correction ^= 1;
       break;
     }
+    ledGammaInitTable(Settings->light_correction);
     LightCalcPWMRange();
     Light.update = true;
   }
@@ -3160,6 +3200,10 @@ bool Xdrv04(uint8_t function)
 {
   bool result = false;
 
+  if (FUNC_PRE_INIT == function) {
+    XdrvSubscribe(XDRV_04, XFUNC_TICK(FUNC_LOOP) | XFUNC_TICK(FUNC_EVERY_50_MSECOND));
+  }
+
   if (FUNC_MODULE_INIT == function) {
       return LightModuleInit();
   }
@@ -310,8 +310,31 @@ uint16_t ledGammaReverse_internal(uint16_t vg, const struct gamma_table_t *gt_pt
   }
 }
 
+// Gamma corrected values for 0..1023, filled by ledGammaInitTable()
+uint16_t * gamma_table_10 = nullptr;
+
+// Compute the Gamma curve once for all 10 bits values (2KB), so that ledGamma10_10() is a lookup
+// The table is only kept while LedTable is on, other users get the computed value
+void ledGammaInitTable(bool enable) {
+  if (!enable) {
+    free(gamma_table_10);
+    gamma_table_10 = nullptr;
+    return;
+  }
+  if (gamma_table_10) { return; }
+  uint16_t * table = (uint16_t*) malloc(1024 * sizeof(uint16_t));
+  if (nullptr == table) { return; }
+  for (uint32_t v = 0; v < 1024; v++) {
+    table[v] = ledGamma_internal(v, gamma_table);
+  }
+  gamma_table_10 = table;
+}
+
 // 10 bits in, 10 bits out
 uint16_t ledGamma10_10(uint16_t v) {
+  if (gamma_table_10 && (v < 1024)) {
+    return gamma_table_10[v];
+  }
   return ledGamma_internal(v, gamma_table);
 }
 
@@ -813,6 +813,10 @@ bool Xdrv05(uint8_t function)
 {
   bool result = false;
 
+  if (FUNC_PRE_INIT == function) {
+    XdrvSubscribe(XDRV_05, XFUNC_TICK(FUNC_EVERY_50_MSECOND));
+  }
+
   if (PinUsed(GPIO_IRSEND) || PinUsed(GPIO_IRRECV)) {
     switch (function) {
       case FUNC_PRE_INIT:
@@ -509,6 +509,10 @@ bool Xdrv06(uint8_t function)
 {
   bool result = false;
 
+  if (FUNC_PRE_INIT == function) {
+    XdrvSubscribe(XDRV_06, 0);              // No periodic functions
+  }
+
 #ifdef ESP8266
   if (SONOFF_BRIDGE == TasmotaGlobal.module_type) {
     switch (function) {
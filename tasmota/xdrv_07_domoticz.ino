@@ -630,6 +630,10 @@ void DomoticzSaveSettings(void) {
 bool Xdrv07(uint8_t function) {
   bool result = false;
 
+  if (FUNC_PRE_INIT == function) {
+    XdrvSubscribe(XDRV_07, XFUNC_TICK(FUNC_EVERY_SECOND));
+  }
+
   if (Settings->flag.mqtt_enabled) {  // SetOption3 - Enable MQTT
     switch (function) {
       case FUNC_EVERY_SECOND:
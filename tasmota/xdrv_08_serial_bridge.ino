@@ -186,6 +186,10 @@ bool Xdrv08(uint8_t function)
 {
   bool result = false;
 
+  if (FUNC_PRE_INIT == function) {
+    XdrvSubscribe(XDRV_08, XFUNC_TICK(FUNC_LOOP));
+  }
+
   if (serial_bridge_active) {
     switch (function) {
       case FUNC_LOOP:
@@ -919,6 +919,7 @@ bool Xdrv09(uint8_t function)
 
   switch (function) {
     case FUNC_PRE_INIT:
+      XdrvSubscribe(XDRV_09, XFUNC_TICK(FUNC_EVERY_SECOND));
       TimerSetRandomWindows();
       break;
 #ifdef USE_WEBSERVER
@@ -161,8 +161,41 @@ void (* const RulesCommand[])(void) PROGMEM = {
   LinkedList<MQTT_Subscription> subscriptions;
 #endif  // SUPPORT_MQTT_EVENT
 
+/*
+ * Rule sets are compiled once into a table of triggers so events are matched without
+ * re-parsing the rule text. A table is recompiled on the next event after SetRule().
+ */
+typedef struct RULE_TRIGGER {
+  String trigger;            // "INA219#CURRENT>0.100" as written after ON, used for logging
+  String name;               // "INA219#CURRENT" JSON path without TELE- prefix and [index]
+  String param;              // "0.100" or "%VAR1%" right side of comparison
+  String commands;           // "Backlog Dimmer 10;Color 100000"
+  float value;               // Value of param if constant
+  uint32_t root_bit;         // Bit of first JSON path key in event key mask
+  uint16_t vars;             // Bitmask of %VARx% used in commands
+  uint16_t mems;             // Bitmask of %MEMx% used in commands
+  uint16_t specials;         // Bitmask of kRulesSpecialVars used in commands
+  int8_t compare;            // Compare operator or COMPARE_OPERATOR_NONE
+  uint8_t name_index;        // Array index 1..6 or 0 if none
+  bool teleperiod;           // TELE- prefix
+  bool constant;             // param is a constant and value is valid
+  bool stop;                 // BREAK instead of ENDON
+} RULE_TRIGGER;
+
+// Special variables in order of replacement in commands
+enum RulesSpecialVars { RULES_VAR_VALUE, RULES_VAR_TIME, RULES_VAR_UTCTIME, RULES_VAR_UPTIME, RULES_VAR_TIMESTAMP,
+                        RULES_VAR_TOPIC, RULES_VAR_DEVICEID, RULES_VAR_MACADDR, RULES_VAR_SUNRISE, RULES_VAR_SUNSET,
+                        RULES_VAR_ZBDEVICE, RULES_VAR_ZBGROUP, RULES_VAR_ZBCLUSTER, RULES_VAR_ZBENDPOINT };
+const char kRulesSpecialVars[] PROGMEM =
+  "%VALUE%|%TIME%|%UTCTIME%|%UPTIME%|%TIMESTAMP%|"
+  "%TOPIC%|%DEVICEID%|%MACADDR%|%SUNRISE%|%SUNSET%|"
+  "%ZBDEVICE%|%ZBGROUP%|%ZBCLUSTER%|%ZBENDPOINT%";
+
 struct RULES {
   String event_value;
+  RULE_TRIGGER* compiled[MAX_RULE_SETS] = { nullptr };
+  uint8_t compiled_count[MAX_RULE_SETS] = { 0 };
+  uint8_t compiled_valid = 0;  // Bitmask of rule sets with valid compiled triggers
   unsigned long timer[MAX_RULE_TIMERS] = { 0 };
   uint32_t triggers[MAX_RULE_SETS] = { 0 };
   uint8_t trigger_count[MAX_RULE_SETS] = { 0 };
@@ -329,6 +362,7 @@ int32_t SetRule_compress(uint32_t idx, const char *in, size_t in_len, char *out,
 //   <0 : not enough space
 int32_t SetRule(uint32_t idx, const char *content, bool append = false) {
   if (nullptr == content) { content = ""; }   // if nullptr, use empty string
+  bitClear(Rules.compiled_valid, idx);        // Recompile triggers on next event
   size_t len_in = strlen(content);
   bool needsCompress = false;
   size_t offset = 0;
@@ -410,137 +444,233 @@ int32_t SetRule(uint32_t idx, const char *content, bool append = false) {
 
 /*******************************************************************************************/
 
-bool RulesRuleMatch(uint8_t rule_set, String &event, String &rule, bool stop_all_rules)
-{
-  // event = {"INA219":{"Voltage":4.494,"Current":0.020,"Power":0.089}}
-  // event = {"System":{"Boot":1}}
-  // rule = "INA219#CURRENT>0.100"
+uint32_t RulesKeyBit(const char* key, uint32_t len) {
+  // Bit in event key mask for (upper case) key
+  uint32_t hash = 0;
+  for (uint32_t i = 0; i < len; i++) {
+    hash = (hash * 31) + (uint8_t)key[i];
+  }
+  return 1UL << (hash & 0x1F);
+}
 
-  bool match = false;
-  char stemp[10];
+void RulesCompileTrigger(struct RULE_TRIGGER &trigger, const String &event_trigger, String commands, bool stop)
+{
+  // event_trigger = "TELE-INA219#CURRENT[1]>0.100", commands = " Backlog Dimmer 10;Color 100000 "
+  trigger.trigger = event_trigger;
+  trigger.stop = stop;
 
-  // Step1: Analyse rule
-  String rule_expr = rule;                             // "TELE-INA219#CURRENT>0.100"
-  if (Rules.teleperiod) {
-    int ppos = rule_expr.indexOf(F("TELE-"));          // "TELE-INA219#CURRENT>0.100" or "INA219#CURRENT>0.100"
-    if (ppos == -1) { return false; }                  // No pre-amble in rule
-    rule_expr = rule.substring(5);                     // "INA219#CURRENT>0.100" or "SYSTEM#BOOT"
+  String rule_expr = event_trigger;
+  trigger.teleperiod = (rule_expr.indexOf(F("TELE-")) != -1);
+  if (trigger.teleperiod) {
+    rule_expr = event_trigger.substring(5);            // "INA219#CURRENT[1]>0.100"
   }
-
   String rule_name, rule_param;
-  int8_t compareOperator = parseCompareExpression(rule_expr, rule_name, rule_param);  // Parse the compare expression.Return operator and the left, right part of expression
+  trigger.compare = parseCompareExpression(rule_expr, rule_name, rule_param);  // Parse the compare expression.Return operator and the left, right part of expression
 
-  // rule_name  = "INA219#CURRENT"
-  // rule_param = "0.100" or "%VAR1%"
+  trigger.name_index = 0;
+  int pos;
+  if ((pos = rule_name.indexOf(F("["))) > 0) {         // "SUBTYPE1#CURRENT[1]"
+    int rule_name_idx = rule_name.substring(pos +1).toInt();
+    if ((rule_name_idx < 1) || (rule_name_idx > 6)) {  // Allow indexes 1 to 6
+      rule_name_idx = 1;
+    }
+    trigger.name_index = rule_name_idx;
+    rule_name = rule_name.substring(0, pos);           // "SUBTYPE1#CURRENT"
+  }
+  trigger.name = rule_name;
+  pos = rule_name.indexOf(F("#"));
+  if (pos <= 0) { pos = rule_name.length(); }
+  if ((1 == pos) && ('?' == rule_name[0])) {
+    trigger.root_bit = 0xFFFFFFFF;                     // Wildcard matches any key
+  } else {
+    trigger.root_bit = RulesKeyBit(rule_name.c_str(), pos);
+  }
 
-#ifdef DEBUG_RULES
-  AddLog(LOG_LEVEL_DEBUG, PSTR("RUL-RM1: Teleperiod %d, Expr %s, Name %s, Param %s"), Rules.teleperiod, rule_expr.c_str(), rule_name.c_str(), rule_param.c_str());
-#endif
+  // Parameters not starting with a variable are converted once
+  trigger.param = rule_param;
+  trigger.constant = !rule_param.startsWith(F("%"));
+  trigger.value = 0;
+  if ((trigger.compare != COMPARE_OPERATOR_NONE) && trigger.constant) {
+    char rule_svalue[80];
+    strlcpy(rule_svalue, rule_param.c_str(), sizeof(rule_svalue));
+    trigger.param = rule_svalue;
+    trigger.value = CharToFloat(rule_svalue);          // 0.1      - This saves 9k code over toFLoat()!
+  }
 
-  char rule_svalue[80] = { 0 };
-  float rule_value = 0;
-  if (compareOperator != COMPARE_OPERATOR_NONE) {
+  commands.trim();
+  String ucommand = commands;
+  ucommand.toUpperCase();
+//  if (!ucommand.startsWith("BACKLOG")) { commands = "backlog " + commands; }  // Always use Backlog to prevent power race exception
+  // Use Backlog with event to prevent rule event loop exception unless IF is used which uses an implicit backlog
+  if ((ucommand.indexOf(F("IF ")) == -1) &&
+      (ucommand.indexOf(F("EVENT ")) != -1) &&
+      (ucommand.indexOf(F("BACKLOG ")) == -1)) {
+    commands = String(F("backlog ")) + commands;
+  }
+  trigger.commands = commands;
+
+  // Locate variables used in commands so only those are replaced on execution
+  char stemp[14];
+  trigger.vars = 0;
+  trigger.mems = 0;
+  trigger.specials = 0;
+  if (ucommand.indexOf(F("%")) != -1) {
     for (uint32_t i = 0; i < MAX_RULE_VARS; i++) {
       snprintf_P(stemp, sizeof(stemp), PSTR("%%VAR%d%%"), i +1);
-      if (rule_param.startsWith(stemp)) {
-        rule_param = rules_vars[i];
-        break;
-      }
+      if (ucommand.indexOf(stemp) != -1) { bitSet(trigger.vars, i); }
     }
     for (uint32_t i = 0; i < MAX_RULE_MEMS; i++) {
       snprintf_P(stemp, sizeof(stemp), PSTR("%%MEM%d%%"), i +1);
-      if (rule_param.startsWith(stemp)) {
-        rule_param = SettingsText(SET_MEM1 + i);
-        break;
-      }
-    }
-    if (rule_param.startsWith(F("%TIME%"))) {
-      rule_param = String(MinutesPastMidnight());
-    }
-    if (rule_param.startsWith(F("%UPTIME%"))) {
-      rule_param = String(MinutesUptime());
-    }
-    if (rule_param.startsWith(F("%TIMESTAMP%"))) {
-      rule_param = GetDateAndTime(DT_LOCAL).c_str();
-    }
-#if defined(USE_TIMERS) && defined(USE_SUNRISE)
-    if (rule_param.startsWith(F("%SUNRISE%"))) {
-      rule_param = String(SunMinutes(0));
+      if (ucommand.indexOf(stemp) != -1) { bitSet(trigger.mems, i); }
     }
-    if (rule_param.startsWith(F("%SUNSET%"))) {
-      rule_param = String(SunMinutes(1));
-    }
-#endif  // USE_TIMERS and USE_SUNRISE
-// #ifdef USE_ZIGBEE
-//     if (rule_param.startsWith(F("%ZBDEVICE%"))) {
-//       snprintf_P(stemp, sizeof(stemp), PSTR("0x%04X"), Z_GetLastDevice());
-//       rule_param = String(stemp);
-//     }
-//     if (rule_param.startsWith(F("%ZBGROUP%"))) {
-//       rule_param = String(Z_GetLastGroup());
-//     }
-//     if (rule_param.startsWith(F("%ZBCLUSTER%"))) {
-//       rule_param = String(Z_GetLastCluster());
-//     }
-//     if (rule_param.startsWith(F("%ZBENDPOINT%"))) {
-//       rule_param = String(Z_GetLastEndpoint());
-//     }
-// #endif
-    rule_param.toUpperCase();
-    strlcpy(rule_svalue, rule_param.c_str(), sizeof(rule_svalue));
-
-    int temp_value = GetStateNumber(rule_svalue);
-    if (temp_value > -1) {
-      rule_value = temp_value;
-    } else {
-      rule_value = CharToFloat((char*)rule_svalue);    // 0.1      - This saves 9k code over toFLoat()!
+    for (uint32_t i = 0; i <= RULES_VAR_ZBENDPOINT; i++) {
+      if (ucommand.indexOf(GetTextIndexed(stemp, sizeof(stemp), i, kRulesSpecialVars)) != -1) { bitSet(trigger.specials, i); }
     }
   }
+}
 
-  // Step2: Search rule_name
-  int pos;
-  int rule_name_idx = 0;
-  if ((pos = rule_name.indexOf(F("["))) > 0) {         // "SUBTYPE1#CURRENT[1]"
-    rule_name_idx = rule_name.substring(pos +1).toInt();
-    if ((rule_name_idx < 1) || (rule_name_idx > 6)) {  // Allow indexes 1 to 6
-      rule_name_idx = 1;
+void RulesCompile(uint32_t rule_set)
+{
+  // Parse rule set into a table of triggers
+  // rules = "on INA219#Current>0.100 do Backlog Dimmer 10;Color 100000 endon on System#Boot do color 001000 endon"
+  delete[] Rules.compiled[rule_set];
+  Rules.compiled[rule_set] = nullptr;
+  Rules.compiled_count[rule_set] = 0;
+  bitSet(Rules.compiled_valid, rule_set);
+
+  String rules_saved = GetRule(rule_set);
+  uint32_t count = 0;
+  for (uint32_t pass = 0; pass < 2; pass++) {          // First pass counts triggers, second pass compiles them
+    if (pass) {
+      if (!count) { return; }
+      Rules.compiled[rule_set] = new RULE_TRIGGER[count];
+      if (!Rules.compiled[rule_set]) { return; }
+    }
+    String rules = rules_saved;
+    uint32_t index = 0;
+    int plen = 0;
+    int plen2 = 0;
+    while (index < 255) {
+      rules = rules.substring(plen);                   // Select relative to last rule
+      rules.trim();
+      if (!rules.length()) { break; }                  // No more rules
+
+      String rule = rules;
+      rule.toUpperCase();                              // "ON INA219#CURRENT>0.100 DO BACKLOG DIMMER 10;COLOR 100000 ENDON"
+      if (!rule.startsWith(F("ON "))) { break; }       // Bad syntax - Nothing to start on
+
+      int pevt = rule.indexOf(F(" DO "));
+      if (pevt == -1) { break; }                       // Bad syntax - Nothing to do
+
+      plen = rule.indexOf(F(" ENDON"));
+      plen2 = rule.indexOf(F(" BREAK"));
+      if ((plen == -1) && (plen2 == -1)) { break; }    // Bad syntax - No ENDON neither BREAK
+
+      if (plen == -1) { plen = 9999; }
+      if (plen2 == -1) { plen2 = 9999; }
+      plen = tmin(plen, plen2);
+
+      if (pass) {
+        RulesCompileTrigger(Rules.compiled[rule_set][index], rule.substring(3, pevt), rules.substring(pevt +4, plen), (plen == plen2));
+      }
+      index++;
+      plen += 6;
     }
-    rule_name = rule_name.substring(0, pos);           // "SUBTYPE1#CURRENT"
+    count = index;
   }
+  Rules.compiled_count[rule_set] = count;
+}
 
-  String buf = event;                                  // Copy the string into a new buffer that will be modified
+bool RulesRuleMatch(uint8_t rule_set, const struct RULE_TRIGGER &trigger, const JsonParserObject &root, uint32_t event_keys, bool stop_all_rules)
+{
+  // root = {"INA219":{"Voltage":4.494,"Current":0.020,"Power":0.089}}
+  // root = {"System":{"Boot":1}}
+  // trigger.name = "INA219#CURRENT"
 
-// Do not do below replace as it will replace escaped quote too.
-//  buf.replace("\\"," ");                               // "Disable" any escaped control character
+  bool match = false;
+  char stemp[10];
 
-//AddLog(LOG_LEVEL_DEBUG, PSTR("RUL-RM2: RulesRuleMatch |%s|"), buf.c_str());
+  // Step1: Check trigger applies to event
+  if (Rules.teleperiod != trigger.teleperiod) { return false; }  // Pre-amble in rule must match teleperiod event
+  if (!(event_keys & trigger.root_bit)) { return false; }          // First key not in event
 
-  JsonParser parser((char*)buf.c_str());
-  JsonParserObject obj = parser.getRootObject();
-  if (!obj) {
-//    AddLog(LOG_LEVEL_DEBUG, PSTR("RUL: Event too long (%d)"), event.length());
-    AddLog(LOG_LEVEL_DEBUG, PSTR("RUL: No valid JSON (%s)"), buf.c_str());
-    return false; // No valid JSON data
+  char rule_svalue[80] = { 0 };
+  float rule_value = trigger.value;
+  if (trigger.compare != COMPARE_OPERATOR_NONE) {
+    if (trigger.constant) {
+      strlcpy(rule_svalue, trigger.param.c_str(), sizeof(rule_svalue));
+      int temp_value = GetStateNumber(rule_svalue);    // StateText may have changed since compile
+      if (temp_value > -1) {
+        rule_value = temp_value;
+      }
+    } else {
+      String rule_param = trigger.param;
+      for (uint32_t i = 0; i < MAX_RULE_VARS; i++) {
+        snprintf_P(stemp, sizeof(stemp), PSTR("%%VAR%d%%"), i +1);
+        if (rule_param.startsWith(stemp)) {
+          rule_param = rules_vars[i];
+          break;
+        }
+      }
+      for (uint32_t i = 0; i < MAX_RULE_MEMS; i++) {
+        snprintf_P(stemp, sizeof(stemp), PSTR("%%MEM%d%%"), i +1);
+        if (rule_param.startsWith(stemp)) {
+          rule_param = SettingsText(SET_MEM1 + i);
+          break;
+        }
+      }
+      if (rule_param.startsWith(F("%TIME%"))) {
+        rule_param = String(MinutesPastMidnight());
+      }
+      if (rule_param.startsWith(F("%UPTIME%"))) {
+        rule_param = String(MinutesUptime());
+      }
+      if (rule_param.startsWith(F("%TIMESTAMP%"))) {
+        rule_param = GetDateAndTime(DT_LOCAL).c_str();
+      }
+#if defined(USE_TIMERS) && defined(USE_SUNRISE)
+      if (rule_param.startsWith(F("%SUNRISE%"))) {
+        rule_param = String(SunMinutes(0));
+      }
+      if (rule_param.startsWith(F("%SUNSET%"))) {
+        rule_param = String(SunMinutes(1));
+      }
+#endif  // USE_TIMERS and USE_SUNRISE
+      rule_param.toUpperCase();
+      strlcpy(rule_svalue, rule_param.c_str(), sizeof(rule_svalue));
+
+      int temp_value = GetStateNumber(rule_svalue);
+      if (temp_value > -1) {
+        rule_value = temp_value;
+      } else {
+        rule_value = CharToFloat((char*)rule_svalue);  // 0.1      - This saves 9k code over toFLoat()!
+      }
+    }
   }
-  String subtype;
+
+  // Step2: Search rule name
+  JsonParserObject obj = root;
+  const char* rule_name = trigger.name.c_str();
+  const char* pos;
   uint32_t i = 0;
-  while ((pos = rule_name.indexOf(F("#"))) > 0) {      // "SUBTYPE1#SUBTYPE2#CURRENT"
-    subtype = rule_name.substring(0, pos);
-    obj = obj[subtype.c_str()].getObject();
+  while (((pos = strchr(rule_name, '#')) != nullptr) && (pos > rule_name)) {  // "SUBTYPE1#SUBTYPE2#CURRENT"
+    char subtype[pos - rule_name +1];
+    strlcpy(subtype, rule_name, sizeof(subtype));
+    obj = obj[subtype].getObject();
     if (!obj) { return false; }                        // not found
 
-    rule_name = rule_name.substring(pos +1);
+    rule_name = pos +1;
     if (i++ > 10) { return false; }                    // Abandon possible loop
 
     yield();
   }
 
-  JsonParserToken val = obj[rule_name.c_str()];
+  JsonParserToken val = obj[rule_name];
   if (!val) { return false; }                          // last level not found
   const char* str_value;
-  if (rule_name_idx) {
+  if (trigger.name_index) {
     if (val.isArray()) {
-      str_value = (val.getArray())[rule_name_idx -1].getStr();
+      str_value = (val.getArray())[trigger.name_index -1].getStr();
     } else {
       str_value = val.getStr();
     }
@@ -549,9 +679,9 @@ bool RulesRuleMatch(uint8_t rule_set, String &event, String &rule, bool stop_all
   }
 
 #ifdef DEBUG_RULES
-  AddLog(LOG_LEVEL_DEBUG, PSTR("RUL-RM3: Name %s, Value |%s|, TrigCnt %d, TrigSt %d, Source %s, Json |%s|"),
-    rule_name.c_str(), rule_svalue, Rules.trigger_count[rule_set], bitRead(Rules.triggers[rule_set],
-    Rules.trigger_count[rule_set]), event.c_str(), (str_value[0] != '\0') ? str_value : "none");
+  AddLog(LOG_LEVEL_DEBUG, PSTR("RUL-RM3: Name %s, Value |%s|, TrigCnt %d, TrigSt %d, Json |%s|"),
+    rule_name, rule_svalue, Rules.trigger_count[rule_set], bitRead(Rules.triggers[rule_set],
+    Rules.trigger_count[rule_set]), (str_value[0] != '\0') ? str_value : "none");
 #endif
 
   Rules.event_value = str_value;                       // Prepare %value%
@@ -562,8 +692,7 @@ bool RulesRuleMatch(uint8_t rule_set, String &event, String &rule, bool stop_all
     value = CharToFloat((char*)str_value);
     int int_value = int(value);
     int int_rule_value = int(rule_value);
-    String str_str_value = String(str_value);
-    switch (compareOperator) {
+    switch (trigger.compare) {
       case COMPARE_OPERATOR_EXACT_DIVISION:
         match = (int_rule_value && (int_value % int_rule_value) == 0);
         break;
@@ -588,20 +717,23 @@ bool RulesRuleMatch(uint8_t rule_set, String &event, String &rule, bool stop_all
       case COMPARE_OPERATOR_SMALLER_EQUAL:
         match = (value <= rule_value);
         break;
-      case COMPARE_OPERATOR_STRING_ENDS_WITH:
-        match = str_str_value.endsWith(rule_svalue);
+      case COMPARE_OPERATOR_STRING_ENDS_WITH: {
+        size_t str_len = strlen(str_value);
+        size_t rule_len = strlen(rule_svalue);
+        match = (str_len >= rule_len) && !strcmp(str_value + str_len - rule_len, rule_svalue);
         break;
+      }
       case COMPARE_OPERATOR_STRING_STARTS_WITH:
-        match = str_str_value.startsWith(rule_svalue);
+        match = !strncmp(str_value, rule_svalue, strlen(rule_svalue));
         break;
       case COMPARE_OPERATOR_STRING_CONTAINS:
-        match = (str_str_value.indexOf(rule_svalue) >= 0);
+        match = (strstr(str_value, rule_svalue) != nullptr);
         break;
       case  COMPARE_OPERATOR_STRING_NOT_EQUAL:
         match = (0!=strcasecmp(str_value, rule_svalue));  // Compare strings - this also works for hexadecimals
         break;
       case  COMPARE_OPERATOR_STRING_NOT_CONTAINS:
-        match = (str_str_value.indexOf(rule_svalue) < 0);
+        match = (strstr(str_value, rule_svalue) == nullptr);
         break;
       default:
         match = true;
@@ -689,98 +821,74 @@ void RulesVarReplace(String &commands, const String &sfind, const String &replac
 
 /*******************************************************************************************/
 
-bool RuleSetProcess(uint8_t rule_set, String &event_saved)
+bool RuleSetProcess(uint8_t rule_set, const JsonParserObject &root, uint32_t event_keys)
 {
   bool serviced = false;
   char stemp[10];
 
   delay(0);                                               // Prohibit possible loop software watchdog
 
-//AddLog(LOG_LEVEL_DEBUG, PSTR("RUL-RP1: Event = %s, Rule = %s"), event_saved.c_str(), Settings->rules[rule_set]);
-
-  String rules = GetRule(rule_set);
+  if (!bitRead(Rules.compiled_valid, rule_set)) {
+    RulesCompile(rule_set);
+  }
+  // Commands may change rules but the compiled triggers are only replaced on the next event
+  const RULE_TRIGGER* triggers = Rules.compiled[rule_set];
+  uint32_t count = Rules.compiled_count[rule_set];
 
   Rules.trigger_count[rule_set] = 0;
-  int plen = 0;
-  int plen2 = 0;
   bool stop_all_rules = false;
-  while (true) {
-    rules = rules.substring(plen);                        // Select relative to last rule
-    rules.trim();
-    if (!rules.length()) { return serviced; }             // No more rules
-
-    String rule = rules;
-    rule.toUpperCase();                                   // "ON INA219#CURRENT>0.100 DO BACKLOG DIMMER 10;COLOR 100000 ENDON"
-    if (!rule.startsWith(F("ON "))) { return serviced; }     // Bad syntax - Nothing to start on
-
-    int pevt = rule.indexOf(F(" DO "));
-    if (pevt == -1) { return serviced; }                  // Bad syntax - Nothing to do
-    String event_trigger = rule.substring(3, pevt);       // "INA219#CURRENT>0.100"
-
-    plen = rule.indexOf(F(" ENDON"));
-    plen2 = rule.indexOf(F(" BREAK"));
-    if ((plen == -1) && (plen2 == -1)) { return serviced; } // Bad syntax - No ENDON neither BREAK
-
-    if (plen == -1) { plen = 9999; }
-    if (plen2 == -1) { plen2 = 9999; }
-    plen = tmin(plen, plen2);
-
-    String commands = rules.substring(pevt +4, plen);     // "Backlog Dimmer 10;Color 100000"
+  for (uint32_t index = 0; index < count; index++) {
+    const RULE_TRIGGER &trigger = triggers[index];
     Rules.event_value = "";
-    String event = event_saved;
 
-#ifdef DEBUG_RULES
-//    AddLog(LOG_LEVEL_DEBUG, PSTR("RUL-RP2: Event |%s|, Rule |%s|, Command(s) |%s|"), event.c_str(), event_trigger.c_str(), commands.c_str());
-#endif
-
-    if (RulesRuleMatch(rule_set, event, event_trigger, stop_all_rules)) {
+    if (RulesRuleMatch(rule_set, trigger, root, event_keys, stop_all_rules)) {
       if (Rules.no_execute) return true;
-      if (plen == plen2) { stop_all_rules = true; }       // If BREAK was used on a triggered rule, Stop execution of this rule set
-      commands.trim();
-      String ucommand = commands;
-      ucommand.toUpperCase();
-
-//      if (!ucommand.startsWith("BACKLOG")) { commands = "backlog " + commands; }  // Always use Backlog to prevent power race exception
-      // Use Backlog with event to prevent rule event loop exception unless IF is used which uses an implicit backlog
-      if ((ucommand.indexOf(F("IF ")) == -1) &&
-          (ucommand.indexOf(F("EVENT ")) != -1) &&
-          (ucommand.indexOf(F("BACKLOG ")) == -1)) {
-        commands = String(F("backlog ")) + commands;
-      }
+      if (trigger.stop) { stop_all_rules = true; }        // If BREAK was used on a triggered rule, Stop execution of this rule set
+      String commands = trigger.commands;                 // "Backlog Dimmer 10;Color 100000"
 
-      RulesVarReplace(commands, F("%VALUE%"), Rules.event_value);
+      if (bitRead(trigger.specials, RULES_VAR_VALUE)) { RulesVarReplace(commands, F("%VALUE%"), Rules.event_value); }
       for (uint32_t i = 0; i < MAX_RULE_VARS; i++) {
-        snprintf_P(stemp, sizeof(stemp), PSTR("%%VAR%d%%"), i +1);
-        RulesVarReplace(commands, stemp, rules_vars[i]);
+        if (bitRead(trigger.vars, i)) {
+          snprintf_P(stemp, sizeof(stemp), PSTR("%%VAR%d%%"), i +1);
+          RulesVarReplace(commands, stemp, rules_vars[i]);
+        }
       }
       for (uint32_t i = 0; i < MAX_RULE_MEMS; i++) {
-        snprintf_P(stemp, sizeof(stemp), PSTR("%%MEM%d%%"), i +1);
-        RulesVarReplace(commands, stemp, SettingsText(SET_MEM1 +i));
+        if (bitRead(trigger.mems, i)) {
+          snprintf_P(stemp, sizeof(stemp), PSTR("%%MEM%d%%"), i +1);
+          RulesVarReplace(commands, stemp, SettingsText(SET_MEM1 +i));
+        }
       }
-      RulesVarReplace(commands, F("%TIME%"), String(MinutesPastMidnight()));
-      RulesVarReplace(commands, F("%UTCTIME%"), String(UtcTime()));
-      RulesVarReplace(commands, F("%UPTIME%"), String(MinutesUptime()));
-      RulesVarReplace(commands, F("%TIMESTAMP%"), GetDateAndTime(DT_LOCAL));
-      RulesVarReplace(commands, F("%TOPIC%"), TasmotaGlobal.mqtt_topic);
-      snprintf_P(stemp, sizeof(stemp), PSTR("%06X"), ESP_getChipId());
-      RulesVarReplace(commands, F("%DEVICEID%"), stemp);
-      RulesVarReplace(commands, F("%MACADDR%"), NetworkUniqueId());
+      if (trigger.specials) {
+        if (bitRead(trigger.specials, RULES_VAR_TIME)) { RulesVarReplace(commands, F("%TIME%"), String(MinutesPastMidnight())); }
+        if (bitRead(trigger.specials, RULES_VAR_UTCTIME)) { RulesVarReplace(commands, F("%UTCTIME%"), String(UtcTime())); }
+        if (bitRead(trigger.specials, RULES_VAR_UPTIME)) { RulesVarReplace(commands, F("%UPTIME%"), String(MinutesUptime())); }
+        if (bitRead(trigger.specials, RULES_VAR_TIMESTAMP)) { RulesVarReplace(commands, F("%TIMESTAMP%"), GetDateAndTime(DT_LOCAL)); }
+        if (bitRead(trigger.specials, RULES_VAR_TOPIC)) { RulesVarReplace(commands, F("%TOPIC%"), TasmotaGlobal.mqtt_topic); }
+        if (bitRead(trigger.specials, RULES_VAR_DEVICEID)) {
+          snprintf_P(stemp, sizeof(stemp), PSTR("%06X"), ESP_getChipId());
+          RulesVarReplace(commands, F("%DEVICEID%"), stemp);
+        }
+        if (bitRead(trigger.specials, RULES_VAR_MACADDR)) { RulesVarReplace(commands, F("%MACADDR%"), NetworkUniqueId()); }
 #if defined(USE_TIMERS) && defined(USE_SUNRISE)
-      RulesVarReplace(commands, F("%SUNRISE%"), String(SunMinutes(0)));
-      RulesVarReplace(commands, F("%SUNSET%"), String(SunMinutes(1)));
+        if (bitRead(trigger.specials, RULES_VAR_SUNRISE)) { RulesVarReplace(commands, F("%SUNRISE%"), String(SunMinutes(0))); }
+        if (bitRead(trigger.specials, RULES_VAR_SUNSET)) { RulesVarReplace(commands, F("%SUNSET%"), String(SunMinutes(1))); }
 #endif  // USE_TIMERS and USE_SUNRISE
 #ifdef USE_ZIGBEE
-      snprintf_P(stemp, sizeof(stemp), PSTR("0x%04X"), Z_GetLastDevice());
-      RulesVarReplace(commands, F("%ZBDEVICE%"), String(stemp));
-      RulesVarReplace(commands, F("%ZBGROUP%"), String(Z_GetLastGroup()));
-      RulesVarReplace(commands, F("%ZBCLUSTER%"), String(Z_GetLastCluster()));
-      RulesVarReplace(commands, F("%ZBENDPOINT%"), String(Z_GetLastEndpoint()));
+        if (bitRead(trigger.specials, RULES_VAR_ZBDEVICE)) {
+          snprintf_P(stemp, sizeof(stemp), PSTR("0x%04X"), Z_GetLastDevice());
+          RulesVarReplace(commands, F("%ZBDEVICE%"), String(stemp));
+        }
+        if (bitRead(trigger.specials, RULES_VAR_ZBGROUP)) { RulesVarReplace(commands, F("%ZBGROUP%"), String(Z_GetLastGroup())); }
+        if (bitRead(trigger.specials, RULES_VAR_ZBCLUSTER)) { RulesVarReplace(commands, F("%ZBCLUSTER%"), String(Z_GetLastCluster())); }
+        if (bitRead(trigger.specials, RULES_VAR_ZBENDPOINT)) { RulesVarReplace(commands, F("%ZBENDPOINT%"), String(Z_GetLastEndpoint())); }
 #endif
+      }
 
       char command[commands.length() +1];
       strlcpy(command, commands.c_str(), sizeof(command));
 
-      AddLog(LOG_LEVEL_INFO, PSTR("RUL: %s performs \"%s\""), event_trigger.c_str(), command);
+      AddLog(LOG_LEVEL_INFO, PSTR("RUL: %s performs \"%s\""), trigger.trigger.c_str(), command);
 
 //      Response_P(S_JSON_COMMAND_SVALUE, D_CMND_RULE, D_JSON_INITIATED);
 //      MqttPublishPrefixTopic_P(RESULT_OR_STAT, PSTR(D_CMND_RULE));
@@ -791,7 +899,6 @@ bool RuleSetProcess(uint8_t rule_set, String &event_saved)
       ExecuteCommand(command, SRC_RULE);
       serviced = true;
     }
-    plen += 6;
     Rules.trigger_count[rule_set]++;
   }
   return serviced;
@@ -803,6 +910,12 @@ bool RulesProcessEvent(const char *json_event)
 {
   if (Rules.busy) { return false; }
 
+  uint32_t rule_sets = 0;
+  for (uint32_t i = 0; i < MAX_RULE_SETS; i++) {
+    if (GetRuleLen(i) && bitRead(Settings->rule_enabled, i)) { bitSet(rule_sets, i); }
+  }
+  if (!rule_sets) { return false; }                       // No enabled rule sets
+
   Rules.busy = true;
   bool serviced = false;
 
@@ -824,9 +937,22 @@ bool RulesProcessEvent(const char *json_event)
 
 //AddLog(LOG_LEVEL_DEBUG, PSTR("RUL: Event |%s|"), event_saved.c_str());
 
-  for (uint32_t i = 0; i < MAX_RULE_SETS; i++) {
-    if (GetRuleLen(i) && bitRead(Settings->rule_enabled, i)) {
-      if (RuleSetProcess(i, event_saved)) { serviced = true; }
+  // Parse event once for all triggers and collect its first level keys
+  JsonParser parser((char*)event_saved.c_str());
+  JsonParserObject root = parser.getRootObject();
+  if (!root) {
+    AddLog(LOG_LEVEL_DEBUG, PSTR("RUL: No valid JSON (%s)"), json_event);
+  } else {
+    uint32_t event_keys = 0;
+    for (auto key : root) {
+      const char* key_str = key.getStr();
+      event_keys |= RulesKeyBit(key_str, strlen(key_str));
+    }
+
+    for (uint32_t i = 0; i < MAX_RULE_SETS; i++) {
+      if (bitRead(rule_sets, i)) {
+        if (RuleSetProcess(i, root, event_keys)) { serviced = true; }
+      }
     }
   }
 
@@ -847,6 +973,7 @@ void RulesInit(void)
   bitWrite(Settings->rule_once, 6, 0);
 
   TasmotaGlobal.rules_flag.data = 0;
+  Rules.compiled_valid = 0;
   for (uint32_t i = 0; i < MAX_RULE_SETS; i++) {
     if (0 == GetRuleLen(i)) {
       bitWrite(Settings->rule_enabled, i, 0);
@@ -2356,6 +2483,7 @@ bool Xdrv10(uint8_t function)
       break;
 #endif  // SUPPORT_MQTT_EVENT
     case FUNC_PRE_INIT:
+      XdrvSubscribe(XDRV_10, XFUNC_TICK(FUNC_EVERY_50_MSECOND) | XFUNC_TICK(FUNC_EVERY_100_MSECOND) | XFUNC_TICK(FUNC_EVERY_SECOND));
       RulesInit();
       break;
   }
@@ -8273,6 +8273,11 @@ void lvgl_setup(void) {
 bool Xdrv10(uint8_t function)
 {
   bool result = false;
+
+  if (FUNC_PRE_INIT == function) {
+    XdrvSubscribe(XDRV_10, XFUNC_TICK(FUNC_LOOP) | XFUNC_TICK(FUNC_EVERY_100_MSECOND) | XFUNC_TICK(FUNC_EVERY_SECOND));
+  }
+
   glob_script_mem.event_handeled = false;
   char *sprt;
 
@@ -1300,6 +1300,11 @@ void CmndKnxCb(void)
 bool Xdrv11(uint8_t function)
 {
   bool result = false;
+
+  if (FUNC_PRE_INIT == function) {
+    XdrvSubscribe(XDRV_11, XFUNC_TICK(FUNC_LOOP) | XFUNC_TICK(FUNC_EVERY_50_MSECOND));
+  }
+
     switch (function) {
       case FUNC_LOOP:
         if (!TasmotaGlobal.global_state.network_down) { knx.loop(); }  // Process knx events
@@ -268,6 +268,9 @@ void CmndTasDiscover(void) {
 bool Xdrv12(uint8_t function) {
   bool result = false;
 
+  if (FUNC_PRE_INIT == function) {
+    XdrvSubscribe(XDRV_12, XFUNC_TICK(FUNC_EVERY_SECOND));
+  }
   if (Settings->flag.mqtt_enabled) {                            // SetOption3 - Enable MQTT
     switch (function) {
     case FUNC_EVERY_SECOND:
@@ -1178,6 +1178,10 @@ bool Xdrv12(uint8_t function)
 {
   bool result = false;
   bool hasslwt = HOME_ASSISTANT_LWT_SUBSCRIBE;
+  if (FUNC_PRE_INIT == function)
+  {
+    XdrvSubscribe(XDRV_12, XFUNC_TICK(FUNC_EVERY_SECOND));
+  }
   if (Settings->flag.mqtt_enabled)
   { // SetOption3 - Enable MQTT
     switch (function)
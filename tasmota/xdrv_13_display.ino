@@ -2695,6 +2695,10 @@ bool Xdrv13(uint8_t function)
 {
   bool result = false;
 
+  if (FUNC_PRE_INIT == function) {
+    XdrvSubscribe(XDRV_13, XFUNC_TICK(FUNC_EVERY_50_MSECOND) | XFUNC_TICK(FUNC_EVERY_SECOND));
+  }
+
   if (XdspPresent()) {
     switch (function) {
       case FUNC_PRE_INIT:
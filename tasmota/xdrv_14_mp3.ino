@@ -322,6 +322,10 @@ bool Xdrv14(uint8_t function)
 {
   bool result = false;
 
+  if (FUNC_PRE_INIT == function) {
+    XdrvSubscribe(XDRV_14, 0);              // No periodic functions
+  }
+
   if (PinUsed(GPIO_MP3_DFR562)) {
     switch (function) {
       case FUNC_PRE_INIT:
@@ -186,6 +186,10 @@ void PCA9685_OutputTelemetry(bool telemetry)
 
 bool Xdrv15(uint8_t function)
 {
+  if (FUNC_PRE_INIT == function) {
+    XdrvSubscribe(XDRV_15, XFUNC_TICK(FUNC_EVERY_SECOND));
+  }
+
   if (!I2cEnabled(XI2C_01)) { return false; }
 
   bool result = false;
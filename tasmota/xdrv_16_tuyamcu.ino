@@ -1462,6 +1462,10 @@ bool Xdrv16(uint8_t function)
 {
   bool result = false;
 
+  if (FUNC_PRE_INIT == function) {
+    XdrvSubscribe(XDRV_16, XFUNC_TICK(FUNC_LOOP) | XFUNC_TICK(FUNC_EVERY_SECOND));
+  }
+
   if (TUYA_DIMMER == TasmotaGlobal.module_type) {
     switch (function) {
       case FUNC_LOOP:
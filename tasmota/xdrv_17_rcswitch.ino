@@ -222,6 +222,10 @@ bool Xdrv17(uint8_t function)
 {
   bool result = false;
 
+  if (FUNC_PRE_INIT == function) {
+    XdrvSubscribe(XDRV_17, XFUNC_TICK(FUNC_EVERY_50_MSECOND));
+  }
+
   if (PinUsed(GPIO_RFSEND) || PinUsed(GPIO_RFRECV)) {
     switch (function) {
       case FUNC_EVERY_50_MSECOND:
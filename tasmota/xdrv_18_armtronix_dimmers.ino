@@ -168,6 +168,10 @@ bool Xdrv18(uint8_t function)
 {
   bool result = false;
 
+  if (FUNC_PRE_INIT == function) {
+    XdrvSubscribe(XDRV_18, XFUNC_TICK(FUNC_LOOP) | XFUNC_TICK(FUNC_EVERY_SECOND));
+  }
+
   if (ARMTRONIX_DIMMERS == TasmotaGlobal.module_type) {
     switch (function) {
       case FUNC_LOOP:
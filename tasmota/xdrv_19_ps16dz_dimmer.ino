@@ -210,6 +210,10 @@ bool Xdrv19(uint8_t function)
 {
   bool result = false;
 
+  if (FUNC_PRE_INIT == function) {
+    XdrvSubscribe(XDRV_19, XFUNC_TICK(FUNC_LOOP));
+  }
+
   if (PS_16_DZ == TasmotaGlobal.module_type) {
     switch (function) {
       case FUNC_LOOP:
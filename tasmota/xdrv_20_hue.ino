@@ -1084,6 +1084,10 @@ bool Xdrv20(uint8_t function)
 {
   bool result = false;
 
+  if (FUNC_PRE_INIT == function) {
+    XdrvSubscribe(XDRV_20, 0);                  // No periodic functions
+  }
+
 #if defined(USE_SCRIPT_HUE) || defined(USE_ZIGBEE)
   if ((EMUL_HUE == Settings->flag2.emulation)) {
 #else
@@ -346,6 +346,10 @@ bool Xdrv21(uint8_t function)
 {
   bool result = false;
 
+  if (FUNC_PRE_INIT == function) {
+    XdrvSubscribe(XDRV_21, 0);                  // No periodic functions
+  }
+
   if (TasmotaGlobal.devices_present && (EMUL_WEMO == Settings->flag2.emulation)) {
     switch (function) {
       case FUNC_WEB_ADD_HANDLER:
@@ -431,6 +431,10 @@ bool Xdrv21(uint8_t function)
 {
   bool result = false;
 
+  if (FUNC_PRE_INIT == function) {
+    XdrvSubscribe(XDRV_21, XFUNC_TICK(FUNC_LOOP));
+  }
+
   if (TasmotaGlobal.devices_present && (EMUL_WEMO == Settings->flag2.emulation)) {
     switch (function) {
       case FUNC_LOOP:
@@ -248,6 +248,10 @@ bool Xdrv22(uint8_t function)
 {
   bool result = false;
 
+  if (FUNC_PRE_INIT == function) {
+    XdrvSubscribe(XDRV_22, XFUNC_TICK(FUNC_EVERY_250_MSECOND));
+  }
+
   if (IsModuleIfan()) {
     switch (function) {
       case FUNC_EVERY_250_MSECOND:
@@ -715,6 +715,8 @@ public:
   // _defer_last_time : what was the last time an outgoing message is scheduled
   // this is designed for flow control and avoid messages to be lost or unanswered
   uint32_t              defer_last_message_sent;
+  // CRC32 of the device record last written to storage, used to journal only changed devices
+  uint32_t              journal_crc;
 
   uint8_t               endpoints[endpoints_max];   // static array to limit memory consumption, list of endpoints until 0x00 or end of array
   // Used for attribute reporting
@@ -749,6 +751,7 @@ public:
     modelId(nullptr),
     friendlyName(nullptr),
     defer_last_message_sent(0),
+    journal_crc(0),
     endpoints{ 0, 0, 0, 0, 0, 0, 0, 0 },
     attr_list(),
     shortaddr(_shortaddr),
@@ -876,12 +879,104 @@ typedef struct Z_Deferred {
   uint8_t               category;       // which category of deferred is it
   uint32_t              value;          // any raw value to use for the timer
   Z_DeviceTimer         func;           // function to call when timer occurs
+  uint32_t              seq;            // creation order, timers with the same deadline run in this order
+  uint16_t              slot;           // slot in the index of Z_Timers, Z_TIMER_NO_SLOT if not indexed
 } Z_Deferred;
 
+/*********************************************************************************************\
+ * Deferred timers
+ *
+ * Binary min-heap of Z_Deferred ordered by deadline, only the top is checked at each tick.
+ * Timers of a category that replaces previous ones are also indexed by (shortaddr, groupaddr,
+ * category) in an open addressing table of heap positions, so that they are removed without
+ * scanning the heap.
+\*********************************************************************************************/
+
+const uint16_t Z_TIMER_NO_SLOT = 0xFFFF;    // Z_Deferred not indexed
+const uint16_t Z_TIMER_EMPTY = 0xFFFF;      // free slot, end of chain
+const uint16_t Z_TIMER_DELETED = 0xFFFE;    // removed slot, the chain goes on
+
+class Z_Timers {
+public:
+  Z_Timers() {};
+  ~Z_Timers() { free(_heap); free(_slots); }
+
+  bool add(Z_Deferred defer);
+  // remove the timers matching, 0xFF and 0xFFFF are wildcards. Returns the number of timers removed
+  uint32_t remove(uint16_t shortaddr, uint16_t groupaddr, uint8_t category, uint16_t cluster, uint8_t endpoint);
+  // remove the first timer in `defer` if it is due and was created before `seq_end`
+  bool pop(Z_Deferred & defer, uint32_t seq_end);
+
+  inline uint32_t size(void) const { return _size; }
+  inline uint32_t nextDeadline(void) const { return _heap[0].timer; }   // only if size() > 0
+  inline uint32_t nextSeq(void) const { return _seq; }
+
+  static uint32_t hashKey(uint16_t shortaddr, uint16_t groupaddr, uint8_t category);
+
+protected:
+  void set(uint32_t i, const Z_Deferred & defer);
+  void place(uint32_t i, Z_Deferred defer);
+  void removeAt(uint32_t i);
+  uint16_t indexAdd(uint32_t pos);
+  bool reindex(uint32_t slots_size);
+
+  Z_Deferred *  _heap = nullptr;
+  uint16_t *    _slots = nullptr;   // heap position of indexed timers
+  uint16_t      _size = 0;
+  uint16_t      _capacity = 0;
+  uint16_t      _slots_size = 0;    // power of 2
+  uint16_t      _used = 0;          // slots not empty, including deleted ones
+  uint16_t      _count = 0;         // timers indexed
+  uint32_t      _seq = 0;
+};
+
 /*********************************************************************************************\
  * Singleton for device configuration
 \*********************************************************************************************/
 
+/*********************************************************************************************\
+ * Device index
+ *
+ * Open addressing hash table of device pointers, used to find devices by short address,
+ * long address or friendly name without scanning the whole device list.
+ * Each slot keeps the hash of the key, the key itself is checked against the device.
+\*********************************************************************************************/
+
+class Z_DeviceIndex {
+public:
+  Z_DeviceIndex() {};
+  ~Z_DeviceIndex() { free(_slots); }
+
+  void add(uint32_t hash, Z_Device * device);
+  bool remove(uint32_t hash, const Z_Device * device);    // returns true if device was indexed
+  // iterate over devices with the same hash, start with pos = -1, returns nullptr at the end
+  Z_Device * next(uint32_t hash, int32_t & pos) const;
+  // false if an allocation failed, the index is then incomplete and must not be used
+  inline bool valid(void) const { return !_failed; }
+
+  static uint32_t hashShortAddr(uint16_t shortaddr);
+  static uint32_t hashLongAddr(uint64_t longaddr);
+  static uint32_t hashName(const char * name);             // case insensitive, null is hashed as empty
+
+protected:
+  typedef struct Z_DeviceIndexSlot {
+    Z_Device *  device;       // nullptr if empty, Z_DeviceIndex::deleted() if removed
+    uint32_t    hash;
+  } Z_DeviceIndexSlot;
+
+  static inline Z_Device * deleted(void) { return (Z_Device*) &_slots_deleted; }
+  bool resize(uint32_t size);
+
+  Z_DeviceIndexSlot * _slots = nullptr;
+  uint16_t  _size = 0;        // number of slots, power of 2
+  uint16_t  _used = 0;        // slots not empty, including deleted ones
+  uint16_t  _count = 0;       // devices indexed
+  bool      _failed = false;
+  static uint8_t _slots_deleted;    // address used as tombstone marker
+};
+
+uint8_t Z_DeviceIndex::_slots_deleted = 0;
+
 // All devices are stored in a Vector
 // Invariants:
 // - shortaddr is unique if not null
@@ -889,7 +984,7 @@ typedef struct Z_Deferred {
 // - shortaddr and longaddr cannot be both null
 class Z_Devices {
 public:
-  Z_Devices() : _deferred() {};
+  Z_Devices() : _timers() {};
 
   // Probe the existence of device keys
   // Results:
@@ -910,6 +1005,8 @@ public:
   inline bool foundDevice(const Z_Device & device) const { return device.valid(); }
 
   int32_t findFriendlyName(const char * name) const;
+  // update the friendly name index after a device was renamed
+  void reindexFriendlyName(Z_Device * device, uint32_t old_hash);
   uint64_t getDeviceLongAddr(uint16_t shortaddr) const;
 
   uint8_t findFirstEndpoint(uint16_t shortaddr) const;
@@ -959,6 +1056,7 @@ public:
 
   // Iterator
   inline const LList<Z_Device> & getDevices(void) const { return _devices; }
+  inline LList<Z_Device> & getDevices(void) { return _devices; }
   size_t devicesSize(void) const {
     return _devices.length();
   }
@@ -970,6 +1068,7 @@ public:
 
   // Mark data as 'dirty' and requiring to save in Flash
   void dirty(void);
+  void dirtyAll(void);  // the change can't be journaled (ex: device removed), rewrite all devices
   void clean(void);   // avoid writing to flash the last changes
 
   // Find device by name, can be short_addr, long_addr, number_in_array or name
@@ -979,14 +1078,23 @@ public:
 
 private:
   LList<Z_Device>           _devices;     // list of devices
-  LList<Z_Deferred>         _deferred;    // list of deferred calls
+  Z_Timers                  _timers;      // deferred calls
+  Z_DeviceIndex             _short_index; // index of _devices by shortaddr
+  Z_DeviceIndex             _long_index;  // index of _devices by longaddr
+  Z_DeviceIndex             _name_index;  // index of _devices by friendlyName
   uint32_t                  _saveTimer = 0;
+  bool                      _saveAll = false;   // next save rewrites all devices instead of appending to the journal
   uint8_t                   _seqNumber = 0;     // global seqNumber if device is unknown
 
   //int32_t findShortAddrIdx(uint16_t shortaddr) const;
   // Create a new entry in the devices list - must be called if it is sure it does not already exist
   Z_Device & createDeviceEntry(uint16_t shortaddr, uint64_t longaddr = 0);
   void freeDeviceEntry(Z_Device *device);
+  // find a device by friendlyName, nullptr if not found
+  Z_Device * findFriendlyNameDevice(const char * name) const;
+  // add or remove a device from all indexes
+  void indexDevice(Z_Device * device);
+  void unindexDevice(Z_Device * device);
 };
 
 /*********************************************************************************************\
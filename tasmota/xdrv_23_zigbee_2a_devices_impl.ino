@@ -19,6 +19,271 @@
 
 #ifdef USE_ZIGBEE
 
+/*********************************************************************************************\
+ * Device index
+\*********************************************************************************************/
+
+uint32_t Z_DeviceIndex::hashShortAddr(uint16_t shortaddr) {
+  uint32_t hash = shortaddr * 2654435761UL;       // Knuth multiplicative hash, fold high bits in low bits
+  return hash ^ (hash >> 16);
+}
+
+uint32_t Z_DeviceIndex::hashLongAddr(uint64_t longaddr) {
+  return hashShortAddr((uint16_t)longaddr) ^ (((uint32_t)(longaddr >> 16)) * 2654435761UL);
+}
+
+uint32_t Z_DeviceIndex::hashName(const char * name) {
+  uint32_t hash = 2166136261UL;                   // FNV-1a
+  if (name) {
+    while (*name) {
+      hash = (hash ^ tolower((uint8_t)*name++)) * 16777619UL;
+    }
+  }
+  return hash;
+}
+
+bool Z_DeviceIndex::resize(uint32_t size) {
+  Z_DeviceIndexSlot * slots = (Z_DeviceIndexSlot*) calloc(size, sizeof(Z_DeviceIndexSlot));
+  if (!slots) { return false; }
+  Z_DeviceIndexSlot * old_slots = _slots;
+  uint32_t old_size = _size;
+  _slots = slots;
+  _size = size;
+  _used = 0;
+  _count = 0;
+  for (uint32_t i = 0; i < old_size; i++) {
+    if (old_slots[i].device && (deleted() != old_slots[i].device)) {
+      add(old_slots[i].hash, old_slots[i].device);
+    }
+  }
+  free(old_slots);
+  return true;
+}
+
+void Z_DeviceIndex::add(uint32_t hash, Z_Device * device) {
+  if (_failed) { return; }
+  if ((_used + 1) * 4 > _size * 3) {              // keep load factor below 75%, deleted slots included
+    uint32_t size = 16;
+    while (size < (uint32_t)(_count + 1) * 2) { size <<= 1; }
+    if (!resize(size) && (_used + 1 >= _size)) {
+      _failed = true;                             // no room left, the index is now unusable
+      return;
+    }
+  }
+  uint32_t mask = _size - 1;
+  for (uint32_t probe = 0; probe < _size; probe++) {
+    Z_DeviceIndexSlot & slot = _slots[(hash + probe) & mask];
+    if ((nullptr == slot.device) || (deleted() == slot.device)) {
+      if (nullptr == slot.device) { _used++; }
+      slot.device = device;
+      slot.hash = hash;
+      _count++;
+      return;
+    }
+  }
+}
+
+bool Z_DeviceIndex::remove(uint32_t hash, const Z_Device * device) {
+  if (!_size) { return false; }
+  uint32_t mask = _size - 1;
+  for (uint32_t probe = 0; probe < _size; probe++) {
+    Z_DeviceIndexSlot & slot = _slots[(hash + probe) & mask];
+    if (nullptr == slot.device) { break; }        // end of chain
+    if (device == slot.device) {
+      slot.device = deleted();
+      _count--;
+      return true;
+    }
+  }
+  return false;
+}
+
+Z_Device * Z_DeviceIndex::next(uint32_t hash, int32_t & pos) const {
+  uint32_t mask = _size - 1;
+  for (uint32_t probe = pos + 1; probe < _size; probe++) {
+    const Z_DeviceIndexSlot & slot = _slots[(hash + probe) & mask];
+    if (nullptr == slot.device) { break; }        // end of chain
+    if ((hash == slot.hash) && (deleted() != slot.device)) {
+      pos = probe;
+      return slot.device;
+    }
+  }
+  pos = _size;
+  return nullptr;
+}
+
+/*********************************************************************************************\
+ * Deferred timers
+\*********************************************************************************************/
+
+// a timer is before another if its deadline is earlier, or equal and created first
+inline bool Z_TimerBefore(const Z_Deferred & a, const Z_Deferred & b) {
+  int32_t diff = TimeDifference(b.timer, a.timer);
+  return (diff < 0) || ((0 == diff) && ((int32_t)(a.seq - b.seq) < 0));
+}
+
+// timers replaced by a new one of the same category, see Z_Devices::setTimer()
+inline bool Z_TimerIndexed(const Z_Deferred & defer) {
+  return (defer.category >= Z_CLEAR_DEVICE);
+}
+
+uint32_t Z_Timers::hashKey(uint16_t shortaddr, uint16_t groupaddr, uint8_t category) {
+  uint32_t hash = (((uint32_t)shortaddr << 16) | groupaddr) * 2654435761UL;
+  hash = (hash ^ (hash >> 16)) + category * 2654435761UL;
+  return hash ^ (hash >> 16);
+}
+
+// Store `defer` at heap position `i` and update its slot
+void Z_Timers::set(uint32_t i, const Z_Deferred & defer) {
+  _heap[i] = defer;
+  if (Z_TIMER_NO_SLOT != defer.slot) { _slots[defer.slot] = i; }
+}
+
+// Put `defer` at the free position `i`, moving it up or down to keep the heap ordered
+void Z_Timers::place(uint32_t i, Z_Deferred defer) {
+  while (i > 0) {                           // sift up
+    uint32_t parent = (i - 1) / 2;
+    if (!Z_TimerBefore(defer, _heap[parent])) { break; }
+    set(i, _heap[parent]);
+    i = parent;
+  }
+  while (true) {                            // sift down
+    uint32_t child = 2 * i + 1;
+    if (child >= _size) { break; }
+    if ((child + 1 < _size) && Z_TimerBefore(_heap[child + 1], _heap[child])) { child++; }
+    if (!Z_TimerBefore(_heap[child], defer)) { break; }
+    set(i, _heap[child]);
+    i = child;
+  }
+  set(i, defer);
+}
+
+// Index the timer at heap position `pos`, returns its slot. There must be a free slot
+uint16_t Z_Timers::indexAdd(uint32_t pos) {
+  const Z_Deferred & defer = _heap[pos];
+  uint32_t hash = hashKey(defer.shortaddr, defer.groupaddr, defer.category);
+  uint32_t mask = _slots_size - 1;
+  for (uint32_t probe = 0; probe < _slots_size; probe++) {
+    uint32_t slot = (hash + probe) & mask;
+    if ((Z_TIMER_EMPTY == _slots[slot]) || (Z_TIMER_DELETED == _slots[slot])) {
+      if (Z_TIMER_EMPTY == _slots[slot]) { _used++; }
+      _slots[slot] = pos;
+      _count++;
+      return slot;
+    }
+  }
+  return Z_TIMER_NO_SLOT;
+}
+
+// Index again all the timers of the heap in `slots_size` slots, which also clears the deleted slots
+bool Z_Timers::reindex(uint32_t slots_size) {
+  if (slots_size != _slots_size) {
+    uint16_t * slots = (uint16_t*) malloc(slots_size * sizeof(uint16_t));
+    if (!slots) { return false; }
+    free(_slots);
+    _slots = slots;
+    _slots_size = slots_size;
+  }
+  memset(_slots, 0xFF, _slots_size * sizeof(uint16_t));   // Z_TIMER_EMPTY
+  _used = 0;
+  _count = 0;
+  for (uint32_t i = 0; i < _size; i++) {
+    if (Z_TimerIndexed(_heap[i])) {
+      _heap[i].slot = indexAdd(i);
+    }
+  }
+  return true;
+}
+
+bool Z_Timers::add(Z_Deferred defer) {
+  if (_size >= _capacity) {
+    uint32_t capacity = _capacity ? _capacity * 2 : 8;
+    if (capacity > Z_TIMER_DELETED) { return false; }   // positions must not collide with slot markers
+    Z_Deferred * heap = (Z_Deferred*) realloc(_heap, capacity * sizeof(Z_Deferred));
+    if (nullptr == heap) { return false; }
+    _heap = heap;
+    _capacity = capacity;
+  }
+  defer.seq = _seq++;
+  defer.slot = Z_TIMER_NO_SLOT;
+  _heap[_size] = defer;
+  if (Z_TimerIndexed(defer)) {
+    if ((_used + 1) * 4 > _slots_size * 3) {    // keep load factor below 75%, deleted slots included
+      uint32_t slots_size = 16;
+      while (slots_size < (uint32_t)(_count + 1) * 2) { slots_size <<= 1; }
+      if (!reindex(slots_size) && (_used + 1 >= _slots_size)) { return false; }
+    }
+    _heap[_size].slot = indexAdd(_size);
+  }
+  _size++;
+  place(_size - 1, _heap[_size - 1]);
+  return true;
+}
+
+// Remove the timer at heap position `i`, the last timer takes its place
+void Z_Timers::removeAt(uint32_t i) {
+  if (Z_TIMER_NO_SLOT != _heap[i].slot) {
+    _slots[_heap[i].slot] = Z_TIMER_DELETED;
+    _count--;
+  }
+  _size--;
+  if (i < _size) { place(i, _heap[_size]); }
+}
+
+uint32_t Z_Timers::remove(uint16_t shortaddr, uint16_t groupaddr, uint8_t category, uint16_t cluster, uint8_t endpoint) {
+  uint32_t removed = 0;
+  if ((category >= Z_CLEAR_DEVICE) && (0xFF != category)) {
+    if (0 == _count) { return 0; }
+    // all the timers of the category for this address are in the same chain
+    uint32_t hash = hashKey(shortaddr, groupaddr, category);
+    uint32_t mask = _slots_size - 1;
+    for (uint32_t probe = 0; probe < _slots_size; probe++) {
+      uint16_t pos = _slots[(hash + probe) & mask];
+      if (Z_TIMER_EMPTY == pos) { break; }      // end of chain
+      if (Z_TIMER_DELETED == pos) { continue; }
+      const Z_Deferred & defer = _heap[pos];
+      if ((defer.shortaddr == shortaddr) && (defer.groupaddr == groupaddr) && (defer.category == category) &&
+          ((0xFFFF == cluster) || (defer.cluster == cluster)) &&
+          ((0xFF == endpoint) || (defer.endpoint == endpoint))) {
+        removeAt(pos);
+        removed++;
+      }
+    }
+  } else {
+    // any category or timers not indexed, keep the timers not matching and order the heap again
+    uint32_t size = _size;
+    uint32_t kept = 0;
+    for (uint32_t i = 0; i < size; i++) {
+      const Z_Deferred & defer = _heap[i];
+      if ((defer.shortaddr == shortaddr) && (defer.groupaddr == groupaddr) &&
+          ((0xFF == category) || (defer.category == category)) &&
+          ((0xFFFF == cluster) || (defer.cluster == cluster)) &&
+          ((0xFF == endpoint) || (defer.endpoint == endpoint))) {
+        continue;
+      }
+      _heap[kept++] = defer;
+    }
+    removed = size - kept;
+    if (removed) {
+      for (_size = 0; _size < kept; _size++) {
+        _heap[_size].slot = Z_TIMER_NO_SLOT;
+        place(_size, _heap[_size]);
+      }
+      reindex(_slots_size);
+    }
+  }
+  return removed;
+}
+
+bool Z_Timers::pop(Z_Deferred & defer, uint32_t seq_end) {
+  if ((0 == _size) || !TimeReached(_heap[0].timer) || ((int32_t)(_heap[0].seq - seq_end) >= 0)) {
+    return false;
+  }
+  defer = _heap[0];
+  removeAt(0);
+  return true;
+}
+
 /*********************************************************************************************\
  * Implementation
 \*********************************************************************************************/
@@ -41,6 +306,7 @@ Z_Device & Z_Devices::createDeviceEntry(uint16_t shortaddr, uint64_t longaddr) {
   Z_Device & device = _devices.addToLast();
   device.shortaddr = shortaddr;
   device.longaddr = longaddr;
+  indexDevice(&device);
 
   dirty();
   return device;
@@ -54,64 +320,120 @@ void Z_Devices::freeDeviceEntry(Z_Device *device) {
 }
 
 //
-// Scan all devices to find a corresponding shortaddr
+// Keep the shortaddr, longaddr and friendlyName indexes in sync with _devices
+// Every device is indexed, including null longaddr or friendlyName
+//
+void Z_Devices::indexDevice(Z_Device * device) {
+  _short_index.add(Z_DeviceIndex::hashShortAddr(device->shortaddr), device);
+  _long_index.add(Z_DeviceIndex::hashLongAddr(device->longaddr), device);
+  _name_index.add(Z_DeviceIndex::hashName(device->friendlyName), device);
+}
+
+void Z_Devices::unindexDevice(Z_Device * device) {
+  _short_index.remove(Z_DeviceIndex::hashShortAddr(device->shortaddr), device);
+  _long_index.remove(Z_DeviceIndex::hashLongAddr(device->longaddr), device);
+  _name_index.remove(Z_DeviceIndex::hashName(device->friendlyName), device);
+}
+
+void Z_Devices::reindexFriendlyName(Z_Device * device, uint32_t old_hash) {
+  if (_name_index.remove(old_hash, device)) {
+    _name_index.add(Z_DeviceIndex::hashName(device->friendlyName), device);
+  }
+}
+
+//
+// Find the device with a corresponding shortaddr
 // Looks info device.shortaddr entry
+// Uses the index, and falls back to a scan of all devices if more than one
+// device share the same shortaddr, so that the first one in the list is returned
 // In:
 //    shortaddr (not BAD_SHORTADDR)
 // Out:
 //    reference to device, or to device_unk if not found
 //    (use foundDevice() to check if found)
 Z_Device & Z_Devices::findShortAddr(uint16_t shortaddr) {
-  for (auto & elem : _devices) {
-    if (elem.shortaddr == shortaddr) { return elem; }
-  }
-  return device_unk;
+  return (Z_Device &) ((const Z_Devices*)this)->findShortAddr(shortaddr);
 }
 const Z_Device & Z_Devices::findShortAddr(uint16_t shortaddr) const {
+  if (_short_index.valid()) {
+    uint32_t hash = Z_DeviceIndex::hashShortAddr(shortaddr);
+    const Z_Device * found = nullptr;
+    uint32_t matches = 0;
+    int32_t pos = -1;
+    while (const Z_Device * device = _short_index.next(hash, pos)) {
+      if (device->shortaddr == shortaddr) { found = device; matches++; }
+    }
+    if (matches <= 1) { return found ? *found : device_unk; }
+  }
   for (const auto & elem : _devices) {
     if (elem.shortaddr == shortaddr) { return elem; }
   }
   return device_unk;
 }
 //
-// Scan all devices to find a corresponding longaddr
+// Find the device with a corresponding longaddr
 // Looks info device.longaddr entry
+// Uses the index, and falls back to a scan of all devices on duplicates
 // In:
 //    longaddr (non null)
 // Out:
-//    index in _devices of entry, -1 if not found
+//    reference to device, or to device_unk if not found
 //
 Z_Device & Z_Devices::findLongAddr(uint64_t longaddr) {
-  if (!longaddr) { return device_unk; }
-  for (auto &elem : _devices) {
-    if (elem.longaddr == longaddr) { return elem; }
-  }
-  return device_unk;
+  return (Z_Device &) ((const Z_Devices*)this)->findLongAddr(longaddr);
 }
 const Z_Device & Z_Devices::findLongAddr(uint64_t longaddr) const {
   if (!longaddr) { return device_unk; }
+  if (_long_index.valid()) {
+    uint32_t hash = Z_DeviceIndex::hashLongAddr(longaddr);
+    const Z_Device * found = nullptr;
+    uint32_t matches = 0;
+    int32_t pos = -1;
+    while (const Z_Device * device = _long_index.next(hash, pos)) {
+      if (device->longaddr == longaddr) { found = device; matches++; }
+    }
+    if (matches <= 1) { return found ? *found : device_unk; }
+  }
   for (const auto &elem : _devices) {
     if (elem.longaddr == longaddr) { return elem; }
   }
   return device_unk;
 }
 //
-// Scan all devices to find a corresponding friendlyNme
+// Find the device with a corresponding friendlyName (case insensitive)
 // Looks info device.friendlyName entry
+// Uses the index, and falls back to a scan of all devices on duplicates
 // In:
 //    friendlyName (null terminated, should not be empty)
 // Out:
-//    index in _devices of entry, -1 if not found
+//    pointer to device, nullptr if not found
+//
+Z_Device * Z_Devices::findFriendlyNameDevice(const char * name) const {
+  if ((!name) || (0 == name[0])) { return nullptr; }
+  if (_name_index.valid()) {
+    uint32_t hash = Z_DeviceIndex::hashName(name);
+    Z_Device * found = nullptr;
+    uint32_t matches = 0;
+    int32_t pos = -1;
+    while (Z_Device * device = _name_index.next(hash, pos)) {
+      if ((device->friendlyName) && (strcasecmp(device->friendlyName, name) == 0)) { found = device; matches++; }
+    }
+    if (matches <= 1) { return found; }
+  }
+  for (auto &elem : _devices) {
+    if ((elem.friendlyName) && (strcasecmp(elem.friendlyName, name) == 0)) { return &elem; }
+  }
+  return nullptr;
+}
+//
+// Same as above but returns the index in _devices of entry, -1 if not found
 //
 int32_t Z_Devices::findFriendlyName(const char * name) const {
-  if (!name) { return -1; }              // if pointer is null
-  size_t name_len = strlen(name);
-  int32_t found = 0;
-  if (name_len) {
-    for (auto &elem : _devices) {
-      if (elem.friendlyName) {
-        if (strcasecmp(elem.friendlyName, name) == 0) { return found; }
-      }
+  const Z_Device * device = findFriendlyNameDevice(name);
+  if (device) {
+    int32_t found = 0;
+    for (const auto &elem : _devices) {
+      if (&elem == device) { return found; }
       found++;
     }
   }
@@ -132,9 +454,9 @@ Z_Device & Z_Devices::isKnownIndexDevice(uint32_t index) const {
 
 Z_Device & Z_Devices::isKnownFriendlyNameDevice(const char * name) const {
   if ((!name) || (0 == strlen(name))) { return device_unk; }         // Error
-  int32_t found = findFriendlyName(name);
-  if (found >= 0) {
-    return devicesAt(found);
+  Z_Device * device = findFriendlyNameDevice(name);
+  if (device) {
+    return *device;
   } else {
     return device_unk;
   }
@@ -170,8 +492,9 @@ Z_Device & Z_Devices::getLongAddr(uint64_t longaddr) {
 bool Z_Devices::removeDevice(uint16_t shortaddr) {
   Z_Device & device = findShortAddr(shortaddr);
   if (foundDevice(device)) {
+    unindexDevice(&device);
     _devices.remove(&device);
-    dirty();
+    dirtyAll();
     return true;
   }
   return false;
@@ -190,7 +513,10 @@ Z_Device & Z_Devices::updateDevice(uint16_t shortaddr, uint64_t longaddr) {
     if (s_found == l_found) {
     } else {                                        // they don't match
       // the device with longaddr got a new shortaddr
+      unindexDevice(s_found);
+      _short_index.remove(Z_DeviceIndex::hashShortAddr(l_found->shortaddr), l_found);
       l_found->shortaddr = shortaddr;      // update the shortaddr corresponding to the longaddr
+      _short_index.add(Z_DeviceIndex::hashShortAddr(shortaddr), l_found);
       // erase the previous shortaddr
       freeDeviceEntry(s_found);
       _devices.remove(s_found);
@@ -200,12 +526,16 @@ Z_Device & Z_Devices::updateDevice(uint16_t shortaddr, uint64_t longaddr) {
   } else if (foundDevice(*s_found)) {
     // shortaddr already exists but longaddr not
     // add the longaddr to the entry
+    _long_index.remove(Z_DeviceIndex::hashLongAddr(s_found->longaddr), s_found);
     s_found->longaddr = longaddr;
+    _long_index.add(Z_DeviceIndex::hashLongAddr(longaddr), s_found);
     dirty();
     return *s_found;
   } else if (foundDevice(*l_found)) {
     // longaddr entry exists, update shortaddr
+    _short_index.remove(Z_DeviceIndex::hashShortAddr(l_found->shortaddr), l_found);
     l_found->shortaddr = shortaddr;
+    _short_index.add(Z_DeviceIndex::hashShortAddr(shortaddr), l_found);
     dirty();
     return *l_found;
   } else {
@@ -317,7 +647,9 @@ void Z_Device::setModelId(const char * str) {
 }
 
 void Z_Device::setFriendlyName(const char * str) {
+  uint32_t old_hash = Z_DeviceIndex::hashName(friendlyName);
   setStringAttribute(friendlyName, str);
+  zigbee_devices.reindexFriendlyName(this, old_hash);
 }
 
 void Z_Device::setLastSeenNow(void) {
@@ -405,18 +737,7 @@ bool Z_Devices::isHueBulbHidden(uint16_t shortaddr) const {
 // Parse for a specific category, of all deferred for a device if category == 0xFF
 // Only with specific cluster number or for all clusters if cluster == 0xFFFF
 void Z_Devices::resetTimersForDevice(uint16_t shortaddr, uint16_t groupaddr, uint8_t category, uint16_t cluster, uint8_t endpoint) {
-  // iterate the list of deferred, and remove any linked to the shortaddr
-  for (auto & defer : _deferred) {
-    if ((defer.shortaddr == shortaddr) && (defer.groupaddr == groupaddr)) {
-      if ((0xFF == category) || (defer.category == category)) {
-        if ((0xFFFF == cluster) || (defer.cluster == cluster)) {
-          if ((0xFF == endpoint) || (defer.endpoint == endpoint)) {
-            _deferred.remove(&defer);
-          }
-        }
-      }
-    }
-  }
+  _timers.remove(shortaddr, groupaddr, category, cluster, endpoint);
 }
 
 // Set timer for a specific device
@@ -427,8 +748,7 @@ void Z_Devices::setTimer(uint16_t shortaddr, uint16_t groupaddr, uint32_t wait_m
   }
 
   // Now create the new timer
-  Z_Deferred & deferred = _deferred.addHead();
-  deferred = { wait_ms + millis(),   // timer
+  Z_Deferred deferred = { wait_ms + millis(),   // timer
                           shortaddr,
                           groupaddr,
                           cluster,
@@ -436,6 +756,9 @@ void Z_Devices::setTimer(uint16_t shortaddr, uint16_t groupaddr, uint32_t wait_m
                           category,
                           value,
                           func };
+  if (!_timers.add(deferred)) {
+    AddLog(LOG_LEVEL_ERROR, PSTR(D_LOG_ZIGBEE "Cannot allocate timer"));
+  }
 }
 
 // Set timer after the already queued events
@@ -453,22 +776,25 @@ void Z_Devices::queueTimer(uint16_t shortaddr, uint16_t groupaddr, uint32_t wait
   setTimer(shortaddr, groupaddr, (device.defer_last_message_sent - now_millis), cluster, endpoint, Z_CAT_ALWAYS, value, func);
 }
 
-// Run timer at each tick
-// WARNING: don't set a new timer within a running timer, this causes memory corruption
+// Run the timers due, called at each loop
+// Timers can be set or reset within a running timer, new timers wait for the next run
 void Z_Devices::runTimer(void) {
-  // visit all timers
-  for (auto & defer : _deferred) {
-    uint32_t timer = defer.timer;
-    if (TimeReached(timer)) {
-      (*defer.func)(defer.shortaddr, defer.groupaddr, defer.cluster, defer.endpoint, defer.value);
-      _deferred.remove(&defer);
-    }
+  Z_Deferred defer;
+  uint32_t seq_end = _timers.nextSeq();
+  while (_timers.pop(defer, seq_end)) {
+    (*defer.func)(defer.shortaddr, defer.groupaddr, defer.cluster, defer.endpoint, defer.value);
+  }
+  if (_timers.size()) {
+    SetWakeupDeadline(_timers.nextDeadline());    // wake up the main loop for the next timer
   }
 
   // check if we need to save to Flash
   if ((_saveTimer) && TimeReached(_saveTimer)) {
-    saveZigbeeDevices();
+    if (_saveAll || !journalZigbeeDevices()) {
+      saveZigbeeDevices();      // full rewrite, also starts a new journal
+    }
     _saveTimer = 0;
+    _saveAll = false;
   }
 }
 
@@ -611,8 +937,13 @@ void Z_Devices::jsonPublishNow(uint16_t shortaddr, Z_attribute_list &attr_list)
 void Z_Devices::dirty(void) {
   _saveTimer = kZigbeeSaveDelaySeconds * 1000 + millis();
 }
+void Z_Devices::dirtyAll(void) {
+  _saveAll = true;
+  dirty();
+}
 void Z_Devices::clean(void) {
   _saveTimer = 0;
+  _saveAll = false;
 }
 
 // Parse the command parameters for either:
@@ -25,6 +25,7 @@
 const static uint32_t ZIGB_NAME1 = 0x3167697A; // 'zig1' little endian
 const static uint32_t ZIGB_NAME2 = 0x3267697A; // 'zig2' little endian, v2
 const static uint32_t ZIGB_DATA2 = 0x32746164; // 'dat2' little endian, v2
+const static uint32_t ZIGB_JOURNAL2 = 0x326E726A; // 'jrn2' little endian, v2
 extern FS *dfsp;
 extern "C" uint32_t _FS_end;
 // Is it ok to write to bank 0x402FF000
@@ -97,10 +98,11 @@ void hydrateSingleDevice(const SBuffer & buf_d);
 // Version 0:
 // Many features are not yet implemented.
 // We start with hardcoded values:
-//  - the two entries for files 'zig2' and 'dat2' are predefined
+//  - the three entries for files 'zig2', 'dat2' and 'jrn2' are predefined
 //  - the starting block for each file is fixed.
-//    'Zig2' uses 32 blocks (8kb max) - starting at block 32
-//    'Dat2' uses 32 blocks (8kb max) - starting at block 64
+//    'Zig2' uses 31 blocks (8kb max) - starting at block 2
+//    'Dat2' uses 31 blocks (8kb max) - starting at block 33
+//    'Jrn2' uses 31 blocks (8kb max) - starting at block 64, added to EEPROMs formatted without it
 //  - the bitmap marks those blocks as used
 //  - version number only uses first entry that doesn't get re-written
 //  - only file size actually changes
@@ -217,6 +219,10 @@ void ZFS_Dir_Block::format(void) {
   e[1].name = ZIGB_DATA2;
   e[1].length = 0;
   e[1].blk_start = 2 + 31;        // start at block 33 to 63
+  // entry 2 - 'jrn2'
+  e[2].name = ZIGB_JOURNAL2;
+  e[2].length = 0;
+  e[2].blk_start = 2 + 31 + 31;   // start at block 64 to 94
 }
 
 void ZFS_Bitmap::format(void) {
@@ -228,8 +234,8 @@ void ZFS_Bitmap::format(void) {
   // block[0x00] = val_used;    // already in loop
   // block[0x01] = val_used;
   block[0xFF] = val_used;
-  // reserve block 32->63 for file 0 and 64->95 for file 1
-  for (uint32_t i = 0; i < 64; i++) {
+  // reserve block 2->32 for file 0, 33->63 for file 1 and 64->94 for file 2
+  for (uint32_t i = 0; i < 2 + 31 * 3; i++) {
     block[i] = val_used;
   }
 }
@@ -257,9 +263,10 @@ public:
   uint8_t   entry_idx;      // entry number in the directory
 
   ZFS_Write_File(void) : name(0), cursor(0), length(0), blk_start(0) {}
-  void init(uint32_t _name) {
+  void init(uint32_t _name, bool append = false) {
     name = _name;
     findOrCreate();
+    if (!append) { length = 0; }
   }
 
   inline bool valid(void) const { return blk_start != 0; }       // does the file exist?
@@ -398,6 +405,21 @@ void ZFS::initOrFormat(void) {
   if (dir->b0.signature == ZFS_SIGNATURE) {
     // Good
     AddLog(LOG_LEVEL_DEBUG, PSTR(D_LOG_ZIGBEE "EEPROM signature 0x%08X is correct"), dir->b0.signature);
+    if (dir->e[2].name == 0) {
+      // formatted before the journal existed, reserve its blocks 64 to 94 in the bitmap then add its entry
+      ZFS_Dir_Block * dir_default = new ZFS_Dir_Block();
+      dir_default->format();
+      uint8_t blk_start = dir_default->e[2].blk_start;
+      ZFS_Bitmap_Entry blocks[ZFS_FILE_BLOCKS];
+      zigbee.eeprom.readBytes(0xFF00 + blk_start, sizeof(blocks), (byte*) blocks);
+      for (uint32_t i = 0; i < ZFS_FILE_BLOCKS; i++) {
+        blocks[i].used = true;
+      }
+      zigbee.eeprom.writeBytes(0xFF00 + blk_start, sizeof(blocks), (byte*) blocks);
+      dir_default->e[2].write(2);
+      delete dir_default;
+      AddLog(LOG_LEVEL_DEBUG, PSTR(D_LOG_ZIGBEE "EEPROM journal file added"));
+    }
   } else {
     AddLog(LOG_LEVEL_DEBUG, PSTR(D_LOG_ZIGBEE "EEPROM signature 0x%08X is incorrect, formatting"), dir->b0.signature);
     format();
@@ -441,11 +463,17 @@ void ZFS_File_Entry::read(uint8_t entry_idx) {
   zigbee.eeprom.readBytes(getAddress(entry_idx), sizeof(ZFS_File_Entry), (byte*)this);
 }
 
+void ZFS_File_Entry::write(uint8_t entry_idx) const {
+  if (!zigbee.eeprom_present) { return; }
+  zigbee.eeprom.writeBytes(getAddress(entry_idx), sizeof(ZFS_File_Entry), (byte*)this);
+}
+
 void ZFS_Write_File::findOrCreate(void) {
   ZFS_File_Entry entry;
 
   if (ZFS::findFileEntry(name, entry, &entry_idx)) {
     blk_start = entry.blk_start;
+    length = entry.length;
   }
 };
 
@@ -600,8 +628,9 @@ public:
 #ifdef USE_ZIGBEE_EEPROM
   ZFS_Write_File eeprom_file;
 
-  void init(uint32_t _name) {
-    eeprom_file.init(_name);
+  // append = true writes after the current content instead of replacing it
+  void init(uint32_t _name, bool append = false) {
+    eeprom_file.init(_name, append);
     is_valid = eeprom_file.valid();
   }
 #endif // USE_ZIGBEE_EEPROM
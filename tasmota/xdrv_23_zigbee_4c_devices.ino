@@ -77,6 +77,28 @@
 // uint8[] - list of configuration bytes, 0xFF marks the end
 // i.e. 0xFF-0xFF marks the end of the array of endpoints
 //
+// =======================
+// Journal
+//
+// Changes are appended to a journal instead of rewriting all devices. Only devices
+// whose record changed since the last save are written. The devices file is rewritten
+// (compaction) when the journal is full, when a device was removed, or with `ZbSave`.
+//
+// Journal structure:
+// uint32 - 'jrn2' signature
+// uint32 - CRC32 of the devices file it applies to, a journal for another file is ignored
+//
+// [Array of records]
+// uint8  - length of record including this byte and the CRC, multiple of 4. 0xFF marks the end (erased Flash)
+// uint8  - record type, 0x01 = device record as above
+// uint8[] - payload, padded with 0xFF
+// uint32 - CRC32 of the previous bytes of the record
+//
+// The journal is stored in EEPROM as file 'jrn2', in the file system as TASM_FILE_ZIGBEE_JOURNAL,
+// or in Flash (ESP8266) just after the devices in the same block so that records are written
+// in erased Flash without erasing the sector.
+// At boot, the records are applied over the devices file until the first invalid record.
+//
 
 
 // Memory footprint
@@ -190,14 +212,16 @@ SBuffer hibernateDevice(const struct Z_Device &device) {
  * In case of problem, the output file is left untouched
 \*********************************************************************************************/
 // EEPROM variant that writes one item at a time and is not limited to 2KB
-bool hibernateDevices(Univ_Write_File & write_data);
-bool hibernateDevices(Univ_Write_File & write_data) {
+// crc receives the CRC32 of all bytes written
+bool hibernateDevices(Univ_Write_File & write_data, uint32_t * crc);
+bool hibernateDevices(Univ_Write_File & write_data, uint32_t * crc) {
   // first prefix is number of devices
   uint8_t devices_size = zigbee_devices.devicesSize();
   if (devices_size > 250) { devices_size = 250; }         // arbitrarily limit to 250 devices in EEPROM instead of 32 in Flash
   write_data.writeBytes(&devices_size, sizeof(devices_size));
+  *crc = Z_Crc32(0, &devices_size, sizeof(devices_size));
 
-  for (const auto & device : zigbee_devices.getDevices()) {
+  for (auto & device : zigbee_devices.getDevices()) {
     const SBuffer buf = hibernateDevice(device);
     if (buf.len() > 0) {
       int32_t ret = write_data.writeBytes(buf.getBuffer(), buf.len());
@@ -205,8 +229,252 @@ bool hibernateDevices(Univ_Write_File & write_data) {
         AddLog(LOG_LEVEL_ERROR, PSTR(D_LOG_ZIGBEE "Error writing Devices, written = %d, expected = %d"), ret, buf.len());
         return false;
       }
+      *crc = Z_Crc32(*crc, buf.getBuffer(), buf.len());
+      device.journal_crc = Z_Crc32(0, buf.getBuffer(), buf.len());
+    }
+  }
+  return true;
+}
+
+/*********************************************************************************************\
+ * Journal of device changes
+\*********************************************************************************************/
+enum Z_Journal_Storage : uint8_t {
+  Z_JOURNAL_NONE = 0,             // no journal, next save rewrites all devices
+  Z_JOURNAL_EEPROM,
+  Z_JOURNAL_FILE,
+  Z_JOURNAL_FLASH,
+};
+
+const uint8_t Z_JOURNAL_DEVICE = 0x01;      // record type: device record from hibernateDevice()
+const size_t  Z_JOURNAL_HEADER = 8;         // signature + CRC32 of the devices file
+const size_t  Z_JOURNAL_MAX    = 4096;      // max size of the journal in EEPROM or file system
+
+class Z_Journal {
+public:
+  uint32_t  stamp = 0;            // CRC32 of the devices file the journal applies to
+  uint16_t  len = 0;              // bytes used, including the header
+  uint16_t  max_len = 0;          // capacity, a compaction is done when full
+  uint16_t  flash_offset = 0;     // ESP8266 Flash, offset of the journal in the Zigbee block
+  uint8_t   storage = Z_JOURNAL_NONE;
+};
+
+Z_Journal zigbee_journal;
+
+// CRC32, can be chained by passing the previous result, start with 0
+uint32_t Z_Crc32(uint32_t crc, const uint8_t * buf, size_t len) {
+  crc = ~crc;
+  while (len--) {
+    crc ^= *buf++;
+    for (uint32_t j = 0; j < 8; j++) {
+      crc = (crc >> 1) ^ (-int(crc & 1) & 0xEDB88320);
+    }
+  }
+  return ~crc;
+}
+
+// Apply a device record from the journal, it replaces endpoints and configuration of the known device
+void replayJournalDevice(const SBuffer & buf_d);
+void replayJournalDevice(const SBuffer & buf_d) {
+  uint16_t shortaddr = buf_d.get16(1);
+  uint64_t longaddr  = buf_d.get64(3);
+  Z_Device & device = longaddr ? zigbee_devices.findLongAddr(longaddr) : zigbee_devices.findShortAddr(shortaddr);
+  if (zigbee_devices.foundDevice(device)) {
+    memset(device.endpoints, 0, sizeof(device.endpoints));
+    device.data.reset();
+  }
+  hydrateSingleDevice(buf_d);
+}
+
+// Apply the journal stored with the devices file that was just loaded
+// stamp: CRC32 of the devices file
+void replayZigbeeJournal(uint32_t stamp) {
+  Univ_Read_File f;
+
+#ifdef USE_ZIGBEE_EEPROM
+  if (Z_JOURNAL_EEPROM == zigbee_journal.storage) {
+    f.init(ZIGB_JOURNAL2);
+    zigbee_journal.max_len = Z_JOURNAL_MAX;
+  }
+#endif // USE_ZIGBEE_EEPROM
+
+#ifdef USE_UFILESYS
+  File file;
+  if (Z_JOURNAL_FILE == zigbee_journal.storage) {
+    file = dfsp->open(TASM_FILE_ZIGBEE_JOURNAL, "r");
+    if (file) {
+      f.init(&file);
+    }
+    zigbee_journal.max_len = Z_JOURNAL_MAX;
+  }
+#endif // USE_UFILESYS
+
+#ifdef ESP8266
+  if (Z_JOURNAL_FLASH == zigbee_journal.storage) {
+    zigbee_journal.max_len = z_block_len - zigbee_journal.flash_offset;
+    f.init(z_dev_start + zigbee_journal.flash_offset, zigbee_journal.max_len);
+  }
+#endif // ESP8266
+
+  uint32_t header[2] = { 0, 0 };
+  if (!f.valid() || (f.readBytes((uint8_t*) header, sizeof(header)) != sizeof(header)) ||
+      (header[0] != ZIGB_JOURNAL2) || (header[1] != stamp)) {
+    f.close();
+    zigbee_journal.storage = Z_JOURNAL_NONE;      // no journal for this file, start one at next save
+    return;
+  }
+
+  SBuffer rec(252);
+  uint32_t records = 0;
+  bool valid = true;
+  zigbee_journal.stamp = stamp;
+  zigbee_journal.len = Z_JOURNAL_HEADER;
+  while (zigbee_journal.len < zigbee_journal.max_len) {
+    uint8_t rec_len = 0xFF;
+    if ((f.readBytes(&rec_len, sizeof(rec_len)) != sizeof(rec_len)) || (0xFF == rec_len)) { break; }   // end of journal
+    if ((rec_len < 8) || (rec_len & 0x03) || (zigbee_journal.len + rec_len > zigbee_journal.max_len)) { valid = false; break; }
+    rec.setLen(rec_len);
+    rec.set8(0, rec_len);
+    if (f.readBytes(rec.buf(1), rec_len - 1) != rec_len - 1) { valid = false; break; }
+    if (Z_Crc32(0, rec.buf(), rec_len - 4) != rec.get32(rec_len - 4)) { valid = false; break; }
+
+    uint8_t dev_len = rec.get8(2);
+    if ((Z_JOURNAL_DEVICE == rec.get8(1)) && (dev_len >= 11) && (dev_len <= rec_len - 6)) {
+      replayJournalDevice(rec.subBuffer(2, dev_len));
+    }
+    zigbee_journal.len += rec_len;
+    records++;
+  }
+  f.close();
+
+  if (valid) {
+    AddLog(LOG_LEVEL_INFO, PSTR(D_LOG_ZIGBEE "Zigbee journal replayed (%d records - %d bytes)"), records, zigbee_journal.len);
+  } else {
+    // incomplete record, probably a power loss while writing, nothing can be appended after it
+    AddLog(LOG_LEVEL_INFO, PSTR(D_LOG_ZIGBEE "Invalid journal record after %d records, rewriting devices"), records);
+    zigbee_journal.storage = Z_JOURNAL_NONE;
+  }
+}
+
+// Start an empty journal for the devices file that was just written
+// The ESP8266 Flash journal is written with the devices, only the offsets are set here
+void resetZigbeeJournal(uint8_t storage, uint32_t stamp) {
+  uint32_t header[2] = { ZIGB_JOURNAL2, stamp };
+  Univ_Write_File f;
+
+#ifdef USE_ZIGBEE_EEPROM
+  if (Z_JOURNAL_EEPROM == storage) {
+    f.init(ZIGB_JOURNAL2);
+  }
+#endif // USE_ZIGBEE_EEPROM
+
+#ifdef USE_UFILESYS
+  File file;
+  if (Z_JOURNAL_FILE == storage) {
+    file = dfsp->open(TASM_FILE_ZIGBEE_JOURNAL, "w");
+    if (file) {
+      f.init(&file);
+    }
+  }
+#endif // USE_UFILESYS
+
+  zigbee_journal.storage = Z_JOURNAL_NONE;
+  if (f.valid()) {
+    bool ok = (f.writeBytes((uint8_t*) header, sizeof(header)) == sizeof(header));
+    f.close();
+    if (!ok) { return; }
+    zigbee_journal.max_len = Z_JOURNAL_MAX;
+#ifdef ESP8266
+  } else if (Z_JOURNAL_FLASH == storage) {
+    zigbee_journal.max_len = z_block_len - zigbee_journal.flash_offset;
+#endif // ESP8266
+  } else {
+    return;
+  }
+  zigbee_journal.storage = storage;
+  zigbee_journal.stamp = stamp;
+  zigbee_journal.len = Z_JOURNAL_HEADER;
+}
+
+/*********************************************************************************************\
+ * journalZigbeeDevices
+ *
+ * Append the devices that changed since the last save to the journal.
+ * Returns false if the journal can't be used or is full, devices must be saved with saveZigbeeDevices()
+\*********************************************************************************************/
+bool journalZigbeeDevices(void) {
+  if (Z_JOURNAL_NONE == zigbee_journal.storage) { return false; }
+  if (zigbee_journal.len >= zigbee_journal.max_len) { return false; }
+
+  SBuffer records(zigbee_journal.max_len - zigbee_journal.len);    // must fit in the space left
+  for (auto & device : zigbee_devices.getDevices()) {
+    const SBuffer buf = hibernateDevice(device);
+    uint32_t crc = Z_Crc32(0, buf.getBuffer(), buf.len());
+    if (crc == device.journal_crc) { continue; }         // unchanged since last save
+
+    size_t rec_len = (2 + buf.len() + 4 + 3) & ~0x03;
+    if (rec_len > 252) {       // record length is a single byte, 0xFF marks the end
+      AddLog(LOG_LEVEL_INFO, PSTR(D_LOG_ZIGBEE "Device 0x%04X too large for the journal (%d bytes), rewriting devices"), device.shortaddr, buf.len());
+      return false;
+    }
+    if (records.len() + rec_len > records.size()) {
+      AddLog(LOG_LEVEL_DEBUG, PSTR(D_LOG_ZIGBEE "Zigbee journal full, rewriting devices"));
+      return false;
+    }
+    size_t rec_start = records.len();
+    records.add8(rec_len);
+    records.add8(Z_JOURNAL_DEVICE);
+    records.addBuffer(buf);
+    while (records.len() < rec_start + rec_len - 4) { records.add8(0xFF); }
+    records.add32(Z_Crc32(0, records.buf(rec_start), rec_len - 4));
+    device.journal_crc = crc;    // if writing fails, all devices are rewritten anyway
+  }
+  if (0 == records.len()) { return true; }               // nothing changed
+
+  bool written = false;
+  const char * storage_class = PSTR("");
+
+#ifdef USE_ZIGBEE_EEPROM
+  if (Z_JOURNAL_EEPROM == zigbee_journal.storage) {
+    Univ_Write_File f;
+    f.init(ZIGB_JOURNAL2, true);      // append
+    if (f.valid()) {
+      written = (f.writeBytes(records.getBuffer(), records.len()) == records.len());
+      f.close();
     }
+    storage_class = PSTR("EEPROM");
+  }
+#endif // USE_ZIGBEE_EEPROM
+
+#ifdef USE_UFILESYS
+  if (Z_JOURNAL_FILE == zigbee_journal.storage) {
+    File file = dfsp->open(TASM_FILE_ZIGBEE_JOURNAL, "a");
+    if (file) {
+      written = (file.size() == zigbee_journal.len) &&
+                (file.write(records.getBuffer(), records.len()) == records.len());
+      file.close();
+    }
+    storage_class = PSTR("File System");
+  }
+#endif // USE_UFILESYS
+
+#ifdef ESP8266
+  if (Z_JOURNAL_FLASH == zigbee_journal.storage) {
+    // records are a multiple of 4 bytes and written in erased Flash, no need to erase the sector
+    uint32_t address = z_spi_start_sector * SPI_FLASH_SEC_SIZE + z_block_offset + zigbee_journal.flash_offset + zigbee_journal.len;
+    written = ESP.flashWrite(address, (uint32_t*) records.getBuffer(), records.len());
+    storage_class = PSTR("Flash");
+  }
+#endif // ESP8266
+
+  if (!written) {
+    AddLog(LOG_LEVEL_ERROR, PSTR(D_LOG_ZIGBEE "Error writing journal, rewriting devices"));
+    zigbee_journal.storage = Z_JOURNAL_NONE;
+    return false;
   }
+  zigbee_journal.len += records.len();
+  AddLog(LOG_LEVEL_DEBUG, PSTR(D_LOG_ZIGBEE "Zigbee Devices changes journaled in %s (%d bytes, journal %d/%d)"),
+         storage_class, records.len(), zigbee_journal.len, zigbee_journal.max_len);
   return true;
 }
 
@@ -277,11 +545,14 @@ void hydrateSingleDevice(const SBuffer & buf_d) {
 bool loadZigbeeDevices(void) {
   Univ_Read_File f;   // universal reader
   const char * storage_class = PSTR("");
+  uint8_t storage = Z_JOURNAL_NONE;
+  zigbee_journal.storage = Z_JOURNAL_NONE;
 
 #ifdef USE_ZIGBEE_EEPROM
   if (zigbee.eeprom_ready) {
     f.init(ZIGB_NAME2);
     storage_class = PSTR("EEPROM");
+    storage = Z_JOURNAL_EEPROM;
   }
 #endif // USE_ZIGBEE_EEPROM
 
@@ -300,6 +571,7 @@ bool loadZigbeeDevices(void) {
       }
       f.init(&file);
       storage_class = PSTR("File System");
+      storage = Z_JOURNAL_FILE;
     }
   }
 #endif // USE_UFILESYS
@@ -320,15 +592,19 @@ bool loadZigbeeDevices(void) {
       // uint32_t version = (flashdata.name == ZIGB_NAME2) ? 2 : 1;
       f.init(z_dev_start + sizeof(Z_Flashentry), buf_len);
       storage_class = PSTR("Flash");
+      storage = Z_JOURNAL_FLASH;
+      zigbee_journal.flash_offset = (sizeof(Z_Flashentry) + buf_len + 3) & ~0x03;    // journal follows, aligned on 4 bytes
     }
   }
 #endif // ESP8266
 
   uint32_t file_len = 0;
   uint8_t num_devices = 0;
+  uint32_t crc = 0;     // CRC32 of the file, identifies the journal that goes with it
   if (f.valid()) {
     file_len = f.len;
     f.readBytes(&num_devices, sizeof(num_devices));
+    crc = Z_Crc32(crc, &num_devices, sizeof(num_devices));
   }
   if ((file_len < 10) || (num_devices == 0x00) || (num_devices == 0xFF)) {             // No data
     AddLog(LOG_LEVEL_INFO, PSTR(D_LOG_ZIGBEE "No Zigbee device information"));
@@ -358,12 +634,26 @@ bool loadZigbeeDevices(void) {
     }
 
     hydrateSingleDevice(buf);
+    crc = Z_Crc32(crc, buf.getBuffer(), buf.len());
 
     // next iteration
     k += dev_record_len;
   }
+  f.close();
+
+  zigbee_journal.storage = storage;
+  replayZigbeeJournal(crc);
+
+  // what is now in memory is what is stored
+  for (auto & device : zigbee_devices.getDevices()) {
+    const SBuffer buf = hibernateDevice(device);
+    device.journal_crc = Z_Crc32(0, buf.getBuffer(), buf.len());
+  }
 
   zigbee_devices.clean();   // don't write back to Flash what we just loaded
+  if (Z_JOURNAL_NONE == zigbee_journal.storage) {
+    zigbee_devices.dirty();   // no usable journal, rewrite all devices to start one
+  }
   return true;
 }
 
@@ -376,11 +666,13 @@ bool loadZigbeeDevices(void) {
 void saveZigbeeDevices(void) {
   Univ_Write_File f;
   const char * storage_class = PSTR("");
+  uint8_t storage = Z_JOURNAL_NONE;
 
 #ifdef USE_ZIGBEE_EEPROM
   if (!f.valid() && zigbee.eeprom_ready) {
     f.init(ZIGB_NAME2);
     storage_class = PSTR("EEPROM");
+    storage = Z_JOURNAL_EEPROM;
   }
 #endif
 
@@ -391,6 +683,7 @@ void saveZigbeeDevices(void) {
     if (file) {
       f.init(&file);
       storage_class = PSTR("File System");
+      storage = Z_JOURNAL_FILE;
     }
   }
 #endif
@@ -402,18 +695,24 @@ void saveZigbeeDevices(void) {
     sbuffer = (uint8_t*) malloc(max_flash_size);
     f.init(sbuffer, max_flash_size);
     storage_class = PSTR("Flash");
+    storage = Z_JOURNAL_FLASH;
   }
 #endif // defined(ESP8266)
 
   bool written = false;
   size_t buf_len = 0;
+  uint32_t crc = 0;
+  zigbee_journal.storage = Z_JOURNAL_NONE;    // the previous journal does not apply anymore
   if (f.valid()) {
-    written = hibernateDevices(f);
+    written = hibernateDevices(f, &crc);
 
     buf_len = f.getCursor();
     f.close();
     AddLog(LOG_LEVEL_INFO, PSTR(D_LOG_ZIGBEE "Zigbee Devices Data saved in %s (%d bytes)"), storage_class, buf_len);
   }
+  if (written && (Z_JOURNAL_FLASH != storage)) {
+    resetZigbeeJournal(storage, crc);
+  }
 
 #if defined(ESP8266)
   if (written && sbuffer != nullptr) {
@@ -426,6 +725,8 @@ void saveZigbeeDevices(void) {
     }
     ESP.flashRead(z_spi_start_sector * SPI_FLASH_SEC_SIZE, (uint32_t*) spi_buffer, SPI_FLASH_SEC_SIZE);
 
+    // the rest of the block stays erased for the journal
+    memset(spi_buffer + z_block_offset, 0xFF, z_block_len);
     Z_Flashentry *flashdata = (Z_Flashentry*)(spi_buffer + z_block_offset);
     flashdata->name = ZIGB_NAME2;     // v2
     flashdata->len = buf_len;
@@ -433,9 +734,20 @@ void saveZigbeeDevices(void) {
 
     memcpy(spi_buffer + z_block_offset + sizeof(Z_Flashentry), sbuffer, buf_len);
 
+    // journal header just after the devices, if there is room for records
+    uint16_t journal_offset = (sizeof(Z_Flashentry) + buf_len + 3) & ~0x03;
+    if (journal_offset + Z_JOURNAL_HEADER + 64 <= z_block_len) {
+      uint32_t header[2] = { ZIGB_JOURNAL2, crc };
+      memcpy(spi_buffer + z_block_offset + journal_offset, header, sizeof(header));
+    }
+
     // buffer is now ready, write it back
     if (ESP.flashEraseSector(z_spi_start_sector)) {
       ESP.flashWrite(z_spi_start_sector * SPI_FLASH_SEC_SIZE, (uint32_t*) spi_buffer, SPI_FLASH_SEC_SIZE);
+      if (journal_offset + Z_JOURNAL_HEADER + 64 <= z_block_len) {
+        zigbee_journal.flash_offset = journal_offset;
+        resetZigbeeJournal(Z_JOURNAL_FLASH, crc);
+      }
     }
     AddLog(LOG_LEVEL_INFO, PSTR(D_LOG_ZIGBEE "Zigbee Devices Data store in Flash (0x%08X - %d bytes)"), z_dev_start, buf_len);
     free(spi_buffer);
@@ -454,6 +766,7 @@ void saveZigbeeDevices(void) {
 // Erase the flash area containing the ZigbeeData
 void eraseZigbeeDevices(void) {
   zigbee_devices.clean();     // avoid writing data to flash after erase
+  zigbee_journal.storage = Z_JOURNAL_NONE;
 #ifdef USE_ZIGBEE_EEPROM
   ZFS_Erase();
 #endif // USE_ZIGBEE_EEPROM
@@ -481,6 +794,7 @@ void eraseZigbeeDevices(void) {
 #endif  // defined(ESP8266) && !defined(USE_UFILESYS)
 
 #ifdef USE_UFILESYS
+  TfsDeleteFile(TASM_FILE_ZIGBEE_JOURNAL);
   if (TfsDeleteFile(TASM_FILE_ZIGBEE)) {
     AddLog(LOG_LEVEL_INFO, PSTR(D_LOG_ZIGBEE "Zigbee Devices Data erased"));
   }
@@ -938,4 +938,143 @@ enum Z_offsets {
 */
 
 
+/*********************************************************************************************\
+ * Lookup indexes for Z_PostProcess
+ *
+ * Z_PostProcess_by_id lists the indices of Z_PostProcess sorted by cluster then attribute
+ * (Cx values are in cluster order), for binary search.
+ * Z_PostProcess_by_name lists the 16 bits hash of each name, see Z_NameHash(), sorted by hash.
+ * In both tables entries with the same key keep the order of Z_PostProcess.
+ *
+ * Both tables must be regenerated whenever Z_PostProcess is changed, using the Python code
+ * below from the `tasmota` directory.
+\*********************************************************************************************/
+
+typedef struct Z_NameIndex {
+  uint16_t    hash;           // hash of the lower case name
+  uint16_t    index;          // index in Z_PostProcess
+} Z_NameIndex;
+
+/*Python code to generate code below
+
+import re
+
+pat_entry = r"^\s*\{\s*(\w+),\s*(Cx[0-9A-F]{4}),\s*([^,]+),\s*Z_\((\w*)\)"   # type, cluster, attribute, name
+pat_enum = r"^\s*(ZA_\w+)\s*=\s*(\w+),"           # Z_Alarm_Type values used in attributes
+
+def name_hash(s):
+    # FNV-1a of the lower case name, folded to 16 bits, must match Z_NameHash()
+    h = 2166136261
+    for c in s.lower():
+        h = ((h ^ ord(c)) * 16777619) & 0xFFFFFFFF
+    return (h >> 16) ^ (h & 0xFFFF)
+
+def post_process_index(devices_src, converters_src):
+    enums = { k: int(v, 0) for (k, v) in re.findall(pat_enum, devices_src, re.M) }
+    table = converters_src[converters_src.index("Z_PostProcess[] PROGMEM = {"):]
+    table = table[:table.index("\n};")]
+    entries = []
+    for l in table.split("\n"):
+        m = re.match(pat_entry, l)
+        if m:
+            (t, cx, attr, name) = m.groups()
+            entries.append((int(cx[2:], 16), eval(attr, {}, enums), name))
+
+    by_id = sorted(range(len(entries)), key = lambda i: (entries[i][0], entries[i][1], i))
+    by_name = sorted([ (name_hash(e[2]), i) for (i, e) in enumerate(entries) if e[2] != "" ])
+
+    out_id = "const uint16_t Z_PostProcess_by_id[] PROGMEM = {\n"
+    for k in range(0, len(by_id), 16):
+        out_id += "  " + " ".join("%d," % i for i in by_id[k:k+16]) + "\n"
+    out_id += "};"
+    out_name = "const Z_NameIndex Z_PostProcess_by_name[] PROGMEM = {\n"
+    for k in range(0, len(by_name), 8):
+        out_name += "  " + " ".join("{ 0x%04X, %d }," % e for e in by_name[k:k+8]) + "\n"
+    out_name += "};"
+    return (len(entries), out_id, out_name)
+
+(n, out_id, out_name) = post_process_index(open("xdrv_23_zigbee_2_devices.ino").read(), open("xdrv_23_zigbee_5_converters.ino").read())
+print(out_id)
+print(out_name)
+
+*/
+
+/*
+  DO NOT EDIT
+*/
+
+const uint16_t Z_PostProcess_by_id[] PROGMEM = {
+  0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15,
+  16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31,
+  32, 33, 34, 36, 35, 37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47,
+  48, 49, 50, 51, 52, 53, 54, 55, 56, 57, 58, 59, 60, 61, 62, 63,
+  64, 66, 65, 67, 68, 69, 70, 71, 72, 73, 74, 75, 76, 77, 78, 79,
+  80, 81, 82, 83, 84, 85, 86, 87, 88, 89, 90, 91, 92, 93, 94, 95,
+  96, 97, 98, 99, 100, 101, 102, 103, 104, 105, 106, 107, 108, 109, 110, 111,
+  112, 113, 114, 115, 116, 117, 118, 119, 120, 121, 122, 123, 124, 125, 126, 127,
+  128, 129, 130, 131, 132, 133, 134, 135, 136, 137, 138, 139, 140, 141, 142, 143,
+  144, 145, 146, 147, 148, 149, 150, 151, 152, 153, 154, 155, 156, 157, 158, 159,
+  160, 161, 162, 163, 164, 165, 166, 167, 168, 169, 170, 171, 172, 173, 174, 175,
+  176, 177, 178, 179, 180, 181, 182, 183, 184, 185, 186, 187, 188, 189, 190, 191,
+  192, 193, 194, 195, 196, 197, 198, 199, 200, 201, 202, 203, 204, 205, 206, 207,
+  208, 209, 210, 211, 212, 213, 214, 215, 216, 217, 218, 219, 220, 221, 222, 223,
+  224, 225, 226, 227, 228, 229, 230, 231, 232, 233, 234, 235, 236, 237, 238, 239,
+  240, 241, 242, 243, 244, 245, 246, 247, 248, 249, 250, 251, 252, 253, 254, 255,
+  256, 257, 258, 259, 260, 261, 262, 263, 264, 265, 266, 267, 268, 269, 270, 271,
+  272, 273, 274, 275, 276, 277, 278, 279, 280, 281, 282, 283, 284, 285, 286, 287,
+  288, 289, 290, 291, 292, 293, 294, 295, 296, 297, 298, 299, 300, 301, 302, 303,
+  304, 305, 306, 307, 308, 309, 310, 311, 312, 313, 314, 315, 316, 317, 318, 319,
+  320, 321, 322, 323, 324, 325, 326, 327, 328, 329, 330, 331, 332, 333, 334, 335,
+  336, 337, 338, 339, 340, 341, 342, 343, 344, 345, 346, 347, 348, 349, 350,
+};
+const Z_NameIndex Z_PostProcess_by_name[] PROGMEM = {
+  { 0x00AD, 114 }, { 0x029C, 205 }, { 0x04A1, 280 }, { 0x060F, 204 }, { 0x0721, 309 }, { 0x0792, 344 }, { 0x07A8, 92 }, { 0x0846, 94 },
+  { 0x08DE, 28 }, { 0x09DF, 305 }, { 0x0A7E, 84 }, { 0x0A87, 293 }, { 0x0B2F, 189 }, { 0x0B6F, 246 }, { 0x0B81, 266 }, { 0x0BC8, 128 },
+  { 0x0C53, 307 }, { 0x0C7C, 3 }, { 0x0C7C, 158 }, { 0x0C7C, 187 }, { 0x0CB4, 346 }, { 0x0CC0, 272 }, { 0x0EA9, 74 }, { 0x0EEA, 202 },
+  { 0x0F4B, 345 }, { 0x0F7E, 262 }, { 0x1067, 270 }, { 0x10BA, 218 }, { 0x1100, 231 }, { 0x1105, 126 }, { 0x1207, 282 }, { 0x1318, 22 },
+  { 0x1325, 222 }, { 0x1409, 33 }, { 0x1435, 271 }, { 0x14ED, 264 }, { 0x14F4, 8 }, { 0x1565, 236 }, { 0x15A3, 81 }, { 0x15F6, 11 },
+  { 0x165A, 69 }, { 0x1690, 5 }, { 0x16A6, 38 }, { 0x16B3, 207 }, { 0x1763, 318 }, { 0x1B7C, 149 }, { 0x1CBE, 179 }, { 0x1E84, 172 },
+  { 0x1E8D, 151 }, { 0x1E8E, 148 }, { 0x1F0E, 96 }, { 0x1F62, 154 }, { 0x217A, 259 }, { 0x2215, 95 }, { 0x2308, 23 }, { 0x235C, 0 },
+  { 0x238B, 175 }, { 0x23FB, 348 }, { 0x247E, 41 }, { 0x25DE, 108 }, { 0x2791, 73 }, { 0x27F9, 21 }, { 0x28A3, 104 }, { 0x28B0, 85 },
+  { 0x2B0E, 292 }, { 0x2B54, 193 }, { 0x2B6B, 208 }, { 0x2BBA, 59 }, { 0x2BBA, 80 }, { 0x2C8C, 37 }, { 0x2CCB, 100 }, { 0x2CE6, 341 },
+  { 0x2CF4, 261 }, { 0x2D6D, 54 }, { 0x2E5A, 82 }, { 0x2E8C, 46 }, { 0x31F4, 317 }, { 0x328D, 13 }, { 0x3329, 6 }, { 0x333D, 244 },
+  { 0x34F5, 12 }, { 0x34FB, 220 }, { 0x37A4, 2 }, { 0x38DD, 139 }, { 0x3910, 111 }, { 0x3922, 63 }, { 0x39FA, 58 }, { 0x3B14, 45 },
+  { 0x3B1D, 247 }, { 0x3B1D, 250 }, { 0x3CD7, 152 }, { 0x3D3B, 123 }, { 0x3DDB, 185 }, { 0x3E00, 27 }, { 0x3E96, 61 }, { 0x3FC7, 9 },
+  { 0x3FFA, 121 }, { 0x4071, 10 }, { 0x40C7, 253 }, { 0x422A, 24 }, { 0x437C, 19 }, { 0x44CB, 214 }, { 0x44D7, 64 }, { 0x45F9, 117 },
+  { 0x467E, 35 }, { 0x47DF, 276 }, { 0x47EB, 43 }, { 0x47FB, 97 }, { 0x49DC, 67 }, { 0x49FD, 88 }, { 0x4A4B, 285 }, { 0x4A7C, 71 },
+  { 0x4B15, 140 }, { 0x4BBA, 146 }, { 0x4C0F, 157 }, { 0x4C15, 297 }, { 0x4CE4, 66 }, { 0x4D0A, 323 }, { 0x4D0B, 142 }, { 0x4D13, 83 },
+  { 0x4FB8, 198 }, { 0x5008, 320 }, { 0x5044, 188 }, { 0x5060, 53 }, { 0x518D, 182 }, { 0x51E2, 322 }, { 0x51E3, 68 }, { 0x522B, 324 },
+  { 0x52A3, 155 }, { 0x52CD, 173 }, { 0x5354, 203 }, { 0x537D, 55 }, { 0x53BE, 62 }, { 0x57EF, 165 }, { 0x5867, 25 }, { 0x586F, 147 },
+  { 0x58BA, 197 }, { 0x5AE6, 49 }, { 0x5B1D, 249 }, { 0x5C81, 239 }, { 0x5CAB, 26 }, { 0x5EA8, 119 }, { 0x5F19, 130 }, { 0x602C, 191 },
+  { 0x6124, 265 }, { 0x618C, 190 }, { 0x618C, 328 }, { 0x61DC, 312 }, { 0x62EA, 215 }, { 0x633A, 57 }, { 0x6349, 124 }, { 0x6373, 115 },
+  { 0x652C, 192 }, { 0x690B, 303 }, { 0x6AC4, 159 }, { 0x6AEC, 269 }, { 0x6BD6, 160 }, { 0x6C0A, 258 }, { 0x6C8F, 186 }, { 0x6DE3, 326 },
+  { 0x6E45, 251 }, { 0x6EAD, 122 }, { 0x700B, 237 }, { 0x714B, 47 }, { 0x71BB, 321 }, { 0x7273, 89 }, { 0x7299, 50 }, { 0x7374, 238 },
+  { 0x74C2, 201 }, { 0x759C, 170 }, { 0x78FF, 314 }, { 0x7939, 180 }, { 0x79C0, 106 }, { 0x7A6F, 77 }, { 0x7C2B, 109 }, { 0x7CE2, 333 },
+  { 0x7DD0, 75 }, { 0x80D4, 213 }, { 0x82E3, 184 }, { 0x8482, 48 }, { 0x85D1, 56 }, { 0x85F0, 211 }, { 0x8662, 135 }, { 0x86E8, 17 },
+  { 0x8731, 277 }, { 0x8797, 107 }, { 0x8843, 98 }, { 0x8861, 60 }, { 0x8963, 327 }, { 0x8A32, 7 }, { 0x8A88, 44 }, { 0x8AA3, 42 },
+  { 0x8AD7, 132 }, { 0x8C03, 284 }, { 0x9030, 313 }, { 0x9094, 137 }, { 0x9129, 161 }, { 0x928F, 241 }, { 0x92CB, 86 }, { 0x947B, 52 },
+  { 0x94A5, 127 }, { 0x96AC, 335 }, { 0x96E9, 177 }, { 0x97A0, 296 }, { 0x9838, 162 }, { 0x9872, 288 }, { 0x98B8, 347 }, { 0x9AE3, 228 },
+  { 0x9B6A, 299 }, { 0x9C4B, 234 }, { 0x9C65, 274 }, { 0x9DD8, 235 }, { 0x9F20, 301 }, { 0x9F80, 255 }, { 0xA0D0, 339 }, { 0xA22A, 144 },
+  { 0xA663, 304 }, { 0xA6D1, 315 }, { 0xA8DA, 233 }, { 0xA903, 334 }, { 0xA9CD, 283 }, { 0xA9F1, 336 }, { 0xAA34, 129 }, { 0xAB49, 232 },
+  { 0xAC1E, 72 }, { 0xAC52, 131 }, { 0xACCF, 332 }, { 0xAD8B, 216 }, { 0xAE1F, 308 }, { 0xAE33, 340 }, { 0xAF4B, 16 }, { 0xAF61, 31 },
+  { 0xAFFC, 240 }, { 0xB2F8, 217 }, { 0xB3CE, 200 }, { 0xB41C, 34 }, { 0xB41C, 329 }, { 0xB5D0, 254 }, { 0xB670, 99 }, { 0xB680, 183 },
+  { 0xB75B, 116 }, { 0xB93D, 166 }, { 0xBBDA, 224 }, { 0xBC49, 223 }, { 0xBC69, 178 }, { 0xBC7D, 18 }, { 0xBCF7, 306 }, { 0xBD52, 20 },
+  { 0xBE62, 136 }, { 0xBEC8, 134 }, { 0xBFB4, 40 }, { 0xBFB5, 196 }, { 0xC0EF, 338 }, { 0xC2D9, 79 }, { 0xC2E0, 36 }, { 0xC37C, 337 },
+  { 0xC408, 267 }, { 0xC469, 331 }, { 0xC4BB, 343 }, { 0xC571, 310 }, { 0xC62E, 290 }, { 0xC65F, 103 }, { 0xC662, 90 }, { 0xC6B7, 260 },
+  { 0xC6C8, 295 }, { 0xC6D8, 39 }, { 0xC719, 138 }, { 0xC78A, 118 }, { 0xC7C0, 298 }, { 0xC7CE, 101 }, { 0xC80E, 70 }, { 0xC8D3, 176 },
+  { 0xC972, 120 }, { 0xC989, 291 }, { 0xCB76, 275 }, { 0xCD7C, 93 }, { 0xCDA4, 156 }, { 0xCEA5, 242 }, { 0xD02D, 168 }, { 0xD049, 153 },
+  { 0xD200, 294 }, { 0xD26D, 169 }, { 0xD2E6, 316 }, { 0xD32B, 206 }, { 0xD3D0, 171 }, { 0xD3D6, 289 }, { 0xD5F8, 102 }, { 0xD609, 30 },
+  { 0xD609, 32 }, { 0xD609, 319 }, { 0xD6D1, 300 }, { 0xD854, 279 }, { 0xD854, 286 }, { 0xD854, 330 }, { 0xD85C, 229 }, { 0xD8B0, 221 },
+  { 0xD9CE, 225 }, { 0xD9EE, 195 }, { 0xDA96, 243 }, { 0xDC22, 174 }, { 0xDCCD, 150 }, { 0xDCF2, 212 }, { 0xDD10, 325 }, { 0xDD8A, 91 },
+  { 0xDDAB, 342 }, { 0xDF13, 219 }, { 0xDF94, 113 }, { 0xDFEB, 230 }, { 0xE0C4, 76 }, { 0xE0C6, 181 }, { 0xE122, 4 }, { 0xE13B, 226 },
+  { 0xE249, 141 }, { 0xE267, 163 }, { 0xE2C8, 1 }, { 0xE4C5, 245 }, { 0xE57C, 78 }, { 0xE5D8, 350 }, { 0xE716, 256 }, { 0xE74A, 145 },
+  { 0xE7A7, 302 }, { 0xEA11, 263 }, { 0xEA2E, 194 }, { 0xEB13, 87 }, { 0xEB13, 110 }, { 0xEBE4, 112 }, { 0xEC38, 164 }, { 0xEE42, 209 },
+  { 0xEF40, 133 }, { 0xEFD8, 199 }, { 0xEFDC, 51 }, { 0xF121, 167 }, { 0xF35E, 311 }, { 0xF59F, 210 }, { 0xF679, 349 }, { 0xF7E6, 105 },
+  { 0xF864, 125 }, { 0xF8C4, 143 }, { 0xFA05, 65 }, { 0xFA20, 287 }, { 0xFE00, 29 }, { 0xFF88, 227 },
+};
+
+/*
+  DO NOT EDIT
+*/
+
 #endif // USE_ZIGBEE
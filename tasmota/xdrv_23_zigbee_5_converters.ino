@@ -146,10 +146,19 @@ uint16_t CxToCluster(uint8_t cx) {
   return 0xFFFF;
 }
 
+// Cx_cluster is sorted, use binary search
 uint8_t ClusterToCx(uint16_t cluster) {
-  for (uint32_t i=0; i<nitems(Cx_cluster); i++) {
-    if (pgm_read_word(&Cx_cluster[i]) == cluster) {
-      return i;
+  uint32_t low = 0;
+  uint32_t high = nitems(Cx_cluster);
+  while (low < high) {
+    uint32_t mid = (low + high) / 2;
+    uint16_t mid_cluster = pgm_read_word(&Cx_cluster[mid]);
+    if (mid_cluster == cluster) {
+      return mid;
+    } else if (mid_cluster < cluster) {
+      low = mid + 1;
+    } else {
+      high = mid;
     }
   }
   return 0xFF;
@@ -661,6 +670,74 @@ const Z_AttributeConverter Z_PostProcess[] PROGMEM = {
 };
 #pragma GCC diagnostic pop
 
+static_assert(nitems(Z_PostProcess_by_id) == nitems(Z_PostProcess), "Z_PostProcess indexes are outdated, regenerate them in xdrv_23_zigbee_5__constants.ino");
+
+// Case insensitive hash of attribute names, must match name_hash() used to generate Z_PostProcess_by_name
+uint16_t Z_NameHash(const char * name) {
+  uint32_t hash = 2166136261UL;       // FNV-1a
+  while (*name) {
+    hash = (hash ^ tolower((uint8_t)*name++)) * 16777619UL;
+  }
+  return (hash >> 16) ^ (hash & 0xFFFF);
+}
+
+// Sort key of a Z_PostProcess entry: cluster_short and attribute
+uint32_t Z_ConverterIdKey(uint32_t idx) {
+  const Z_AttributeConverter *converter = &Z_PostProcess[idx];
+  return (pgm_read_byte(&converter->cluster_short) << 16) | pgm_read_word(&converter->attribute);
+}
+
+//
+// Find the first converter for cluster/attribute, using binary search in Z_PostProcess_by_id
+// Returns index in Z_PostProcess, or -1 if not found
+//
+int32_t Z_FindConverterById(uint16_t cluster, uint16_t attr_id) {
+  uint8_t cx = ClusterToCx(cluster);
+  if (0xFF == cx) { return -1; }
+  uint32_t key = (cx << 16) | attr_id;
+  uint32_t low = 0;
+  uint32_t high = nitems(Z_PostProcess_by_id);
+  while (low < high) {                // find first entry with key not lower than searched key
+    uint32_t mid = (low + high) / 2;
+    if (Z_ConverterIdKey(pgm_read_word(&Z_PostProcess_by_id[mid])) < key) {
+      low = mid + 1;
+    } else {
+      high = mid;
+    }
+  }
+  if (low < nitems(Z_PostProcess_by_id)) {
+    uint32_t idx = pgm_read_word(&Z_PostProcess_by_id[low]);
+    if (Z_ConverterIdKey(idx) == key) { return idx; }
+  }
+  return -1;
+}
+
+//
+// Find the first converter by name (case insensitive), using binary search on name hash in Z_PostProcess_by_name
+// Only converters of `cluster` are considered, unless it is 0xFFFF
+// Returns index in Z_PostProcess, or -1 if not found
+//
+int32_t Z_FindConverterByName(const char * name, uint16_t cluster) {
+  uint16_t hash = Z_NameHash(name);
+  uint32_t low = 0;
+  uint32_t high = nitems(Z_PostProcess_by_name);
+  while (low < high) {                // find first entry with hash
+    uint32_t mid = (low + high) / 2;
+    if (pgm_read_word(&Z_PostProcess_by_name[mid].hash) < hash) {
+      low = mid + 1;
+    } else {
+      high = mid;
+    }
+  }
+  for (; (low < nitems(Z_PostProcess_by_name)) && (pgm_read_word(&Z_PostProcess_by_name[low].hash) == hash); low++) {
+    uint32_t idx = pgm_read_word(&Z_PostProcess_by_name[low].index);
+    const Z_AttributeConverter *converter = &Z_PostProcess[idx];
+    if ((0xFFFF != cluster) && (CxToCluster(pgm_read_byte(&converter->cluster_short)) != cluster)) { continue; }
+    if (0 == strcasecmp_P(name, Z_strings + pgm_read_word(&converter->name_offset))) { return idx; }   // discard hash collisions
+  }
+  return -1;
+}
+
 typedef union ZCLHeaderFrameControl_t {
   struct {
     uint8_t frame_type : 2;           // 00 = across entire profile, 01 = cluster specific
@@ -678,19 +755,17 @@ typedef union ZCLHeaderFrameControl_t {
 const __FlashStringHelper* zigbeeFindAttributeByName(const char *command,
                                     uint16_t *cluster, uint16_t *attribute, int8_t *multiplier,
                                     uint8_t *zigbee_type = nullptr, Z_Data_Type *data_type = nullptr, uint8_t *map_offset = nullptr) {
-  for (uint32_t i = 0; i < nitems(Z_PostProcess); i++) {
-    const Z_AttributeConverter *converter = &Z_PostProcess[i];
-    if (0 == pgm_read_word(&converter->name_offset)) { continue; }         // avoid strcasecmp_P() from crashing
-    if (0 == strcasecmp_P(command, Z_strings + pgm_read_word(&converter->name_offset))) {
-      if (cluster)      { *cluster    = CxToCluster(pgm_read_byte(&converter->cluster_short)); }
-      if (attribute)    { *attribute  = pgm_read_word(&converter->attribute); }
-      if (multiplier)   { *multiplier = CmToMultiplier(pgm_read_byte(&converter->multiplier_idx)); }
-      if (zigbee_type)  { *zigbee_type = pgm_read_byte(&converter->type); }
-      uint8_t conv_mapping = pgm_read_byte(&converter->mapping);
-      if (data_type)    { *data_type = (Z_Data_Type) ((conv_mapping & 0xF0)>>4); }
-      if (map_offset)   { *map_offset = (conv_mapping & 0x0F); }
-      return (const __FlashStringHelper*) (Z_strings + pgm_read_word(&converter->name_offset));
-    }
+  int32_t idx = Z_FindConverterByName(command, 0xFFFF);
+  if (idx >= 0) {
+    const Z_AttributeConverter *converter = &Z_PostProcess[idx];
+    if (cluster)      { *cluster    = CxToCluster(pgm_read_byte(&converter->cluster_short)); }
+    if (attribute)    { *attribute  = pgm_read_word(&converter->attribute); }
+    if (multiplier)   { *multiplier = CmToMultiplier(pgm_read_byte(&converter->multiplier_idx)); }
+    if (zigbee_type)  { *zigbee_type = pgm_read_byte(&converter->type); }
+    uint8_t conv_mapping = pgm_read_byte(&converter->mapping);
+    if (data_type)    { *data_type = (Z_Data_Type) ((conv_mapping & 0xF0)>>4); }
+    if (map_offset)   { *map_offset = (conv_mapping & 0x0F); }
+    return (const __FlashStringHelper*) (Z_strings + pgm_read_word(&converter->name_offset));
   }
   return nullptr;
 }
@@ -700,16 +775,12 @@ const __FlashStringHelper* zigbeeFindAttributeByName(const char *command,
 //
 const __FlashStringHelper* zigbeeFindAttributeById(uint16_t cluster, uint16_t attr_id,
                                       uint8_t *attr_type, int8_t *multiplier) {
-  for (uint32_t i = 0; i < nitems(Z_PostProcess); i++) {
-    const Z_AttributeConverter *converter = &Z_PostProcess[i];
-    uint16_t conv_cluster = CxToCluster(pgm_read_byte(&converter->cluster_short));
-    uint16_t conv_attr_id = pgm_read_word(&converter->attribute);
-
-    if ((conv_cluster == cluster) && (conv_attr_id == attr_id)) {
-      if (multiplier)   { *multiplier = CmToMultiplier(pgm_read_byte(&converter->multiplier_idx)); }
-      if (attr_type)    { *attr_type  = pgm_read_byte(&converter->type); }
-      return (const __FlashStringHelper*) (Z_strings + pgm_read_word(&converter->name_offset));
-    }
+  int32_t idx = Z_FindConverterById(cluster, attr_id);
+  if (idx >= 0) {
+    const Z_AttributeConverter *converter = &Z_PostProcess[idx];
+    if (multiplier)   { *multiplier = CmToMultiplier(pgm_read_byte(&converter->multiplier_idx)); }
+    if (attr_type)    { *attr_type  = pgm_read_byte(&converter->type); }
+    return (const __FlashStringHelper*) (Z_strings + pgm_read_word(&converter->name_offset));
   }
   return nullptr;
 }
@@ -1472,15 +1543,9 @@ void ZCLFrame::parseReadAttributes(Z_attribute_list& attr_list) {
     read_attr_ids[i/2] = attrid;
 
     // find the attribute name
-    for (uint32_t i = 0; i < nitems(Z_PostProcess); i++) {
-      const Z_AttributeConverter *converter = &Z_PostProcess[i];
-      uint16_t conv_cluster = CxToCluster(pgm_read_byte(&converter->cluster_short));
-      uint16_t conv_attribute = pgm_read_word(&converter->attribute);
-
-      if ((conv_cluster == _cluster_id) && (conv_attribute == attrid)) {
-        attr_names.addAttribute(Z_strings + pgm_read_word(&converter->name_offset), true).setBool(true);
-        break;
-      }
+    int32_t idx = Z_FindConverterById(_cluster_id, attrid);
+    if (idx >= 0) {
+      attr_names.addAttribute(Z_strings + pgm_read_word(&Z_PostProcess[idx].name_offset), true).setBool(true);
     }
     i += 2;
   }
@@ -1541,17 +1606,12 @@ void ZCLFrame::parseReadConfigAttributes(Z_attribute_list& attr_list) {
 
     // find the attribute name
     int8_t multiplier = 1;
-    for (uint32_t i = 0; i < nitems(Z_PostProcess); i++) {
-      const Z_AttributeConverter *converter = &Z_PostProcess[i];
-      uint16_t conv_cluster = CxToCluster(pgm_read_byte(&converter->cluster_short));
-      uint16_t conv_attribute = pgm_read_word(&converter->attribute);
-
-      if ((conv_cluster == _cluster_id) && (conv_attribute == attrid)) {
-        const char * attr_name = Z_strings + pgm_read_word(&converter->name_offset);
-        attr_2.addAttribute(attr_name, true).setBool(true);
-        multiplier = CmToMultiplier(pgm_read_byte(&converter->multiplier_idx));
-        break;
-      }
+    int32_t idx = Z_FindConverterById(_cluster_id, attrid);
+    if (idx >= 0) {
+      const Z_AttributeConverter *converter = &Z_PostProcess[idx];
+      const char * attr_name = Z_strings + pgm_read_word(&converter->name_offset);
+      attr_2.addAttribute(attr_name, true).setBool(true);
+      multiplier = CmToMultiplier(pgm_read_byte(&converter->multiplier_idx));
     }
     i += 4;
     if (0 != status) {
@@ -2015,22 +2075,19 @@ void Z_postProcessAttributes(uint16_t shortaddr, uint16_t src_ep, class Z_attrib
       uint8_t map_offset = 0;
       uint8_t zigbee_type = Znodata;
       int8_t conv_multiplier;
-      for (uint32_t i = 0; i < nitems(Z_PostProcess); i++) {
-        const Z_AttributeConverter *converter = &Z_PostProcess[i];
-        uint16_t conv_cluster = CxToCluster(pgm_read_byte(&converter->cluster_short));
-        uint16_t conv_attribute = pgm_read_word(&converter->attribute);
-
-        if ((conv_cluster == cluster) &&
-            ((conv_attribute == attribute) || (conv_attribute == 0xFFFF)) ) {
-          conv_multiplier = CmToMultiplier(pgm_read_byte(&converter->multiplier_idx));
-          zigbee_type = pgm_read_byte(&converter->type);
-          uint8_t mapping = pgm_read_byte(&converter->mapping);
-          map_type = (Z_Data_Type) ((mapping & 0xF0)>>4);
-          map_offset = (mapping & 0x0F);
-          conv_name = Z_strings + pgm_read_word(&converter->name_offset);
-          found = true;
-          break;
-        }
+      // exact attribute or 0xFFFF wildcard for the cluster, whichever comes first in Z_PostProcess
+      int32_t idx = Z_FindConverterById(cluster, attribute);
+      int32_t idx_any = Z_FindConverterById(cluster, 0xFFFF);
+      if ((idx < 0) || ((idx_any >= 0) && (idx_any < idx))) { idx = idx_any; }
+      if (idx >= 0) {
+        const Z_AttributeConverter *converter = &Z_PostProcess[idx];
+        conv_multiplier = CmToMultiplier(pgm_read_byte(&converter->multiplier_idx));
+        zigbee_type = pgm_read_byte(&converter->type);
+        uint8_t mapping = pgm_read_byte(&converter->mapping);
+        map_type = (Z_Data_Type) ((mapping & 0xF0)>>4);
+        map_offset = (mapping & 0x0F);
+        conv_name = Z_strings + pgm_read_word(&converter->name_offset);
+        found = true;
       }
 
       float    fval   = attr.getFloat();
@@ -2105,33 +2162,19 @@ void Z_postProcessAttributes(uint16_t shortaddr, uint16_t src_ep, class Z_attrib
 
 // Internal search function
 void Z_parseAttributeKey_inner(class Z_attribute & attr, uint16_t preferred_cluster) {
-  // scan attributes to find by name, and retrieve type
-  for (uint32_t i = 0; i < nitems(Z_PostProcess); i++) {
-    const Z_AttributeConverter *converter = &Z_PostProcess[i];
-    uint16_t local_attr_id = pgm_read_word(&converter->attribute);
-    uint16_t local_cluster_id = CxToCluster(pgm_read_byte(&converter->cluster_short));
-    uint8_t  local_type_id = pgm_read_byte(&converter->type);
-    int8_t   local_multiplier = CmToMultiplier(pgm_read_byte(&converter->multiplier_idx));
-    // AddLog(LOG_LEVEL_DEBUG, PSTR("Try cluster = 0x%04X, attr = 0x%04X, type_id = 0x%02X"), local_cluster_id, local_attr_id, local_type_id);
-
-    if (!attr.key_is_str) {
-      if ((attr.key.id.cluster == local_cluster_id) && (attr.key.id.attr_id == local_attr_id)) {
-        attr.attr_type = local_type_id;
-        break;
-      }
-    } else if (pgm_read_word(&converter->name_offset)) {
-      const char * key = attr.key.key;
-      // AddLog(LOG_LEVEL_DEBUG, PSTR("Comparing '%s' with '%s'"), attr_name, converter->name);
-      if (0 == strcasecmp_P(key, Z_strings + pgm_read_word(&converter->name_offset))) {
-        if ((preferred_cluster == 0xFFFF) ||    // any cluster
-            (local_cluster_id == preferred_cluster)) {
-          // match
-          attr.setKeyId(local_cluster_id, local_attr_id);
-          attr.attr_type = local_type_id;
-          attr.attr_multiplier = local_multiplier;
-          break;
-        }
-      }
+  // find attribute by id or by name, and retrieve type
+  if (!attr.key_is_str) {
+    int32_t idx = Z_FindConverterById(attr.key.id.cluster, attr.key.id.attr_id);
+    if (idx >= 0) {
+      attr.attr_type = pgm_read_byte(&Z_PostProcess[idx].type);
+    }
+  } else {
+    int32_t idx = Z_FindConverterByName(attr.key.key, preferred_cluster);
+    if (idx >= 0) {
+      const Z_AttributeConverter *converter = &Z_PostProcess[idx];
+      attr.setKeyId(CxToCluster(pgm_read_byte(&converter->cluster_short)), pgm_read_word(&converter->attribute));
+      attr.attr_type = pgm_read_byte(&converter->type);
+      attr.attr_multiplier = CmToMultiplier(pgm_read_byte(&converter->multiplier_idx));
     }
   }
 }
@@ -621,35 +621,33 @@ void ZbSendRead(JsonParserToken val_attr, ZCLMessage & zcl) {
       JsonParserToken value = key.getValue();
 
       bool found = false;
-      // scan attributes to find by name, and retrieve type
-      for (uint32_t i = 0; i < nitems(Z_PostProcess); i++) {
-        const Z_AttributeConverter *converter = &Z_PostProcess[i];
+      // find attribute by name, and retrieve type
+      int32_t idx = Z_FindConverterByName(key.getStr(), 0xFFFF);
+      if (idx >= 0) {
+        const Z_AttributeConverter *converter = &Z_PostProcess[idx];
         uint16_t local_attr_id = pgm_read_word(&converter->attribute);
         uint16_t local_cluster_id = CxToCluster(pgm_read_byte(&converter->cluster_short));
         // uint8_t  local_type_id = pgm_read_byte(&converter->type);
 
-        if ((pgm_read_word(&converter->name_offset)) && (0 == strcasecmp_P(key.getStr(), Z_strings + pgm_read_word(&converter->name_offset)))) {
-          // match name
-          // check if there is a conflict with cluster
-          // TODO
-          if (!(value.getBool()) && attr_item_offset) {
-            // If value is false (non-default) then set direction to 1 (for ReadConfig)
-            attrs[actual_attr_len] = 0x01;
-          }
-          actual_attr_len += attr_item_offset;
-          attrs[actual_attr_len++] = local_attr_id & 0xFF;
-          attrs[actual_attr_len++] = local_attr_id >> 8;
-          actual_attr_len += attr_item_len - 2 - attr_item_offset;    // normally 0
-          found = true;
-          // check cluster
-          if (!zcl.validCluster()) {
-            zcl.cluster = local_cluster_id;
-          } else if (zcl.cluster != local_cluster_id) {
-            ResponseCmndChar_P(PSTR(D_ZIGBEE_TOO_MANY_CLUSTERS));
-            if (attrs) { free(attrs); }
-            return;
-          }
-          break;    // found, exit loop
+        // match name
+        // check if there is a conflict with cluster
+        // TODO
+        if (!(value.getBool()) && attr_item_offset) {
+          // If value is false (non-default) then set direction to 1 (for ReadConfig)
+          attrs[actual_attr_len] = 0x01;
+        }
+        actual_attr_len += attr_item_offset;
+        attrs[actual_attr_len++] = local_attr_id & 0xFF;
+        attrs[actual_attr_len++] = local_attr_id >> 8;
+        actual_attr_len += attr_item_len - 2 - attr_item_offset;    // normally 0
+        found = true;
+        // check cluster
+        if (!zcl.validCluster()) {
+          zcl.cluster = local_cluster_id;
+        } else if (zcl.cluster != local_cluster_id) {
+          ResponseCmndChar_P(PSTR(D_ZIGBEE_TOO_MANY_CLUSTERS));
+          if (attrs) { free(attrs); }
+          return;
         }
       }
       if (!found) {
@@ -2129,23 +2127,25 @@ void ZigbeeShowMap(void) {
 \*********************************************************************************************/
 
 bool Xdrv23(uint8_t function) {
+  if (FUNC_PRE_INIT == function) {
+    XdrvSubscribe(XDRV_23, XFUNC_TICK(FUNC_LOOP));
+  }
+
   if (TasmotaGlobal.gpio_optiona.enable_ccloader) { return false; }
 
   bool result = false;
 
   if (zigbee.active) {
     switch (function) {
-      case FUNC_EVERY_50_MSECOND:
-        if (!zigbee.init_phase) {
-          zigbee_devices.runTimer();
-        }
-        break;
       case FUNC_LOOP:
 #ifdef USE_ZIGBEE_EZSP
         if (ZigbeeUploadXmodem()) {
           return false;
         }
 #endif
+        if (!zigbee.init_phase) {
+          zigbee_devices.runTimer();    // only the first deadline is checked when no timer is due
+        }
         if (ZigbeeSerial) {
           ZigbeeInputLoop();
           ZigbeeOutputLoop();   // send any outstanding data
@@ -232,6 +232,10 @@ void CmndBuzzer(void) {
 bool Xdrv24(uint8_t function) {
   bool result = false;
 
+  if (FUNC_PRE_INIT == function) {
+    XdrvSubscribe(XDRV_24, XFUNC_TICK(FUNC_EVERY_100_MSECOND));
+  }
+
   if (Buzzer.active) {
     switch (function) {
       case FUNC_EVERY_100_MSECOND:
@@ -122,6 +122,11 @@ void CmndSetRPM(void) {
 bool Xdrv25(uint8_t function)
 {
   bool result = false;
+
+  if (FUNC_PRE_INIT == function) {
+    XdrvSubscribe(XDRV_25, 0);              // No periodic functions
+  }
+
   if (PinUsed(GPIO_A4988_DIR) && PinUsed(GPIO_A4988_STP)) {
     switch (function) {
       case FUNC_INIT:
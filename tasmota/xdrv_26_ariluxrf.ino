@@ -174,6 +174,10 @@ bool Xdrv26(uint8_t function)
 {
   bool result = false;
 
+  if (FUNC_PRE_INIT == function) {
+    XdrvSubscribe(XDRV_26, XFUNC_TICK(FUNC_EVERY_50_MSECOND) | XFUNC_TICK(FUNC_EVERY_SECOND));
+  }
+
   switch (function) {
     case FUNC_EVERY_50_MSECOND:
       if (PinUsed(GPIO_ARIRFRCV)) { AriluxRfHandler(); }
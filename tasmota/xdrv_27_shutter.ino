@@ -1502,6 +1502,10 @@ bool Xdrv27(uint8_t function)
 {
   bool result = false;
 
+  if (FUNC_PRE_INIT == function) {
+    XdrvSubscribe(XDRV_27, XFUNC_TICK(FUNC_EVERY_50_MSECOND) | XFUNC_TICK(FUNC_EVERY_250_MSECOND) | XFUNC_TICK(FUNC_EVERY_SECOND));
+  }
+
   if (Settings->flag3.shutter_mode) {  // SetOption80 - Enable shutter support
     switch (function) {
       case FUNC_PRE_INIT:
@@ -315,6 +315,7 @@ bool Xdrv28(uint8_t function)
   bool result = false;
 
   if (FUNC_PRE_INIT == function) {
+    XdrvSubscribe(XDRV_28, XFUNC_TICK(FUNC_EVERY_50_MSECOND));
     Pcf8574Init();
   }
   else if (Pcf8574.type) {
@@ -199,6 +199,10 @@ bool Xdrv29(uint8_t function)
 {
   bool result = false;
 
+  if (FUNC_PRE_INIT == function) {
+    XdrvSubscribe(XDRV_29, XFUNC_TICK(FUNC_EVERY_SECOND));
+  }
+
   switch (function) {
     case FUNC_EVERY_SECOND:
       DeepSleepEverySecond();
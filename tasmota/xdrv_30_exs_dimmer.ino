@@ -589,6 +589,10 @@ bool Xdrv30(uint8_t function)
 {
   bool result = false;
 
+  if (FUNC_PRE_INIT == function) {
+    XdrvSubscribe(XDRV_30, XFUNC_TICK(FUNC_LOOP));
+  }
+
   if (EXS_DIMMER == TasmotaGlobal.module_type)
   {
     switch (function)
@@ -534,6 +534,10 @@ void TasmotaClient_ProcessIn(void) {
 bool Xdrv31(uint8_t function) {
   bool result = false;
 
+  if (FUNC_PRE_INIT == function) {
+    XdrvSubscribe(XDRV_31, XFUNC_TICK(FUNC_EVERY_100_MSECOND) | XFUNC_TICK(FUNC_EVERY_SECOND));
+  }
+
   switch (function) {
     case FUNC_EVERY_100_MSECOND:
       if (TClient.type) {
@@ -84,6 +84,10 @@ bool Xdrv32(uint8_t function)
 {
   bool result = false;
 
+  if (FUNC_PRE_INIT == function) {
+    XdrvSubscribe(XDRV_32, XFUNC_TICK(FUNC_EVERY_SECOND));
+  }
+
   switch (function) {
     case FUNC_EVERY_SECOND:
       HotPlugEverySecond();
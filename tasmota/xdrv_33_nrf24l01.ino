@@ -83,6 +83,10 @@ void NRF24Detect(void) {
 bool Xdrv33(uint8_t function) {
   bool result = false;
 
+  if (FUNC_PRE_INIT == function) {
+    XdrvSubscribe(XDRV_33, 0);              // No periodic functions
+  }
+
   if (FUNC_INIT == function) {
     NRF24Detect();
   }
@@ -270,6 +270,10 @@ void WMotorV2command(uint8_t *data, uint8_t len)    // process V2 request
 
 bool Xdrv34(uint8_t function)
 {
+  if (FUNC_PRE_INIT == function) {
+    XdrvSubscribe(XDRV_34, 0);              // No periodic functions
+  }
+
   if (!I2cEnabled(XI2C_44)) { return false; }
 
   bool result = false;
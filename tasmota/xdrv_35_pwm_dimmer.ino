@@ -725,6 +725,10 @@ bool Xdrv35(uint8_t function)
 {
   bool result = false;
 
+  if (FUNC_PRE_INIT == function) {
+    XdrvSubscribe(XDRV_35, XFUNC_TICK(FUNC_EVERY_SECOND));
+  }
+
   if (PWM_DIMMER != TasmotaGlobal.module_type) return result;
 
   switch (function) {
@@ -266,6 +266,10 @@ void KeeloqInit()
 \*********************************************************************************************/
 bool Xdrv36(uint8_t function)
 {
+  if (FUNC_PRE_INIT == function) {
+    XdrvSubscribe(XDRV_36, 0);              // No periodic functions
+  }
+
   if (!PinUsed(GPIO_CC1101_GDO0) || !PinUsed(GPIO_CC1101_GDO2)) { return false; }
 
   bool result = false;
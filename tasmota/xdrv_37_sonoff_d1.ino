@@ -177,6 +177,10 @@ bool Xdrv37(uint8_t function)
 {
   bool result = false;
 
+  if (FUNC_PRE_INIT == function) {
+    XdrvSubscribe(XDRV_37, 0);              // No periodic functions
+  }
+
   if (SONOFF_D1 == TasmotaGlobal.module_type) {
     switch (function) {
       case FUNC_SERIAL:
@@ -369,6 +369,10 @@ bool Xdrv38(uint8_t function)
 {
   bool result = false;
 
+  if (FUNC_PRE_INIT == function) {
+    XdrvSubscribe(XDRV_38, XFUNC_TICK(FUNC_EVERY_250_MSECOND));
+  }
+
   switch (function) {
     case FUNC_EVERY_250_MSECOND:
     PingResponsePoll();   // TODO
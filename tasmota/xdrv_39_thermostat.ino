@@ -1993,6 +1993,10 @@ bool Xdrv39(uint8_t function)
   bool result = false;
   uint8_t ctr_output;
 
+  if (FUNC_PRE_INIT == function) {
+    XdrvSubscribe(XDRV_39, XFUNC_TICK(FUNC_LOOP) | XFUNC_TICK(FUNC_EVERY_SECOND));
+  }
+
   switch (function) {
     case FUNC_INIT:
       for (ctr_output = 0; ctr_output < THERMOSTAT_CONTROLLER_OUTPUTS; ctr_output++) {
@@ -480,6 +480,10 @@ bool Xdrv40(uint8_t function)
 {
   bool result = false;
 
+  if (FUNC_PRE_INIT == function) {
+    XdrvSubscribe(XDRV_40, XFUNC_TICK(FUNC_EVERY_SECOND));
+  }
+
   switch (function) {
     case FUNC_EVERY_SECOND:
       TelegramLoop();
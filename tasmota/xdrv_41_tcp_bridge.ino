@@ -184,6 +184,10 @@ bool Xdrv41(uint8_t function)
 {
   bool result = false;
 
+  if (FUNC_PRE_INIT == function) {
+    XdrvSubscribe(XDRV_41, XFUNC_TICK(FUNC_LOOP));
+  }
+
   switch (function) {
     case FUNC_LOOP:
       TCPLoop();
@@ -732,6 +732,10 @@ void Cmd_Time(void) {
 bool Xdrv42(uint8_t function) {
   bool result = false;
 
+  if (FUNC_PRE_INIT == function) {
+    XdrvSubscribe(XDRV_42, 0);              // No periodic functions
+  }
+
   switch (function) {
     case FUNC_COMMAND:
       result = DecodeCommand(kI2SAudio_Commands, I2SAudio_Command);
@@ -595,6 +595,10 @@ bool Xdrv43(uint8_t function)
 {
   bool result = false;
 
+  if (FUNC_PRE_INIT == function) {
+    XdrvSubscribe(XDRV_43, XFUNC_TICK(FUNC_EVERY_100_MSECOND));
+  }
+
   if (FUNC_INIT == function) {
     MLX90640init();
   }
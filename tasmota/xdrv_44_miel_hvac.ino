@@ -1240,6 +1240,11 @@ static void (*const miel_hvac_cmnds[])(void) PROGMEM = {
 
 bool Xdrv44(uint8_t function) {
 	bool result = false;
+
+  if (FUNC_PRE_INIT == function) {
+    XdrvSubscribe(XDRV_44, XFUNC_TICK(FUNC_LOOP) | XFUNC_TICK(FUNC_EVERY_50_MSECOND) | XFUNC_TICK(FUNC_EVERY_100_MSECOND) | XFUNC_TICK(FUNC_EVERY_200_MSECOND) | XFUNC_TICK(FUNC_EVERY_250_MSECOND) | XFUNC_TICK(FUNC_EVERY_SECOND));
+  }
+
 	struct miel_hvac_softc *sc = miel_hvac_sc;
 
 	switch (function) {
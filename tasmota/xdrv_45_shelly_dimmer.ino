@@ -867,6 +867,10 @@ bool Xnrg31(uint8_t function) {
 bool Xdrv45(uint8_t function) {
   bool result = false;
 
+  if (FUNC_PRE_INIT == function) {
+    XdrvSubscribe(XDRV_45, XFUNC_TICK(FUNC_EVERY_SECOND));
+  }
+
   if (FUNC_MODULE_INIT == function) {
     result = ShdModuleSelected();
   } else if (Shd.present) {
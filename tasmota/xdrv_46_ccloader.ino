@@ -670,6 +670,10 @@ void CCLoadershow(bool json) {
 \*********************************************************************************************/
 
 bool Xdrv46(uint8_t function) {
+  if (FUNC_PRE_INIT == function) {
+    XdrvSubscribe(XDRV_46, XFUNC_TICK(FUNC_EVERY_100_MSECOND));
+  }
+
   if (!TasmotaGlobal.gpio_optiona.enable_ccloader) { return false; }
 
   bool result = false;
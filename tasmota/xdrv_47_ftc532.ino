@@ -218,6 +218,10 @@ void ftc532_publish(void) {
 bool Xdrv47(uint8_t function) {
   bool result = false;
 
+  if (FUNC_PRE_INIT == function) {
+    XdrvSubscribe(XDRV_47, XFUNC_TICK(FUNC_EVERY_50_MSECOND));
+  }
+
   if (FUNC_INIT == function) {
     // Initialize driver
     ftc532_init();
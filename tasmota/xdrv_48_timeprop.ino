@@ -228,6 +228,10 @@ bool TimepropCommand()
 bool Xdrv48(byte function) {
   bool result = false;
 
+  if (FUNC_PRE_INIT == function) {
+    XdrvSubscribe(XDRV_48, XFUNC_TICK(FUNC_EVERY_SECOND));
+  }
+
   switch (function) {
     case FUNC_INIT:
       TimepropInit();
@@ -418,6 +418,10 @@ void PIDRun(void) {
 bool Xdrv49(byte function) {
   bool result = false;
 
+  if (FUNC_PRE_INIT == function) {
+    XdrvSubscribe(XDRV_49, XFUNC_TICK(FUNC_EVERY_SECOND));
+  }
+
   switch (function) {
     case FUNC_INIT:
       PIDInit();
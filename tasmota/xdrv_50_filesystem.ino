@@ -1027,6 +1027,10 @@ void UfsEditorUpload(void) {
 bool Xdrv50(uint8_t function) {
   bool result = false;
 
+  if (FUNC_PRE_INIT == function) {
+    XdrvSubscribe(XDRV_50, XFUNC_TICK(FUNC_LOOP));
+  }
+
   switch (function) {
     case FUNC_LOOP:
       UfsExecuteCommandFileLoop();
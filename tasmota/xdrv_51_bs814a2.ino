@@ -169,6 +169,10 @@ void bs814_publish(void) {
 bool Xdrv51(uint8_t function) {
   bool result = false;
 
+  if (FUNC_PRE_INIT == function) {
+    XdrvSubscribe(XDRV_51, XFUNC_TICK(FUNC_EVERY_50_MSECOND));
+  }
+
   if (FUNC_INIT == function) {
     // Initialize driver
     bs814_init();
@@ -24,6 +24,10 @@
 
 #define BERRY_CONSOLE_CMD_DELIMITER   "\x01"
 
+#ifndef BERRY_GC_STEP_WORK
+#define BERRY_GC_STEP_WORK            400   // objects scanned or swept by the GC every 50ms
+#endif
+
 typedef LList_elt<char[0]> log_elt;   // store the string after the header to avoid double allocation if we had used char*
 
 class BerryLog {
@@ -48,6 +52,90 @@ public:
   LList<char[0]> log;
 };
 
+// Rule registered with `tasmota.add_rule()`, the pattern is compiled once
+// and matched natively against each rule event
+class BerryRule {
+public:
+  ~BerryRule() { free(pattern); free(name); free(path); }
+  bool compile(const char * pat);
+  bool match(JsonParserToken & val) const;
+
+  char * pattern = nullptr;             // pattern as registered, key in `tasmota._rules`
+  char * name = nullptr;                // trigger part of the pattern, i.e. "Dimmer#State"
+  char * path = nullptr;                // keys of the trigger separated by '\0'
+  const char * operand = nullptr;       // right part of the compare expression, points into `pattern`
+  float value = 0;                      // operand converted to number
+  uint8_t depth = 0;                    // number of keys in `path`
+  int8_t op = -1;                       // compare operator (index in kBerryRuleOps) or -1 if none
+};
+
+// Cron entry registered with `tasmota.add_cron()`, each field of the pattern
+// "sec min hour day month weekday" is compiled to a bit mask
+class BerryCron {
+public:
+  bool compile(const char * pattern);
+  bool match(const struct TIME_T & t) const;
+
+  uint64_t second = 0;
+  uint64_t minute = 0;
+  uint32_t hour = 0;
+  uint32_t day = 0;                     // day of month, bits 1..31
+  uint16_t month = 0;                   // bits 1..12
+  uint8_t weekday = 0;                  // bits 0..6, sunday is 0
+  bool pending = false;                 // matched, waiting for `tasmota.run_deferred()`
+  int32_t id = 0;                       // key of the function in `tasmota._timers`
+};
+
+// Timers of `tasmota.set_timer()` in a binary min-heap ordered by deadline,
+// only the top of the heap is checked by the main loop
+class BerryTimers {
+public:
+  typedef struct {
+    uint32_t due;                       // millis() deadline
+    int32_t id;                         // key of the function in `tasmota._timers`
+  } timer_t;
+
+  ~BerryTimers() { free(heap); }
+  bool add(uint32_t due, int32_t id);
+  bool remove(int32_t id);
+  int32_t pop(void);
+  // is the first timer due, timers created after `last_id` wait for the next run
+  inline bool expired(int32_t last_id = INT32_MAX) const {
+    return size && TimeReached(heap[0].due) && (heap[0].id <= last_id);
+  }
+  void checkCrons(void);
+  void reset(void) { size = 0; crons.reset(); cron_pending = false; }
+
+  timer_t * heap = nullptr;
+  uint32_t size = 0;
+  uint32_t capacity = 0;
+  int32_t next_id = 1;                  // ids are shared by timers and crons
+  LList<BerryCron> crons;
+  uint32_t cron_time = 0;               // local time of the last cron check
+  bool cron_pending = false;            // at least one cron matched
+
+private:
+  void place(uint32_t i, timer_t t);
+};
+
+// Driver events dispatched natively to the methods of `tasmota.add_driver()`,
+// the index is the position of the hooks list in `tasmota._events`
+const char kBerryDriverEvents[] PROGMEM =
+  "every_second|every_100ms|web_add_button|web_add_main_button|web_add_management_button|"
+  "web_add_config_button|web_add_console_button|save_before_restart|web_add_handler|"
+  "web_sensor|json_append|button_pressed|display";
+enum BerryDriverEvents { BERRY_EVENT_EVERY_SECOND, BERRY_EVENT_EVERY_100MS, BERRY_EVENT_WEB_ADD_BUTTON,
+                         BERRY_EVENT_WEB_ADD_MAIN_BUTTON, BERRY_EVENT_WEB_ADD_MANAGEMENT_BUTTON,
+                         BERRY_EVENT_WEB_ADD_CONFIG_BUTTON, BERRY_EVENT_WEB_ADD_CONSOLE_BUTTON,
+                         BERRY_EVENT_SAVE_BEFORE_RESTART, BERRY_EVENT_WEB_ADD_HANDLER,
+                         BERRY_EVENT_WEB_SENSOR, BERRY_EVENT_JSON_APPEND, BERRY_EVENT_BUTTON_PRESSED,
+                         BERRY_EVENT_DISPLAY, BERRY_DRIVER_EVENTS };
+
+// Event types of `tasmota.event()`, interned once per VM so that callBerryEventDispatcher()
+// pushes them without creating the string again
+const char kBerryEventTypes[] PROGMEM = "cmd|rule|mqtt_data|gc";
+enum BerryEventTypes { BERRY_EVENT_CMD, BERRY_EVENT_RULE, BERRY_EVENT_MQTT_DATA, BERRY_EVENT_GC, BERRY_EVENT_TYPES };
+
 class BerrySupport {
 public:
   bvm *vm = nullptr;                    // berry vm
@@ -57,6 +145,10 @@ public:
   // output log is stored as a LinkedList of buffers
   // and active only when a REPL command is running
   BerryLog log;
+  LList<BerryRule> rules;               // compiled rules of `tasmota.add_rule()`
+  BerryTimers timers;                   // timers and crons of `tasmota.set_timer()` and `tasmota.add_cron()`
+  uint16_t driver_hooks[BERRY_DRIVER_EVENTS] = {};  // number of drivers with a method for each event
+  struct bstring * event_types[BERRY_EVENT_TYPES] = {};  // interned names of kBerryEventTypes
 };
 BerrySupport berry;
 
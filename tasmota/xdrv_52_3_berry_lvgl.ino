@@ -964,7 +964,7 @@ extern "C" {
       style = (lv_style_t*) be_convert_single_elt(vm, 2);
     }
     if (style == nullptr) {
-      style = (lv_style_t*) be_malloc(vm, sizeof(lv_style_t));
+      style = (lv_style_t*) be_os_malloc(sizeof(lv_style_t));   // not from the VM pool, the style is kept by LVGL
       if (style != nullptr) {
         lv_style_init(style);
       }
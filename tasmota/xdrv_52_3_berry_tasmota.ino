@@ -388,6 +388,675 @@ extern "C" {
 
 }
 
+/*********************************************************************************************\
+ * Rules
+ *
+ * Patterns are compiled by `tasmota.add_rule()` and matched natively against the
+ * event JSON, Berry is only called for the rules that fire.
+ *
+ * tasmota.add_rule(pattern:string, f:function) -> nil
+ * tasmota.remove_rule(pattern:string) -> nil
+ * tasmota.exec_rules(event:string) -> bool
+ *
+\*********************************************************************************************/
+const char kBerryRuleOps[] PROGMEM = "==|!==|=|!=|>|>=|<|<=";
+enum BerryRuleOps { BERRY_RULE_STR_EQ, BERRY_RULE_STR_NE, BERRY_RULE_EQ, BERRY_RULE_NE,
+                    BERRY_RULE_GT, BERRY_RULE_GE, BERRY_RULE_LT, BERRY_RULE_LE };
+
+// Split the pattern in trigger, compare operator and operand, i.e. "Dimmer#State>50"
+// Returns false if out of memory or if the compare operator is unknown, i.e. "Dimmer#State=>50"
+bool BerryRule::compile(const char * pat) {
+  pattern = strdup(pat);
+  if (nullptr == pattern) { return false; }
+  size_t name_len = strcspn(pattern, "=<>!");
+  size_t op_len = strspn(pattern + name_len, "=<>!");
+  operand = pattern + name_len + op_len;
+  if ((0 == op_len) || (0 == *operand)) {   // no operand, the whole pattern is the trigger
+    name_len = strlen(pattern);
+  } else {
+    char op_str[4];
+    char op_found[4];
+    if (op_len >= sizeof(op_str)) { return false; }
+    strlcpy(op_str, pattern + name_len, op_len + 1);
+    op = GetCommandCode(op_found, sizeof(op_found), op_str, kBerryRuleOps);
+    if (op < 0) { return false; }
+    value = CharToFloat(operand);
+  }
+  name = strndup(pattern, name_len);
+  path = strndup(pattern, name_len);
+  if ((nullptr == name) || (nullptr == path)) { return false; }
+  depth = 1;
+  for (char * p = path; *p; p++) {
+    if ('#' == *p) { *p = '\0'; depth++; }
+  }
+  return true;
+}
+
+// Walk the keys of the trigger from `val` and compare the value found, which is returned in `val`.
+// Keys are case insensitive and '?' matches any key
+bool BerryRule::match(JsonParserToken & val) const {
+  const char * key = path;
+  for (uint32_t i = 0; i < depth; i++) {
+    val = JsonParserObject(val)[key];
+    if (!val) { return false; }
+    key += strlen(key) + 1;
+  }
+  switch (op) {
+    case BERRY_RULE_STR_EQ: return (0 == strcmp(val.getStr(), operand));
+    case BERRY_RULE_STR_NE: return (0 != strcmp(val.getStr(), operand));
+    case BERRY_RULE_EQ:     return (val.getFloat() == value);
+    case BERRY_RULE_NE:     return (val.getFloat() != value);
+    case BERRY_RULE_GT:     return (val.getFloat() > value);
+    case BERRY_RULE_GE:     return (val.getFloat() >= value);
+    case BERRY_RULE_LT:     return (val.getFloat() < value);
+    case BERRY_RULE_LE:     return (val.getFloat() <= value);
+  }
+  return true;    // no compare operator
+}
+
+BerryRule * BerryRuleFind(const char * pattern);
+BerryRule * BerryRuleFind(const char * pattern) {
+  for (auto & rule : berry.rules) {
+    if (0 == strcmp(rule.pattern, pattern)) { return &rule; }
+  }
+  return nullptr;
+}
+
+// Push a JSON value as Berry value, objects and arrays are converted to map and list
+void BerryPushJson(bvm *vm, const JsonParserToken & tok);
+void BerryPushJson(bvm *vm, const JsonParserToken & tok) {
+  be_stack_require(vm, 4);
+  if (tok.isObject()) {
+    be_newobject(vm, "map");
+    for (const auto key : JsonParserObject(tok)) {
+      be_pushstring(vm, key.getStr());
+      BerryPushJson(vm, key.getValue());
+      be_data_insert(vm, -3);
+      be_pop(vm, 2);
+    }
+    be_pop(vm, 1);
+  } else if (tok.isArray()) {
+    be_newobject(vm, "list");
+    for (const auto elt : JsonParserArray(tok)) {
+      BerryPushJson(vm, elt);
+      be_data_push(vm, -2);
+      be_pop(vm, 1);
+    }
+    be_pop(vm, 1);
+  } else if (tok.isStr()) {
+    be_pushstring(vm, tok.getStr());
+  } else if (tok.isBool()) {
+    be_pushbool(vm, tok.getBool());
+  } else if (tok.isInt() || tok.isUint()) {
+    be_pushint(vm, tok.getInt());
+  } else if (tok.isFloat()) {
+    be_pushreal(vm, tok.getFloat());
+  } else {
+    be_pushnil(vm);
+  }
+}
+
+// Match the compiled rules against the event. For each rule that fires, push its function
+// (found in the raw map of `_rules` at `rules_idx`), the value found and the trigger name,
+// then push the whole event. Returns the number of rules fired.
+// Nothing is called here: the JSON parser buffer is global and Berry could parse another event.
+int32_t BerryRulesMatch(bvm *vm, int32_t rules_idx, const char * event_json);
+int32_t BerryRulesMatch(bvm *vm, int32_t rules_idx, const char * event_json) {
+  String event_saved = event_json;    // the parser modifies the buffer
+  JsonParser parser((char*)event_saved.c_str());
+  JsonParserObject root = parser.getRootObject();
+  if (!root) {
+    AddLog(LOG_LEVEL_INFO, PSTR(D_LOG_BERRY "ERROR, bad json: %s"), event_json);
+    return 0;
+  }
+  int32_t fired = 0;
+  for (const auto & rule : berry.rules) {
+    JsonParserToken val = root;
+    if (!rule.match(val)) { continue; }
+    be_stack_require(vm, 4);
+    be_pushstring(vm, rule.pattern);
+    if (!be_getindex(vm, rules_idx) || !be_isfunction(vm, -1)) {
+      be_pop(vm, 2);    // removed from `_rules` behind our back
+      continue;
+    }
+    be_remove(vm, -2);  // keep the function only
+    BerryPushJson(vm, val);
+    be_pushstring(vm, rule.name);
+    fired++;
+  }
+  if (fired) {
+    BerryPushJson(vm, root);
+  }
+  return fired;
+}
+
+extern "C" {
+  // Berry: `tasmota.add_rule(pattern:string, f:function) -> nil`
+  //
+  int32_t l_addRule(bvm *vm);
+  int32_t l_addRule(bvm *vm) {
+    int32_t top = be_top(vm); // Get the number of arguments
+    if (top == 3 && be_isstring(vm, 2)) {
+      if (!be_isfunction(vm, 3)) {
+        be_raise(vm, "value_error", "the second argument is not a function");
+      }
+      const char * pattern = be_tostring(vm, 2);
+      if (nullptr == BerryRuleFind(pattern)) {
+        BerryRule & rule = berry.rules.addToLast();
+        if (!rule.compile(pattern)) {
+          berry.rules.remove(&rule);
+          be_raise(vm, "value_error", "invalid rule pattern");
+        }
+      }
+      // the function is kept in `_rules` so that it stays referenced
+      be_getmember(vm, 1, "_rules");
+      if (!be_isinstance(vm, -1)) {
+        be_pop(vm, 1);
+        be_newobject(vm, "map");
+        be_pop(vm, 1);
+        be_setmember(vm, 1, "_rules");
+      }
+      be_getmember(vm, -1, ".p");
+      be_pushvalue(vm, 2);
+      be_pushvalue(vm, 3);
+      be_setindex(vm, -3);
+      be_pop(vm, 4);
+      be_return_nil(vm);
+    }
+    be_raise(vm, kTypeError, nullptr);
+  }
+
+  // Berry: `tasmota.remove_rule(pattern:string) -> nil`
+  //
+  int32_t l_removeRule(bvm *vm);
+  int32_t l_removeRule(bvm *vm) {
+    int32_t top = be_top(vm); // Get the number of arguments
+    if (top == 2 && be_isstring(vm, 2)) {
+      berry.rules.remove(BerryRuleFind(be_tostring(vm, 2)));
+      be_getmember(vm, 1, "_rules");
+      if (be_isinstance(vm, -1)) {
+        be_getmember(vm, -1, ".p");
+        be_pushvalue(vm, 2);
+        be_data_remove(vm, -2);
+        be_pop(vm, 2);
+      }
+      be_pop(vm, 1);
+      be_return_nil(vm);
+    }
+    be_raise(vm, kTypeError, nullptr);
+  }
+
+  // Berry: `tasmota.exec_rules(event:string) -> bool`
+  // Calls `f(value, trigger, event)` for each rule that fires, returns true if any fired
+  //
+  int32_t l_execRules(bvm *vm);
+  int32_t l_execRules(bvm *vm) {
+    int32_t top = be_top(vm); // Get the number of arguments
+    if (top == 2 && be_isstring(vm, 2)) {
+      int32_t fired = 0;
+      be_getmember(vm, 1, "_rules");
+      if (!berry.rules.isEmpty() && be_isinstance(vm, -1)) {
+        be_getmember(vm, -1, ".p");
+        int32_t base = be_top(vm);        // index of the raw map
+        fired = BerryRulesMatch(vm, base, be_tostring(vm, 2));
+        int32_t event = base + 3 * fired + 1;
+        for (int32_t i = 0; i < fired; i++) {
+          be_pushvalue(vm, base + 3 * i + 1);   // function
+          be_pushvalue(vm, base + 3 * i + 2);   // value
+          be_pushvalue(vm, base + 3 * i + 3);   // trigger
+          be_pushvalue(vm, event);
+          be_call(vm, 3);
+          be_pop(vm, 4);
+        }
+      }
+      be_pushbool(vm, fired > 0);
+      be_return(vm);
+    }
+    be_raise(vm, kTypeError, nullptr);
+  }
+}
+
+/*********************************************************************************************\
+ * Timers and crons
+ *
+ * Timers are kept in a native min-heap, the main loop only checks the first deadline
+ * and Berry is entered when a timer or a cron is due. Functions are kept in
+ * `tasmota._timers` (map id -> function) so that they stay referenced.
+ *
+ * tasmota.set_timer(delay_ms:int, f:function) -> int (id)
+ * tasmota.add_cron(pattern:string, f:function) -> int (id)
+ *    pattern is "sec min hour day month weekday" as with crontab, i.e. "0 30 8-18/2 * * 1-5"
+ * tasmota.remove_timer(id:int) -> nil, removes a timer or a cron
+ * tasmota.run_deferred() -> nil, calls the functions of the timers and crons due
+ *
+\*********************************************************************************************/
+// a timer is before another if its deadline is earlier, or equal and created first
+inline bool BerryTimerBefore(const BerryTimers::timer_t & a, const BerryTimers::timer_t & b) {
+  int32_t diff = TimeDifference(b.due, a.due);
+  return (diff < 0) || ((0 == diff) && (a.id < b.id));
+}
+
+// Put `t` at the free slot `i`, moving it up or down to keep the heap ordered
+void BerryTimers::place(uint32_t i, timer_t t) {
+  while (i > 0) {                           // sift up
+    uint32_t parent = (i - 1) / 2;
+    if (!BerryTimerBefore(t, heap[parent])) { break; }
+    heap[i] = heap[parent];
+    i = parent;
+  }
+  while (true) {                            // sift down
+    uint32_t child = 2 * i + 1;
+    if (child >= size) { break; }
+    if ((child + 1 < size) && BerryTimerBefore(heap[child + 1], heap[child])) { child++; }
+    if (!BerryTimerBefore(heap[child], t)) { break; }
+    heap[i] = heap[child];
+    i = child;
+  }
+  heap[i] = t;
+}
+
+bool BerryTimers::add(uint32_t due, int32_t id) {
+  if (size >= capacity) {
+    uint32_t new_capacity = capacity ? capacity * 2 : 8;
+    timer_t * new_heap = (timer_t*) realloc(heap, new_capacity * sizeof(timer_t));
+    if (nullptr == new_heap) { return false; }
+    heap = new_heap;
+    capacity = new_capacity;
+  }
+  size++;
+  place(size - 1, { due, id });
+  return true;
+}
+
+// Remove the timer or the cron `id`, returns false if not found
+bool BerryTimers::remove(int32_t id) {
+  for (uint32_t i = 0; i < size; i++) {
+    if (heap[i].id == id) {
+      size--;
+      if (i < size) { place(i, heap[size]); }
+      return true;
+    }
+  }
+  for (auto & cron : crons) {
+    if (cron.id == id) {
+      crons.remove(&cron);
+      return true;
+    }
+  }
+  return false;
+}
+
+// Remove the first timer and return its id
+int32_t BerryTimers::pop(void) {
+  int32_t id = heap[0].id;
+  size--;
+  if (size) { place(0, heap[size]); }
+  return id;
+}
+
+// Mark the crons matching the local time. Each second since the last check is matched so that
+// a stalled loop doesn't skip crons, a longer gap or a clock change only matches the current second
+void BerryTimers::checkCrons(void) {
+  const uint32_t max_catch_up = 60;         // seconds
+  uint32_t now = Rtc.local_time;
+  if (!RtcTime.valid || (now == cron_time)) { return; }
+  uint32_t time = ((now > cron_time) && (now - cron_time <= max_catch_up)) ? cron_time + 1 : now;
+  cron_time = now;
+  if (crons.isEmpty()) { return; }
+  TIME_T t;
+  for (; time <= now; time++) {
+    BreakTime(time, t);
+    for (auto & cron : crons) {
+      if (cron.match(t)) {
+        cron.pending = true;
+        cron_pending = true;
+      }
+    }
+  }
+}
+
+// Parse one field of a cron pattern into a bit mask, `*pp` is moved after the field
+bool BerryCronField(const char ** pp, uint32_t lo, uint32_t hi, uint64_t * mask);
+bool BerryCronField(const char ** pp, uint32_t lo, uint32_t hi, uint64_t * mask) {
+  char * p = (char*) *pp;
+  *mask = 0;
+  while (true) {
+    uint32_t from = lo;
+    uint32_t to = hi;
+    uint32_t step = 1;
+    if ('*' == *p) {
+      p++;
+    } else {
+      if (!isdigit(*p)) { return false; }
+      from = to = strtoul(p, &p, 10);
+      if ('-' == *p) {
+        p++;
+        if (!isdigit(*p)) { return false; }
+        to = strtoul(p, &p, 10);
+      }
+    }
+    if ('/' == *p) {
+      p++;
+      if (!isdigit(*p)) { return false; }
+      step = strtoul(p, &p, 10);
+      if (0 == step) { return false; }
+      if (from == to) { to = hi; }          // "5/10" is "5-max/10"
+    }
+    if ((from < lo) || (to > hi) || (from > to)) { return false; }
+    for (uint32_t i = from; i <= to; i += step) {
+      *mask |= 1ULL << i;
+    }
+    if (',' != *p) { break; }
+    p++;
+  }
+  *pp = p;
+  return true;
+}
+
+bool BerryCron::compile(const char * pattern) {
+  static const uint8_t limits[6][2] = { {0, 59}, {0, 59}, {0, 23}, {1, 31}, {1, 12}, {0, 7} };
+  uint64_t masks[6];
+  const char * p = pattern;
+  for (uint32_t i = 0; i < 6; i++) {
+    while (' ' == *p) { p++; }
+    if (!BerryCronField(&p, limits[i][0], limits[i][1], &masks[i])) { return false; }
+    if (*p && (' ' != *p)) { return false; }
+  }
+  while (' ' == *p) { p++; }
+  if (*p) { return false; }                 // more than 6 fields
+  second = masks[0];
+  minute = masks[1];
+  hour = masks[2];
+  day = masks[3];
+  month = masks[4];
+  weekday = (masks[5] | (masks[5] >> 7)) & 0x7F;    // 7 is sunday too
+  return true;
+}
+
+// As with crontab, when both day and weekday are restricted either one matches
+bool BerryCron::match(const struct TIME_T & t) const {
+  if (!(second & (1ULL << t.second)) || !(minute & (1ULL << t.minute)) ||
+      !(hour & (1UL << t.hour)) || !(month & (1 << t.month))) {
+    return false;
+  }
+  bool day_match = day & (1UL << t.day_of_month);
+  bool weekday_match = weekday & (1 << (t.day_of_week - 1));
+  if ((0xFFFFFFFE == day) || (0x7F == weekday)) {
+    return day_match && weekday_match;
+  }
+  return day_match || weekday_match;
+}
+
+// Store `f` at index 3 in `tasmota._timers` with key `id`
+void BerryTimerStore(bvm *vm, int32_t id);
+void BerryTimerStore(bvm *vm, int32_t id) {
+  be_getmember(vm, 1, "_timers");
+  if (!be_isinstance(vm, -1)) {
+    be_pop(vm, 1);
+    be_newobject(vm, "map");
+    be_pop(vm, 1);
+    be_setmember(vm, 1, "_timers");
+  }
+  be_getmember(vm, -1, ".p");
+  be_pushint(vm, id);
+  be_pushvalue(vm, 3);
+  be_setindex(vm, -3);
+  be_pop(vm, 4);
+}
+
+// Push the function of `id` from the raw map at `map_idx`, and remove it from the map if `once`
+void BerryTimerPush(bvm *vm, int32_t map_idx, int32_t id, bool once);
+void BerryTimerPush(bvm *vm, int32_t map_idx, int32_t id, bool once) {
+  be_stack_require(vm, 3);
+  be_pushint(vm, id);
+  be_getindex(vm, map_idx);
+  if (once) {
+    be_pushvalue(vm, -2);
+    be_data_remove(vm, map_idx);
+    be_pop(vm, 1);
+  }
+  be_remove(vm, -2);                        // keep the function only
+}
+
+// Call the function on top of the stack and pop it, an exception is logged and doesn't stop the next functions
+void BerryTimerCall(bvm *vm);
+void BerryTimerCall(bvm *vm) {
+  int32_t top = be_top(vm);
+  if (be_isfunction(vm, -1) && (be_pcall(vm, 0) != 0)) {
+    AddLog(LOG_LEVEL_ERROR, PSTR(D_LOG_BERRY "Exception> '%s' - %s"), be_tostring(vm, top + 1), be_tostring(vm, top + 2));
+    be_pop(vm, be_top(vm) - top);
+  }
+  be_pop(vm, 1);
+}
+
+extern "C" {
+  // Berry: `tasmota.set_timer(delay_ms:int, f:function) -> int`
+  //
+  int32_t l_setTimer(bvm *vm);
+  int32_t l_setTimer(bvm *vm) {
+    int32_t top = be_top(vm); // Get the number of arguments
+    if (top == 3 && be_isnumber(vm, 2)) {
+      if (!be_isfunction(vm, 3)) {
+        be_raise(vm, "value_error", "the second argument is not a function");
+      }
+      int32_t id = berry.timers.next_id++;
+      if (!berry.timers.add(millis() + be_toint(vm, 2), id)) {
+        be_raise(vm, "memory_error", nullptr);
+      }
+      BerryTimerStore(vm, id);
+      be_pushint(vm, id);
+      be_return(vm);
+    }
+    be_raise(vm, kTypeError, nullptr);
+  }
+
+  // Berry: `tasmota.add_cron(pattern:string, f:function) -> int`
+  //
+  int32_t l_addCron(bvm *vm);
+  int32_t l_addCron(bvm *vm) {
+    int32_t top = be_top(vm); // Get the number of arguments
+    if (top == 3 && be_isstring(vm, 2)) {
+      if (!be_isfunction(vm, 3)) {
+        be_raise(vm, "value_error", "the second argument is not a function");
+      }
+      BerryCron & cron = berry.timers.crons.addToLast();
+      if (!cron.compile(be_tostring(vm, 2))) {
+        berry.timers.crons.remove(&cron);
+        be_raise(vm, "value_error", "invalid cron pattern");
+      }
+      cron.id = berry.timers.next_id++;
+      BerryTimerStore(vm, cron.id);
+      be_pushint(vm, cron.id);
+      be_return(vm);
+    }
+    be_raise(vm, kTypeError, nullptr);
+  }
+
+  // Berry: `tasmota.remove_timer(id:int) -> nil`
+  //
+  int32_t l_removeTimer(bvm *vm);
+  int32_t l_removeTimer(bvm *vm) {
+    int32_t top = be_top(vm); // Get the number of arguments
+    if (top == 2 && be_isint(vm, 2)) {
+      if (berry.timers.remove(be_toint(vm, 2))) {
+        be_getmember(vm, 1, "_timers");
+        if (be_isinstance(vm, -1)) {
+          be_getmember(vm, -1, ".p");
+          be_pushvalue(vm, 2);
+          be_data_remove(vm, -2);
+          be_pop(vm, 2);
+        }
+        be_pop(vm, 1);
+      }
+      be_return_nil(vm);
+    }
+    be_raise(vm, kTypeError, nullptr);
+  }
+
+  // Berry: `tasmota.run_deferred() -> nil`
+  // Timers created by the functions called wait for the next run
+  //
+  int32_t l_runDeferred(bvm *vm);
+  int32_t l_runDeferred(bvm *vm) {
+    be_getmember(vm, 1, "_timers");
+    if (be_isinstance(vm, -1)) {
+      be_getmember(vm, -1, ".p");
+      int32_t map_idx = be_top(vm);
+      int32_t last_id = berry.timers.next_id - 1;
+      while (berry.timers.expired(last_id)) {
+        BerryTimerPush(vm, map_idx, berry.timers.pop(), true);
+        BerryTimerCall(vm);
+      }
+      while (berry.timers.cron_pending) {   // a function can remove crons, look for the next pending from start
+        berry.timers.cron_pending = false;
+        for (auto & cron : berry.timers.crons) {
+          if (cron.pending) {
+            cron.pending = false;
+            berry.timers.cron_pending = true;
+            BerryTimerPush(vm, map_idx, cron.id, false);
+            BerryTimerCall(vm);
+            break;
+          }
+        }
+      }
+      be_pop(vm, 1);
+    }
+    be_pop(vm, 1);
+    be_return_nil(vm);
+  }
+}
+
+/*********************************************************************************************\
+ * Drivers
+ *
+ * The methods of a driver are looked up once when it is added: each driver event has a list
+ * of pairs (driver, method) in `tasmota._events`, called natively by `callBerryDrivers()`.
+ * Events without a driver method don't enter Berry.
+ *
+ * tasmota.add_driver(d:instance) -> nil
+ * tasmota.remove_driver(d:instance) -> nil
+ *
+\*********************************************************************************************/
+// Push the raw list `tasmota._events`, created with an empty list of hooks per event if needed
+void BerryDriverEventsPush(bvm *vm);
+void BerryDriverEventsPush(bvm *vm) {
+  be_getmember(vm, 1, "_events");
+  if (!be_isinstance(vm, -1)) {
+    be_pop(vm, 1);
+    be_newobject(vm, "list");
+    for (uint32_t i = 0; i < BERRY_DRIVER_EVENTS; i++) {
+      be_newobject(vm, "list");
+      be_pop(vm, 1);
+      be_data_push(vm, -2);
+      be_pop(vm, 1);
+    }
+    be_pop(vm, 1);
+    be_setmember(vm, 1, "_events");
+  }
+  be_getmember(vm, -1, ".p");
+  be_remove(vm, -2);
+}
+
+// Push the raw list of hooks of `event` from the raw list of events at `events_idx`
+void BerryDriverHooksPush(bvm *vm, int32_t events_idx, uint32_t event);
+void BerryDriverHooksPush(bvm *vm, int32_t events_idx, uint32_t event) {
+  be_pushint(vm, event);
+  be_getindex(vm, events_idx);
+  be_getmember(vm, -1, ".p");
+  be_remove(vm, -2);
+  be_remove(vm, -2);
+}
+
+// Remove the value at index 2 from the raw list at `list_idx`, with `stride` values per entry.
+// Returns the number of entries removed
+int32_t BerryDriverListRemove(bvm *vm, int32_t list_idx, int32_t stride);
+int32_t BerryDriverListRemove(bvm *vm, int32_t list_idx, int32_t stride) {
+  int32_t removed = 0;
+  for (int32_t i = be_data_size(vm, list_idx) - stride; i >= 0; i -= stride) {
+    be_pushint(vm, i);
+    be_getindex(vm, list_idx);
+    be_pushvalue(vm, 2);
+    bool found = be_iseq(vm);
+    be_pop(vm, 2);
+    if (found) {
+      for (int32_t j = 0; j < stride; j++) { be_data_remove(vm, list_idx); }
+      removed++;
+    }
+    be_pop(vm, 1);
+  }
+  return removed;
+}
+
+extern "C" {
+  // Berry: `tasmota.add_driver(d:instance) -> nil`
+  //
+  int32_t l_addDriver(bvm *vm);
+  int32_t l_addDriver(bvm *vm) {
+    int32_t top = be_top(vm); // Get the number of arguments
+    if (top == 2 && be_isinstance(vm, 2)) {
+      be_getmember(vm, 1, "_drivers");
+      if (!be_isinstance(vm, -1)) {
+        be_pop(vm, 1);
+        be_newobject(vm, "list");
+        be_pop(vm, 1);
+        be_setmember(vm, 1, "_drivers");
+      }
+      be_getmember(vm, -1, ".p");
+      be_pushvalue(vm, 2);
+      be_data_push(vm, -2);
+      be_pop(vm, 3);
+      BerryDriverEventsPush(vm);
+      int32_t events_idx = be_top(vm);
+      char event_name[32];
+      for (uint32_t i = 0; i < BERRY_DRIVER_EVENTS; i++) {
+        if (be_getmethod(vm, 2, GetTextIndexed(event_name, sizeof(event_name), i, kBerryDriverEvents))) {
+          BerryDriverHooksPush(vm, events_idx, i);
+          be_pushvalue(vm, 2);
+          be_data_push(vm, -2);
+          be_pushvalue(vm, -3);
+          be_data_push(vm, -3);
+          be_pop(vm, 3);
+          berry.driver_hooks[i]++;
+        }
+        be_pop(vm, 1);
+      }
+      be_pop(vm, 1);
+      be_return_nil(vm);
+    }
+    be_raise(vm, kTypeError, nullptr);
+  }
+
+  // Berry: `tasmota.remove_driver(d:instance) -> nil`
+  //
+  int32_t l_removeDriver(bvm *vm);
+  int32_t l_removeDriver(bvm *vm) {
+    int32_t top = be_top(vm); // Get the number of arguments
+    if (top == 2 && be_isinstance(vm, 2)) {
+      be_getmember(vm, 1, "_drivers");
+      if (be_isinstance(vm, -1)) {
+        be_getmember(vm, -1, ".p");
+        BerryDriverListRemove(vm, be_top(vm), 1);
+        be_pop(vm, 1);
+      }
+      be_pop(vm, 1);
+      be_getmember(vm, 1, "_events");
+      if (be_isinstance(vm, -1)) {
+        be_getmember(vm, -1, ".p");
+        int32_t events_idx = be_top(vm);
+        for (uint32_t i = 0; i < BERRY_DRIVER_EVENTS; i++) {
+          BerryDriverHooksPush(vm, events_idx, i);
+          berry.driver_hooks[i] -= BerryDriverListRemove(vm, be_top(vm), 2);
+          be_pop(vm, 1);
+        }
+        be_pop(vm, 1);
+      }
+      be_pop(vm, 1);
+      be_return_nil(vm);
+    }
+    be_raise(vm, kTypeError, nullptr);
+  }
+}
+
 /*********************************************************************************************\
  * Native functions mapped to Berry functions
  * 
@@ -435,6 +1104,18 @@ extern "C" {
     }
     be_raise(vm, kTypeError, nullptr);
   }
+
+  // Berry: `_bec_valid(bec:string, source:string) -> bool`
+  // true if the compiled file was saved from the current content of the source file
+  int32_t l_becValid(struct bvm *vm);
+  int32_t l_becValid(struct bvm *vm) {
+    int32_t top = be_top(vm); // Get the number of arguments
+    if (top == 3 && be_isstring(vm, 2) && be_isstring(vm, 3)) {
+      be_pushbool(vm, be_checkcode(vm, be_tostring(vm, 2), be_tostring(vm, 3)));
+      be_return(vm); // Return
+    }
+    be_raise(vm, kTypeError, nullptr);
+  }
 }
 
 // called as a replacement to Berry `print()`
@@ -81,6 +81,11 @@ extern "C" {
   void berry_free(void *ptr) {
     free(ptr);
   }
+
+  // clock of the GC pause statistics
+  uint32_t berry_micros(void) {
+    return micros();
+  }
 }
 
 
@@ -92,16 +97,74 @@ extern "C" {
 
 bool callBerryRule(void) {
   if (berry.rules_busy) { return false; }
+  if (berry.rules.isEmpty()) { return false; }    // no rule registered, don't enter Berry
   berry.rules_busy = true;
-  char * json_event = XdrvMailbox.data;
   bool serviced = false;
-  serviced = callBerryEventDispatcher(PSTR("rule"), nullptr, 0, XdrvMailbox.data);
+  serviced = callBerryEventDispatcher(BERRY_EVENT_RULE, nullptr, 0, XdrvMailbox.data);
   berry.rules_busy = false;
   return serviced;     // TODO event not handled
 }
 
+// Run the Berry timers and crons that are due, Berry is not entered otherwise.
+// The next deadline shortens the sleep of the main loop
+void callBerryTimers(void) {
+  bvm *vm = berry.vm;
+  if (nullptr == vm) { return; }
+  berry.timers.checkCrons();
+  if (berry.timers.expired() || berry.timers.cron_pending) {
+    checkBeTop();
+    be_getglobal(vm, PSTR("tasmota"));
+    be_getmethod(vm, -1, PSTR("run_deferred"));
+    be_pushvalue(vm, -2); // add instance as first arg
+    if (be_pcall(vm, 1) != 0) {
+      BerryDumpErrorAndClear(vm, false);  // log in Tasmota console only, timers not run yet are kept
+    } else {
+      be_pop(vm, 3);
+    }
+    checkBeTop();
+  }
+  if (berry.timers.size) {
+    SetWakeupDeadline(berry.timers.heap[0].due);
+  }
+}
+
+// Call the method of each driver registered for `event`, Berry is not entered if no driver has one.
+// Hooks are pairs (driver, method) in `tasmota._events[event]`, an exception is logged and the
+// next driver is called
+void callBerryDrivers(uint32_t event) {
+  bvm *vm = berry.vm;
+  if ((nullptr == vm) || (0 == berry.driver_hooks[event])) { return; }
+  checkBeTop();
+  be_getglobal(vm, PSTR("tasmota"));
+  be_getmember(vm, -1, PSTR("_events"));
+  if (be_isinstance(vm, -1)) {
+    be_getmember(vm, -1, ".p");
+    be_pushint(vm, event);
+    be_getindex(vm, -2);
+    be_getmember(vm, -1, ".p");
+    int32_t hooks_idx = be_top(vm);
+    for (int32_t i = 0; i + 1 < be_data_size(vm, hooks_idx); i += 2) {   // a driver can be removed by a hook
+      be_pushint(vm, i + 1);
+      be_getindex(vm, hooks_idx);           // method
+      be_remove(vm, -2);
+      be_pushint(vm, i);
+      be_getindex(vm, hooks_idx);           // driver as self
+      be_remove(vm, -2);
+      if (be_pcall(vm, 1) != 0) {
+        if (be_isstring(vm, -1) && be_isstring(vm, -2)) {
+          AddLog(LOG_LEVEL_ERROR, PSTR(D_LOG_BERRY "Exception> '%s' - %s"), be_tostring(vm, -2), be_tostring(vm, -1));
+        }
+      }
+      be_pop(vm, be_top(vm) - hooks_idx);
+    }
+    be_pop(vm, 4);
+  }
+  be_pop(vm, 2);
+  checkBeTop();
+}
+
 size_t callBerryGC(void) {
-  return callBerryEventDispatcher(PSTR("gc"), nullptr, 0, nullptr);
+  return callBerryEventDispatcher(BERRY_EVENT_GC, nullptr, 0, nullptr);
 }
 
 void BerryDumpErrorAndClear(bvm *vm, bool berry_console);
@@ -190,7 +253,7 @@ bool callMethodObjectWithArgs(const char * objname, const char * method, size_t
 
 
 // call the event dispatcher from Tasmota object
-int32_t callBerryEventDispatcher(const char *type, const char *cmd, int32_t idx, const char *payload) {
+int32_t callBerryEventDispatcher(uint32_t type, const char *cmd, int32_t idx, const char *payload) {
   int32_t ret = 0;
   bvm *vm = berry.vm;
 
@@ -201,7 +264,7 @@ int32_t callBerryEventDispatcher(const char *type, const char *cmd, int32_t idx,
     be_getmethod(vm, -1, PSTR("event"));
     if (!be_isnil(vm, -1)) {
       be_pushvalue(vm, -2); // add instance as first arg
-      be_pushstring(vm, type != nullptr ? type : "");
+      be_pushintern(vm, berry.event_types[type]);
       be_pushstring(vm, cmd != nullptr ? cmd : "");
       be_pushint(vm, idx);
       be_pushstring(vm, payload != nullptr ? payload : "{}");  // empty json
@@ -243,8 +306,9 @@ void BerryObservability(bvm *vm, int event...) {
     case BE_OBS_GC_END:
       {
         int32_t vm_usage2 = va_arg(param, int32_t);
+        uint32_t gc_pause = va_arg(param, uint32_t);    // longest pause of the cycle in us
         uint32_t gc_elapsed = millis() - gc_time;
-        AddLog(LOG_LEVEL_DEBUG, PSTR(D_LOG_BERRY "GC from %i to %i bytes (in %d ms)"), vm_usage, vm_usage2, gc_elapsed);
+        AddLog(LOG_LEVEL_DEBUG, PSTR(D_LOG_BERRY "GC from %i to %i bytes (in %d ms, max pause %d us)"), vm_usage, vm_usage2, gc_elapsed, gc_pause);
       }
       break;
     default: break;
@@ -261,13 +325,21 @@ void BerryInit(void) {
     be_vm_delete(berry.vm);
     berry.vm = nullptr;
   }
+  berry.rules.reset();
+  berry.timers.reset();
+  memset(berry.driver_hooks, 0, sizeof(berry.driver_hooks));
 
   int32_t ret_code1, ret_code2;
   bool berry_init_ok = false;
   do {
     berry.vm = be_vm_new(); /* create a virtual machine instance */
     be_set_obs_hook(berry.vm, &BerryObservability);
+    be_gc_incremental(berry.vm, true);    // collect garbage in small steps, see FUNC_EVERY_50_MSECOND
     be_load_custom_libs(berry.vm);
+    for (uint32_t i = 0; i < BERRY_EVENT_TYPES; i++) {
+      char type[12];
+      berry.event_types[i] = be_intern(berry.vm, GetTextIndexed(type, sizeof(type), i, kBerryEventTypes));
+    }
 
     // Register functions
     // be_regfunc(berry.vm, PSTR("log"), l_logInfo);
@@ -306,6 +378,9 @@ void BerryInit(void) {
       be_vm_delete(berry.vm);
       berry.vm = nullptr;
     }
+    berry.rules.reset();
+    berry.timers.reset();
+    memset(berry.driver_hooks, 0, sizeof(berry.driver_hooks));
   }
 }
 
@@ -706,6 +781,10 @@ bool Xdrv52(uint8_t function)
 {
   bool result = false;
 
+  if (FUNC_PRE_INIT == function) {
+    XdrvSubscribe(XDRV_52, XFUNC_TICK(FUNC_LOOP) | XFUNC_TICK(FUNC_EVERY_50_MSECOND) | XFUNC_TICK(FUNC_EVERY_100_MSECOND) | XFUNC_TICK(FUNC_EVERY_SECOND));
+  }
+
   switch (function) {
     // case FUNC_PRE_INIT: // we start Berry in pre_init so that other modules can call Berry in their init methods
     // // case FUNC_INIT:
@@ -716,6 +795,7 @@ bool Xdrv52(uint8_t function)
         BrLoad("autoexec.be");   // run autoexec.be at first tick, so we know all modules are initialized
         berry.autoexec_done = true;
       }
+      callBerryTimers();
       break;
 
     // Berry wide commands and events
@@ -723,24 +803,24 @@ bool Xdrv52(uint8_t function)
       result = callBerryRule();
       break;
     case FUNC_MQTT_DATA:
-      result = callBerryEventDispatcher(PSTR("mqtt_data"), XdrvMailbox.topic, 0, XdrvMailbox.data);
+      result = callBerryEventDispatcher(BERRY_EVENT_MQTT_DATA, XdrvMailbox.topic, 0, XdrvMailbox.data);
       break;
     case FUNC_EVERY_50_MSECOND:
-      callBerryEventDispatcher(PSTR("every_50ms"), nullptr, 0, nullptr);
+      if (berry.vm != nullptr) { be_gc_step(berry.vm, BERRY_GC_STEP_WORK); }
       break;
     case FUNC_COMMAND:
       result = DecodeCommand(kBrCommands, BerryCommand);
       if (!result) {
-        result = callBerryEventDispatcher(PSTR("cmd"), XdrvMailbox.topic, XdrvMailbox.index, XdrvMailbox.data);
+        result = callBerryEventDispatcher(BERRY_EVENT_CMD, XdrvMailbox.topic, XdrvMailbox.index, XdrvMailbox.data);
       }
       break;
 
     // Module specific events
     case FUNC_EVERY_100_MSECOND:
-      callBerryEventDispatcher(PSTR("every_100ms"), nullptr, 0, nullptr);
+      callBerryDrivers(BERRY_EVENT_EVERY_100MS);
       break;
     case FUNC_EVERY_SECOND:
-      callBerryEventDispatcher(PSTR("every_second"), nullptr, 0, nullptr);
+      callBerryDrivers(BERRY_EVENT_EVERY_SECOND);
       break;
     // case FUNC_SET_POWER:
     //   break;
@@ -750,37 +830,37 @@ bool Xdrv52(uint8_t function)
         XdrvMailbox.index++;
       } else {
         WSContentSend_P(HTTP_BTN_BERRY_CONSOLE);
-        callBerryEventDispatcher(PSTR("web_add_button"), nullptr, 0, nullptr);
-        callBerryEventDispatcher(PSTR("web_add_console_button"), nullptr, 0, nullptr);
+        callBerryDrivers(BERRY_EVENT_WEB_ADD_BUTTON);
+        callBerryDrivers(BERRY_EVENT_WEB_ADD_CONSOLE_BUTTON);
       }
       break;
     case FUNC_WEB_ADD_MAIN_BUTTON:
-      callBerryEventDispatcher(PSTR("web_add_main_button"), nullptr, 0, nullptr);
+      callBerryDrivers(BERRY_EVENT_WEB_ADD_MAIN_BUTTON);
       break;
     case FUNC_WEB_ADD_MANAGEMENT_BUTTON:
-      callBerryEventDispatcher(PSTR("web_add_management_button"), nullptr, 0, nullptr);
+      callBerryDrivers(BERRY_EVENT_WEB_ADD_MANAGEMENT_BUTTON);
       break;
     case FUNC_WEB_ADD_BUTTON:
-      callBerryEventDispatcher(PSTR("web_add_config_button"), nullptr, 0, nullptr);
+      callBerryDrivers(BERRY_EVENT_WEB_ADD_CONFIG_BUTTON);
       break;
     case FUNC_WEB_ADD_HANDLER:
-      callBerryEventDispatcher(PSTR("web_add_handler"), nullptr, 0, nullptr);
+      callBerryDrivers(BERRY_EVENT_WEB_ADD_HANDLER);
       WebServer_on(PSTR("/bc"), HandleBerryConsole);
       break;
 #endif // USE_WEBSERVER
     case FUNC_SAVE_BEFORE_RESTART:
-      callBerryEventDispatcher(PSTR("save_before_restart"), nullptr, 0, nullptr);
+      callBerryDrivers(BERRY_EVENT_SAVE_BEFORE_RESTART);
       break;
     case FUNC_WEB_SENSOR:
-      callBerryEventDispatcher(PSTR("web_sensor"), nullptr, 0, nullptr);
+      callBerryDrivers(BERRY_EVENT_WEB_SENSOR);
       break;
 
     case FUNC_JSON_APPEND:
-      callBerryEventDispatcher(PSTR("json_append"), nullptr, 0, nullptr);
+      callBerryDrivers(BERRY_EVENT_JSON_APPEND);
       break;
 
     case FUNC_BUTTON_PRESSED:
-      callBerryEventDispatcher(PSTR("button_pressed"), nullptr, 0, nullptr);
+      callBerryDrivers(BERRY_EVENT_BUTTON_PRESSED);
       break;
 
 
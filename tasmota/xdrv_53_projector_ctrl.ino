@@ -441,6 +441,11 @@ projector_ctrl_set_power(struct projector_ctrl_softc_s *sc)
 
 bool Xdrv53(uint8_t function) {
 	bool result;
+
+  if (FUNC_PRE_INIT == function) {
+    XdrvSubscribe(XDRV_53, XFUNC_TICK(FUNC_LOOP) | XFUNC_TICK(FUNC_EVERY_SECOND));
+  }
+
 	struct projector_ctrl_softc_s *sc;
 
 	result = false;
@@ -306,6 +306,10 @@ void TS_RotConvert(int16_t *x, int16_t *y) {
 bool Xdrv55(uint8_t function) {
   bool result = false;
 
+  if (FUNC_PRE_INIT == function) {
+    XdrvSubscribe(XDRV_55, XFUNC_TICK(FUNC_EVERY_100_MSECOND));
+  }
+
   switch (function) {
     case FUNC_INIT:
       break;
@@ -129,6 +129,11 @@ void BM8563EverySecond(void) {
 bool Xdrv56(uint8_t function)
 {
   bool result = false;
+
+  if (FUNC_PRE_INIT == function) {
+    XdrvSubscribe(XDRV_56, XFUNC_TICK(FUNC_EVERY_SECOND));
+  }
+
   if (!I2cEnabled(XI2C_59)) { return false; }
 
   switch (function) {
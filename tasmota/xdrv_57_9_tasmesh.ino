@@ -797,6 +797,10 @@ void CmndMeshInterval(void) {
 bool Xdrv57(uint8_t function) {
   bool result = false;
 
+  if (FUNC_PRE_INIT == function) {
+    XdrvSubscribe(XDRV_57, XFUNC_TICK(FUNC_LOOP) | XFUNC_TICK(FUNC_EVERY_SECOND));
+  }
+
   switch (function) {
     case FUNC_COMMAND:
       result = DecodeCommand(kMeshCommands, MeshCommand);
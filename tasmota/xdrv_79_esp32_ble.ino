@@ -3590,6 +3590,10 @@ int ExtRestartBLEIfEnabled(){
 
 bool Xdrv79(uint8_t function)
 {
+  if (FUNC_PRE_INIT == function) {
+    XdrvSubscribe(XDRV_79, XFUNC_TICK(FUNC_EVERY_50_MSECOND) | XFUNC_TICK(FUNC_EVERY_250_MSECOND) | XFUNC_TICK(FUNC_EVERY_SECOND));
+  }
+
   //if (!Settings->flag5.mi32_enable) { return false; }  // SetOption115 - Enable ESP32 BLE BLE
 
   bool result = false;
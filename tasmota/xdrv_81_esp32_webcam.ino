@@ -1081,6 +1081,10 @@ void CmndWebRtsp(void) {
 bool Xdrv81(uint8_t function) {
   bool result = false;
 
+  if (FUNC_PRE_INIT == function) {
+    XdrvSubscribe(XDRV_81, XFUNC_TICK(FUNC_LOOP));
+  }
+
   switch (function) {
     case FUNC_LOOP:
       WcLoop();
@@ -211,6 +211,10 @@ void CmndEthClockMode(void)
 bool Xdrv82(uint8_t function) {
   bool result = false;
 
+  if (FUNC_PRE_INIT == function) {
+    XdrvSubscribe(XDRV_82, 0);              // No periodic functions
+  }
+
   switch (function) {
     case FUNC_COMMAND:
       result = DecodeCommand(kEthernetCommands, EthernetCommand);
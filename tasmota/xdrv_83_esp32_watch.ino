@@ -438,6 +438,10 @@ bool TTGO_button(void) {
 bool Xdrv83(uint8_t function) {
   bool result = false;
 
+  if (FUNC_PRE_INIT == function) {
+    XdrvSubscribe(XDRV_83, XFUNC_TICK(FUNC_LOOP));
+  }
+
   switch (function) {
 
     case FUNC_WEB_SENSOR:
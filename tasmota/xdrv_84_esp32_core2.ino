@@ -334,6 +334,10 @@ void CmndCore2Shutdown(void) {
 bool Xdrv84(uint8_t function) {
   bool result = false;
 
+  if (FUNC_PRE_INIT == function) {
+    XdrvSubscribe(XDRV_84, XFUNC_TICK(FUNC_LOOP) | XFUNC_TICK(FUNC_EVERY_SECOND));
+  }
+
   switch (function) {
     case FUNC_LOOP:
       Core2Loop(1);
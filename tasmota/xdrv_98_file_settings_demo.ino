@@ -177,6 +177,10 @@ void DrvDemoSettingsSave(void) {
 bool Xdrv98(uint8_t function) {
   bool result = false;
 
+  if (FUNC_PRE_INIT == function) {
+    XdrvSubscribe(XDRV_98, 0);              // No periodic functions
+  }
+
   switch (function) {
     case FUNC_SAVE_SETTINGS:
       DrvDemoSettingsSave();
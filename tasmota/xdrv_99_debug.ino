@@ -698,6 +698,10 @@ bool Xdrv99(uint8_t function)
 {
   bool result = false;
 
+  if (FUNC_PRE_INIT == function) {
+    XdrvSubscribe(XDRV_99, XFUNC_TICK(FUNC_LOOP));
+  }
+
   switch (function) {
     case FUNC_LOOP:
       CpuLoadLoop();
@@ -1061,6 +1061,95 @@ const uint8_t kXdrvList[] = {
 #endif
 };
 
+/*********************************************************************************************\
+ * Periodic function subscriptions
+ *
+ * Drivers and sensors are only called for FUNC_LOOP to FUNC_EVERY_SECOND if subscribed. All
+ * are subscribed by default. A driver narrows its subscription at any time, usually on
+ * FUNC_PRE_INIT, with XdrvSubscribe(XDRV_xx, XFUNC_TICK(FUNC_EVERY_SECOND) | ...).
+\*********************************************************************************************/
+
+typedef struct XFUNC_TICK_TABLE {
+  uint8_t* skip;                        // Per slot bitmask of unsubscribed periodic functions
+  uint8_t* list;                        // Per periodic function list of subscribed slots
+  uint8_t count[XFUNC_TICKS];           // Number of subscribed slots per periodic function
+  uint8_t present;                      // Number of slots
+  uint8_t dispatching;                  // Number of dispatches iterating a list
+  bool valid;                           // Lists are up to date with skip masks
+} XFUNC_TICK_TABLE;
+
+struct XFUNC_STATS {
+  uint32_t calls;
+  uint64_t cycles;
+} XFuncStats[FUNC_DEVICE_GROUP_ITEM +1];
+
+uint8_t xdrv_tick_skip[sizeof(kXdrvList)] = { 0 };
+uint8_t xdrv_tick_list[XFUNC_TICKS * sizeof(kXdrvList)];
+XFUNC_TICK_TABLE XdrvTicks = { xdrv_tick_skip, xdrv_tick_list, { 0 }, xdrv_present, 0, false };
+
+bool XFuncIsTick(uint32_t function) {
+  return ((function >= FUNC_LOOP) && (function <= FUNC_EVERY_SECOND));
+}
+
+const uint8_t* XFuncTickList(struct XFUNC_TICK_TABLE &table, uint32_t function, uint32_t &count) {
+  // Rebuild lists only between dispatches so subscription changes by a called driver are safe.
+  // A dispatch nested in another one uses the lists as they are
+  if (!table.valid && !table.dispatching) {
+    for (uint32_t tick = 0; tick < XFUNC_TICKS; tick++) {
+      uint8_t* list = table.list + (tick * table.present);
+      uint32_t entries = 0;
+      for (uint32_t x = 0; x < table.present; x++) {
+        if (!bitRead(table.skip[x], tick)) { list[entries++] = x; }
+      }
+      table.count[tick] = entries;
+    }
+    table.valid = true;
+  }
+  uint32_t tick = function - FUNC_LOOP;
+  count = table.count[tick];
+  return table.list + (tick * table.present);
+}
+
+uint32_t XFuncTickCount(struct XFUNC_TICK_TABLE &table, uint32_t function) {
+  // Number of slots subscribed to function, from the skip masks as the lists may be iterated
+  uint32_t tick = function - FUNC_LOOP;
+  uint32_t count = 0;
+  for (uint32_t x = 0; x < table.present; x++) {
+    if (!bitRead(table.skip[x], tick)) { count++; }
+  }
+  return count;
+}
+
+bool XFuncSubscribe(struct XFUNC_TICK_TABLE &table, const uint8_t* id_list, uint32_t id, uint32_t ticks) {
+  for (uint32_t x = 0; x < table.present; x++) {
+#ifdef XFUNC_PTR_IN_ROM
+    uint32_t listed = pgm_read_byte(id_list + x);
+#else
+    uint32_t listed = id_list[x];
+#endif
+    if (id == listed) {
+      uint8_t skip = ~ticks & XFUNC_TICK_ALL;
+      if (table.skip[x] != skip) {
+        table.skip[x] = skip;
+        table.valid = false;
+      }
+      return true;
+    }
+  }
+  return false;
+}
+
+bool XdrvSubscribe(uint32_t driver, uint32_t ticks) {
+  return XFuncSubscribe(XdrvTicks, kXdrvList, driver, ticks);
+}
+
+void XFuncStatsAdd(uint32_t function, uint32_t start_cycles) {
+  if (function <= FUNC_DEVICE_GROUP_ITEM) {
+    XFuncStats[function].calls++;
+    XFuncStats[function].cycles += ESP.getCycleCount() - start_cycles;
+  }
+}
+
 /*********************************************************************************************/
 
 void XsnsDriverState(void)
@@ -1116,6 +1205,16 @@ void ShowFreeMem(const char *where)
  * Function call to single xdrv
 \*********************************************************************************************/
 
+uint32_t XdrvId(uint32_t slot)
+{
+  if (slot >= xdrv_present) { return 0; }
+#ifdef XFUNC_PTR_IN_ROM
+  return pgm_read_byte(kXdrvList + slot);
+#else
+  return kXdrvList[slot];
+#endif
+}
+
 bool XdrvCallDriver(uint32_t driver, uint8_t Function)
 {
   for (uint32_t x = 0; x < xdrv_present; x++) {
@@ -1125,7 +1224,10 @@ bool XdrvCallDriver(uint32_t driver, uint8_t Function)
     uint32_t listed = kXdrvList[x];
 #endif
     if (driver == listed) {
-      return xdrv_func_ptr[x](Function);
+      uint32_t profile_start = ESP.getCycleCount();
+      bool result = xdrv_func_ptr[x](Function);
+      if (Profile.table) { ProfileAdd(PROFILE_XDRV, x, Function, profile_start); }
+      return result;
     }
   }
   return false;
@@ -1141,8 +1243,26 @@ bool XdrvCall(uint8_t Function)
 
   DEBUG_TRACE_LOG(PSTR("DRV: %d"), Function);
 
+  uint32_t start_cycles = ESP.getCycleCount();
+
+  if (XFuncIsTick(Function)) {
+    uint32_t count;
+    const uint8_t* list = XFuncTickList(XdrvTicks, Function, count);
+    XdrvTicks.dispatching++;
+    for (uint32_t i = 0; i < count; i++) {
+      uint32_t profile_start = ESP.getCycleCount();
+      result = xdrv_func_ptr[list[i]](Function);
+      if (Profile.table) { ProfileAdd(PROFILE_XDRV, list[i], Function, profile_start); }
+    }
+    XdrvTicks.dispatching--;
+    XFuncStatsAdd(Function, start_cycles);
+    return result;
+  }
+
   for (uint32_t x = 0; x < xdrv_present; x++) {
+    uint32_t profile_start = ESP.getCycleCount();
     result = xdrv_func_ptr[x](Function);
+    if (Profile.table) { ProfileAdd(PROFILE_XDRV, x, Function, profile_start); }
 
     if (result && ((FUNC_COMMAND == Function) ||
                    (FUNC_COMMAND_DRIVER == Function) ||
@@ -1159,5 +1279,7 @@ bool XdrvCall(uint8_t Function)
     }
   }
 
+  XFuncStatsAdd(Function, start_cycles);
+
   return result;
 }
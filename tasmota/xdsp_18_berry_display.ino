@@ -32,19 +32,19 @@ bool Xdsp18(uint8_t function) {
   switch (function) {
 
     case FUNC_DISPLAY_INIT_DRIVER:
-      result = callBerryEventDispatcher(PSTR("display"), PSTR("init_driver"), function, XdrvMailbox.data);
+      callBerryDrivers(BERRY_EVENT_DISPLAY);
       break;
     case FUNC_DISPLAY_INIT:
-      result = callBerryEventDispatcher(PSTR("display"), PSTR("init_driver"), function, XdrvMailbox.data);
+      callBerryDrivers(BERRY_EVENT_DISPLAY);
       break;
     case FUNC_DISPLAY_MODEL:
-      result = callBerryEventDispatcher(PSTR("display"), PSTR("model"), function, XdrvMailbox.data);
+      callBerryDrivers(BERRY_EVENT_DISPLAY);
       break;
     case FUNC_DISPLAY_DIM:
-      result = callBerryEventDispatcher(PSTR("display"), PSTR("dim"), function, XdrvMailbox.data);
+      callBerryDrivers(BERRY_EVENT_DISPLAY);
       break;
     case FUNC_DISPLAY_POWER:
-      result = callBerryEventDispatcher(PSTR("display"), PSTR("power"), function, XdrvMailbox.data);
+      callBerryDrivers(BERRY_EVENT_DISPLAY);
       break;
   }
   return result;
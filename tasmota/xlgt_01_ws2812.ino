@@ -189,6 +189,11 @@ uint8_t kWsRepeat[5] = {
     1 };   // All
 
 struct WS2812 {
+  WsColor *palette = nullptr;          // gradient colors of the scheme, two ranges as every other range is reversed
+  uint16_t palette_range = 0;          // range and gradRange used to compute the palette
+  uint16_t palette_grad_range = 0;
+  uint8_t palette_scheme = 0;
+  uint8_t palette_dimmer = 0;
   uint8_t show_next = 1;
   uint8_t scheme_offset = 0;
   bool suspend_update = false;
@@ -289,6 +294,55 @@ void Ws2812Clock(void)
   Ws2812StripShow();
 }
 
+// Dim a scheme color, 0..255 to 0..255 * light_dimmer / 100
+uint8_t Ws2812Dim(uint32_t v)
+{
+  return (v * Settings->light_dimmer) / 100;
+}
+
+// Blend two colors, blend is the weight of b in 16 bits fixed point
+uint8_t Ws2812Blend(uint8_t a, uint8_t b, uint32_t blend)
+{
+  if (b >= a) {
+    return a + (((b - a) * blend) >> 16);
+  } else {
+    return a - (((a - b) * blend) >> 16);
+  }
+}
+
+// Write a pixel of a scheme directly in the strip buffer, with Gamma correction if enabled
+// Returns true if the pixel changed, unchanged frames are not sent to the strip
+bool Ws2812SetSchemePixel(uint32_t i, struct WsColor color)
+{
+#if (USE_WS2812_CTYPE > NEO_3LED)
+  RgbwColor c;
+  c.W = 0;
+#else
+  RgbColor c;
+#endif
+
+  if (Settings->light_correction) {
+    c.R = ledGamma(color.red);
+    c.G = ledGamma(color.green);
+    c.B = ledGamma(color.blue);
+  } else {
+    c.R = color.red;
+    c.G = color.green;
+    c.B = color.blue;
+  }
+  uint8_t *pixels = strip->Pixels();
+  if (selectedNeoFeatureType::retrievePixelColor(pixels, i) == c) { return false; }
+  selectedNeoFeatureType::applyPixelColor(pixels, i, c);
+  return true;
+}
+
+// Send a scheme frame to the strip, only if a pixel changed since the previous frame
+void Ws2812SchemeShow(bool changed)
+{
+  if (changed) { strip->Dirty(); }
+  strip->Show();    // does nothing if the strip is not dirty
+}
+
 void Ws2812GradientColor(uint32_t schemenr, struct WsColor* mColor, uint32_t range, uint32_t gradRange, uint32_t i)
 {
 /*
@@ -305,13 +359,38 @@ void Ws2812GradientColor(uint32_t schemenr, struct WsColor* mColor, uint32_t ran
     start = (scheme.count -1) - start;
     end = (scheme.count -1) - end;
   }
-  float dimmer = 100 / (float)Settings->light_dimmer;
-  float fmyRed = (float)wsmap(rangeIndex % gradRange, 0, gradRange, scheme.colors[start].red, scheme.colors[end].red) / dimmer;
-  float fmyGrn = (float)wsmap(rangeIndex % gradRange, 0, gradRange, scheme.colors[start].green, scheme.colors[end].green) / dimmer;
-  float fmyBlu = (float)wsmap(rangeIndex % gradRange, 0, gradRange, scheme.colors[start].blue, scheme.colors[end].blue) / dimmer;
-  mColor->red = (uint8_t)fmyRed;
-  mColor->green = (uint8_t)fmyGrn;
-  mColor->blue = (uint8_t)fmyBlu;
+  mColor->red = Ws2812Dim(wsmap(rangeIndex % gradRange, 0, gradRange, scheme.colors[start].red, scheme.colors[end].red));
+  mColor->green = Ws2812Dim(wsmap(rangeIndex % gradRange, 0, gradRange, scheme.colors[start].green, scheme.colors[end].green));
+  mColor->blue = Ws2812Dim(wsmap(rangeIndex % gradRange, 0, gradRange, scheme.colors[start].blue, scheme.colors[end].blue));
+}
+
+bool Ws2812GradientPalette(uint32_t schemenr, uint32_t range, uint32_t gradRange)
+{
+/*
+ * Compute the gradient colors of the scheme once for all frames, the gradient repeats every two ranges.
+ * The palette is computed again when the scheme, the number of pixels, the width or the dimmer change.
+ */
+  if (Ws2812.palette && (Ws2812.palette_scheme == schemenr) && (Ws2812.palette_range == range) &&
+      (Ws2812.palette_grad_range == gradRange) && (Ws2812.palette_dimmer == Settings->light_dimmer)) {
+    return true;
+  }
+  free(Ws2812.palette);
+  Ws2812.palette = (WsColor*)malloc(2 * range * sizeof(WsColor));
+  if (!Ws2812.palette) { return false; }
+  for (uint32_t i = 0; i < 2 * range; i++) {
+    Ws2812GradientColor(schemenr, &Ws2812.palette[i], range, gradRange, i);
+  }
+  Ws2812.palette_scheme = schemenr;
+  Ws2812.palette_range = range;
+  Ws2812.palette_grad_range = gradRange;
+  Ws2812.palette_dimmer = Settings->light_dimmer;
+  return true;
+}
+
+void Ws2812FreePalette(void)
+{
+  free(Ws2812.palette);
+  Ws2812.palette = nullptr;
 }
 
 void Ws2812Gradient(uint32_t schemenr)
@@ -321,38 +400,45 @@ void Ws2812Gradient(uint32_t schemenr)
  * Display a gradient of colors for the current color scheme.
  *  Repeat is the number of repetitions of the gradient (pick a multiple of 2 for smooth looping of the gradient).
  */
-#if (USE_WS2812_CTYPE > NEO_3LED)
-  RgbwColor c;
-  c.W = 0;
-#else
-  RgbColor c;
-#endif
-
   ColorScheme scheme = kSchemes[schemenr];
   if (scheme.count < 2) { return; }
 
   uint32_t repeat = kWsRepeat[Settings->light_width];  // number of scheme.count per ledcount
-  uint32_t range = (uint32_t)ceil((float)Settings->light_pixels / (float)repeat);
-  uint32_t gradRange = (uint32_t)ceil((float)range / (float)(scheme.count - 1));
+  uint32_t range = (Settings->light_pixels + repeat -1) / repeat;
+  uint32_t gradRange = (range + scheme.count -2) / (scheme.count - 1);
   uint32_t speed = ((Settings->light_speed * 2) -1) * (STATES / 10);
   uint32_t offset = speed > 0 ? Light.strip_timer_counter / speed : 0;
+  speed = speed ? speed : 1;    // should never happen, just avoid div0
+  // Weight of the current color to blend with the old color, rounded up so that the blend is the same as wsmap()
+  uint32_t blend = (((Light.strip_timer_counter % speed) << 16) + speed -1) / speed;
 
+  bool palette = Ws2812GradientPalette(schemenr, range, gradRange);
+  uint32_t index = offset % (2 * range);
   WsColor oldColor, currentColor;
-  Ws2812GradientColor(schemenr, &oldColor, range, gradRange, offset);
+  if (palette) {
+    oldColor = Ws2812.palette[index];
+  } else {
+    Ws2812GradientColor(schemenr, &oldColor, range, gradRange, index);
+  }
   currentColor = oldColor;
-  speed = speed ? speed : 1;    // should never happen, just avoid div0
+  bool changed = false;
   for (uint32_t i = 0; i < Settings->light_pixels; i++) {
-    if (kWsRepeat[Settings->light_width] > 1) {
-      Ws2812GradientColor(schemenr, &currentColor, range, gradRange, i + offset + 1);
+    if (repeat > 1) {
+      if (++index >= 2 * range) { index = 0; }
+      if (palette) {
+        currentColor = Ws2812.palette[index];
+      } else {
+        Ws2812GradientColor(schemenr, &currentColor, range, gradRange, index);
+      }
     }
     // Blend old and current color based on time for smooth movement.
-    c.R = wsmap(Light.strip_timer_counter % speed, 0, speed, oldColor.red, currentColor.red);
-    c.G = wsmap(Light.strip_timer_counter % speed, 0, speed, oldColor.green, currentColor.green);
-    c.B = wsmap(Light.strip_timer_counter % speed, 0, speed, oldColor.blue, currentColor.blue);
-    strip->SetPixelColor(i, c);
+    WsColor c = { Ws2812Blend(oldColor.red, currentColor.red, blend),
+                  Ws2812Blend(oldColor.green, currentColor.green, blend),
+                  Ws2812Blend(oldColor.blue, currentColor.blue, blend) };
+    changed |= Ws2812SetSchemePixel(i, c);
     oldColor = currentColor;
   }
-  Ws2812StripShow();
+  Ws2812SchemeShow(changed);
 }
 
 void Ws2812Bars(uint32_t schemenr)
@@ -362,13 +448,6 @@ void Ws2812Bars(uint32_t schemenr)
  * Display solid bars of color for the current color scheme.
  * Width is the width of each bar in pixels/lights.
  */
-#if (USE_WS2812_CTYPE > NEO_3LED)
-  RgbwColor c;
-  c.W = 0;
-#else
-  RgbColor c;
-#endif
-
   ColorScheme scheme = kSchemes[schemenr];
 
   uint32_t maxSize = Settings->light_pixels / scheme.count;
@@ -378,25 +457,18 @@ void Ws2812Bars(uint32_t schemenr)
   uint32_t offset = (speed > 0) ? Light.strip_timer_counter / speed : 0;
 
   WsColor mcolor[scheme.count];
-  memcpy(mcolor, scheme.colors, sizeof(mcolor));
-  float dimmer = 100 / (float)Settings->light_dimmer;
   for (uint32_t i = 0; i < scheme.count; i++) {
-    float fmyRed = (float)mcolor[i].red / dimmer;
-    float fmyGrn = (float)mcolor[i].green / dimmer;
-    float fmyBlu = (float)mcolor[i].blue / dimmer;
-    mcolor[i].red = (uint8_t)fmyRed;
-    mcolor[i].green = (uint8_t)fmyGrn;
-    mcolor[i].blue = (uint8_t)fmyBlu;
+    mcolor[i].red = Ws2812Dim(scheme.colors[i].red);
+    mcolor[i].green = Ws2812Dim(scheme.colors[i].green);
+    mcolor[i].blue = Ws2812Dim(scheme.colors[i].blue);
   }
   uint32_t colorIndex = offset % scheme.count;
+  bool changed = false;
   for (uint32_t i = 0; i < Settings->light_pixels; i++) {
     if (maxSize) { colorIndex = ((i + offset) % (scheme.count * kWidth[Settings->light_width])) / kWidth[Settings->light_width]; }
-    c.R = mcolor[colorIndex].red;
-    c.G = mcolor[colorIndex].green;
-    c.B = mcolor[colorIndex].blue;
-    strip->SetPixelColor(i, c);
+    changed |= Ws2812SetSchemePixel(i, mcolor[colorIndex]);
   }
-  Ws2812StripShow();
+  Ws2812SchemeShow(changed);
 }
 
 void Ws2812Clear(void)
@@ -479,6 +551,7 @@ bool Ws2812SetChannels(void)
 {
   uint8_t *cur_col = (uint8_t*)XdrvMailbox.data;
 
+  Ws2812FreePalette();    // only used by schemes
   Ws2812SetColor(0, cur_col[0], cur_col[1], cur_col[2], cur_col[3]);
 
   return true;
@@ -100,7 +100,9 @@ bool XlgtCall(uint8_t function)
 
   if (FUNC_MODULE_INIT == function) {
     for (uint32_t x = 0; x < xlgt_present; x++) {
+      uint32_t profile_start = ESP.getCycleCount();
       xlgt_func_ptr[x](function);
+      if (Profile.table) { ProfileAdd(PROFILE_XLGT, x, function, profile_start); }
       if (TasmotaGlobal.light_driver) {
         xlgt_active = x;
         return true;  // Stop further driver investigation
@@ -108,7 +110,10 @@ bool XlgtCall(uint8_t function)
     }
   }
   else if (TasmotaGlobal.light_driver) {
-    return xlgt_func_ptr[xlgt_active](function);
+    uint32_t profile_start = ESP.getCycleCount();
+    bool result = xlgt_func_ptr[xlgt_active](function);
+    if (Profile.table) { ProfileAdd(PROFILE_XLGT, xlgt_active, function, profile_start); }
+    return result;
   }
   return false;
 }
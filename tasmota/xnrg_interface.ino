@@ -164,7 +164,9 @@ bool XnrgCall(uint8_t function)
 
   if (FUNC_PRE_INIT == function) {
     for (uint32_t x = 0; x < xnrg_present; x++) {
+      uint32_t profile_start = ESP.getCycleCount();
       xnrg_func_ptr[x](function);
+      if (Profile.table) { ProfileAdd(PROFILE_XNRG, x, function, profile_start); }
       if (TasmotaGlobal.energy_driver) {
         xnrg_active = x;
         return true;  // Stop further driver investigation
@@ -172,7 +174,10 @@ bool XnrgCall(uint8_t function)
     }
   }
   else if (TasmotaGlobal.energy_driver) {
-    return xnrg_func_ptr[xnrg_active](function);
+    uint32_t profile_start = ESP.getCycleCount();
+    bool result = xnrg_func_ptr[xnrg_active](function);
+    if (Profile.table) { ProfileAdd(PROFILE_XNRG, xnrg_active, function, profile_start); }
+    return result;
   }
   return false;
 }
@@ -337,6 +337,10 @@ bool Xsns01(uint8_t function)
 {
   bool result = false;
 
+  if (FUNC_PRE_INIT == function) {
+    XsnsSubscribe(XSNS_01, XFUNC_TICK(FUNC_LOOP) | XFUNC_TICK(FUNC_EVERY_SECOND));
+  }
+
   if (Counter.any_counter) {
     switch (function) {
       case FUNC_EVERY_SECOND:
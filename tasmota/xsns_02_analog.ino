@@ -673,6 +673,10 @@ void CmndAdcParam(void) {
 bool Xsns02(uint8_t function) {
   bool result = false;
 
+  if (FUNC_PRE_INIT == function) {
+    XsnsSubscribe(XSNS_02, XFUNC_TICK(FUNC_EVERY_250_MSECOND) | XFUNC_TICK(FUNC_EVERY_SECOND));
+  }
+
   switch (function) {
     case FUNC_COMMAND:
       result = DecodeCommand(kAdcCommands, AdcCommand);
@@ -152,6 +152,10 @@ bool Xsns04(uint8_t function)
 {
   bool result = false;
 
+  if (FUNC_PRE_INIT == function) {
+    XsnsSubscribe(XSNS_04, 0);              // No periodic functions
+  }
+
   if (SONOFF_SC == TasmotaGlobal.module_type) {
     switch (function) {
       case FUNC_JSON_APPEND:
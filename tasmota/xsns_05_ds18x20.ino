@@ -520,6 +520,10 @@ void Ds18x20Show(bool json) {
 bool Xsns05(uint8_t function) {
   bool result = false;
 
+  if (FUNC_PRE_INIT == function) {
+    XsnsSubscribe(XSNS_05, XFUNC_TICK(FUNC_EVERY_SECOND));
+  }
+
   if (PinUsed(GPIO_DSB)) {
     switch (function) {
       case FUNC_INIT:
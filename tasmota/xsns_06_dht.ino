@@ -203,6 +203,10 @@ void DhtInit(void) {
       if (dht_sensors > 1) {
         snprintf_P(Dht[i].stype, sizeof(Dht[i].stype), PSTR("%s%c%02d"), Dht[i].stype, IndexSeparator(), Dht[i].pin);
       }
+#ifdef USE_PROMETHEUS
+      MetricsAdd(Dht[i].stype, PSTR(D_JSON_TEMPERATURE), &Dht[i].t, METRIC_FLOAT, METRIC_GAUGE, METRIC_RES_TEMPERATURE);
+      MetricsAdd(Dht[i].stype, PSTR(D_JSON_HUMIDITY), &Dht[i].h, METRIC_FLOAT, METRIC_GAUGE, METRIC_RES_HUMIDITY);
+#endif  // USE_PROMETHEUS
     }
     AddLog(LOG_LEVEL_DEBUG, PSTR(D_LOG_DHT "(v5) " D_SENSORS_FOUND " %d"), dht_sensors);
   } else {
@@ -238,6 +242,10 @@ void DhtShow(bool json) {
 bool Xsns06(uint8_t function) {
   bool result = false;
 
+  if (FUNC_PRE_INIT == function) {
+    XsnsSubscribe(XSNS_06, XFUNC_TICK(FUNC_EVERY_SECOND));
+  }
+
   if (dht_active) {
     switch (function) {
       case FUNC_EVERY_SECOND:
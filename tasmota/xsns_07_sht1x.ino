@@ -193,6 +193,10 @@ void ShtShow(bool json)
 
 bool Xsns07(uint8_t function)
 {
+  if (FUNC_PRE_INIT == function) {
+    XsnsSubscribe(XSNS_07, XFUNC_TICK(FUNC_EVERY_SECOND));
+  }
+
   if (!I2cEnabled(XI2C_08)) { return false; }
 
   bool result = false;
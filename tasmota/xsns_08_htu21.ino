@@ -257,6 +257,10 @@ void HtuShow(bool json)
 
 bool Xsns08(uint8_t function)
 {
+  if (FUNC_PRE_INIT == function) {
+    XsnsSubscribe(XSNS_08, XFUNC_TICK(FUNC_EVERY_SECOND));
+  }
+
   if (!I2cEnabled(XI2C_09)) { return false; }
 
   bool result = false;
@@ -630,6 +630,10 @@ void BMP_EnterSleep(void)
 
 bool Xsns09(uint8_t function)
 {
+  if (FUNC_PRE_INIT == function) {
+    XsnsSubscribe(XSNS_09, XFUNC_TICK(FUNC_EVERY_SECOND));
+  }
+
   if (!I2cEnabled(XI2C_10)) { return false; }
 
   bool result = false;
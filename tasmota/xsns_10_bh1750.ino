@@ -194,6 +194,10 @@ void Bh1750Show(bool json) {
 \*********************************************************************************************/
 
 bool Xsns10(uint8_t function) {
+  if (FUNC_PRE_INIT == function) {
+    XsnsSubscribe(XSNS_10, XFUNC_TICK(FUNC_EVERY_SECOND));
+  }
+
   if (!I2cEnabled(XI2C_11)) { return false; }
 
   bool result = false;
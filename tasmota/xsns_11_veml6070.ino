@@ -296,6 +296,10 @@ void Veml6070Show(bool json)
 
 bool Xsns11(uint8_t function)
 {
+  if (FUNC_PRE_INIT == function) {
+    XsnsSubscribe(XSNS_11, XFUNC_TICK(FUNC_EVERY_SECOND));
+  }
+
   if (!I2cEnabled(XI2C_12)) { return false; }
 
   bool result = false;
@@ -120,6 +120,10 @@ void Esp32SensorShow(bool json) {
 bool Xsns127(uint8_t function) {
   bool result = false;
 
+  if (FUNC_PRE_INIT == function) {
+    XsnsSubscribe(XSNS_127, 0);             // No periodic functions
+  }
+
   switch (function) {
     case FUNC_JSON_APPEND:
       Esp32SensorShow(1);
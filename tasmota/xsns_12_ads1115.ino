@@ -283,6 +283,10 @@ void Ads1115Show(bool json)
 
 bool Xsns12(uint8_t function)
 {
+  if (FUNC_PRE_INIT == function) {
+    XsnsSubscribe(XSNS_12, XFUNC_TICK(FUNC_EVERY_250_MSECOND));
+  }
+
   if (!I2cEnabled(XI2C_13)) { return false; }
 
   bool result = false;
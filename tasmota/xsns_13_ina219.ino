@@ -316,6 +316,10 @@ void Ina219Show(bool json)
 
 bool Xsns13(uint8_t function)
 {
+  if (FUNC_PRE_INIT == function) {
+    XsnsSubscribe(XSNS_13, XFUNC_TICK(FUNC_EVERY_SECOND));
+  }
+
   if (!I2cEnabled(XI2C_14)) { return false; }
 
   bool result = false;
@@ -114,6 +114,10 @@ void Sht3xShow(bool json)
 
 bool Xsns14(uint8_t function)
 {
+  if (FUNC_PRE_INIT == function) {
+    XsnsSubscribe(XSNS_14, 0);              // No periodic functions
+  }
+
   if (!I2cEnabled(XI2C_15)) { return false; }
 
   bool result = false;
@@ -366,6 +366,10 @@ bool Xsns15(uint8_t function)
 {
   bool result = false;
 
+  if (FUNC_PRE_INIT == function) {
+    XsnsSubscribe(XSNS_15, XFUNC_TICK(FUNC_EVERY_SECOND));
+  }
+
   if (mhz_type) {
     switch (function) {
       case FUNC_INIT:
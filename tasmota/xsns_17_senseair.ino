@@ -176,6 +176,10 @@ bool Xsns17(uint8_t function)
 {
   bool result = false;
 
+  if (FUNC_PRE_INIT == function) {
+    XsnsSubscribe(XSNS_17, XFUNC_TICK(FUNC_EVERY_250_MSECOND));
+  }
+
   if (senseair_type) {
     switch (function) {
       case FUNC_INIT:
@@ -335,6 +335,10 @@ bool Xsns18(uint8_t function)
 {
   bool result = false;
 
+  if (FUNC_PRE_INIT == function) {
+    XsnsSubscribe(XSNS_18, XFUNC_TICK(FUNC_EVERY_SECOND));
+  }
+
   if (Pms.type) {
     switch (function) {
       case FUNC_INIT:
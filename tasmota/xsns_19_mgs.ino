@@ -95,6 +95,10 @@ void MGSShow(bool json)
 
 bool Xsns19(uint8_t function)
 {
+  if (FUNC_PRE_INIT == function) {
+    XsnsSubscribe(XSNS_19, 0);              // No periodic functions
+  }
+
   if (!I2cEnabled(XI2C_17)) { return false; }
 
   bool result = false;
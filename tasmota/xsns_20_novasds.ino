@@ -253,6 +253,10 @@ bool Xsns20(uint8_t function)
 {
   bool result = false;
 
+  if (FUNC_PRE_INIT == function) {
+    XsnsSubscribe(XSNS_20, XFUNC_TICK(FUNC_EVERY_SECOND));
+  }
+
   if (novasds_type) {
     switch (function) {
       case FUNC_INIT:
@@ -145,6 +145,10 @@ void Sgp30Show(bool json)
 
 bool Xsns21(uint8_t function)
 {
+  if (FUNC_PRE_INIT == function) {
+    XsnsSubscribe(XSNS_21, XFUNC_TICK(FUNC_EVERY_SECOND));
+  }
+
   if (!I2cEnabled(XI2C_18)) { return false; }
 
   bool result = false;
@@ -189,6 +189,10 @@ bool Xsns22(uint8_t function)
 {
   bool result = false;
 
+  if (FUNC_PRE_INIT == function) {
+    XsnsSubscribe(XSNS_22, XFUNC_TICK(FUNC_EVERY_SECOND));
+  }
+
   if (sr04_type) {
     switch (function) {
       case FUNC_INIT:
@@ -371,6 +371,10 @@ void Si1145Show(bool json)
 
 bool Xsns24(uint8_t function)
 {
+  if (FUNC_PRE_INIT == function) {
+    XsnsSubscribe(XSNS_24, XFUNC_TICK(FUNC_EVERY_SECOND));
+  }
+
   if (!I2cEnabled(XI2C_19)) { return false; }
 
   bool result = false;
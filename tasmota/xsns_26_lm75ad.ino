@@ -104,6 +104,10 @@ void LM75ADShow(bool json)
 
 bool Xsns26(uint8_t function)
 {
+  if (FUNC_PRE_INIT == function) {
+    XsnsSubscribe(XSNS_26, 0);              // No periodic functions
+  }
+
   if (!I2cEnabled(XI2C_20)) { return false; }
 
   bool result = false;
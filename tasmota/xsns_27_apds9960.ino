@@ -1993,6 +1993,10 @@ bool APDS9960CommandSensor(void) {
 \*********************************************************************************************/
 
 bool Xsns27(uint8_t function) {
+  if (FUNC_PRE_INIT == function) {
+    XsnsSubscribe(XSNS_27, XFUNC_TICK(FUNC_EVERY_50_MSECOND));
+  }
+
   if (!I2cEnabled(XI2C_21)) { return false; }
 
   bool result = false;
@@ -202,6 +202,10 @@ bool Xsns28(uint8_t function)
 {
   bool result = false;
 
+  if (FUNC_PRE_INIT == function) {
+    XsnsSubscribe(XSNS_28, XFUNC_TICK(FUNC_EVERY_50_MSECOND));
+  }
+
   if (tm1638_type) {
     switch (function) {
       case FUNC_INIT:
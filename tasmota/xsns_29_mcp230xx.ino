@@ -905,6 +905,10 @@ void MCP230xx_SwitchRelay() {
 
 bool Xsns29(uint8_t function)
 {
+  if (FUNC_PRE_INIT == function) {
+    XsnsSubscribe(XSNS_29, XFUNC_TICK(FUNC_EVERY_50_MSECOND) | XFUNC_TICK(FUNC_EVERY_SECOND));
+  }
+
   if (!I2cEnabled(XI2C_22)) { return false; }
 
   bool result = false;
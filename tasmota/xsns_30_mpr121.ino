@@ -409,6 +409,10 @@ void Mpr121Show(struct mpr121 *pS, uint8_t function)
  */
 bool Xsns30(uint8_t function)
 {
+  if (FUNC_PRE_INIT == function) {
+    XsnsSubscribe(XSNS_30, XFUNC_TICK(FUNC_EVERY_50_MSECOND));
+  }
+
   if (!I2cEnabled(XI2C_23)) { return false; }
 
 	bool result = false;
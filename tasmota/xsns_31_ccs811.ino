@@ -107,6 +107,10 @@ void CCS811Show(bool json)
 
 bool Xsns31(uint8_t function)
 {
+  if (FUNC_PRE_INIT == function) {
+    XsnsSubscribe(XSNS_31, XFUNC_TICK(FUNC_EVERY_SECOND));
+  }
+
   if (!I2cEnabled(XI2C_24)) { return false; }
 
   bool result = false;
@@ -250,6 +250,10 @@ void MPU_6050Show(bool json)
 
 bool Xsns32(uint8_t function)
 {
+  if (FUNC_PRE_INIT == function) {
+    XsnsSubscribe(XSNS_32, XFUNC_TICK(FUNC_EVERY_SECOND));
+  }
+
   if (!I2cEnabled(XI2C_25)) { return false; }
 
   bool result = false;
@@ -164,6 +164,10 @@ void DS3231EverySecond(void)
 
 bool Xsns33(uint8_t function)
 {
+  if (FUNC_PRE_INIT == function) {
+    XsnsSubscribe(XSNS_33, XFUNC_TICK(FUNC_EVERY_SECOND));
+  }
+
   if (!I2cEnabled(XI2C_26)) { return false; }
 
   bool result = false;
@@ -544,6 +544,10 @@ bool Xsns34(uint8_t function)
 {
   bool result = false;
 
+  if (FUNC_PRE_INIT == function) {
+    XsnsSubscribe(XSNS_34, XFUNC_TICK(FUNC_EVERY_100_MSECOND));
+  }
+
   if (Hx.type) {
     switch (function) {
       case FUNC_EVERY_100_MSECOND:
@@ -585,6 +585,10 @@ bool Xsns35(uint8_t function)
 {
   bool result = false;
 
+  if (FUNC_PRE_INIT == function) {
+    XsnsSubscribe(XSNS_35, XFUNC_TICK(FUNC_EVERY_SECOND));
+  }
+
   if (PinUsed(GPIO_TX2X_TXD_BLACK)) {
     switch (function) {
       case FUNC_INIT:
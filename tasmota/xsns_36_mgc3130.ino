@@ -601,6 +601,10 @@ bool MGC3130CommandSensor()
 
 bool Xsns36(uint8_t function)
 {
+  if (FUNC_PRE_INIT == function) {
+    XsnsSubscribe(XSNS_36, XFUNC_TICK(FUNC_EVERY_50_MSECOND));
+  }
+
   if (!I2cEnabled(XI2C_27)) { return false; }
 
   bool result = false;
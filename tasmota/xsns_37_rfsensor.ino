@@ -653,6 +653,10 @@ bool Xsns37(uint8_t function)
 {
   bool result = false;
 
+  if (FUNC_PRE_INIT == function) {
+    XsnsSubscribe(XSNS_37, XFUNC_TICK(FUNC_LOOP) | XFUNC_TICK(FUNC_EVERY_SECOND));
+  }
+
   if (PinUsed(GPIO_RF_SENSOR) && (FUNC_INIT == function)) {
     RfSnsInit();
   }
@@ -301,6 +301,10 @@ bool Xsns38(uint8_t function)
 {
   bool result = false;
 
+  if (FUNC_PRE_INIT == function) {
+    XsnsSubscribe(XSNS_38, XFUNC_TICK(FUNC_EVERY_SECOND));
+  }
+
   if(az_type){
     switch (function) {
       case FUNC_INIT:
@@ -173,6 +173,10 @@ bool Xsns39(uint8_t function)
 {
   bool result = false;
 
+  if (FUNC_PRE_INIT == function) {
+    XsnsSubscribe(XSNS_39, XFUNC_TICK(FUNC_EVERY_SECOND));
+  }
+
   if (FUNC_INIT == function) {
     MAX31855_Init();
   }
@@ -547,6 +547,10 @@ void PN532_Show(void) {
 bool Xsns40(uint8_t function) {
   bool result = false;
 
+  if (FUNC_PRE_INIT == function) {
+    XsnsSubscribe(XSNS_40, XFUNC_TICK(FUNC_EVERY_250_MSECOND));
+  }
+
   if (FUNC_INIT == function) {
     PN532_Init();
   }
@@ -141,6 +141,10 @@ void Max4409Show(bool json)
 
 bool Xsns41(uint8_t function)
 {
+  if (FUNC_PRE_INIT == function) {
+    XsnsSubscribe(XSNS_41, XFUNC_TICK(FUNC_EVERY_SECOND));
+  }
+
   if (!I2cEnabled(XI2C_28)) { return false; }
 
   bool result = false;
@@ -393,6 +393,10 @@ void Scd30Show(bool json)
 
 bool Xsns42(byte function)
 {
+  if (FUNC_PRE_INIT == function) {
+    XsnsSubscribe(XSNS_42, XFUNC_TICK(FUNC_EVERY_SECOND));
+  }
+
   if (!I2cEnabled(XI2C_29)) { return false; }
 
   bool result = false;
@@ -259,6 +259,10 @@ void hreShow(boolean json)
 \*********************************************************************************************/
 bool Xsns43(byte function)
 {
+  if (FUNC_PRE_INIT == function) {
+    XsnsSubscribe(XSNS_43, XFUNC_TICK(FUNC_EVERY_50_MSECOND) | XFUNC_TICK(FUNC_EVERY_SECOND));
+  }
+
    // If we don't have pins assigned give up quickly.
    if (!PinUsed(GPIO_HRE_CLOCK) || !PinUsed(GPIO_HRE_DATA)) { return false; }
 
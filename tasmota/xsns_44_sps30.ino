@@ -285,6 +285,10 @@ bool SPS30_cmd(void)
 
 bool Xsns44(byte function)
 {
+  if (FUNC_PRE_INIT == function) {
+    XsnsSubscribe(XSNS_44, XFUNC_TICK(FUNC_EVERY_SECOND));
+  }
+
   if (!I2cEnabled(XI2C_30)) { return false; }
 
   bool result = false;
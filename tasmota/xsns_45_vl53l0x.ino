@@ -240,6 +240,10 @@ void Vl53l0Show(boolean json) {
 \*********************************************************************************************/
 
 bool Xsns45(byte function) {
+  if (FUNC_PRE_INIT == function) {
+    XsnsSubscribe(XSNS_45, XFUNC_TICK(FUNC_EVERY_250_MSECOND) | XFUNC_TICK(FUNC_EVERY_SECOND));
+  }
+
   if (!I2cEnabled(XI2C_31)) { return false; }
 
   bool result = false;
@@ -139,6 +139,10 @@ uint8_t MLX90614_crc8(uint8_t *addr, uint8_t len)
 
 bool Xsns46(byte function)
 {
+  if (FUNC_PRE_INIT == function) {
+    XsnsSubscribe(XSNS_46, XFUNC_TICK(FUNC_EVERY_SECOND));
+  }
+
   if (!I2cEnabled(XI2C_32)) { return false; }
 
   bool result = false;
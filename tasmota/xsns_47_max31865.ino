@@ -391,6 +391,10 @@ bool Xsns47(uint8_t function)
 {
   bool result = false;
 
+  if (FUNC_PRE_INIT == function) {
+    XsnsSubscribe(XSNS_47, XFUNC_TICK(FUNC_EVERY_SECOND));
+  }
+
   if (PinUsed(GPIO_SSPI_MAX31865_CS1, GPIO_ANY) && PinUsed(GPIO_SSPI_MISO) && PinUsed(GPIO_SSPI_MOSI) && PinUsed(GPIO_SSPI_SCLK)) {
     switch (function) {
       case FUNC_INIT:
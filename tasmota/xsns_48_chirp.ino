@@ -519,6 +519,10 @@ bool ChirpCmd(void) {
 
 bool Xsns48(uint8_t function)
 {
+  if (FUNC_PRE_INIT == function) {
+    XsnsSubscribe(XSNS_48, XFUNC_TICK(FUNC_EVERY_100_MSECOND));
+  }
+
   if (!I2cEnabled(XI2C_33)) { return false; }
 
   bool result = false;
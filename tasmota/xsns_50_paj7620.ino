@@ -424,6 +424,10 @@ bool PAJ7620CommandSensor(void)
 
 bool Xsns50(uint8_t function)
 {
+  if (FUNC_PRE_INIT == function) {
+    XsnsSubscribe(XSNS_50, XFUNC_TICK(FUNC_EVERY_100_MSECOND));
+  }
+
   if (!I2cEnabled(XI2C_34)) { return false; }
 
   bool result = false;
@@ -148,6 +148,10 @@ void RDM6300Show(void) {
 bool Xsns51(byte function) {
   bool result = false;
 
+  if (FUNC_PRE_INIT == function) {
+    XsnsSubscribe(XSNS_51, XFUNC_TICK(FUNC_EVERY_100_MSECOND));
+  }
+
   switch (function) {
     case FUNC_INIT:
       RDM6300Init();
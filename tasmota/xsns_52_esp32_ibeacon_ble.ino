@@ -566,6 +566,10 @@ bool Xsns52(byte function)
 {
   bool result = false;
 
+  if (FUNC_PRE_INIT == function) {
+    XsnsSubscribe(XSNS_52, XFUNC_TICK(FUNC_LOOP) | XFUNC_TICK(FUNC_EVERY_SECOND));
+  }
+
     switch (function) {
       case FUNC_INIT:
         IBEACON_Init();
@@ -2996,6 +2996,11 @@ void SML_CounterSaveState(void) {
 
 bool Xsns53(byte function) {
   bool result = false;
+
+  if (FUNC_PRE_INIT == function) {
+    XsnsSubscribe(XSNS_53, XFUNC_TICK(FUNC_LOOP) | XFUNC_TICK(FUNC_EVERY_50_MSECOND) | XFUNC_TICK(FUNC_EVERY_100_MSECOND));
+  }
+
     switch (function) {
       case FUNC_INIT:
         SML_Init();
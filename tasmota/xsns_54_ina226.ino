@@ -545,6 +545,10 @@ void Ina226Show(bool json)
  */
 bool Xsns54(byte callback_id)
 {
+  if (FUNC_PRE_INIT == callback_id) {
+    XsnsSubscribe(XSNS_54, XFUNC_TICK(FUNC_EVERY_SECOND));
+  }
+
   if (!I2cEnabled(XI2C_35)) { return false; }
 
   // Set return value to `false`
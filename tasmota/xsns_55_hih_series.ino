@@ -106,6 +106,10 @@ void Hih6Show(bool json)
 
 bool Xsns55(uint8_t function)
 {
+  if (FUNC_PRE_INIT == function) {
+    XsnsSubscribe(XSNS_55, XFUNC_TICK(FUNC_EVERY_SECOND));
+  }
+
   if (!I2cEnabled(XI2C_36)) { return false; }
 
   bool result = false;
@@ -117,6 +117,10 @@ bool Xsns56(uint8_t function)
 {
   bool result = false;
 
+  if (FUNC_PRE_INIT == function) {
+    XsnsSubscribe(XSNS_56, XFUNC_TICK(FUNC_EVERY_SECOND));
+  }
+
   if (hpma_type) {
     switch (function) {
       case FUNC_INIT:
@@ -96,6 +96,10 @@ void Tsl2591Show(bool json)
 
 bool Xsns57(uint8_t function)
 {
+  if (FUNC_PRE_INIT == function) {
+    XsnsSubscribe(XSNS_57, XFUNC_TICK(FUNC_EVERY_SECOND));
+  }
+
   if (!I2cEnabled(XI2C_40)) { return false; }
 
   bool result = false;
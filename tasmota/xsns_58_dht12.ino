@@ -100,6 +100,10 @@ void Dht12Show(bool json)
 
 bool Xsns58(uint8_t function)
 {
+  if (FUNC_PRE_INIT == function) {
+    XsnsSubscribe(XSNS_58, XFUNC_TICK(FUNC_EVERY_SECOND));
+  }
+
   if (!I2cEnabled(XI2C_41)) { return false; }
 
   bool result = false;
@@ -206,6 +206,10 @@ void DS1624Show(bool json)
 
 bool Xsns59(uint8_t function)
 {
+  if (FUNC_PRE_INIT == function) {
+    XsnsSubscribe(XSNS_59, XFUNC_TICK(FUNC_EVERY_SECOND));
+  }
+
   if (!I2cEnabled(XI2C_42)) { return false; }
 
   bool result = false;
@@ -877,6 +877,10 @@ bool Xsns60(uint8_t function)
 {
   bool result = false;
 
+  if (FUNC_PRE_INIT == function) {
+    XsnsSubscribe(XSNS_60, XFUNC_TICK(FUNC_EVERY_50_MSECOND) | XFUNC_TICK(FUNC_EVERY_100_MSECOND));
+  }
+
   if (FUNC_INIT == function) {
     UBXDetect();
   }
@@ -1969,6 +1969,11 @@ void MINRFShow(bool json)
 bool Xsns61(uint8_t function)
 {
   bool result = false;
+
+  if (FUNC_PRE_INIT == function) {
+    XsnsSubscribe(XSNS_61, XFUNC_TICK(FUNC_EVERY_50_MSECOND) | XFUNC_TICK(FUNC_EVERY_SECOND));
+  }
+
   if (NRF24.chipType) {
     switch (function) {
       case FUNC_INIT:
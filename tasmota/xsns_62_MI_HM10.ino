@@ -2042,6 +2042,10 @@ bool Xsns62(uint8_t function)
 {
   bool result = false;
 
+  if (FUNC_PRE_INIT == function) {
+    XsnsSubscribe(XSNS_62, XFUNC_TICK(FUNC_EVERY_50_MSECOND) | XFUNC_TICK(FUNC_EVERY_100_MSECOND) | XFUNC_TICK(FUNC_EVERY_SECOND));
+  }
+
   if (PinUsed(GPIO_HM10_RX) && PinUsed(GPIO_HM10_TX)) {
     switch (function) {
       case FUNC_INIT:
@@ -189,6 +189,10 @@ void AHT1XShow(bool json) {
 
 bool Xsns63(uint8_t function)
 {
+  if (FUNC_PRE_INIT == function) {
+    XsnsSubscribe(XSNS_63, XFUNC_TICK(FUNC_EVERY_100_MSECOND));
+  }
+
   if (!I2cEnabled(XI2C_43)) { return false; }
   bool result = false;
 
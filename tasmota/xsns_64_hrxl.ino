@@ -100,6 +100,10 @@ void HRXLShow(bool json)
 
 bool Xsns64(uint8_t function)
 {
+  if (FUNC_PRE_INIT == function) {
+    XsnsSubscribe(XSNS_64, XFUNC_TICK(FUNC_EVERY_SECOND));
+  }
+
    if (!PinUsed(GPIO_HRXL_RX)) { return false; }
 
    switch (function)
@@ -126,6 +126,10 @@ void IAQ_Show(uint8_t json)
 
 bool Xsns66(byte function)
 {
+  if (FUNC_PRE_INIT == function) {
+    XsnsSubscribe(XSNS_66, 0);              // No periodic functions
+  }
+
   if (!I2cEnabled(XI2C_46)) { return false; }
 
   bool result = false;
@@ -827,6 +827,10 @@ void AH3935Show(bool json) {
 \*********************************************************************************************/
 
 bool Xsns67(uint8_t function) {
+  if (FUNC_PRE_INIT == function) {
+    XsnsSubscribe(XSNS_67, XFUNC_TICK(FUNC_EVERY_SECOND));
+  }
+
   if (!I2cEnabled(XI2C_48)) { return false; }
   bool result = false;
   if (FUNC_INIT == function) {
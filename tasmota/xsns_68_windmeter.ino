@@ -317,6 +317,11 @@ bool Xsns68Cmnd(void)
 bool Xsns68(uint8_t function)
 {
   bool result = false;
+
+  if (FUNC_PRE_INIT == function) {
+    XsnsSubscribe(XSNS_68, XFUNC_TICK(FUNC_EVERY_SECOND));
+  }
+
   if (PinUsed(GPIO_WINDMETER_SPEED)) {
     switch (function) {
       case FUNC_INIT:
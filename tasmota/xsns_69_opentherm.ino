@@ -559,6 +559,11 @@ void sns_opentherm_set_hot_water_cmd(void)
 bool Xsns69(uint8_t function)
 {
     bool result = false;
+
+  if (FUNC_PRE_INIT == function) {
+    XsnsSubscribe(XSNS_69, XFUNC_TICK(FUNC_LOOP) | XFUNC_TICK(FUNC_EVERY_100_MSECOND) | XFUNC_TICK(FUNC_EVERY_SECOND));
+  }
+
     if (FUNC_INIT == function)
     {
         if (sns_opentherm_Init())
@@ -274,6 +274,10 @@ void VEML6075Show(bool json)
 
 bool Xsns70(uint8_t function)
 {
+  if (FUNC_PRE_INIT == function) {
+    XsnsSubscribe(XSNS_70, XFUNC_TICK(FUNC_EVERY_SECOND));
+  }
+
   if (!I2cEnabled(XI2C_49)) { return false; }
 
   bool result = false;
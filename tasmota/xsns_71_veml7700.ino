@@ -173,6 +173,10 @@ bool VEML7700Cmd(void) {
 
 bool Xsns71(uint8_t function)
 {
+  if (FUNC_PRE_INIT == function) {
+    XsnsSubscribe(XSNS_71, XFUNC_TICK(FUNC_EVERY_SECOND));
+  }
+
   if (!I2cEnabled(XI2C_50)) { return false; }
 
   bool result = false;
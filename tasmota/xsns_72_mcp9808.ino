@@ -105,6 +105,10 @@ void MCP9808Show(bool json) {
 
 bool Xsns72(uint8_t function)
 {
+  if (FUNC_PRE_INIT == function) {
+    XsnsSubscribe(XSNS_72, XFUNC_TICK(FUNC_EVERY_SECOND));
+  }
+
   if (!I2cEnabled(XI2C_51)) { return false; }
   bool result = false;
 
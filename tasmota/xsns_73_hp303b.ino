@@ -144,6 +144,10 @@ void HP303B_Show(bool json) {
 
 bool Xsns73(uint8_t function)
 {
+  if (FUNC_PRE_INIT == function) {
+    XsnsSubscribe(XSNS_73, XFUNC_TICK(FUNC_EVERY_SECOND));
+  }
+
   if (!I2cEnabled(XI2C_52)) { return false; }
 
   bool result = false;
@@ -112,6 +112,10 @@ bool Xsns74(uint8_t function)
 {
   bool result = false;
 
+  if (FUNC_PRE_INIT == function) {
+    XsnsSubscribe(XSNS_74, XFUNC_TICK(FUNC_EVERY_SECOND));
+  }
+
   if (FUNC_INIT == function) {
     LMT01_Init();
   }
@@ -66,14 +66,128 @@ const char *UnitfromType(const char *type)
 
 // Replace spaces and periods in metric name to match Prometheus metrics
 // convention.
-String FormatMetricName(const char *metric) {
-  String formatted = metric;
-  formatted.toLowerCase();
-  formatted.replace(" ", "_");
-  formatted.replace(".", "_");
+char* FormatMetricName(char *formatted, size_t size, const char *metric) {
+  uint32_t i = 0;
+  for (; metric[i] && (i < size -1); i++) {
+    char c = tolower(metric[i]);
+    formatted[i] = ((' ' == c) || ('.' == c)) ? '_' : c;
+  }
+  formatted[i] = '\0';
   return formatted;
 }
 
+/*********************************************************************************************\
+ * Metrics registry
+ *
+ * Drivers register the address of a measured value once, usually on FUNC_INIT, with
+ * MetricsAdd("SHT3X", PSTR(D_JSON_TEMPERATURE), &temperature, METRIC_FLOAT, METRIC_GAUGE, METRIC_RES_TEMPERATURE).
+ * Registered values are streamed on /metrics as tasmota_sensors_<type>_<unit>{sensor="<name>"}
+ * without building and parsing sensor JSON. A float NAN value is not exported. The float resolution
+ * is either a fixed number of decimals or a MetricResolutions setting read when the value is sent.
+ * Values of drivers not using the registry are still taken from the sensor JSON.
+\*********************************************************************************************/
+
+const uint8_t MAX_METRICS = 64;
+
+typedef struct METRIC_ENTRY {
+  const void* value;
+  const char* unit;                  // From UnitfromType()
+  char sensor[24];                   // Formatted sensor name as "am2301-14"
+  char type[24];                     // Formatted type as "temperature"
+  uint8_t format;                    // MetricFormats
+  uint8_t metric_type;               // MetricTypes
+  uint8_t resolution;                // Float decimals or MetricResolutions
+} METRIC_ENTRY;
+
+struct METRICS {
+  METRIC_ENTRY* entries = nullptr;
+  uint8_t count = 0;
+  uint8_t size = 0;
+} Metrics;
+
+bool MetricsAdd(const char* sensor, const char* type_P, const void* value, uint32_t format, uint32_t metric_type, uint32_t resolution) {
+  if (Metrics.count == Metrics.size) {
+    if (Metrics.size >= MAX_METRICS) { return false; }
+    uint32_t size = Metrics.size + 8;
+    METRIC_ENTRY* entries = (METRIC_ENTRY*)realloc(Metrics.entries, size * sizeof(METRIC_ENTRY));
+    if (!entries) { return false; }
+    Metrics.entries = entries;
+    Metrics.size = size;
+  }
+  METRIC_ENTRY &entry = Metrics.entries[Metrics.count];
+  char type[sizeof(entry.type)];
+  strncpy_P(type, type_P, sizeof(type) -1);
+  type[sizeof(type) -1] = '\0';
+  FormatMetricName(entry.type, sizeof(entry.type), type);
+  FormatMetricName(entry.sensor, sizeof(entry.sensor), sensor);
+  entry.unit = UnitfromType(entry.type);
+  entry.value = value;
+  entry.format = format;
+  entry.metric_type = metric_type;
+  entry.resolution = resolution;
+  Metrics.count++;
+  return true;
+}
+
+uint32_t MetricsResolution(uint32_t resolution) {
+  switch (resolution) {
+    case METRIC_RES_TEMPERATURE: return Settings->flag2.temperature_resolution;
+    case METRIC_RES_HUMIDITY:    return Settings->flag2.humidity_resolution;
+    case METRIC_RES_PRESSURE:    return Settings->flag2.pressure_resolution;
+    case METRIC_RES_ENERGY:      return Settings->flag2.energy_resolution;
+    case METRIC_RES_WATTAGE:     return Settings->flag2.wattage_resolution;
+    case METRIC_RES_VOLTAGE:     return Settings->flag2.voltage_resolution;
+    case METRIC_RES_CURRENT:     return Settings->flag2.current_resolution;
+    case METRIC_RES_FREQUENCY:   return Settings->flag2.frequency_resolution;
+  }
+  return resolution;
+}
+
+bool MetricsFind(const char* sensor, const char* type) {
+  // Sensor and type as formatted by FormatMetricName()
+  for (uint32_t i = 0; i < Metrics.count; i++) {
+    if (!strcmp(Metrics.entries[i].type, type) && !strcmp(Metrics.entries[i].sensor, sensor)) { return true; }
+  }
+  return false;
+}
+
+void MetricsStream(void) {
+  char line[128];
+  char value[FLOATSZ];
+  for (uint32_t i = 0; i < Metrics.count; i++) {
+    const METRIC_ENTRY &first = Metrics.entries[i];
+    bool shown = false;
+    for (uint32_t j = 0; j < i; j++) {
+      if (!strcmp(Metrics.entries[j].type, first.type)) { shown = true; break; }
+    }
+    if (shown) { continue; }                         // Metric family already sent with all its samples
+
+    uint32_t len = snprintf_P(line, sizeof(line), PSTR("# TYPE tasmota_sensors_%s_%s %s\n"),
+      first.type, first.unit, (METRIC_COUNTER == first.metric_type) ? "counter" : "gauge");
+    WSContentSend(line, tmin(len, sizeof(line) -1));
+    for (uint32_t k = i; k < Metrics.count; k++) {
+      const METRIC_ENTRY &entry = Metrics.entries[k];
+      if (strcmp(entry.type, first.type)) { continue; }
+      switch (entry.format) {
+        case METRIC_FLOAT: {
+          float fvalue = *(const float*)entry.value;
+          if (isnan(fvalue)) { continue; }
+          dtostrfd(fvalue, MetricsResolution(entry.resolution), value);
+          break;
+        }
+        case METRIC_INT32:
+          snprintf_P(value, sizeof(value), PSTR("%d"), *(const int32_t*)entry.value);
+          break;
+        default:
+          snprintf_P(value, sizeof(value), PSTR("%u"), *(const uint32_t*)entry.value);
+      }
+      len = snprintf_P(line, sizeof(line), PSTR("tasmota_sensors_%s_%s{sensor=\"%s\"} %s\n"),
+        entry.type, entry.unit, entry.sensor, value);
+      WSContentSend(line, tmin(len, sizeof(line) -1));
+    }
+  }
+}
+
 // Labels can be any sequence of UTF-8 characters, but backslash, double-quote
 // and line feed must be escaped.
 String FormatLabelValue(const char *value) {
@@ -84,6 +198,45 @@ String FormatLabelValue(const char *value) {
   return formatted;
 }
 
+// Driver call profile, enabled with command Profile 1, as histogram of call durations.
+void HandleMetricsProfile(void) {
+  if (!Profile.table) { return; }
+
+  char labels[48];
+  char parameter[FLOATSZ];
+  double cycles_per_second = Profile.cycles_per_us * 1000000.0;
+
+  WSContentSend_P(PSTR("# TYPE tasmota_driver_call_duration_seconds histogram\n"));
+  for (uint32_t i = 0; i < PROFILE_MAX_ENTRIES; i++) {
+    const PROFILE_ENTRY &entry = Profile.table[i];
+    if (!entry.key) { continue; }
+    char source[4];
+    snprintf_P(labels, sizeof(labels), PSTR("dispatcher=\"%s\",driver=\"%u\",function=\"%u\""),
+      GetTextIndexed(source, sizeof(source), (entry.key >> 13) & 0x03, kProfileSources), ProfileDriverId(entry.key), entry.key & 0x3F);
+    uint32_t cumulative = 0;
+    for (uint32_t bucket = 0; bucket < PROFILE_BUCKETS -1; bucket++) {
+      cumulative += entry.histogram[bucket];
+      dtostrfd(kProfileBucketUs[bucket] / 1000000.0, 5, parameter);
+      WSContentSend_P(PSTR("tasmota_driver_call_duration_seconds_bucket{%s,le=\"%s\"} %u\n"), labels, parameter, cumulative);
+    }
+    // The +Inf bucket must equal the count
+    WSContentSend_P(PSTR("tasmota_driver_call_duration_seconds_bucket{%s,le=\"+Inf\"} %u\n"), labels, entry.calls);
+    dtostrfd(entry.cycles / cycles_per_second, 6, parameter);
+    WSContentSend_P(PSTR("tasmota_driver_call_duration_seconds_sum{%s} %s\n"), labels, parameter);
+    WSContentSend_P(PSTR("tasmota_driver_call_duration_seconds_count{%s} %u\n"), labels, entry.calls);
+  }
+
+  WSContentSend_P(PSTR("# TYPE tasmota_driver_call_max_seconds gauge\n"));
+  for (uint32_t i = 0; i < PROFILE_MAX_ENTRIES; i++) {
+    const PROFILE_ENTRY &entry = Profile.table[i];
+    if (!entry.key) { continue; }
+    char source[4];
+    dtostrfd(entry.max_cycles / cycles_per_second, 6, parameter);
+    WSContentSend_P(PSTR("tasmota_driver_call_max_seconds{dispatcher=\"%s\",driver=\"%u\",function=\"%u\"} %s\n"),
+      GetTextIndexed(source, sizeof(source), (entry.key >> 13) & 0x03, kProfileSources), ProfileDriverId(entry.key), entry.key & 0x3F, parameter);
+  }
+}
+
 void HandleMetrics(void) {
   if (!HttpCheckPriviledgedAccess()) { return; }
 
@@ -145,15 +298,21 @@ void HandleMetrics(void) {
   WSContentSend_P(PSTR("# TYPE energy_power_kilowatts_total counter\nenergy_power_kilowatts_total %s\n"), parameter);
 #endif
 
+  HandleMetricsProfile();
+
   for (uint32_t device = 0; device < TasmotaGlobal.devices_present; device++) {
     power_t mask = 1 << device;
     WSContentSend_P(PSTR("# TYPE relay%d_state gauge\nrelay%d_state %d\n"), device+1, device+1, (TasmotaGlobal.power & mask));
   }
 
+  MetricsStream();
+
+  // Fallback for drivers not using the metrics registry
   ResponseClear();
   MqttShowSensor(); //Pull sensor data
-  String jsonStr = TasmotaGlobal.mqtt_data;
-  JsonParser parser((char *)jsonStr.c_str());
+  char sensor[24];
+  char type[24];
+  JsonParser parser(ResponseData());  // Parse in place as response is cleared afterwards
   JsonParserObject root = parser.getRootObject();
   if (root) { // did JSON parsing succeed?
     for (auto key1 : root) {
@@ -167,26 +326,28 @@ void HandleMetrics(void) {
             for (auto key3 : Object3) {
               const char *value = key3.getValue().getStr(nullptr);
               if (value != nullptr && isdigit(value[0])) {
-                String sensor = FormatMetricName(key2.getStr());
-                String type = FormatMetricName(key3.getStr());
-                const char *unit = UnitfromType(type.c_str());                     //grab base unit corresponding to type
+                FormatMetricName(sensor, sizeof(sensor), key2.getStr());
+                FormatMetricName(type, sizeof(type), key3.getStr());
+                if (MetricsFind(sensor, type)) { continue; }                         // Already sent from registry
+                const char *unit = UnitfromType(type);                               //grab base unit corresponding to type
                 WSContentSend_P(PSTR("# TYPE tasmota_sensors_%s_%s gauge\ntasmota_sensors_%s_%s{sensor=\"%s\"} %s\n"),
-                  type.c_str(), unit, type.c_str(), unit, sensor.c_str(), value);  //build metric as "# TYPE tasmota_sensors_%type%_%unit% gauge\ntasmotasensors_%type%_%unit%{sensor=%sensor%"} %value%""
+                  type, unit, type, unit, sensor, value);  //build metric as "# TYPE tasmota_sensors_%type%_%unit% gauge\ntasmotasensors_%type%_%unit%{sensor=%sensor%"} %value%""
               }
             }
           } else {
             const char *value = value2.getStr(nullptr);
             if (value != nullptr && isdigit(value[0])) {
-              String sensor = FormatMetricName(key1.getStr());
-              String type = FormatMetricName(key2.getStr());
-              const char *unit = UnitfromType(type.c_str());
-              if (strcmp(type.c_str(), "totalstarttime") != 0) {  // this metric causes Prometheus of fail
-                if (strcmp(type.c_str(), "id") == 0) {            // this metric is NaN, so convert it to a label, see Wi-Fi metrics above
+              FormatMetricName(sensor, sizeof(sensor), key1.getStr());
+              FormatMetricName(type, sizeof(type), key2.getStr());
+              if (MetricsFind(sensor, type)) { continue; }                           // Already sent from registry
+              const char *unit = UnitfromType(type);
+              if (strcmp(type, "totalstarttime") != 0) {  // this metric causes Prometheus of fail
+                if (strcmp(type, "id") == 0) {            // this metric is NaN, so convert it to a label, see Wi-Fi metrics above
                   WSContentSend_P(PSTR("# TYPE tasmota_sensors_%s_%s gauge\ntasmota_sensors_%s_%s{sensor=\"%s\",id=\"%s\"} 1\n"),
-                    type.c_str(), unit, type.c_str(), unit, sensor.c_str(), value);
+                    type, unit, type, unit, sensor, value);
                 } else {
                   WSContentSend_P(PSTR("# TYPE tasmota_sensors_%s_%s gauge\ntasmota_sensors_%s_%s{sensor=\"%s\"} %s\n"),
-                    type.c_str(), unit, type.c_str(), unit, sensor.c_str(), value);
+                    type, unit, type, unit, sensor, value);
                 }
               }
             }
@@ -194,13 +355,14 @@ void HandleMetrics(void) {
         }
       } else {
         const char *value = value1.getStr(nullptr);
-        String sensor = FormatMetricName(key1.getStr());
-        if (value != nullptr && isdigit(value[0] && strcmp(sensor.c_str(), "time") != 0)) {  //remove false 'time' metric
-          WSContentSend_P(PSTR("# TYPE tasmota_sensors_%s gauge\ntasmota_sensors{sensor=\"%s\"} %s\n"), sensor.c_str(), sensor.c_str(), value);
+        FormatMetricName(sensor, sizeof(sensor), key1.getStr());
+        if (value != nullptr && isdigit(value[0] && strcmp(sensor, "time") != 0)) {  //remove false 'time' metric
+          WSContentSend_P(PSTR("# TYPE tasmota_sensors_%s gauge\ntasmota_sensors{sensor=\"%s\"} %s\n"), sensor, sensor, value);
         }
       }
     }
   }
+  ResponseClear();
 
   WSContentEnd();
 }
@@ -213,6 +375,9 @@ bool Xsns75(uint8_t function) {
   bool result = false;
 
   switch (function) {
+    case FUNC_PRE_INIT:
+      XsnsSubscribe(XSNS_75, 0);                // No periodic functions
+      break;
     case FUNC_WEB_ADD_HANDLER:
       WebServer_on(PSTR("/metrics"), HandleMetrics);
       break;
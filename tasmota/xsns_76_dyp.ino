@@ -119,6 +119,10 @@ void DYPShow(bool json) {
 \*********************************************************************************************/
 
 bool Xsns76(uint8_t function) {
+  if (FUNC_PRE_INIT == function) {
+    XsnsSubscribe(XSNS_76, XFUNC_TICK(FUNC_EVERY_SECOND));
+  }
+
   if (!PinUsed(GPIO_DYP_RX)) { return false; }
 
   switch (function) {
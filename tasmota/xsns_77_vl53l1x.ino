@@ -90,6 +90,10 @@ void Vl53l1Show(bool json) {
 \*********************************************************************************************/
 
 bool Xsns77(uint8_t function) {
+  if (FUNC_PRE_INIT == function) {
+    XsnsSubscribe(XSNS_77, XFUNC_TICK(FUNC_EVERY_250_MSECOND) | XFUNC_TICK(FUNC_EVERY_SECOND));
+  }
+
   if (!I2cEnabled(XI2C_54)) { return false; }
 
   bool result = false;
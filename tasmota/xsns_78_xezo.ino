@@ -308,6 +308,10 @@ private:
 // What changes is the implementation of the class itself
 bool Xsns78(uint8_t function)
 {
+  if (FUNC_PRE_INIT == function) {
+    XsnsSubscribe(XSNS_78, XFUNC_TICK(FUNC_EVERY_SECOND));
+  }
+
   if (!I2cEnabled(XI2C_55)) {
     return false;
   }
@@ -297,6 +297,10 @@ void CmndFpCount(void) {
 bool Xsns79(uint8_t function) {
   bool result = false;
 
+  if (FUNC_PRE_INIT == function) {
+    XsnsSubscribe(XSNS_79, XFUNC_TICK(FUNC_EVERY_250_MSECOND));
+  }
+
   if (FUNC_INIT == function) {
     As608Init();
   }
@@ -163,6 +163,10 @@ bool RC522Command(void) {
 bool Xsns80(uint8_t function) {
   bool result = false;
 
+  if (FUNC_PRE_INIT == function) {
+    XsnsSubscribe(XSNS_80, XFUNC_TICK(FUNC_EVERY_250_MSECOND));
+  }
+
   if (FUNC_INIT == function) {
     RC522Init();
   }
@@ -330,6 +330,10 @@ void seeSoilName(int no, char *name, int len)   // generates a sensor name
 
 bool Xsns81(uint8_t function)
 {
+  if (FUNC_PRE_INIT == function) {
+    XsnsSubscribe(XSNS_81, XFUNC_TICK(FUNC_EVERY_50_MSECOND) | XFUNC_TICK(FUNC_EVERY_SECOND));
+  }
+
   if (!I2cEnabled(XI2C_56)) { return false; }
   bool result = false;
 
@@ -622,6 +622,10 @@ const char kWiegandCommands[] PROGMEM = "Wie|"  // No prefix
 bool Xsns82(byte function) {
   bool result = false;
 
+  if (FUNC_PRE_INIT == function) {
+    XsnsSubscribe(XSNS_82, XFUNC_TICK(FUNC_EVERY_100_MSECOND));
+  }
+
   if (FUNC_INIT == function) {
     oWiegand->Init();
   }
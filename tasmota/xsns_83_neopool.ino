@@ -1977,6 +1977,10 @@ bool Xsns83(uint8_t function)
 {
   bool result = false;
 
+  if (FUNC_PRE_INIT == function) {
+    XsnsSubscribe(XSNS_83, XFUNC_TICK(FUNC_EVERY_250_MSECOND));
+  }
+
   if (FUNC_INIT == function) {
     NeoPoolInit();
   } else if (neopool_active) {
@@ -110,6 +110,10 @@ void Tof10120Show(bool json) {
 \*********************************************************************************************/
 
 bool Xsns84(uint8_t function) {
+  if (FUNC_PRE_INIT == function) {
+    XsnsSubscribe(XSNS_84, XFUNC_TICK(FUNC_EVERY_250_MSECOND) | XFUNC_TICK(FUNC_EVERY_SECOND));
+  }
+
   if (!I2cEnabled(XI2C_57)) { return false; }
 
   bool result = false;
@@ -104,6 +104,10 @@ void MPU_Every_Second(void) {
 \*********************************************************************************************/
 
 bool Xsns85(uint8_t function) {
+  if (FUNC_PRE_INIT == function) {
+    XsnsSubscribe(XSNS_85, XFUNC_TICK(FUNC_EVERY_SECOND));
+  }
+
   if (!I2cEnabled(XI2C_58)) { return false; }
 
   bool result = false;
@@ -212,6 +212,11 @@ void TfmpShow(bool json)
 bool Xsns86(byte callback_id)
 {
     bool result = false;
+
+  if (FUNC_PRE_INIT == callback_id) {
+    XsnsSubscribe(XSNS_86, XFUNC_TICK(FUNC_EVERY_SECOND));
+  }
+
     if (FUNC_INIT == callback_id)
     {
         TfmpInit();
@@ -168,6 +168,10 @@ void Am2320Show(bool json)
 
 bool Xsns88(uint8_t function)
 {
+  if (FUNC_PRE_INIT == function) {
+    XsnsSubscribe(XSNS_88, XFUNC_TICK(FUNC_EVERY_SECOND));
+  }
+
   if (!I2cEnabled(XI2C_60)) { return false; }
 
   boolean result = false;
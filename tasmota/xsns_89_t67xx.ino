@@ -300,6 +300,11 @@ T67XX t67xx;
 bool Xsns89(uint8_t function)
 {
   uint16_t ppm = 0;
+
+  if (FUNC_PRE_INIT == function) {
+    XsnsSubscribe(XSNS_89, XFUNC_TICK(FUNC_EVERY_SECOND));
+  }
+
   if (!I2cEnabled(XI2C_61))
   {
     return false;
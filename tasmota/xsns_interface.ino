@@ -1053,8 +1053,45 @@ const uint8_t kXsnsList[] = {
 #endif
 };
 
+uint8_t xsns_tick_skip[sizeof(kXsnsList)] = { 0 };
+uint8_t xsns_tick_list[XFUNC_TICKS * sizeof(kXsnsList)];
+XFUNC_TICK_TABLE XsnsTicks = { xsns_tick_skip, xsns_tick_list, { 0 }, xsns_present, 0, false };
+
+bool XsnsSubscribe(uint32_t sensor, uint32_t ticks) {
+  return XFuncSubscribe(XsnsTicks, kXsnsList, sensor, ticks);
+}
+
+void XFuncShowStats(void) {
+  // {"StatusDSP":{"5":{"Calls":1234,"CyclesAvg":5678,"mS":12,"Drivers":4,"Sensors":2},...}}
+  // CyclesAvg is the average number of cpu cycles per call, mS the total time spent in all calls
+  Response_P(PSTR("{\"" D_CMND_STATUS D_STATUS14_DISPATCH "\":{"));
+  bool first = true;
+  uint32_t cycles_per_ms = ESP.getCpuFreqMHz() * 1000;
+  for (uint32_t function = 0; function <= FUNC_DEVICE_GROUP_ITEM; function++) {
+    uint32_t calls = XFuncStats[function].calls;
+    if (!calls) { continue; }
+    ResponseAppend_P(PSTR("%s\"%d\":{\"Calls\":%u,\"CyclesAvg\":%u,\"mS\":%u"), (first) ? "" : ",", function, calls,
+      (uint32_t)(XFuncStats[function].cycles / calls), (uint32_t)(XFuncStats[function].cycles / cycles_per_ms));
+    if (XFuncIsTick(function)) {
+      ResponseAppend_P(PSTR(",\"Drivers\":%u,\"Sensors\":%u"), XFuncTickCount(XdrvTicks, function), XFuncTickCount(XsnsTicks, function));
+    }
+    ResponseJsonEnd();
+    first = false;
+  }
+  ResponseJsonEndEnd();
+}
+
 /*********************************************************************************************/
 
+uint32_t XsnsId(uint32_t slot) {
+  if (slot >= xsns_present) { return 0; }
+#ifdef XFUNC_PTR_IN_ROM
+  return pgm_read_byte(kXsnsList + slot);
+#else
+  return kXsnsList[slot];
+#endif
+}
+
 bool XsnsEnabled(uint32_t sensor_list, uint32_t sns_index) {
   // sensor_list 0 = sensors
   // sensor_list 1 = web_sensors
@@ -1108,7 +1145,10 @@ bool XsnsNextCall(uint8_t Function, uint8_t &xsns_index) {
     if (xsns_index == xsns_present) { xsns_index = 0; }
   }
 
-  return xsns_func_ptr[xsns_index](Function);
+  uint32_t profile_start = ESP.getCycleCount();
+  bool result = xsns_func_ptr[xsns_index](Function);
+  if (Profile.table) { ProfileAdd(PROFILE_XSNS, xsns_index, Function, profile_start); }
+  return result;
 }
 
 bool XsnsCall(uint8_t Function) {
@@ -1120,14 +1160,26 @@ bool XsnsCall(uint8_t Function) {
   uint32_t profile_start_millis = millis();
 #endif  // PROFILE_XSNS_EVERY_SECOND
 
-  for (uint32_t x = 0; x < xsns_present; x++) {
+  uint32_t start_cycles = ESP.getCycleCount();
+
+  uint32_t count = xsns_present;
+  const uint8_t* list = nullptr;
+  if (XFuncIsTick(Function)) {
+    list = XFuncTickList(XsnsTicks, Function, count);  // Only subscribed sensors
+    XsnsTicks.dispatching++;
+  }
+
+  for (uint32_t i = 0; i < count; i++) {
+    uint32_t x = (list) ? list[i] : i;
     if (XsnsEnabled(0, x)) {  // Skip disabled sensor
       if ((FUNC_WEB_SENSOR == Function) && !XsnsEnabled(1, x)) { continue; }  // Skip web info for disabled sensors
 
 #ifdef PROFILE_XSNS_SENSOR_EVERY_SECOND
       uint32_t profile_start_millis = millis();
 #endif  // PROFILE_XSNS_SENSOR_EVERY_SECOND
+      uint32_t profile_start = ESP.getCycleCount();
       result = xsns_func_ptr[x](Function);
+      if (Profile.table) { ProfileAdd(PROFILE_XSNS, x, Function, profile_start); }
 
 #ifdef PROFILE_XSNS_SENSOR_EVERY_SECOND
       uint32_t profile_millis = millis() - profile_start_millis;
@@ -1146,6 +1198,9 @@ bool XsnsCall(uint8_t Function) {
       }
     }
   }
+  if (list) { XsnsTicks.dispatching--; }
+
+  XFuncStatsAdd(Function, start_cycles);
 
 #ifdef PROFILE_XSNS_EVERY_SECOND
   uint32_t profile_millis = millis() - profile_start_millis;
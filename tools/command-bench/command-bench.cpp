@@ -0,0 +1,606 @@
+/*
+  command-bench.cpp - host benchmark of the command dispatch, for Tasmota
+
+  Copyright (C) 2021  Theo Arends
+
+  This program is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+Instructions:
+  Dispatches a stream of commands (default 100000) to a simulated firmware of
+  core commands, drivers and sensors, DecodeCommand() on core followed by
+  XdrvCall() and XsnsCall() with FUNC_COMMAND, and reports the cost per
+  command and the number of command names compared of:
+    - the copying scan, GetCommandCode() copying each command name of a list
+      before comparing it
+    - the in place scan, GetCommandCode() comparing each command name where it
+      is and only copying the command found
+
+  The command lists are random names of the size of a typical build. Most
+  commands in the stream come from a working set of a dozen core, driver and
+  sensor commands as used by rules and timers, followed by a long tail. Some
+  drivers behave like the real ones:
+    - a driver only decoding its commands while a GPIO is configured
+    - a driver with add_cmd() like commands added and removed at run time,
+      taking names also used by later drivers
+    - sensors enabled and disabled at run time
+  The benchmark checks that both scans select the same handler and command
+  code for every command, and that GetCommandCode() returns the same code and
+  destination for every command name, in mixed case, truncated, extended and
+  unknown.
+
+  GetCommandCode() and DecodeCommand() are copies of tasmota/support.ino, the
+  copying scan they replaced is kept as a reference.
+
+  Host speeds don't reflect ESP8266 speeds, compare the ratios.
+
+Usage:
+  g++ -O2 -o command-bench tools/command-bench/command-bench.cpp
+  ./command-bench [commands [drivers [sensors]]]
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+#include <strings.h>
+#include <ctype.h>
+#include <time.h>
+#include <string>
+#include <vector>
+
+#define PROGMEM
+#define pgm_read_byte(addr) (*(const uint8_t *)(addr))
+#define snprintf_P snprintf
+
+const uint32_t CMDSZ = 24;                 // Max number of characters in command
+
+struct {
+  char *topic;
+  char command[CMDSZ];
+  uint32_t index;
+  uint32_t command_code;
+} XdrvMailbox;
+
+uint32_t name_compares = 0;                // Command names compared by GetCommandCode()
+
+/*********************************************************************************************\
+ * Copies of tasmota/support.ino
+\*********************************************************************************************/
+
+char* GetTextIndexed(char* destination, size_t destination_size, uint32_t index, const char* haystack)
+{
+  // Returns empty string if not found
+  // Returns text of found
+  char* write = destination;
+  const char* read = haystack;
+
+  index++;
+  while (index--) {
+    size_t size = destination_size -1;
+    write = destination;
+    char ch = '.';
+    while ((ch != '\0') && (ch != '|')) {
+      ch = pgm_read_byte(read++);
+      if (size && (ch != '|'))  {
+        *write++ = ch;
+        size--;
+      }
+    }
+    if (0 == ch) {
+      if (index) {
+        write = destination;
+      }
+      break;
+    }
+  }
+  *write = '\0';
+  return destination;
+}
+
+void CmndSetoptionBase(uint32_t indexed) {
+  XdrvMailbox.command_code = 1000 + XdrvMailbox.index;  // Record synonym as code above any command list
+}
+
+/*********************************************************************************************\
+ * Reference copying scan
+\*********************************************************************************************/
+
+namespace Copying {
+
+int GetCommandCode(char* destination, size_t destination_size, const char* needle, const char* haystack)
+{
+  // Returns -1 of not found
+  // Returns index and command if found
+  int result = -1;
+  const char* read = haystack;
+  char* write = destination;
+
+  while (true) {
+    result++;
+    size_t size = destination_size -1;
+    write = destination;
+    char ch = '.';
+    while ((ch != '\0') && (ch != '|')) {
+      ch = pgm_read_byte(read++);
+      if (size && (ch != '|'))  {
+        *write++ = ch;
+        size--;
+      }
+    }
+    *write = '\0';
+    name_compares++;
+    if (!strcasecmp(needle, destination)) {
+      break;
+    }
+    if (0 == ch) {
+      result = -1;
+      break;
+    }
+  }
+  return result;
+}
+
+bool DecodeCommand(const char* haystack, void (* const MyCommand[])(void), const uint8_t *synonyms = nullptr) {
+  GetTextIndexed(XdrvMailbox.command, CMDSZ, 0, haystack);  // Get prefix if available
+  int prefix_length = strlen(XdrvMailbox.command);
+  if (prefix_length) {
+    char prefix[prefix_length +1];
+    snprintf_P(prefix, sizeof(prefix), "%s", XdrvMailbox.topic);  // Copy prefix part only
+    if (strcasecmp(prefix, XdrvMailbox.command)) {
+      return false;                                         // Prefix not in command
+    }
+  }
+  size_t syn_count = synonyms ? pgm_read_byte(synonyms) : 0;
+  int command_code = GetCommandCode(XdrvMailbox.command + prefix_length, CMDSZ, XdrvMailbox.topic + prefix_length, haystack);
+  if (command_code > 0) {                                   // Skip prefix
+    if (command_code > syn_count) {
+      // We passed the synonyms zone, it's a regular command
+      XdrvMailbox.command_code = command_code - 1 - syn_count;
+      MyCommand[XdrvMailbox.command_code]();
+    } else {
+      // We have a SetOption synonym
+      XdrvMailbox.index = pgm_read_byte(synonyms + command_code);
+      CmndSetoptionBase(0);
+    }
+    return true;
+  }
+  return false;
+}
+
+}  // namespace Copying
+
+/*********************************************************************************************\
+ * In place scan - copy of tasmota/support.ino
+\*********************************************************************************************/
+
+namespace InPlace {
+
+int GetCommandCode(char* destination, size_t destination_size, const char* needle, const char* haystack)
+{
+  // Returns -1 of not found
+  // Returns index and command if found
+  // Commands are compared in place, only the found command (or the last if not found) is copied
+  int result = -1;
+  const char* read = haystack;
+  const char* command;
+  char ch;
+
+  do {
+    result++;
+    name_compares++;
+    command = read;
+    const char* compare = needle;
+    ch = pgm_read_byte(read++);
+    while (ch && (ch != '|') && (tolower((uint8_t)ch) == tolower((uint8_t)*compare))) {
+      compare++;
+      ch = pgm_read_byte(read++);
+    }
+    if (((0 == ch) || ('|' == ch)) && (0 == *compare)) {
+      break;                                                // Found
+    }
+    while (ch && (ch != '|')) {                             // Skip rest of command
+      ch = pgm_read_byte(read++);
+    }
+    if (0 == ch) {
+      result = -1;
+    }
+  } while (ch);
+  GetTextIndexed(destination, destination_size, 0, command);
+  return result;
+}
+
+bool DecodeCommand(const char* haystack, void (* const MyCommand[])(void), const uint8_t *synonyms = nullptr) {
+  GetTextIndexed(XdrvMailbox.command, CMDSZ, 0, haystack);  // Get prefix if available
+  int prefix_length = strlen(XdrvMailbox.command);
+  if (prefix_length) {
+    if (strncasecmp(XdrvMailbox.topic, XdrvMailbox.command, prefix_length)) {
+      return false;                                         // Prefix not in command
+    }
+  }
+  int command_code = GetCommandCode(XdrvMailbox.command + prefix_length, CMDSZ - prefix_length, XdrvMailbox.topic + prefix_length, haystack);
+  size_t syn_count = synonyms ? pgm_read_byte(synonyms) : 0;
+  if (command_code > 0) {                                   // Skip prefix
+    if (command_code > syn_count) {
+      // We passed the synonyms zone, it's a regular command
+      XdrvMailbox.command_code = command_code - 1 - syn_count;
+      MyCommand[XdrvMailbox.command_code]();
+    } else {
+      // We have a SetOption synonym
+      XdrvMailbox.index = pgm_read_byte(synonyms + command_code);
+      CmndSetoptionBase(0);
+    }
+    return true;
+  }
+  return false;
+}
+
+}  // namespace InPlace
+
+/*********************************************************************************************\
+ * Simulated firmware
+\*********************************************************************************************/
+
+enum DriverKinds { DRV_DECODE, DRV_GPIO, DRV_CUSTOM };
+
+struct Driver {
+  std::string haystack;                    // Prefix and commands separated by '|'
+  uint32_t kind;                           // DriverKinds
+  bool enabled;                            // GPIO configured or sensor enabled
+  std::vector<std::string> custom;         // Commands added at run time to a DRV_CUSTOM driver
+};
+
+std::vector<Driver> drivers;
+std::vector<Driver> sensors;
+std::string core_haystack;
+const uint8_t kCoreSynonyms[] = { 3, 1, 2, 3 };
+
+bool in_place = false;
+bool berry = false;                        // DRV_CUSTOM driver dispatches add_cmd() commands
+int32_t handled_by = -1;                   // 0 = core, 1000 + slot = driver, 2000 + slot = sensor
+int32_t handler_base = 0;
+
+void Handled(void) {}
+
+void (*MyCommands[200])(void);              // All Handled(), filled by main()
+
+bool DecodeCommand(const char* haystack, void (* const MyCommand[])(void), const uint8_t *synonyms = nullptr) {
+  return (in_place) ? InPlace::DecodeCommand(haystack, MyCommand, synonyms) : Copying::DecodeCommand(haystack, MyCommand, synonyms);
+}
+
+bool DriverCommand(Driver& driver) {
+  // Equivalent of case FUNC_COMMAND: in a driver
+  bool result = false;
+  switch (driver.kind) {
+    case DRV_DECODE:
+      result = DecodeCommand(driver.haystack.c_str(), MyCommands);
+      break;
+    case DRV_GPIO:
+      if (driver.enabled) {
+        result = DecodeCommand(driver.haystack.c_str(), MyCommands);
+      }
+      break;
+    case DRV_CUSTOM:
+      result = DecodeCommand(driver.haystack.c_str(), MyCommands);
+      if (!result && berry) {
+        for (uint32_t i = 0; i < driver.custom.size(); i++) {
+          if (!strcasecmp(XdrvMailbox.topic, driver.custom[i].c_str())) {
+            XdrvMailbox.command_code = 500 + i;
+            result = true;
+            break;
+          }
+        }
+      }
+      break;
+  }
+  return result;
+}
+
+bool XdrvFunc(uint32_t x) {
+  bool result = DriverCommand(drivers[x]);
+  if (result) { handled_by = 1000 + x; }
+  return result;
+}
+
+bool XsnsFunc(uint32_t x) {
+  bool result = DriverCommand(sensors[x]);
+  if (result) { handled_by = 2000 + x; }
+  return result;
+}
+
+bool XsnsEnabled(uint32_t sensor_list, uint32_t sns_index) {
+  return sensors[sns_index].enabled;
+}
+
+struct { bool table = false; } Profile;
+uint32_t profile_calls = 0;
+uint32_t stats_calls = 0;
+void ProfileAdd(uint32_t type, uint32_t index, uint32_t function, uint32_t start) { profile_calls++; }
+void XFuncStatsAdd(uint32_t function, uint32_t start) { stats_calls++; }
+uint32_t GetCycleCount(void) { return 0; }
+
+const uint8_t FUNC_COMMAND = 0;
+enum { PROFILE_XDRV, PROFILE_XSNS };
+
+bool CoreCommand(void) {
+  bool result = DecodeCommand(core_haystack.c_str(), MyCommands, kCoreSynonyms);
+  if (result) { handled_by = 0; }
+  return result;
+}
+
+/*********************************************************************************************\
+ * Copies of FUNC_COMMAND in XdrvCall() and XsnsCall() and of CommandHandler()
+\*********************************************************************************************/
+
+bool XdrvCall(uint8_t Function) {
+  bool result = false;
+  uint32_t start_cycles = GetCycleCount();
+  for (uint32_t x = 0; x < drivers.size(); x++) {
+    uint32_t profile_start = GetCycleCount();
+    result = XdrvFunc(x);
+    if (Profile.table) { ProfileAdd(PROFILE_XDRV, x, Function, profile_start); }
+    if (result) { break; }
+  }
+  XFuncStatsAdd(Function, start_cycles);
+  return result;
+}
+
+bool XsnsCall(uint8_t Function) {
+  bool result = false;
+  uint32_t start_cycles = GetCycleCount();
+  for (uint32_t x = 0; x < sensors.size(); x++) {
+    if (XsnsEnabled(0, x)) {
+      uint32_t profile_start = GetCycleCount();
+      result = XsnsFunc(x);
+      if (Profile.table) { ProfileAdd(PROFILE_XSNS, x, Function, profile_start); }
+      if (result) { break; }
+    }
+  }
+  XFuncStatsAdd(Function, start_cycles);
+  return result;
+}
+
+bool Dispatch(void) {
+  if (!CoreCommand()) {
+    if (!XdrvCall(FUNC_COMMAND)) {
+      if (!XsnsCall(FUNC_COMMAND)) {
+        return false;
+      }
+    }
+  }
+  return true;
+}
+
+/*********************************************************************************************\
+ * Workload
+\*********************************************************************************************/
+
+std::string RandomName(void) {
+  static const char* parts[] = { "Power", "Set", "Status", "Temp", "Pulse", "Time", "Led", "Color", "Mode",
+    "Speed", "Scheme", "Width", "Fade", "Dimmer", "Sensor", "Rule", "Var", "Mem", "Ir", "Rf", "Zb", "Tuya",
+    "Shutter", "Position", "Channel", "Config", "Reset", "Send", "Receive", "Baud", "Delay", "Interval" };
+  std::string name;
+  uint32_t count = 1 + random() % 3;
+  for (uint32_t i = 0; i < count; i++) {
+    name += parts[random() % (sizeof(parts) / sizeof(parts[0]))];
+  }
+  if (random() % 4 == 0) { name += (char)('A' + random() % 26); }
+  return name.substr(0, CMDSZ - 4);
+}
+
+std::vector<std::string> all_names;        // Commands of the firmware
+std::vector<std::string> shared_names;     // Commands of later drivers also added to the custom driver at run time
+
+std::string MakeHaystack(const char* prefix, uint32_t commands) {
+  std::string haystack = prefix;
+  for (uint32_t i = 0; i < commands; i++) {
+    std::string name = RandomName();
+    haystack += "|" + name;
+    all_names.push_back(std::string(prefix) + name);
+  }
+  return haystack;
+}
+
+void MakeFirmware(uint32_t driver_count, uint32_t sensor_count) {
+  core_haystack = "|Power|Status|Backlog|SetOption1|SetOption2|SetOption3";
+  all_names.push_back("Power");
+  all_names.push_back("Status");
+  all_names.push_back("Backlog");
+  all_names.push_back("SetOption1");
+  core_haystack += MakeHaystack("", 150);
+
+  static const char* prefixes[] = { "", "", "", "", "Zb", "Tuya", "Ir", "Rf", "Br", "Ws" };
+  for (uint32_t i = 0; i < driver_count; i++) {
+    Driver driver;
+    driver.haystack = MakeHaystack(prefixes[random() % 10], 2 + random() % 25);
+    driver.kind = DRV_DECODE;
+    driver.enabled = true;
+    if (i == driver_count * 3 / 4) { driver.kind = DRV_CUSTOM; }  // Berry is near the end of the drivers
+    if (i == driver_count / 8) { driver.kind = DRV_GPIO; }
+    drivers.push_back(driver);
+  }
+  for (uint32_t i = 0; i < sensor_count; i++) {
+    Driver sensor;
+    sensor.haystack = MakeHaystack("", 1 + random() % 6);
+    sensor.kind = DRV_DECODE;
+    sensor.enabled = true;
+    sensors.push_back(sensor);
+  }
+  // Names of drivers after the custom driver which it may take over with add_cmd()
+  for (uint32_t i = driver_count * 3 / 4 +1; i < driver_count; i += 2) {
+    const char* name = strchr(drivers[i].haystack.c_str(), '|');
+    std::string first(name +1, strcspn(name +1, "|"));
+    shared_names.push_back(std::string(drivers[i].haystack.c_str(), name - drivers[i].haystack.c_str()) + first);
+  }
+}
+
+std::vector<std::string> MakeStream(uint32_t count) {
+  // Working set of core commands and a few driver and sensor commands as used by rules and timers
+  std::vector<std::string> working_set = { "Power", "Status", "Backlog", "SetOption1" };
+  for (uint32_t i = 0; i < 8; i++) {
+    working_set.push_back(all_names[154 + random() % (all_names.size() - 154)]);
+  }
+  working_set.push_back(shared_names[0]);  // Driver command taken over by add_cmd() from time to time
+  std::vector<std::string> stream;
+  for (uint32_t i = 0; i < count; i++) {
+    uint32_t r = random() % 100;
+    std::string name;
+    if (r < 25) {
+      name = "Power";
+    } else if (r < 90) {
+      name = working_set[random() % working_set.size()];
+    } else if (r < 92) {
+      name = "Unknown" + std::to_string(random() % 10);
+    } else {
+      name = all_names[random() % all_names.size()];           // Long tail
+    }
+    if (random() % 2) {                                          // Mixed case as typed by users
+      for (auto& c : name) { if (random() % 3 == 0) { c = (isupper(c)) ? tolower(c) : toupper(c); } }
+    }
+    stream.push_back(name);
+  }
+  return stream;
+}
+
+void ChangeState(uint32_t step) {
+  // Run time changes which affect the handler of a command
+  for (auto& driver : drivers) {
+    if (DRV_GPIO == driver.kind) { driver.enabled = !driver.enabled; }
+    if (DRV_CUSTOM == driver.kind) {
+      driver.custom.clear();
+      for (uint32_t i = step % 2; i < shared_names.size(); i += 2) { driver.custom.push_back(shared_names[i]); }
+    }
+  }
+  if (sensors.size()) {
+    sensors[step % sensors.size()].enabled = !sensors[step % sensors.size()].enabled;
+  }
+}
+
+struct Result {
+  int32_t handled_by;
+  uint32_t command_code;
+};
+
+double Run(bool scan_in_place, const std::vector<std::string>& stream, uint32_t state_interval, std::vector<Result>& results, uint32_t& compares) {
+  in_place = scan_in_place;
+  results.clear();
+  for (auto& driver : drivers) { driver.enabled = true; driver.custom.clear(); }
+  for (auto& sensor : sensors) { sensor.enabled = true; }
+  name_compares = 0;
+
+  char topic[CMDSZ];
+  struct timespec start, end;
+  clock_gettime(CLOCK_MONOTONIC, &start);
+  for (uint32_t i = 0; i < stream.size(); i++) {
+    if (state_interval && (i % state_interval == 0)) { ChangeState(i / state_interval); }
+    strncpy(topic, stream[i].c_str(), sizeof(topic));
+    topic[sizeof(topic) -1] = '\0';
+    XdrvMailbox.topic = topic;
+    XdrvMailbox.index = 1;
+    XdrvMailbox.command_code = 0;
+    handled_by = -1;
+    bool handled = Dispatch();
+    results.push_back({ (handled) ? handled_by : -1, XdrvMailbox.command_code });
+  }
+  clock_gettime(CLOCK_MONOTONIC, &end);
+  compares = name_compares;
+  return ((end.tv_sec - start.tv_sec) * 1e9 + (end.tv_nsec - start.tv_nsec)) / stream.size();
+}
+
+// Both GetCommandCode() return the same code and destination for a needle in all command lists
+uint32_t CheckGetCommandCode(const char* needle) {
+  std::vector<const std::string*> haystacks = { &core_haystack };
+  for (auto& driver : drivers) { haystacks.push_back(&driver.haystack); }
+  for (auto& sensor : sensors) { haystacks.push_back(&sensor.haystack); }
+  uint32_t differences = 0;
+  for (auto haystack : haystacks) {
+    for (size_t size : { (size_t)CMDSZ, (size_t)8 }) {
+      char copying[CMDSZ];
+      char in_place[CMDSZ];
+      int copying_code = Copying::GetCommandCode(copying, size, needle, haystack->c_str());
+      int in_place_code = InPlace::GetCommandCode(in_place, size, needle, haystack->c_str());
+      // The copying scan compares the commands truncated to the destination, it can't find a longer needle
+      if (strlen(needle) >= size -1) { continue; }
+      if ((copying_code != in_place_code) || strcmp(copying, in_place)) {
+        if (differences < 5) {
+          printf("  GetCommandCode(%s): copying %d %s, in place %d %s\n", needle, copying_code, copying, in_place_code, in_place);
+        }
+        differences++;
+      }
+    }
+  }
+  return differences;
+}
+
+int main(int argc, char* argv[]) {
+  uint32_t commands = (argc > 1) ? atoi(argv[1]) : 100000;
+  uint32_t driver_count = (argc > 2) ? atoi(argv[2]) : 40;
+  uint32_t sensor_count = (argc > 3) ? atoi(argv[3]) : 30;
+
+  for (auto& command : MyCommands) { command = Handled; }
+  srandom(1);
+  MakeFirmware(driver_count, sensor_count);
+  std::vector<std::string> stream = MakeStream(commands);
+  printf("%u commands, %u core commands, %u drivers, %u sensors, %u command names\n",
+    commands, 150 + 4, driver_count, sensor_count, (uint32_t)all_names.size());
+
+  uint32_t code_differences = 0;
+  for (auto& name : all_names) {
+    std::string mixed = name;
+    for (uint32_t i = 0; i < mixed.size(); i += 2) { mixed[i] = (isupper(mixed[i])) ? tolower(mixed[i]) : toupper(mixed[i]); }
+    for (const std::string& needle : { name, mixed, name.substr(0, name.size() -1), name + "X", std::string("") }) {
+      code_differences += CheckGetCommandCode(needle.c_str());
+    }
+  }
+  printf("%u GetCommandCode() results differ\n", code_differences);
+  bool ok = (0 == code_differences);
+
+  struct {
+    const char* title;
+    bool berry;
+    uint32_t state_interval;
+  } scenarios[] = {
+    { "Static state, no Berry (ESP8266)", false, 0 },
+    { "Static state, Berry (ESP32)", true, 0 },
+    { "Run time state changes every 250 commands, Berry (ESP32)", true, 250 } };
+
+  for (auto& scenario : scenarios) {
+    berry = scenario.berry;
+    uint32_t state_interval = scenario.state_interval;
+    std::vector<Result> copying_results, in_place_results;
+    uint32_t copying_compares, in_place_compares;
+    double copying_ns = Run(false, stream, state_interval, copying_results, copying_compares);
+    double in_place_ns = Run(true, stream, state_interval, in_place_results, in_place_compares);
+
+    uint32_t differences = 0;
+    for (uint32_t i = 0; i < stream.size(); i++) {
+      if ((copying_results[i].handled_by != in_place_results[i].handled_by) ||
+          (copying_results[i].command_code != in_place_results[i].command_code)) {
+        if (differences < 5) {
+          printf("  %s: copying handler %d code %u, in place handler %d code %u\n", stream[i].c_str(),
+            copying_results[i].handled_by, copying_results[i].command_code,
+            in_place_results[i].handled_by, in_place_results[i].command_code);
+        }
+        differences++;
+      }
+    }
+
+    printf("%s:\n", scenario.title);
+    printf("  Copying scan  %8.1f nS/command %7.1f names compared/command\n", copying_ns, (double)copying_compares / commands);
+    printf("  In place scan %8.1f nS/command %7.1f names compared/command\n", in_place_ns, (double)in_place_compares / commands);
+    printf("  %u commands dispatched differently\n", differences);
+    if (differences) { ok = false; }
+  }
+
+  return (ok) ? 0 : 1;
+}
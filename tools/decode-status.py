@@ -255,7 +255,7 @@ a_features = [[
     ],[
     "USE_MPU_ACCEL","USE_TFMINIPLUS","USE_CSE7761","USE_BERRY",
     "USE_BM8563","USE_ENERGY_DUMMY","USE_AM2320","USE_T67XX",
-    "","","","",
+    "USE_ENERGY_HISTORY","","","",
     "","","","",
     "","","","",
     "","","","",
@@ -0,0 +1,389 @@
+/*
+  light-bench.cpp - host check of the precomputed light tables, for Tasmota
+
+  Copyright (C) 2021  Theo Arends
+
+  This program is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+Instructions:
+  Contains copies of the gamma and DimmerRange functions of xdrv_04_light.ino
+  and xdrv_04_light_utils.ino, and checks that the tables precomputed by
+  ledGammaInitTable() and LightCalcPWMRange() give bit-identical values to the
+  runtime computation they replace:
+  - ledGamma10_10() for all 1024 inputs, with LedTable on and after LedTable off
+    freed the table, and ledGamma10() / ledGamma() for all 256 inputs
+  - LightScalePWM() for every value 0..PwmRange, for every DimmerRange min and
+    max, with LedTable on and off, for PwmRange 255, 511 and 1023
+
+  It then reports the time per call of the computed and of the table lookup.
+  Host speeds don't reflect ESP8266 speeds, which has no hardware division,
+  compare the ratios.
+
+  Returns nonzero when any value differs.
+
+Usage:
+  g++ -O2 -o light-bench tools/light-bench/light-bench.cpp
+  ./light-bench [rounds]
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <time.h>
+
+/*********************************************************************************************\
+ * Tasmota environment used by the functions
+\*********************************************************************************************/
+
+struct {
+  uint16_t pwm_range = 1023;
+  uint8_t dimmer_hw_min = 0;
+  uint8_t dimmer_hw_max = 100;
+  uint8_t light_correction = 1;
+} Settings_storage;
+auto Settings = &Settings_storage;
+
+struct {
+  uint16_t pwm_min = 0;
+  uint16_t pwm_max = 1023;
+  uint16_t * pwm_table = nullptr;
+  uint16_t pwm_table_range = 0;
+} Light;
+
+// copy of support_float.ino
+uint16_t changeUIntScale(uint16_t inum, uint16_t ifrom_min, uint16_t ifrom_max,
+                                       uint16_t ito_min, uint16_t ito_max) {
+  // guard-rails
+  if (ifrom_min >= ifrom_max) {
+    return (ito_min > ito_max ? ito_max : ito_min);  // invalid input, return arbitrary value
+  }
+  // convert to uint31, it's more verbose but code is more compact
+  uint32_t num = inum;
+  uint32_t from_min = ifrom_min;
+  uint32_t from_max = ifrom_max;
+  uint32_t to_min = ito_min;
+  uint32_t to_max = ito_max;
+
+  // check source range
+  num = (num > from_max ? from_max : (num < from_min ? from_min : num));
+
+  // check to_* order
+  if (to_min > to_max) {
+    // reverse order
+    num = (from_max - num) + from_min;
+    to_min = ito_max;
+    to_max = ito_min;
+  }
+
+  uint32_t numerator = (num - from_min) * (to_max - to_min);
+  uint32_t result;
+  if (numerator >= 0x80000000L) {
+    // don't do rounding as it would create an overflow
+    result = numerator / (from_max - from_min) + to_min;
+  } else {
+    result = (((numerator * 2) / (from_max - from_min)) + 1) / 2 + to_min;
+  }
+  return (uint32_t) (result > to_max ? to_max : (result < to_min ? to_min : result));
+}
+
+/*********************************************************************************************\
+ * Copies of xdrv_04_light_utils.ino
+\*********************************************************************************************/
+
+typedef struct gamma_table_t {
+  uint16_t to_src;
+  uint16_t to_gamma;
+} gamma_table_t;
+
+const gamma_table_t gamma_table[] = {
+  {    1,      1 },
+  {    4,      1 },
+  {  209,     13 },
+  {  312,     41 },
+  {  457,    106 },
+  {  626,    261 },
+  {  762,    450 },
+  {  895,    703 },
+  { 1023,   1023 },
+  { 0xFFFF, 0xFFFF }          // fail-safe if out of range
+};
+
+uint16_t change8to10(uint8_t v) {
+  return changeUIntScale(v, 0, 255, 0, 1023);
+}
+
+uint8_t change10to8(uint16_t v) {
+  return (0 == v) ? 0 : changeUIntScale(v, 4, 1023, 1, 255);
+}
+
+uint8_t DimmerToBri(uint8_t dimmer) {
+  return changeUIntScale(dimmer, 0, 100, 0, 255);  // 0..255
+}
+
+uint16_t ledGamma_internal(uint16_t v, const struct gamma_table_t *gt_ptr) {
+  uint16_t from_src = 0;
+  uint16_t from_gamma = 0;
+
+  for (const gamma_table_t *gt = gt_ptr; ; gt++) {
+    uint16_t to_src = gt->to_src;
+    uint16_t to_gamma = gt->to_gamma;
+    if (v <= to_src) {
+      return changeUIntScale(v, from_src, to_src, from_gamma, to_gamma);
+    }
+    from_src = to_src;
+    from_gamma = to_gamma;
+  }
+}
+
+uint16_t * gamma_table_10 = nullptr;
+
+void ledGammaInitTable(bool enable) {
+  if (!enable) {
+    free(gamma_table_10);
+    gamma_table_10 = nullptr;
+    return;
+  }
+  if (gamma_table_10) { return; }
+  uint16_t * table = (uint16_t*) malloc(1024 * sizeof(uint16_t));
+  if (nullptr == table) { return; }
+  for (uint32_t v = 0; v < 1024; v++) {
+    table[v] = ledGamma_internal(v, gamma_table);
+  }
+  gamma_table_10 = table;
+}
+
+uint16_t ledGamma10_10(uint16_t v) {
+  if (gamma_table_10 && (v < 1024)) {
+    return gamma_table_10[v];
+  }
+  return ledGamma_internal(v, gamma_table);
+}
+
+uint16_t ledGamma10(uint8_t v) {
+  return ledGamma10_10(change8to10(v));
+}
+
+uint8_t ledGamma(uint8_t v) {
+  return change10to8(ledGamma10(v));
+}
+
+/*********************************************************************************************\
+ * Copies of xdrv_04_light.ino
+\*********************************************************************************************/
+
+void LightCalcPWMRange(void) {
+  uint16_t pwm_min, pwm_max;
+
+  pwm_min = change8to10(DimmerToBri(Settings->dimmer_hw_min));   // default 0
+  pwm_max = change8to10(DimmerToBri(Settings->dimmer_hw_max));   // default 100
+  if (Settings->light_correction) {
+    pwm_min = ledGamma10_10(pwm_min);       // apply gamma correction
+    pwm_max = ledGamma10_10(pwm_max);       // 0..1023
+  }
+  pwm_min = pwm_min > 0 ? changeUIntScale(pwm_min, 1, 1023, 1, Settings->pwm_range) : 0;  // adapt range but keep zero and non-zero values
+  pwm_max = changeUIntScale(pwm_max, 1, 1023, 1, Settings->pwm_range);  // pwm_max cannot be zero
+
+  Light.pwm_min = pwm_min;
+  Light.pwm_max = pwm_max;
+
+  if (Light.pwm_table) {
+    free(Light.pwm_table);
+    Light.pwm_table = nullptr;
+  }
+  Light.pwm_table_range = Settings->pwm_range;
+  if ((pwm_min != 0) || (pwm_max != Settings->pwm_range)) {   // no table needed for the full range
+    Light.pwm_table = (uint16_t*) malloc((Settings->pwm_range + 1) * sizeof(uint16_t));
+    if (Light.pwm_table) {
+      Light.pwm_table[0] = 0;
+      for (uint32_t v = 1; v <= Settings->pwm_range; v++) {
+        Light.pwm_table[v] = changeUIntScale(v, 0, Settings->pwm_range, pwm_min, pwm_max);
+      }
+    }
+  }
+}
+
+uint16_t LightScalePWM(uint16_t v) {
+  if ((Light.pwm_table_range == Settings->pwm_range) && (v <= Settings->pwm_range)) {
+    if (Light.pwm_table) { return Light.pwm_table[v]; }                                 // precomputed by LightCalcPWMRange()
+    if ((0 == Light.pwm_min) && (Light.pwm_max == Settings->pwm_range)) { return v; }  // full range
+  }
+  return v > 0 ? changeUIntScale(v, 0, Settings->pwm_range, Light.pwm_min, Light.pwm_max) : 0;
+}
+
+/*********************************************************************************************\
+ * Runtime computation as done before the tables
+\*********************************************************************************************/
+
+namespace Computed {
+
+uint16_t ledGamma10_10(uint16_t v) {
+  return ledGamma_internal(v, gamma_table);
+}
+
+uint16_t ledGamma10(uint8_t v) {
+  return ledGamma10_10(change8to10(v));
+}
+
+uint8_t ledGamma(uint8_t v) {
+  return change10to8(ledGamma10(v));
+}
+
+// pwm_min and pwm_max as LightCalcPWMRange() computed them
+void LightCalcPWMRange(uint16_t *pwm_min_out, uint16_t *pwm_max_out) {
+  uint16_t pwm_min, pwm_max;
+
+  pwm_min = change8to10(DimmerToBri(Settings->dimmer_hw_min));
+  pwm_max = change8to10(DimmerToBri(Settings->dimmer_hw_max));
+  if (Settings->light_correction) {
+    pwm_min = ledGamma10_10(pwm_min);
+    pwm_max = ledGamma10_10(pwm_max);
+  }
+  *pwm_min_out = pwm_min > 0 ? changeUIntScale(pwm_min, 1, 1023, 1, Settings->pwm_range) : 0;
+  *pwm_max_out = changeUIntScale(pwm_max, 1, 1023, 1, Settings->pwm_range);
+}
+
+// LightSetOutputs() scaling
+uint16_t LightScalePWM(uint16_t v, uint16_t pwm_min, uint16_t pwm_max) {
+  return v > 0 ? changeUIntScale(v, 0, Settings->pwm_range, pwm_min, pwm_max) : 0;
+}
+
+}  // namespace Computed
+
+/*********************************************************************************************\
+ * Checks
+\*********************************************************************************************/
+
+uint32_t differences = 0;
+
+void Difference(const char *what, uint32_t v, uint32_t computed, uint32_t table) {
+  if (differences < 10) {
+    printf("  %s(%u): computed %u, table %u\n", what, v, computed, table);
+  }
+  differences++;
+}
+
+uint32_t CheckGamma(void) {
+  uint32_t checked = 0;
+  for (uint32_t v = 0; v < 1024; v++) {
+    uint16_t computed = Computed::ledGamma10_10(v);
+    uint16_t table = ledGamma10_10(v);
+    if (computed != table) { Difference("ledGamma10_10", v, computed, table); }
+    checked++;
+  }
+  for (uint32_t v = 0; v < 256; v++) {
+    if (Computed::ledGamma10(v) != ledGamma10(v)) { Difference("ledGamma10", v, Computed::ledGamma10(v), ledGamma10(v)); }
+    if (Computed::ledGamma(v) != ledGamma(v)) { Difference("ledGamma", v, Computed::ledGamma(v), ledGamma(v)); }
+    checked += 2;
+  }
+  return checked;
+}
+
+uint32_t CheckDimmerRange(void) {
+  const uint16_t ranges[] = { 255, 511, 1023 };
+  uint32_t checked = 0;
+  for (uint32_t correction = 0; correction <= 1; correction++) {
+    Settings->light_correction = correction;
+    ledGammaInitTable(Settings->light_correction);
+    for (uint32_t r = 0; r < sizeof(ranges) / sizeof(ranges[0]); r++) {
+      Settings->pwm_range = ranges[r];
+      for (uint32_t hw_min = 0; hw_min <= 100; hw_min++) {
+        for (uint32_t hw_max = hw_min; hw_max <= 100; hw_max++) {
+          Settings->dimmer_hw_min = hw_min;
+          Settings->dimmer_hw_max = hw_max;
+          LightCalcPWMRange();
+          uint16_t pwm_min, pwm_max;
+          Computed::LightCalcPWMRange(&pwm_min, &pwm_max);
+          if ((pwm_min != Light.pwm_min) || (pwm_max != Light.pwm_max)) {
+            Difference("pwm_min", hw_min, pwm_min, Light.pwm_min);
+            continue;
+          }
+          for (uint32_t v = 0; v <= Settings->pwm_range; v++) {
+            uint16_t computed = Computed::LightScalePWM(v, pwm_min, pwm_max);
+            uint16_t table = LightScalePWM(v);
+            if (computed != table) { Difference("LightScalePWM", v, computed, table); }
+          }
+          checked += Settings->pwm_range + 1;
+        }
+      }
+    }
+  }
+  return checked;
+}
+
+/*********************************************************************************************\
+ * Timings
+\*********************************************************************************************/
+
+volatile uint32_t sink;
+
+double Now(void) {
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return ts.tv_sec * 1e9 + ts.tv_nsec;
+}
+
+template <typename F>
+double Time(uint32_t rounds, uint32_t count, F f) {
+  uint32_t sum = 0;
+  double start = Now();
+  for (uint32_t r = 0; r < rounds; r++) {
+    for (uint32_t v = 0; v < count; v++) {
+      sum += f(v);
+    }
+  }
+  sink = sum;
+  return (Now() - start) / ((double)rounds * count);
+}
+
+int main(int argc, char* argv[]) {
+  uint32_t rounds = (argc > 1) ? atoi(argv[1]) : 1000;
+
+  // LedTable on
+  Settings->light_correction = 1;
+  ledGammaInitTable(Settings->light_correction);
+  if (nullptr == gamma_table_10) {
+    printf("Gamma table not allocated with LedTable on\n");
+    return 1;
+  }
+  uint32_t checked = CheckGamma();
+  // LedTable off, falls back to the computation
+  ledGammaInitTable(false);
+  if (gamma_table_10) {
+    printf("Gamma table not freed with LedTable off\n");
+    return 1;
+  }
+  checked += CheckGamma();
+  checked += CheckDimmerRange();
+  printf("%u values checked, %u differ\n", checked, differences);
+
+  Settings->light_correction = 1;
+  ledGammaInitTable(Settings->light_correction);
+  Settings->pwm_range = 1023;
+  Settings->dimmer_hw_min = 10;
+  Settings->dimmer_hw_max = 90;
+  LightCalcPWMRange();
+  uint16_t pwm_min, pwm_max;
+  Computed::LightCalcPWMRange(&pwm_min, &pwm_max);
+
+  double gamma_computed = Time(rounds, 1024, [](uint32_t v) { return Computed::ledGamma10_10(v); });
+  double gamma_table = Time(rounds, 1024, [](uint32_t v) { return ledGamma10_10(v); });
+  double scale_computed = Time(rounds, 1024, [=](uint32_t v) { return Computed::LightScalePWM(v, pwm_min, pwm_max); });
+  double scale_table = Time(rounds, 1024, [](uint32_t v) { return LightScalePWM(v); });
+  printf("  ledGamma10_10  computed %6.2f nS, table %6.2f nS\n", gamma_computed, gamma_table);
+  printf("  LightScalePWM  computed %6.2f nS, table %6.2f nS\n", scale_computed, scale_table);
+
+  ledGammaInitTable(false);
+  free(Light.pwm_table);
+  return (differences) ? 1 : 0;
+}
@@ -0,0 +1,549 @@
+/*
+  log-bench.cpp - host benchmark of the log buffer, for Tasmota
+
+  Copyright (C) 2021  Theo Arends
+
+  This program is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+Instructions:
+  Logs a sustained rate of lines (default 500 lines/s) of random length and
+  level during a number of simulated seconds and reports the cost per line of
+  AddLogData() and of the readers calling GetLog():
+    - MQTT logging and syslog drain the log every 50 mSec loop
+    - the web console drains it every second
+
+  AddLogData(), GetLog() and NeedLogRefresh() are copies of tasmota/support.ino,
+  the memmove based log buffer they replaced is kept as a reference. For both
+  buffers the benchmark checks at each loop that the MQTT reader gets the MQTT
+  level lines logged since its previous read, in order. When a loop logs more
+  than the buffer holds its oldest lines are lost, these are reported but only
+  allowed in loops that logged more than the guaranteed capacity (buffer size
+  minus one line, as a ring line never wraps around the end of the buffer).
+  Returns nonzero when a reader misses or gets a wrong line.
+  Build with -funsigned-char like the ESP compilers, the reference relies on it.
+
+  Host speeds don't reflect ESP8266 speeds, compare the ratios.
+
+Usage:
+  g++ -O2 -funsigned-char -o log-bench tools/log-bench/log-bench.cpp
+  ./log-bench [seconds [lines_per_second [log_buffer_size]]]
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+#include <time.h>
+#include <string>
+#include <vector>
+
+/*********************************************************************************************\
+ * Tasmota environment used by the log buffer
+\*********************************************************************************************/
+
+#define PSTR(s) (s)
+#define snprintf_P snprintf
+#define D_HOUR_MINUTE_SEPARATOR ":"
+#define D_MINUTE_SECOND_SEPARATOR ":"
+
+const uint16_t TOPSZ = 151;
+const uint16_t LOG_INDEX_SIZE = 128;
+const uint16_t MAX_LOGSZ = 700;
+enum LoggingLevels {LOG_LEVEL_NONE, LOG_LEVEL_ERROR, LOG_LEVEL_INFO, LOG_LEVEL_DEBUG, LOG_LEVEL_DEBUG_MORE};
+
+uint16_t LOG_BUFFER_SIZE = 4096;          // ESP8266 default, const in tasmota.h
+
+struct { uint8_t hour, minute, second; } RtcTime;
+uint32_t millis_now = 0;
+uint32_t RtcMillis(void) { return millis_now % 1000; }
+void delay(uint32_t) {}
+
+size_t strchrspn(const char *str1, int character)
+{
+  size_t ret = 0;
+  char *start = (char*)str1;
+  char *end = strchr((char*)str1, character);
+  if (end) ret = end - start;
+  return ret;
+}
+
+struct TasmotaGlobalLog {
+  char *log_buffer;
+  uint32_t log_buffer_pointer;
+  uint32_t uptime;
+  uint8_t masterlog_level;
+  uint8_t seriallog_level;
+  uint8_t syslog_level;
+  uint8_t templog_level;
+};
+
+struct SettingsLog {
+  uint8_t weblog_level;
+  uint8_t mqttlog_level;
+};
+
+/*********************************************************************************************\
+ * Indexed ring buffer - copy of tasmota/support.ino
+\*********************************************************************************************/
+
+namespace Ring {
+
+TasmotaGlobalLog TasmotaGlobal;
+SettingsLog SettingsRing;
+SettingsLog *Settings = &SettingsRing;
+
+bool GetLog(uint32_t req_loglevel, uint32_t* index_p, char** entry_pp, size_t* len_p);
+
+struct {
+  struct {
+    uint32_t offset : 13;                  // Offset of log line in log_buffer
+    uint32_t length : 13;                  // Length of log line including terminating '\1'
+    uint32_t loglevel : 4;                 // Log level of log line
+  } index[LOG_INDEX_SIZE];
+  uint16_t head;                           // Index position of oldest log line
+  uint16_t count;                          // Number of log lines in log_buffer
+  uint16_t write;                          // Offset in log_buffer for next log line
+  uint16_t used;                           // Number of characters used by log lines
+  uint8_t oldest;                          // Sequence id of oldest log line
+} TasLog;
+
+int32_t LogIndexPosition(uint32_t index) {
+  // Return position in TasLog.index of sequence id index or -1 if not (or no longer) available
+  if (!TasLog.count || !index || (index > 255)) { return -1; }
+  uint32_t distance = (index >= TasLog.oldest) ? index - TasLog.oldest : index + 255 - TasLog.oldest;  // Skip 0 as it is not allowed
+  if (distance >= TasLog.count) { return -1; }
+  return (TasLog.head + distance) % LOG_INDEX_SIZE;
+}
+
+void LogIndexRemoveOldest(void) {
+  TasLog.used -= TasLog.index[TasLog.head].length;
+  TasLog.head = (TasLog.head + 1) % LOG_INDEX_SIZE;
+  TasLog.count--;
+  TasLog.oldest++;
+  if (!TasLog.oldest) { TasLog.oldest++; }  // Skip 0 as it is not allowed
+}
+
+bool NeedLogRefresh(uint32_t req_loglevel, uint32_t index) {
+  if (!TasmotaGlobal.log_buffer) { return false; }  // Leave now if there is no buffer available
+
+  // Skip initial buffer fill
+  if (TasLog.used < LOG_BUFFER_SIZE / 2) { return false; }
+
+  char* line;
+  size_t len;
+  if (!GetLog(req_loglevel, &index, &line, &len)) { return false; }
+  // Refresh if the next line to be read is amongst the first to be overwritten
+  uint32_t tail = TasLog.index[TasLog.head].offset;
+  uint32_t offset = line - TasmotaGlobal.log_buffer;
+  uint32_t distance = (offset >= tail) ? offset - tail : offset + LOG_BUFFER_SIZE - tail;
+  return (distance < LOG_BUFFER_SIZE / 4);
+}
+
+bool GetLog(uint32_t req_loglevel, uint32_t* index_p, char** entry_pp, size_t* len_p) {
+  if (!TasmotaGlobal.log_buffer) { return false; }  // Leave now if there is no buffer available
+  if (TasmotaGlobal.uptime < 3) { return false; }   // Allow time to setup correct log level
+
+  uint32_t index = *index_p;
+  if (!req_loglevel || (index == TasmotaGlobal.log_buffer_pointer)) { return false; }
+
+  int32_t position = LogIndexPosition(index);
+  if (position < 0) {                      // Dump all or requested entry is no longer available
+    if (!TasLog.count) {
+      *index_p = TasmotaGlobal.log_buffer_pointer;
+      return false;
+    }
+    index = TasLog.oldest;
+    position = TasLog.head;
+  }
+
+  while (index != TasmotaGlobal.log_buffer_pointer) {
+    uint32_t loglevel = TasLog.index[position].loglevel;
+    index++;
+    if (index > 255) { index = 1; }        // Skip 0 as it is not allowed
+    *index_p = index;
+    if ((loglevel <= req_loglevel) &&
+        (TasmotaGlobal.masterlog_level <= req_loglevel)) {
+      *entry_pp = TasmotaGlobal.log_buffer + TasLog.index[position].offset;
+      *len_p = TasLog.index[position].length;
+      return true;
+    }
+    position = (position + 1) % LOG_INDEX_SIZE;
+  }
+  return false;
+}
+
+void AddLogData(uint32_t loglevel, const char* log_data, const char* log_data_payload = nullptr, const char* log_data_retained = nullptr) {
+  char mxtime[24];  // "13:45:21.999 ", sized for any uint32_t millis
+  snprintf_P(mxtime, sizeof(mxtime), PSTR("%02d" D_HOUR_MINUTE_SEPARATOR "%02d" D_MINUTE_SECOND_SEPARATOR "%02d.%03d "), RtcTime.hour, RtcTime.minute, RtcTime.second, RtcMillis());
+
+  char empty[2] = { 0 };
+  if (!log_data_payload) { log_data_payload = empty; }
+  if (!log_data_retained) { log_data_retained = empty; }
+
+  if (!TasmotaGlobal.log_buffer) { return; }  // Leave now if there is no buffer available
+
+  uint32_t highest_loglevel = Settings->weblog_level;
+  if (Settings->mqttlog_level > highest_loglevel) { highest_loglevel = Settings->mqttlog_level; }
+  if (TasmotaGlobal.syslog_level > highest_loglevel) { highest_loglevel = TasmotaGlobal.syslog_level; }
+  if (TasmotaGlobal.templog_level > highest_loglevel) { highest_loglevel = TasmotaGlobal.templog_level; }
+  if (TasmotaGlobal.uptime < 3) { highest_loglevel = LOG_LEVEL_DEBUG_MORE; }  // Log all before setup correct log level
+
+  if ((loglevel <= highest_loglevel) &&    // Log only when needed
+      (TasmotaGlobal.masterlog_level <= highest_loglevel)) {
+    // Truncate log messages longer than MAX_LOGSZ which is the log buffer size minus 64 spare
+    uint32_t log_data_len = strlen(log_data) + strlen(log_data_payload) + strlen(log_data_retained);
+    char too_long[TOPSZ];
+    if (log_data_len > MAX_LOGSZ) {
+      snprintf_P(too_long, sizeof(too_long) - 20, PSTR("%s%s"), log_data, log_data_payload);   // 20 = strlen("... 123456 truncated")
+      uint32_t too_long_len = strlen(too_long);
+      snprintf_P(too_long + too_long_len, sizeof(too_long) - too_long_len, PSTR("... %d truncated"), log_data_len);
+      log_data = too_long;
+      log_data_payload = empty;
+      log_data_retained = empty;
+      log_data_len = strlen(too_long);
+    }
+    uint32_t length = strlen(mxtime) + log_data_len +1;  // 1 = '\1'
+    uint32_t needed = length +1;           // 1 = '\0' added by snprintf and overwritten by next log line
+
+    TasmotaGlobal.log_buffer_pointer &= 0xFF;
+    if (!TasmotaGlobal.log_buffer_pointer) {
+      TasmotaGlobal.log_buffer_pointer++;  // Index 0 is not allowed as it is the end of char string
+    }
+    if (TasLog.count >= LOG_INDEX_SIZE) {
+      LogIndexRemoveOldest();              // Index full so remove oldest log line
+    }
+    while (true) {                         // Make room by removing oldest log lines
+      if (!TasLog.count) {
+        TasLog.write = 0;
+        break;
+      }
+      uint32_t tail = TasLog.index[TasLog.head].offset;
+      if (tail < TasLog.write) {           // Log lines occupy tail up to write
+        if (TasLog.write + needed <= LOG_BUFFER_SIZE) { break; }
+        TasLog.write = 0;                  // Log line does not fit at end so wrap around
+      }
+      if (TasLog.write + needed <= tail) { break; }  // Free space from write up to tail
+      LogIndexRemoveOldest();
+    }
+    if (!TasLog.count) {
+      TasLog.oldest = TasmotaGlobal.log_buffer_pointer;
+    }
+
+    snprintf_P(TasmotaGlobal.log_buffer + TasLog.write, needed, PSTR("%s%s%s%s\1"),
+      mxtime, log_data, log_data_payload, log_data_retained);
+    uint32_t position = (TasLog.head + TasLog.count) % LOG_INDEX_SIZE;
+    TasLog.index[position].offset = TasLog.write;
+    TasLog.index[position].length = length;
+    TasLog.index[position].loglevel = loglevel;
+    TasLog.count++;
+    TasLog.used += length;
+    TasLog.write += length;
+
+    TasmotaGlobal.log_buffer_pointer++;
+    TasmotaGlobal.log_buffer_pointer &= 0xFF;
+    if (!TasmotaGlobal.log_buffer_pointer) {
+      TasmotaGlobal.log_buffer_pointer++;  // Index 0 is not allowed as it is the end of char string
+    }
+  }
+}
+
+}  // namespace Ring
+
+/*********************************************************************************************\
+ * Reference memmove based log buffer
+\*********************************************************************************************/
+
+namespace Memmove {
+
+TasmotaGlobalLog TasmotaGlobal;
+SettingsLog SettingsMemmove;
+SettingsLog *Settings = &SettingsMemmove;
+
+bool GetLog(uint32_t req_loglevel, uint32_t* index_p, char** entry_pp, size_t* len_p);
+
+bool NeedLogRefresh(uint32_t req_loglevel, uint32_t index) {
+  if (!TasmotaGlobal.log_buffer) { return false; }  // Leave now if there is no buffer available
+
+  // Skip initial buffer fill
+  if (strlen(TasmotaGlobal.log_buffer) < LOG_BUFFER_SIZE / 2) { return false; }
+
+  char* line;
+  size_t len;
+  if (!GetLog(req_loglevel, &index, &line, &len)) { return false; }
+  return ((line - TasmotaGlobal.log_buffer) < LOG_BUFFER_SIZE / 4);
+}
+
+bool GetLog(uint32_t req_loglevel, uint32_t* index_p, char** entry_pp, size_t* len_p) {
+  if (!TasmotaGlobal.log_buffer) { return false; }  // Leave now if there is no buffer available
+  if (TasmotaGlobal.uptime < 3) { return false; }   // Allow time to setup correct log level
+
+  uint32_t index = *index_p;
+  if (!req_loglevel || (index == TasmotaGlobal.log_buffer_pointer)) { return false; }
+
+  if (!index) {                            // Dump all
+    index = TasmotaGlobal.log_buffer[0];
+  }
+
+  do {
+    size_t len = 0;
+    uint32_t loglevel = 0;
+    char* entry_p = TasmotaGlobal.log_buffer;
+    do {
+      uint32_t cur_idx = *entry_p;
+      entry_p++;
+      size_t tmp = strchrspn(entry_p, '\1');
+      tmp++;                               // Skip terminating '\1'
+      if (cur_idx == index) {              // Found the requested entry
+        loglevel = *entry_p - '0';
+        entry_p++;                         // Skip loglevel
+        len = tmp -1;
+        break;
+      }
+      entry_p += tmp;
+    } while (entry_p < TasmotaGlobal.log_buffer + LOG_BUFFER_SIZE && *entry_p != '\0');
+    index++;
+    if (index > 255) { index = 1; }        // Skip 0 as it is not allowed
+    *index_p = index;
+    if ((len > 0) &&
+        (loglevel <= req_loglevel) &&
+        (TasmotaGlobal.masterlog_level <= req_loglevel)) {
+      *entry_pp = entry_p;
+      *len_p = len;
+      return true;
+    }
+    delay(0);
+  } while (index != TasmotaGlobal.log_buffer_pointer);
+  return false;
+}
+
+void AddLogData(uint32_t loglevel, const char* log_data, const char* log_data_payload = nullptr, const char* log_data_retained = nullptr) {
+  char mxtime[24];  // "13:45:21.999 ", sized for any uint32_t millis
+  snprintf_P(mxtime, sizeof(mxtime), PSTR("%02d" D_HOUR_MINUTE_SEPARATOR "%02d" D_MINUTE_SECOND_SEPARATOR "%02d.%03d "), RtcTime.hour, RtcTime.minute, RtcTime.second, RtcMillis());
+
+  char empty[2] = { 0 };
+  if (!log_data_payload) { log_data_payload = empty; }
+  if (!log_data_retained) { log_data_retained = empty; }
+
+  if (!TasmotaGlobal.log_buffer) { return; }  // Leave now if there is no buffer available
+
+  uint32_t highest_loglevel = Settings->weblog_level;
+  if (Settings->mqttlog_level > highest_loglevel) { highest_loglevel = Settings->mqttlog_level; }
+  if (TasmotaGlobal.syslog_level > highest_loglevel) { highest_loglevel = TasmotaGlobal.syslog_level; }
+  if (TasmotaGlobal.templog_level > highest_loglevel) { highest_loglevel = TasmotaGlobal.templog_level; }
+  if (TasmotaGlobal.uptime < 3) { highest_loglevel = LOG_LEVEL_DEBUG_MORE; }  // Log all before setup correct log level
+
+  if ((loglevel <= highest_loglevel) &&    // Log only when needed
+      (TasmotaGlobal.masterlog_level <= highest_loglevel)) {
+    // Delimited, zero-terminated buffer of log lines.
+    // Each entry has this format: [index][loglevel][log data]['\1']
+
+    // Truncate log messages longer than MAX_LOGSZ which is the log buffer size minus 64 spare
+    uint32_t log_data_len = strlen(log_data) + strlen(log_data_payload) + strlen(log_data_retained);
+    char too_long[TOPSZ];
+    if (log_data_len > MAX_LOGSZ) {
+      snprintf_P(too_long, sizeof(too_long) - 20, PSTR("%s%s"), log_data, log_data_payload);   // 20 = strlen("... 123456 truncated")
+      uint32_t too_long_len = strlen(too_long);
+      snprintf_P(too_long + too_long_len, sizeof(too_long) - too_long_len, PSTR("... %d truncated"), log_data_len);
+      log_data = too_long;
+      log_data_payload = empty;
+      log_data_retained = empty;
+    }
+
+    TasmotaGlobal.log_buffer_pointer &= 0xFF;
+    if (!TasmotaGlobal.log_buffer_pointer) {
+      TasmotaGlobal.log_buffer_pointer++;  // Index 0 is not allowed as it is the end of char string
+    }
+    while (TasmotaGlobal.log_buffer_pointer == (uint8_t)TasmotaGlobal.log_buffer[0] ||  // If log already holds the next index, remove it
+           strlen(TasmotaGlobal.log_buffer) + strlen(log_data) + strlen(log_data_payload) + strlen(log_data_retained) + strlen(mxtime) + 4 > LOG_BUFFER_SIZE)  // 4 = log_buffer_pointer + '\1' + '\0'
+    {
+      char* it = TasmotaGlobal.log_buffer;
+      it++;                                // Skip log_buffer_pointer
+      it += strchrspn(it, '\1');           // Skip log line
+      it++;                                // Skip delimiting "\1"
+      memmove(TasmotaGlobal.log_buffer, it, LOG_BUFFER_SIZE -(it-TasmotaGlobal.log_buffer));  // Move buffer forward to remove oldest log line
+    }
+    // The original formats the buffer into itself, which glibc does not allow
+    size_t used = strlen(TasmotaGlobal.log_buffer);
+    snprintf_P(TasmotaGlobal.log_buffer + used, LOG_BUFFER_SIZE - used, PSTR("%c%c%s%s%s%s\1"),
+      TasmotaGlobal.log_buffer_pointer++, '0'+loglevel, mxtime, log_data, log_data_payload, log_data_retained);
+    TasmotaGlobal.log_buffer_pointer &= 0xFF;
+    if (!TasmotaGlobal.log_buffer_pointer) {
+      TasmotaGlobal.log_buffer_pointer++;  // Index 0 is not allowed as it is the end of char string
+    }
+  }
+}
+
+}  // namespace Memmove
+
+/*********************************************************************************************\
+ * Benchmark
+\*********************************************************************************************/
+
+double Now(void) {
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+struct LogBench {
+  const char *name;
+  void (*add)(uint32_t, const char*, const char*, const char*);
+  bool (*get)(uint32_t, uint32_t*, char**, size_t*);
+  bool (*refresh)(uint32_t, uint32_t);
+  TasmotaGlobalLog *global;
+  SettingsLog *settings;
+  double add_time;
+  double read_time;
+  uint32_t lines_read;
+  uint32_t mqtt_lines;                     // MQTT lines received
+  uint32_t mqtt_lost;                      // MQTT lines lost in loops logging more than the buffer holds
+  uint32_t mqtt_errors;                    // MQTT lines missed or different from the lines logged
+};
+
+void Setup(LogBench &b) {
+  b.global->log_buffer = (char*)calloc(LOG_BUFFER_SIZE, 1);
+  b.global->log_buffer_pointer = 1;
+  b.global->uptime = 10;
+  b.global->masterlog_level = LOG_LEVEL_NONE;
+  b.global->seriallog_level = LOG_LEVEL_NONE;
+  b.global->syslog_level = LOG_LEVEL_INFO;
+  b.global->templog_level = LOG_LEVEL_NONE;
+  b.settings->weblog_level = LOG_LEVEL_DEBUG;
+  b.settings->mqttlog_level = LOG_LEVEL_INFO;
+}
+
+// Drain the log like MqttPublishLoggingAsync(), SyslogAsync() and HandleConsoleRefresh()
+void Drain(LogBench &b, uint32_t level, uint32_t *index, bool refresh, std::vector<std::string> *lines) {
+  if (refresh && !b.refresh(level, *index)) { return; }
+  char* line;
+  size_t len;
+  while (b.get(level, index, &line, &len)) {
+    b.lines_read++;
+    if (lines) { lines->push_back(std::string(line, len)); }
+  }
+}
+
+// The MQTT reader must get the newest lines logged since its previous read, all of them if
+// the loop logged no more than the buffer is guaranteed to hold
+void CheckMqtt(LogBench &b, const std::vector<std::string> &logged, const std::vector<std::string> &read, bool may_lose) {
+  b.mqtt_lines += read.size();
+  uint32_t lost = (read.size() < logged.size()) ? logged.size() - read.size() : 0;
+  bool error = (read.size() > logged.size()) || (lost && !may_lose);
+  for (uint32_t i = 0; !error && (i < read.size()); i++) {
+    error = (read[i] != logged[lost + i]);
+  }
+  if (error) {
+    if (!b.mqtt_errors) {
+      printf("%s: %u MQTT lines logged, %u read, first logged %.24s\n", b.name,
+        (uint32_t)logged.size(), (uint32_t)read.size(), (logged.size()) ? logged[0].c_str() : "");
+    }
+    b.mqtt_errors += (logged.size() > read.size()) ? logged.size() : read.size();
+  } else {
+    b.mqtt_lost += lost;
+  }
+}
+
+int main(int argc, char *argv[]) {
+  uint32_t seconds = (argc > 1) ? atoi(argv[1]) : 60;
+  uint32_t rate = (argc > 2) ? atoi(argv[2]) : 500;
+  if (argc > 3) { LOG_BUFFER_SIZE = atoi(argv[3]); }
+  if (LOG_BUFFER_SIZE > 8191) { LOG_BUFFER_SIZE = 8191; }  // 13 bit offset in the index
+
+  LogBench bench[2] = {
+    { "Ring", Ring::AddLogData, Ring::GetLog, Ring::NeedLogRefresh, &Ring::TasmotaGlobal, Ring::Settings },
+    { "Memmove", Memmove::AddLogData, Memmove::GetLog, Memmove::NeedLogRefresh, &Memmove::TasmotaGlobal, Memmove::Settings }
+  };
+
+  // Lines of 20 to 200 characters, 1 in 4 at debug level
+  const uint32_t kLines = 1024;
+  std::vector<std::string> texts;
+  std::vector<uint32_t> levels;
+  srand(1);
+  for (uint32_t i = 0; i < kLines; i++) {
+    std::string line = "SNS: ";
+    uint32_t len = 20 + rand() % 181;
+    while (line.size() < len) { line += (char)('a' + rand() % 26); }
+    texts.push_back(line);
+    levels.push_back((rand() % 4) ? LOG_LEVEL_INFO : LOG_LEVEL_DEBUG);
+  }
+
+  for (uint32_t b = 0; b < 2; b++) {
+    LogBench &lb = bench[b];
+    Setup(lb);
+    uint32_t mqtt_index = 1;
+    uint32_t syslog_index = 1;
+    uint32_t web_index = 0;
+    uint32_t line = 0;
+    uint32_t per_loop = rate / 20;
+    std::vector<std::string> logged;
+    std::vector<std::string> read;
+    for (uint32_t loop = 0; loop < seconds * 20; loop++) {   // 50 mSec loops
+      millis_now = loop * 50;
+      RtcTime.second = (millis_now / 1000) % 60;
+      RtcTime.minute = (millis_now / 60000) % 60;
+      RtcTime.hour = (millis_now / 3600000) % 24;
+
+      double start = Now();
+      for (uint32_t i = 0; i < per_loop; i++) {
+        lb.add(levels[line % kLines], texts[line % kLines].c_str(), nullptr, nullptr);
+        line++;
+      }
+      lb.add_time += Now() - start;
+
+      // Lines as the readers get them, "13:45:21.999 " + text + '\1'
+      char mxtime[24];
+      snprintf(mxtime, sizeof(mxtime), "%02d:%02d:%02d.%03d ", RtcTime.hour, RtcTime.minute, RtcTime.second, RtcMillis());
+      logged.clear();
+      uint32_t loop_bytes = 0;               // Bytes used in the memmove buffer, more than in the ring
+      uint32_t max_needed = 0;               // Longest line in the ring including '\0'
+      for (uint32_t l = line - per_loop; l < line; l++) {
+        uint32_t length = strlen(mxtime) + texts[l % kLines].size() +1;
+        loop_bytes += length +2;
+        if (length +1 > max_needed) { max_needed = length +1; }
+        if (levels[l % kLines] <= lb.settings->mqttlog_level) {
+          logged.push_back(std::string(mxtime) + texts[l % kLines] + '\1');
+        }
+      }
+      bool may_lose = (loop_bytes + max_needed +1 > LOG_BUFFER_SIZE) || (per_loop > LOG_INDEX_SIZE);
+
+      read.clear();
+      start = Now();
+      Drain(lb, lb.settings->mqttlog_level, &mqtt_index, false, &read);
+      Drain(lb, lb.global->syslog_level, &syslog_index, false, nullptr);
+      if (0 == loop % 20) {
+        Drain(lb, lb.settings->weblog_level, &web_index, false, nullptr);
+      }
+      lb.read_time += Now() - start;
+      CheckMqtt(lb, logged, read, may_lose);
+    }
+  }
+
+  uint32_t total = seconds * (rate / 20) * 20;
+  printf("%u lines at %u lines/s, log buffer of %u bytes\n", total, rate, LOG_BUFFER_SIZE);
+  printf("%-8s %14s %14s %14s %12s\n", "Buffer", "AddLog ns/line", "GetLog ns/line", "Total ns/line", "Lines read");
+  for (uint32_t b = 0; b < 2; b++) {
+    LogBench &lb = bench[b];
+    printf("%-8s %14.0f %14.0f %14.0f %12u\n", lb.name, lb.add_time * 1e9 / total, lb.read_time * 1e9 / total,
+      (lb.add_time + lb.read_time) * 1e9 / total, lb.lines_read);
+  }
+
+  uint32_t errors = 0;
+  for (uint32_t b = 0; b < 2; b++) {
+    LogBench &lb = bench[b];
+    printf("%-8s MQTT lines: %u read, %u lost in loops logging more than the buffer holds, %u missed or wrong\n",
+      lb.name, lb.mqtt_lines, lb.mqtt_lost, lb.mqtt_errors);
+    errors += lb.mqtt_errors;
+  }
+  return (errors) ? 1 : 0;
+}
@@ -0,0 +1,154 @@
+/*
+  Arduino.h - minimal Arduino environment for response-bench, for Tasmota
+
+  Copyright (C) 2021  Theo Arends
+
+  This program is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef _ARDUINO_BENCH_H_
+#define _ARDUINO_BENCH_H_
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <stdarg.h>
+#include <ctype.h>
+#include <string.h>
+#include <math.h>
+#include <sys/mman.h>
+
+#if !defined(__x86_64__)
+  #error "response-bench needs an x86_64 host"
+#endif
+
+#define PROGMEM
+#define PSTR(s) (s)
+#define strlen_P strlen
+#define strcpy_P strcpy
+#define snprintf_P snprintf
+#define vsnprintf_P HostVsnprintf
+#define pgm_read_byte(addr) (*(const uint8_t *)(addr))
+
+// Counts the characters formatted by ext_printf
+inline uint32_t &HostFormatted(void) { static uint32_t formatted = 0; return formatted; }
+inline int HostVsnprintf(char *buffer, size_t size, const char *format, va_list args) {
+  int len = vsnprintf(buffer, size, format, args);
+  if ((len > 0) && (size > 1)) { HostFormatted() += ((size_t)len < size) ? len : size -1; }
+  return len;
+}
+
+inline char *dtostrf(double number, signed char width, unsigned char prec, char *s) {
+  sprintf(s, "%*.*f", width, prec, number);
+  return s;
+}
+
+/*********************************************************************************************\
+ * Variadic arguments
+ *
+ * ext_printf patches the arguments in place and needs va_cur_ptr4() to find the current one.
+ * x86_64 passes the first 6 integer arguments in registers, functions calling ext_printf get
+ * 5 dummy arguments in front of the format so all variadic arguments are passed on the stack
+ * in 8 byte slots. Pointers are read back as 32 bits so floats passed by address must be
+ * allocated below 4GB and above min_valid_ptr by HostFloat().
+ *
+ * ext_vsnprintf_malloc_P() returns its buffer as int32_t, which needs -fpermissive and, to
+ * keep heap addresses below 2GB, -no-pie.
+\*********************************************************************************************/
+
+struct HostVaList {
+  uint32_t gp_offset;
+  uint32_t fp_offset;
+  void *overflow_arg_area;                 // Next argument passed on the stack
+  void *reg_save_area;
+};
+#define va_cur_ptr4(va,T) ( (T*) ((uint8_t*)((HostVaList*)(va))->overflow_arg_area - 8) )
+
+inline float *HostFloat(float value) {
+  static float *floats = nullptr;
+  static uint32_t used = 0;
+  if (!floats) {
+    floats = (float*)mmap((void*)0x40000000, 0x10000, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_FIXED_NOREPLACE, -1, 0);
+    if (MAP_FAILED == floats) {
+      perror("mmap");
+      exit(2);
+    }
+  }
+  if (used >= 0x10000 / sizeof(float)) { used = 0; }
+  floats[used] = value;
+  return &floats[used++];
+}
+
+/*********************************************************************************************\
+ * String with the growth of the ESP8266 core: reserve() reallocates to the exact size
+\*********************************************************************************************/
+
+struct StringStats {
+  uint32_t reallocs;                       // Buffer (re)allocations
+  uint32_t copied;                         // Bytes copied into or moved by the String
+};
+extern StringStats String_stats;
+
+class String {
+public:
+  String() {}
+  String(const char *cstr) { *this = cstr; }
+  ~String() { free(buffer_); }
+  String &operator=(const char *cstr) { copy(cstr, strlen(cstr)); return *this; }
+  String &operator+=(const char *cstr) { concat(cstr, strlen(cstr)); return *this; }
+  bool reserve(unsigned int size) {
+    if (buffer_ && (capacity_ >= size)) { return true; }
+    if (!changeBuffer(size)) { return false; }
+    if (!len_) { buffer_[0] = '\0'; }
+    return true;
+  }
+  unsigned int length(void) const { return len_; }
+  const char *c_str(void) const { return buffer_ ? buffer_ : ""; }
+  void setCharAt(unsigned int index, char c) { if (index < len_) { buffer_[index] = c; } }
+
+protected:
+  unsigned int capacity(void) const { return capacity_; }
+  char *wbuffer(void) const { return buffer_; }
+  void setLen(int len) { len_ = len; }
+
+private:
+  bool changeBuffer(unsigned int size) {
+    char *old = buffer_;
+    char *buffer = (char*)realloc(buffer_, size +1);
+    if (!buffer) { return false; }
+    String_stats.reallocs++;
+    if (old && (buffer != old)) { String_stats.copied += len_ +1; }
+    buffer_ = buffer;
+    capacity_ = size;
+    return true;
+  }
+  void copy(const char *cstr, unsigned int length) {
+    if (!reserve(length)) { return; }
+    memmove(buffer_, cstr, length +1);
+    len_ = length;
+    String_stats.copied += length;
+  }
+  void concat(const char *cstr, unsigned int length) {
+    if (!reserve(len_ + length)) { return; }
+    memmove(buffer_ + len_, cstr, length +1);
+    len_ += length;
+    String_stats.copied += length;
+  }
+
+  char *buffer_ = nullptr;
+  unsigned int capacity_ = 0;
+  unsigned int len_ = 0;
+};
+
+#endif  // _ARDUINO_BENCH_H_
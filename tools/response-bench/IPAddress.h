@@ -0,0 +1 @@
+// IPAddress.h - empty, ext_printf formats IP addresses itself
@@ -0,0 +1,219 @@
+/*
+  response-bench.cpp - host benchmark of the response buffer, for Tasmota
+
+  Copyright (C) 2021  Theo Arends
+
+  This program is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+Instructions:
+  Builds a teleperiod sensor response like MqttShowSensor() with MQTT_DATA_STRING
+  for a number of sensors (default 30) and reports per MqttShowSensor() the heap
+  allocations, the bytes allocated, the bytes formatted by ext_printf and the
+  bytes copied or moved by the String, for:
+    - String: ext_vsnprintf_malloc_P() and String += per ResponseAppend_P() (previous behavior)
+    - ResponseString: formats straight into its buffer, pre-sized from the previous response
+
+  The String has the growth of the ESP8266 core, see Arduino.h. The benchmark
+  checks that both build the same response.
+
+  Host speeds don't reflect ESP8266 speeds, compare the ratios.
+
+Usage:
+  g++ -O2 -fpermissive -no-pie -I tools/response-bench -I lib/default/Ext-printf/src \
+    -o response-bench tools/response-bench/response-bench.cpp
+  ./response-bench [sensors [teleperiods]]
+*/
+
+#include <time.h>
+#include "response.h"
+
+extern "C" void *__libc_malloc(size_t size);
+extern "C" void *__libc_realloc(void *ptr, size_t size);
+extern "C" void __libc_free(void *ptr);
+
+struct {
+  uint32_t allocs;
+  uint32_t bytes;
+} Heap;
+
+extern "C" void *malloc(size_t size) {
+  Heap.allocs++;
+  Heap.bytes += size;
+  return __libc_malloc(size);
+}
+
+extern "C" void *realloc(void *ptr, size_t size) {
+  Heap.allocs++;
+  Heap.bytes += size;
+  return __libc_realloc(ptr, size);
+}
+
+extern "C" void free(void *ptr) {
+  __libc_free(ptr);
+}
+
+/*********************************************************************************************\
+ * Both response buffers
+\*********************************************************************************************/
+
+String string_data;                        // Previous behavior
+ResponseString response_data;
+uint32_t sensor_response_size = 0;
+
+int StringAppend_P(RESPONSE_ARGS, const char* format, ...) {
+  va_list arg;
+  va_start(arg, format);
+  char* mqtt_data = ext_vsnprintf_malloc_P(format, arg);
+  va_end(arg);
+  if (mqtt_data != nullptr) {
+    string_data += mqtt_data;
+    free(mqtt_data);
+  }
+  return string_data.length();
+}
+
+int ResponseStringAppend_P(RESPONSE_ARGS, const char* format, ...) {
+  va_list arg;
+  va_start(arg, format);
+  int len = response_data.AppendVP(format, arg);
+  va_end(arg);
+  return len;
+}
+
+typedef int (*AppendFunc)(RESPONSE_ARGS, const char* format, ...);
+
+/*********************************************************************************************\
+ * Teleperiod sensor response
+\*********************************************************************************************/
+
+struct Sensor {
+  uint32_t type;
+  char name[16];
+  float values[10];
+};
+
+void ShowSensors(AppendFunc append, Sensor *sensors, uint32_t count) {
+  append ResponseAppendArgs(PSTR("{\"Time\":\"2021-07-20T12:34:56\""));
+  for (uint32_t i = 0; i < count; i++) {
+    Sensor &s = sensors[i];
+    float *v = s.values;
+    switch (s.type) {
+    case 0:                                // Switch
+      append ResponseAppendArgs(PSTR(",\"%s\":\"%s\""), s.name, (i & 1) ? "ON" : "OFF");
+      break;
+    case 1:                                // ResponseAppendTHD()
+      append ResponseAppendArgs(PSTR(",\"%s\":{\"Temperature\":%*_f,\"Humidity\":%*_f,\"DewPoint\":%*_f}"), s.name,
+        1, HostFloat(v[0]), 1, HostFloat(v[1]), 1, HostFloat(v[2]));
+      break;
+    case 2:                                // BME280
+      append ResponseAppendArgs(PSTR(",\"%s\":{\"Temperature\":%*_f,\"Humidity\":%*_f,\"DewPoint\":%*_f,\"Pressure\":%*_f}"), s.name,
+        1, HostFloat(v[0]), 1, HostFloat(v[1]), 1, HostFloat(v[2]), 1, HostFloat(v[3]));
+      break;
+    case 3:                                // DS18B20
+      append ResponseAppendArgs(PSTR(",\"%s\":{\"Id\":\"%s\",\"Temperature\":%*_f}"), s.name, "01144BF2C0AA", 1, HostFloat(v[0]));
+      break;
+    case 4:                                // ADC
+      append ResponseAppendArgs(PSTR(",\"%s\":{\"A0\":%d,\"Range\":%d}"), s.name, (int)v[0], (int)v[1]);
+      break;
+    case 5:                                // Energy
+      append ResponseAppendArgs(PSTR(",\"ENERGY\":{\"TotalStartTime\":\"%s\",\"Total\":%*_f,\"Yesterday\":%*_f,\"Today\":%*_f,\"Period\":%d"),
+        "2021-01-01T00:00:00", 3, HostFloat(v[0]), 3, HostFloat(v[1]), 3, HostFloat(v[2]), (int)v[3]);
+      append ResponseAppendArgs(PSTR(",\"Power\":%*_f,\"ApparentPower\":%*_f,\"ReactivePower\":%*_f,\"Factor\":%*_f,\"Voltage\":%*_f,\"Current\":%*_f}"),
+        0, HostFloat(v[4]), 0, HostFloat(v[5]), 0, HostFloat(v[6]), 2, HostFloat(v[7]), 0, HostFloat(v[8]), 3, HostFloat(v[9]));
+      break;
+    }
+  }
+  append ResponseAppendArgs(PSTR(",\"TempUnit\":\"%c\""), 'C');
+  append ResponseAppendArgs(PSTR("}"));
+}
+
+void StringShowSensor(Sensor *sensors, uint32_t count) {
+  string_data = "";                        // ResponseClear()
+  ShowSensors(StringAppend_P, sensors, count);
+}
+
+void ResponseStringShowSensor(Sensor *sensors, uint32_t count) {
+  response_data = "";                      // ResponseClear()
+  uint32_t response_start = response_data.length();
+  response_data.reserve(response_start + sensor_response_size);  // ResponseReserve()
+  ShowSensors(ResponseStringAppend_P, sensors, count);
+  sensor_response_size = response_data.length() - response_start;
+}
+
+/*********************************************************************************************\
+ * Benchmark
+\*********************************************************************************************/
+
+double Now(void) {
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+struct Result {
+  uint32_t allocs;
+  uint32_t bytes;
+  uint32_t formatted;
+  uint32_t copied;
+  double time;
+};
+
+Result Run(void (*show)(Sensor*, uint32_t), Sensor *sensors, uint32_t count, uint32_t teleperiods) {
+  Heap = {};
+  HostFormatted() = 0;
+  String_stats = {};
+  double start = Now();
+  for (uint32_t t = 0; t < teleperiods; t++) {
+    for (uint32_t i = 0; i < count; i++) {
+      sensors[i].values[0] += 0.1f;        // Sensor readings vary between teleperiods
+      sensors[i].values[3] += 1;
+    }
+    show(sensors, count);
+  }
+  return { Heap.allocs, Heap.bytes, HostFormatted(), String_stats.copied, Now() - start };
+}
+
+int main(int argc, char *argv[]) {
+  uint32_t count = (argc > 1) ? atoi(argv[1]) : 30;
+  uint32_t teleperiods = (argc > 2) ? atoi(argv[2]) : 10000;
+
+  Sensor *initial = (Sensor*)calloc(count, sizeof(Sensor));
+  for (uint32_t i = 0; i < count; i++) {
+    initial[i].type = (i == count / 2) ? 5 : i % 5;
+    snprintf(initial[i].name, sizeof(initial[i].name), "Sensor%u", i +1);
+    for (uint32_t v = 0; v < 10; v++) { initial[i].values[v] = 10.0f * (v +1) + i; }
+  }
+  Sensor *sensors = (Sensor*)calloc(count, sizeof(Sensor));
+
+  printf("%u sensors, %u teleperiods, per MqttShowSensor():\n", count, teleperiods);
+  printf("%-15s %8s %10s %10s %8s %8s\n", "Buffer", "Allocs", "Allocated", "Formatted", "Copied", "ns");
+  for (uint32_t warm = 0; warm < 2; warm++) {
+    const char *names[2] = { "String", "ResponseString" };
+    void (*shows[2])(Sensor*, uint32_t) = { StringShowSensor, ResponseStringShowSensor };
+    for (uint32_t b = 0; b < 2; b++) {
+      uint32_t runs = warm ? teleperiods : 1;
+      memcpy(sensors, initial, count * sizeof(Sensor));
+      Result r = Run(shows[b], sensors, count, runs);
+      printf("%-15s %8.1f %10.0f %10.0f %8.0f %8.0f%s\n", names[b], (double)r.allocs / runs, (double)r.bytes / runs,
+        (double)r.formatted / runs, (double)r.copied / runs, r.time * 1e9 / runs, warm ? "" : "  first");
+    }
+  }
+
+  if (strcmp(string_data.c_str(), response_data.c_str())) {
+    printf("Responses differ:\n%s\n%s\n", string_data.c_str(), response_data.c_str());
+    return 1;
+  }
+  printf("Responses identical, %u bytes\n", string_data.length());
+  return 0;
+}
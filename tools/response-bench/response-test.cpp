@@ -0,0 +1,87 @@
+/*
+  response-test.cpp - host test of the response buffer, for Tasmota
+
+  Copyright (C) 2021  Theo Arends
+
+  This program is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+Instructions:
+  Appends payloads full of %_f, %*_f and %_I to a ResponseString of small
+  capacity so most appends have to grow the buffer, and checks the result
+  against the same payloads formatted into a large buffer. ext_printf patches
+  the arguments in place and frees its temporary strings when done, so a grown
+  buffer must be formatted before ext_printf returns: formatting the same
+  arguments a second time prints freed or patched pointers.
+
+  ResponseString is a copy of tasmota/support.ino, see response.h.
+
+Usage:
+  g++ -g -fpermissive -fsanitize=address,undefined -I tools/response-bench -I lib/default/Ext-printf/src \
+    -o response-test tools/response-bench/response-test.cpp
+  ./response-test
+*/
+
+#include "response.h"
+
+ResponseString mqtt_data;
+
+int ResponseAppendTest(RESPONSE_ARGS, const char* format, ...) {
+  va_list arg;
+  va_start(arg, format);
+  int len = mqtt_data.AppendVP(format, arg);
+  va_end(arg);
+  return len;
+}
+
+int FormatTest(RESPONSE_ARGS, char* buffer, size_t size, const char* format, ...) {
+  va_list arg;
+  va_start(arg, format);
+  int len = ext_vsnprintf_P(buffer, size, format, arg);
+  va_end(arg);
+  return len;
+}
+
+const char kPayload[] = ",\"S%d\":{\"T\":%*_f,\"H\":%*_f,\"D\":%1_f,\"P\":%_f,\"V\":%*_f,"
+  "\"I\":%*_f,\"E\":%3_f,\"F\":%_f,\"Y\":%*_f,\"Z\":%-4_f,\"IP\":\"%_I\",\"N\":\"%s\"}";
+
+int main(void) {
+  char expected[8192] = "";
+  char piece[1024];
+  int errors = 0;
+
+  for (uint32_t capacity = 1; capacity <= 512; capacity *= 8) {
+    mqtt_data = "";
+    mqtt_data.reserve(capacity);
+    expected[0] = '\0';
+    for (int i = 0; i < 40; i++) {
+      float v = i * 1.37f - 20;
+      FormatTest ResponseAppendArgs(piece, sizeof(piece), kPayload, i,
+        1, HostFloat(v), 2, HostFloat(v * 2), HostFloat(v * 3), HostFloat(v * 4), 3, HostFloat(v * 5),
+        -2, HostFloat(v * 6), HostFloat(v * 7), HostFloat(v * 8), 0, HostFloat(v * 9), HostFloat(v * 10),
+        0x0102A8C0 + i, "sensor");
+      int len = ResponseAppendTest ResponseAppendArgs(kPayload, i,
+        1, HostFloat(v), 2, HostFloat(v * 2), HostFloat(v * 3), HostFloat(v * 4), 3, HostFloat(v * 5),
+        -2, HostFloat(v * 6), HostFloat(v * 7), HostFloat(v * 8), 0, HostFloat(v * 9), HostFloat(v * 10),
+        0x0102A8C0 + i, "sensor");
+      strcat(expected, piece);
+      if ((len != (int)strlen(expected)) || strcmp(mqtt_data.c_str(), expected)) {
+        printf("Capacity %u append %d: expected %s\n                    got %s\n", capacity, i, expected, mqtt_data.c_str());
+        errors++;
+        break;
+      }
+    }
+  }
+  printf("%s, %u bytes, %u buffer reallocations\n", errors ? "FAILED" : "OK", (uint32_t)strlen(expected), String_stats.reallocs);
+  return errors ? 1 : 0;
+}
@@ -0,0 +1,69 @@
+/*
+  response.h - Tasmota response buffer for response-bench, for Tasmota
+
+  Copyright (C) 2021  Theo Arends
+
+  This program is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef _RESPONSE_BENCH_H_
+#define _RESPONSE_BENCH_H_
+
+#include <Arduino.h>
+#include "../../lib/default/Ext-printf/src/ext_printf.cpp"
+
+StringStats String_stats;
+
+/*********************************************************************************************\
+ * Response buffer - copy of tasmota/tasmota_globals.h and tasmota/support.ino
+\*********************************************************************************************/
+
+class ResponseString : public String {
+public:
+  using String::operator=;
+  int32_t AppendVP(const char* format, va_list args);
+private:
+  static char* Grow(void* ctx, size_t len);
+};
+
+char* ResponseString::Grow(void* ctx, size_t len) {
+  // Called by ext_vsnprintf_grow_P when the result does not fit, returns the buffer to format into
+  ResponseString* response = (ResponseString*)ctx;
+  uint32_t mlen = response->length();
+  uint32_t size = response->capacity() + (response->capacity() >> 1);  // Grow by 50% to limit regrowth
+  if (size < mlen + len) { size = mlen + len; }
+  if (!response->reserve(size)) { return nullptr; }
+  return response->wbuffer() + mlen;
+}
+
+int32_t ResponseString::AppendVP(const char* format, va_list args) {
+  // Format straight into the String buffer and only grow it if the result does not fit
+  uint32_t mlen = length();
+  if (!reserve(mlen +1)) { return mlen; }  // Make sure there is a valid buffer
+
+  int32_t len = ext_vsnprintf_grow_P(wbuffer() + mlen, capacity() - mlen +1, ResponseString::Grow, this, format, args);
+  if (len < 0) { len = 0; }
+  if (mlen + len > capacity()) {           // Buffer could not grow
+    wbuffer()[mlen] = '\0';                // Remove truncated result
+    return mlen;
+  }
+  setLen(mlen + len);
+  return mlen + len;
+}
+
+// See Arduino.h for the 5 dummy arguments
+#define RESPONSE_ARGS int, int, int, int, int
+#define ResponseAppendArgs(...) (0, 0, 0, 0, 0, __VA_ARGS__)
+
+#endif  // _RESPONSE_BENCH_H_
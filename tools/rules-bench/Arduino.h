@@ -0,0 +1,174 @@
+/*
+  Arduino.h - host replacement of the Arduino core for rules-bench
+
+  Copyright (C) 2021  Theo Arends
+
+  This program is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+  Only what the rules engine and JsonParser use. String counts its heap
+  allocations like the ESP8266 core would make them.
+*/
+
+#ifndef _ARDUINO_BENCH_H_
+#define _ARDUINO_BENCH_H_
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+#include <strings.h>
+#include <ctype.h>
+
+#define PROGMEM
+#define PSTR(s) (s)
+#define F(s) ((const __FlashStringHelper *)(s))
+#define pgm_read_byte(addr) (*(const uint8_t *)(addr))
+#define snprintf_P snprintf
+#define memmove_P memmove
+#define strcmp_P strcmp
+#define strcasecmp_P strcasecmp
+
+#define bitRead(value, bit) (((value) >> (bit)) & 0x01)
+#define bitSet(value, bit) ((value) |= (1UL << (bit)))
+#define bitClear(value, bit) ((value) &= ~(1UL << (bit)))
+
+template<typename T, typename U> static inline T tmin(T a, U b) { return (a < b) ? a : b; }
+
+static inline void yield(void) {}
+static inline void delay(uint32_t) {}
+
+static inline size_t host_strlcpy(char *dst, const char *src, size_t size) {
+  size_t len = strlen(src);
+  if (size) {
+    size_t n = (len < size) ? len : size -1;
+    memcpy(dst, src, n);
+    dst[n] = '\0';
+  }
+  return len;
+}
+#define strlcpy host_strlcpy
+
+class __FlashStringHelper;
+
+struct {
+  uint32_t allocs;
+  uint32_t bytes;
+} String_stats;
+
+class String {
+public:
+  String() {}
+  String(const char *cstr) { copy(cstr, strlen(cstr)); }
+  String(const __FlashStringHelper *fstr) : String((const char *)fstr) {}
+  String(const String &str) { copy(str.c_str(), str.len_); }
+  explicit String(int value) { char buf[12]; snprintf(buf, sizeof(buf), "%d", value); copy(buf, strlen(buf)); }
+  explicit String(uint32_t value) { char buf[12]; snprintf(buf, sizeof(buf), "%u", value); copy(buf, strlen(buf)); }
+  ~String() { free(buffer_); }
+
+  String &operator=(const String &str) { if (this != &str) { copy(str.c_str(), str.len_); } return *this; }
+  String &operator=(const char *cstr) { copy(cstr, strlen(cstr)); return *this; }
+  String &operator+=(const String &str) { concat(str.c_str(), str.len_); return *this; }
+  String &operator+=(const char *cstr) { concat(cstr, strlen(cstr)); return *this; }
+  String &operator+=(const __FlashStringHelper *fstr) { return *this += (const char *)fstr; }
+  friend String operator+(const String &lhs, const String &rhs) { String result(lhs); result += rhs; return result; }
+  bool operator==(const String &rhs) const { return (len_ == rhs.len_) && !strcmp(c_str(), rhs.c_str()); }
+  bool operator!=(const String &rhs) const { return !(*this == rhs); }
+  char operator[](unsigned int index) const { return (index < len_) ? buffer_[index] : '\0'; }
+
+  unsigned int length(void) const { return len_; }
+  const char *c_str(void) const { return buffer_ ? buffer_ : ""; }
+
+  int indexOf(char ch, unsigned int from = 0) const {
+    if (from >= len_) { return -1; }
+    const char *found = strchr(c_str() + from, ch);
+    return (found) ? found - c_str() : -1;
+  }
+  int indexOf(const char *str, unsigned int from = 0) const {
+    if (from >= len_) { return -1; }
+    const char *found = strstr(c_str() + from, str);
+    return (found) ? found - c_str() : -1;
+  }
+  int indexOf(const String &str, unsigned int from = 0) const { return indexOf(str.c_str(), from); }
+  int indexOf(const __FlashStringHelper *fstr, unsigned int from = 0) const { return indexOf((const char *)fstr, from); }
+
+  bool startsWith(const String &prefix) const { return (len_ >= prefix.len_) && !strncmp(c_str(), prefix.c_str(), prefix.len_); }
+  bool endsWith(const String &suffix) const { return (len_ >= suffix.len_) && !strcmp(c_str() + len_ - suffix.len_, suffix.c_str()); }
+
+  String substring(unsigned int from) const { return substring(from, len_); }
+  String substring(unsigned int from, unsigned int to) const {
+    String result;
+    if (to > len_) { to = len_; }
+    if (from < to) { result.copy(c_str() + from, to - from); }
+    return result;
+  }
+
+  void trim(void) {
+    if (!len_) { return; }
+    const char *begin = buffer_;
+    while (isspace(*begin)) { begin++; }
+    const char *end = buffer_ + len_ -1;
+    while ((end >= begin) && isspace(*end)) { end--; }
+    len_ = end + 1 - begin;
+    if (begin > buffer_) { memmove(buffer_, begin, len_); }
+    buffer_[len_] = '\0';
+  }
+  void toUpperCase(void) { for (unsigned int i = 0; i < len_; i++) { buffer_[i] = toupper(buffer_[i]); } }
+  void toLowerCase(void) { for (unsigned int i = 0; i < len_; i++) { buffer_[i] = tolower(buffer_[i]); } }
+  long toInt(void) const { return atol(c_str()); }
+
+  void replace(const String &find, const String &replace) {
+    if (!len_ || !find.len_) { return; }
+    String result;
+    const char *read = c_str();
+    const char *found;
+    while ((found = strstr(read, find.c_str())) != nullptr) {
+      result.concat(read, found - read);
+      result.concat(replace.c_str(), replace.len_);
+      read = found + find.len_;
+    }
+    if (read == c_str()) { return; }
+    result += read;
+    *this = result;
+  }
+
+private:
+  void copy(const char *cstr, unsigned int length) {
+    if (!reserve(length)) { return; }
+    memmove(buffer_, cstr, length);
+    buffer_[length] = '\0';
+    len_ = length;
+  }
+  void concat(const char *cstr, unsigned int length) {
+    if (!reserve(len_ + length)) { return; }
+    memmove(buffer_ + len_, cstr, length);
+    len_ += length;
+    buffer_[len_] = '\0';
+  }
+  bool reserve(unsigned int size) {
+    if (buffer_ && (capacity_ >= size)) { return true; }
+    char *buffer = (char*)realloc(buffer_, size +1);
+    if (!buffer) { return false; }
+    String_stats.allocs++;
+    String_stats.bytes += size +1;
+    buffer_ = buffer;
+    capacity_ = size;
+    return true;
+  }
+
+  char *buffer_ = nullptr;
+  unsigned int capacity_ = 0;
+  unsigned int len_ = 0;
+};
+
+#endif  // _ARDUINO_BENCH_H_
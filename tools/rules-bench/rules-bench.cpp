@@ -0,0 +1,1429 @@
+/*
+  rules-bench.cpp - host benchmark of the rules engine, for Tasmota
+
+  Copyright (C) 2021  Theo Arends
+
+  This program is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+Instructions:
+  Feeds a stream of events (default 20000) to three rule sets of typical rules
+  and reports the cost per event and the String heap allocations per event of:
+    - the text rules engine, parsing the rule text and the event JSON for every
+      trigger
+    - the compiled rules engine, matching the event against the compiled
+      trigger tables after parsing the event once
+
+  The events are the teleperiod SENSOR message of six sensors with slowly
+  changing values and the state events of power, switches, time and rule
+  variables. Var<x> and Mem<x> commands executed by the rules update the rule
+  variables, all other commands are only recorded. The benchmark checks that
+  both engines execute the same commands in the same order.
+
+  The text engine is a copy of tasmota/xdrv_10_rules.ino before the trigger
+  tables, the compiled engine a copy of the current one. The JSON parser is
+  lib/default/jsmn-shadinger-1.0. Build with -fpermissive, the copies rely on
+  the C library strchr() returning a non const pointer.
+
+  Host speeds don't reflect ESP8266 speeds, compare the ratios.
+
+Usage:
+  g++ -O2 -fpermissive -I tools/rules-bench -I lib/default/jsmn-shadinger-1.0/src -o rules-bench tools/rules-bench/rules-bench.cpp
+  ./rules-bench [events]
+*/
+
+#include "Arduino.h"
+#include "jsmn.cpp"
+#include "JsonParser.cpp"
+#include <time.h>
+#include <string>
+#include <vector>
+
+/*********************************************************************************************\
+ * Firmware environment
+\*********************************************************************************************/
+
+#define MAX_RULE_SETS          3
+#define MAX_RULE_TIMERS        8
+#define MAX_RULE_VARS          16
+#define MAX_RULE_MEMS          16
+#define CMDSZ                  24
+
+#define SHOW_FREE_MEM(x)
+
+enum LoggingLevels { LOG_LEVEL_NONE, LOG_LEVEL_ERROR, LOG_LEVEL_INFO, LOG_LEVEL_DEBUG, LOG_LEVEL_DEBUG_MORE };
+enum CommandSource { SRC_IGNORE, SRC_RULE = 8 };
+enum DateTimeFormats { DT_LOCAL };
+enum SettingsTextIndex { SET_MEM1 };
+
+struct {
+  uint8_t rule_enabled;
+  uint8_t rule_once;
+} SettingsData;
+auto Settings = &SettingsData;
+
+struct {
+  char mqtt_topic[33] = "tasmota";
+} TasmotaGlobal;
+
+char rules_vars[MAX_RULE_VARS][33] = {{ 0 }};
+char rules_mems[MAX_RULE_MEMS][33] = {{ 0 }};
+String rule_text[MAX_RULE_SETS];
+uint32_t minutes_past_midnight = 0;
+
+const char* SettingsText(uint32_t index) { return rules_mems[index - SET_MEM1]; }
+uint32_t MinutesPastMidnight(void) { return minutes_past_midnight; }
+uint32_t MinutesUptime(void) { return minutes_past_midnight; }
+uint32_t UtcTime(void) { return 1626000000 + minutes_past_midnight * 60; }
+String GetDateAndTime(uint32_t time_type) { return String("2021-07-14T12:00:00"); }
+uint32_t ESP_getChipId(void) { return 0x83BB10; }
+String NetworkUniqueId(void) { return String("ECFABC83BB10"); }
+void AddLog(uint32_t loglevel, const char* formatP, ...) {}
+
+size_t GetRuleLen(uint32_t idx) { return rule_text[idx].length(); }
+String GetRule(uint32_t idx) { return rule_text[idx]; }
+
+std::vector<std::string> executed;         // Commands executed by the rules in order
+
+void ExecuteCommand(const char* cmnd, uint32_t source) {
+  executed.push_back(cmnd);
+  uint32_t index;
+  char value[33];
+  if (2 == sscanf(cmnd, "Var%u %32s", &index, value) && index && (index <= MAX_RULE_VARS)) {
+    strlcpy(rules_vars[index -1], value, sizeof(rules_vars[0]));
+  }
+  if (2 == sscanf(cmnd, "Mem%u %32s", &index, value) && index && (index <= MAX_RULE_MEMS)) {
+    strlcpy(rules_mems[index -1], value, sizeof(rules_mems[0]));
+  }
+}
+
+/*********************************************************************************************\
+ * Copies of tasmota/support.ino
+\*********************************************************************************************/
+
+float CharToFloat(const char *str)
+{
+  // simple ascii to double, because atof or strtod are too large
+  char strbuf[24];
+
+  strlcpy(strbuf, str, sizeof(strbuf));
+  char *pt = strbuf;
+  if (*pt == '\0') { return 0.0; }
+
+  while ((*pt != '\0') && isblank(*pt)) { pt++; }  // Trim leading spaces
+
+  signed char sign = 1;
+  if (*pt == '-') { sign = -1; }
+  if (*pt == '-' || *pt == '+') { pt++; }          // Skip any sign
+
+  float left = 0;
+  if (*pt != '.') {
+    left = atoi(pt);                               // Get left part
+    while (isdigit(*pt)) { pt++; }                 // Skip number
+  }
+
+  float right = 0;
+  if (*pt == '.') {
+    pt++;
+    uint32_t max_decimals = 0;
+    while ((max_decimals < 8) && isdigit(pt[max_decimals])) { max_decimals++; }
+    pt[max_decimals] = '\0';                       // Limit decimals to float max of 8
+    right = atoi(pt);                              // Decimal part
+    while (isdigit(*pt)) {
+      pt++;
+      right /= 10.0f;
+    }
+  }
+
+  float result = left + right;
+  if (sign < 0) {
+    return -result;                                // Add negative sign
+  }
+  return result;
+}
+
+char* GetTextIndexed(char* destination, size_t destination_size, uint32_t index, const char* haystack)
+{
+  // Returns empty string if not found
+  // Returns text of found
+  char* write = destination;
+  const char* read = haystack;
+
+  index++;
+  while (index--) {
+    size_t size = destination_size -1;
+    write = destination;
+    char ch = '.';
+    while ((ch != '\0') && (ch != '|')) {
+      ch = pgm_read_byte(read++);
+      if (size && (ch != '|'))  {
+        *write++ = ch;
+        size--;
+      }
+    }
+    if (0 == ch) {
+      if (index) {
+        write = destination;
+      }
+      break;
+    }
+  }
+  *write = '\0';
+  return destination;
+}
+
+int GetCommandCode(char* destination, size_t destination_size, const char* needle, const char* haystack)
+{
+  // Returns -1 of not found
+  // Returns index and command if found
+  int result = -1;
+  const char* read = haystack;
+  char* write = destination;
+
+  while (true) {
+    result++;
+    size_t size = destination_size -1;
+    write = destination;
+    char ch = '.';
+    while ((ch != '\0') && (ch != '|')) {
+      ch = pgm_read_byte(read++);
+      if (size && (ch != '|'))  {
+        *write++ = ch;
+        size--;
+      }
+    }
+    *write = '\0';
+    if (!strcasecmp(needle, destination)) {
+      break;
+    }
+    if (0 == ch) {
+      result = -1;
+      break;
+    }
+  }
+  return result;
+}
+
+#define D_ADMIN "Admin"
+#define D_BLINK "Blink"
+#define D_BLINKOFF "BlinkOff"
+#define D_CELSIUS "Celsius"
+#define D_FAHRENHEIT "Fahrenheit"
+#define D_FALSE "False"
+#define D_OFF "Off"
+#define D_ON "On"
+#define D_START "Start"
+#define D_STOP "Stop"
+#define D_TOGGLE "Toggle"
+#define D_TRUE "True"
+#define D_USER "User"
+
+const char kOptions[] PROGMEM = "OFF|" D_OFF "|FALSE|" D_FALSE "|STOP|" D_STOP "|" D_CELSIUS "|"              // 0
+                                "ON|" D_ON "|TRUE|" D_TRUE "|START|" D_START "|" D_FAHRENHEIT "|" D_USER "|"  // 1
+                                "TOGGLE|" D_TOGGLE "|" D_ADMIN "|"                                            // 2
+                                "BLINK|" D_BLINK "|"                                                          // 3
+                                "BLINKOFF|" D_BLINKOFF "|"                                                    // 4
+                                "ALL" ;                                                                       // 255
+
+const uint8_t sNumbers[] PROGMEM = { 0,0,0,0,0,0,0,
+                                     1,1,1,1,1,1,1,1,
+                                     2,2,2,
+                                     3,3,
+                                     4,4,
+                                     255 };
+
+int GetStateNumber(char *state_text)
+{
+  char command[CMDSZ];
+  int state_number = GetCommandCode(command, sizeof(command), state_text, kOptions);
+  if (state_number >= 0) {
+    state_number = pgm_read_byte(sNumbers + state_number);
+  }
+  return state_number;
+}
+
+/*********************************************************************************************\
+ * Rules engines
+\*********************************************************************************************/
+
+#define COMPARE_OPERATOR_NONE                 -1
+#define COMPARE_OPERATOR_EQUAL                 0
+#define COMPARE_OPERATOR_BIGGER                1
+#define COMPARE_OPERATOR_SMALLER               2
+#define COMPARE_OPERATOR_EXACT_DIVISION        3
+#define COMPARE_OPERATOR_NUMBER_EQUAL          4
+#define COMPARE_OPERATOR_NOT_EQUAL             5
+#define COMPARE_OPERATOR_BIGGER_EQUAL          6
+#define COMPARE_OPERATOR_SMALLER_EQUAL         7
+#define COMPARE_OPERATOR_STRING_ENDS_WITH      8
+#define COMPARE_OPERATOR_STRING_STARTS_WITH    9
+#define COMPARE_OPERATOR_STRING_CONTAINS      10
+#define COMPARE_OPERATOR_STRING_NOT_EQUAL     11
+#define COMPARE_OPERATOR_STRING_NOT_CONTAINS  12
+#define MAXIMUM_COMPARE_OPERATOR              COMPARE_OPERATOR_STRING_NOT_CONTAINS
+const char kCompareOperators[] PROGMEM = "=\0>\0<\0|\0==!=>=<=$>$<$|$!$^";
+
+typedef struct RULE_TRIGGER {
+  String trigger;            // "INA219#CURRENT>0.100" as written after ON, used for logging
+  String name;               // "INA219#CURRENT" JSON path without TELE- prefix and [index]
+  String param;              // "0.100" or "%VAR1%" right side of comparison
+  String commands;           // "Backlog Dimmer 10;Color 100000"
+  float value;               // Value of param if constant
+  uint32_t root_bit;         // Bit of first JSON path key in event key mask
+  uint16_t vars;             // Bitmask of %VARx% used in commands
+  uint16_t mems;             // Bitmask of %MEMx% used in commands
+  uint16_t specials;         // Bitmask of kRulesSpecialVars used in commands
+  int8_t compare;            // Compare operator or COMPARE_OPERATOR_NONE
+  uint8_t name_index;        // Array index 1..6 or 0 if none
+  bool teleperiod;           // TELE- prefix
+  bool constant;             // param is a constant and value is valid
+  bool stop;                 // BREAK instead of ENDON
+} RULE_TRIGGER;
+
+// Special variables in order of replacement in commands
+enum RulesSpecialVars { RULES_VAR_VALUE, RULES_VAR_TIME, RULES_VAR_UTCTIME, RULES_VAR_UPTIME, RULES_VAR_TIMESTAMP,
+                        RULES_VAR_TOPIC, RULES_VAR_DEVICEID, RULES_VAR_MACADDR, RULES_VAR_SUNRISE, RULES_VAR_SUNSET,
+                        RULES_VAR_ZBDEVICE, RULES_VAR_ZBGROUP, RULES_VAR_ZBCLUSTER, RULES_VAR_ZBENDPOINT };
+const char kRulesSpecialVars[] PROGMEM =
+  "%VALUE%|%TIME%|%UTCTIME%|%UPTIME%|%TIMESTAMP%|"
+  "%TOPIC%|%DEVICEID%|%MACADDR%|%SUNRISE%|%SUNSET%|"
+  "%ZBDEVICE%|%ZBGROUP%|%ZBCLUSTER%|%ZBENDPOINT%";
+
+struct RULES {
+  String event_value;
+  RULE_TRIGGER* compiled[MAX_RULE_SETS] = { nullptr };
+  uint8_t compiled_count[MAX_RULE_SETS] = { 0 };
+  uint8_t compiled_valid = 0;  // Bitmask of rule sets with valid compiled triggers
+  uint32_t triggers[MAX_RULE_SETS] = { 0 };
+  uint8_t trigger_count[MAX_RULE_SETS] = { 0 };
+  bool teleperiod = false;
+  bool busy = false;
+  bool no_execute = false;   // Don't actually execute rule commands
+} Rules;
+
+namespace Text {
+
+int8_t parseCompareExpression(String &expr, String &leftExpr, String &rightExpr);  // Prototype generated by the Arduino IDE
+
+bool RulesRuleMatch(uint8_t rule_set, String &event, String &rule, bool stop_all_rules)
+{
+  // event = {"INA219":{"Voltage":4.494,"Current":0.020,"Power":0.089}}
+  // event = {"System":{"Boot":1}}
+  // rule = "INA219#CURRENT>0.100"
+
+  bool match = false;
+  char stemp[10];
+
+  // Step1: Analyse rule
+  String rule_expr = rule;                             // "TELE-INA219#CURRENT>0.100"
+  if (Rules.teleperiod) {
+    int ppos = rule_expr.indexOf(F("TELE-"));          // "TELE-INA219#CURRENT>0.100" or "INA219#CURRENT>0.100"
+    if (ppos == -1) { return false; }                  // No pre-amble in rule
+    rule_expr = rule.substring(5);                     // "INA219#CURRENT>0.100" or "SYSTEM#BOOT"
+  }
+
+  String rule_name, rule_param;
+  int8_t compareOperator = parseCompareExpression(rule_expr, rule_name, rule_param);  // Parse the compare expression.Return operator and the left, right part of expression
+
+  // rule_name  = "INA219#CURRENT"
+  // rule_param = "0.100" or "%VAR1%"
+
+#ifdef DEBUG_RULES
+  AddLog(LOG_LEVEL_DEBUG, PSTR("RUL-RM1: Teleperiod %d, Expr %s, Name %s, Param %s"), Rules.teleperiod, rule_expr.c_str(), rule_name.c_str(), rule_param.c_str());
+#endif
+
+  char rule_svalue[80] = { 0 };
+  float rule_value = 0;
+  if (compareOperator != COMPARE_OPERATOR_NONE) {
+    for (uint32_t i = 0; i < MAX_RULE_VARS; i++) {
+      snprintf_P(stemp, sizeof(stemp), PSTR("%%VAR%d%%"), i +1);
+      if (rule_param.startsWith(stemp)) {
+        rule_param = rules_vars[i];
+        break;
+      }
+    }
+    for (uint32_t i = 0; i < MAX_RULE_MEMS; i++) {
+      snprintf_P(stemp, sizeof(stemp), PSTR("%%MEM%d%%"), i +1);
+      if (rule_param.startsWith(stemp)) {
+        rule_param = SettingsText(SET_MEM1 + i);
+        break;
+      }
+    }
+    if (rule_param.startsWith(F("%TIME%"))) {
+      rule_param = String(MinutesPastMidnight());
+    }
+    if (rule_param.startsWith(F("%UPTIME%"))) {
+      rule_param = String(MinutesUptime());
+    }
+    if (rule_param.startsWith(F("%TIMESTAMP%"))) {
+      rule_param = GetDateAndTime(DT_LOCAL).c_str();
+    }
+#if defined(USE_TIMERS) && defined(USE_SUNRISE)
+    if (rule_param.startsWith(F("%SUNRISE%"))) {
+      rule_param = String(SunMinutes(0));
+    }
+    if (rule_param.startsWith(F("%SUNSET%"))) {
+      rule_param = String(SunMinutes(1));
+    }
+#endif  // USE_TIMERS and USE_SUNRISE
+// #ifdef USE_ZIGBEE
+//     if (rule_param.startsWith(F("%ZBDEVICE%"))) {
+//       snprintf_P(stemp, sizeof(stemp), PSTR("0x%04X"), Z_GetLastDevice());
+//       rule_param = String(stemp);
+//     }
+//     if (rule_param.startsWith(F("%ZBGROUP%"))) {
+//       rule_param = String(Z_GetLastGroup());
+//     }
+//     if (rule_param.startsWith(F("%ZBCLUSTER%"))) {
+//       rule_param = String(Z_GetLastCluster());
+//     }
+//     if (rule_param.startsWith(F("%ZBENDPOINT%"))) {
+//       rule_param = String(Z_GetLastEndpoint());
+//     }
+// #endif
+    rule_param.toUpperCase();
+    strlcpy(rule_svalue, rule_param.c_str(), sizeof(rule_svalue));
+
+    int temp_value = GetStateNumber(rule_svalue);
+    if (temp_value > -1) {
+      rule_value = temp_value;
+    } else {
+      rule_value = CharToFloat((char*)rule_svalue);    // 0.1      - This saves 9k code over toFLoat()!
+    }
+  }
+
+  // Step2: Search rule_name
+  int pos;
+  int rule_name_idx = 0;
+  if ((pos = rule_name.indexOf(F("["))) > 0) {         // "SUBTYPE1#CURRENT[1]"
+    rule_name_idx = rule_name.substring(pos +1).toInt();
+    if ((rule_name_idx < 1) || (rule_name_idx > 6)) {  // Allow indexes 1 to 6
+      rule_name_idx = 1;
+    }
+    rule_name = rule_name.substring(0, pos);           // "SUBTYPE1#CURRENT"
+  }
+
+  String buf = event;                                  // Copy the string into a new buffer that will be modified
+
+// Do not do below replace as it will replace escaped quote too.
+//  buf.replace("\\"," ");                               // "Disable" any escaped control character
+
+//AddLog(LOG_LEVEL_DEBUG, PSTR("RUL-RM2: RulesRuleMatch |%s|"), buf.c_str());
+
+  JsonParser parser((char*)buf.c_str());
+  JsonParserObject obj = parser.getRootObject();
+  if (!obj) {
+//    AddLog(LOG_LEVEL_DEBUG, PSTR("RUL: Event too long (%d)"), event.length());
+    AddLog(LOG_LEVEL_DEBUG, PSTR("RUL: No valid JSON (%s)"), buf.c_str());
+    return false; // No valid JSON data
+  }
+  String subtype;
+  uint32_t i = 0;
+  while ((pos = rule_name.indexOf(F("#"))) > 0) {      // "SUBTYPE1#SUBTYPE2#CURRENT"
+    subtype = rule_name.substring(0, pos);
+    obj = obj[subtype.c_str()].getObject();
+    if (!obj) { return false; }                        // not found
+
+    rule_name = rule_name.substring(pos +1);
+    if (i++ > 10) { return false; }                    // Abandon possible loop
+
+    yield();
+  }
+
+  JsonParserToken val = obj[rule_name.c_str()];
+  if (!val) { return false; }                          // last level not found
+  const char* str_value;
+  if (rule_name_idx) {
+    if (val.isArray()) {
+      str_value = (val.getArray())[rule_name_idx -1].getStr();
+    } else {
+      str_value = val.getStr();
+    }
+  } else {
+    str_value = val.getStr();                          // "CURRENT"
+  }
+
+#ifdef DEBUG_RULES
+  AddLog(LOG_LEVEL_DEBUG, PSTR("RUL-RM3: Name %s, Value |%s|, TrigCnt %d, TrigSt %d, Source %s, Json |%s|"),
+    rule_name.c_str(), rule_svalue, Rules.trigger_count[rule_set], bitRead(Rules.triggers[rule_set],
+    Rules.trigger_count[rule_set]), event.c_str(), (str_value[0] != '\0') ? str_value : "none");
+#endif
+
+  Rules.event_value = str_value;                       // Prepare %value%
+
+  // Step 3: Compare rule (value)
+  float value = 0;
+  if (str_value) {
+    value = CharToFloat((char*)str_value);
+    int int_value = int(value);
+    int int_rule_value = int(rule_value);
+    String str_str_value = String(str_value);
+    switch (compareOperator) {
+      case COMPARE_OPERATOR_EXACT_DIVISION:
+        match = (int_rule_value && (int_value % int_rule_value) == 0);
+        break;
+      case COMPARE_OPERATOR_EQUAL:
+        match = (!strcasecmp(str_value, rule_svalue));  // Compare strings - this also works for hexadecimals
+        break;
+      case COMPARE_OPERATOR_BIGGER:
+        match = (value > rule_value);
+        break;
+      case COMPARE_OPERATOR_SMALLER:
+        match = (value < rule_value);
+        break;
+      case COMPARE_OPERATOR_NUMBER_EQUAL:
+        match = (value == rule_value);
+        break;
+      case COMPARE_OPERATOR_NOT_EQUAL:
+        match = (value != rule_value);
+        break;
+      case COMPARE_OPERATOR_BIGGER_EQUAL:
+        match = (value >= rule_value);
+        break;
+      case COMPARE_OPERATOR_SMALLER_EQUAL:
+        match = (value <= rule_value);
+        break;
+      case COMPARE_OPERATOR_STRING_ENDS_WITH:
+        match = str_str_value.endsWith(rule_svalue);
+        break;
+      case COMPARE_OPERATOR_STRING_STARTS_WITH:
+        match = str_str_value.startsWith(rule_svalue);
+        break;
+      case COMPARE_OPERATOR_STRING_CONTAINS:
+        match = (str_str_value.indexOf(rule_svalue) >= 0);
+        break;
+      case  COMPARE_OPERATOR_STRING_NOT_EQUAL:
+        match = (0!=strcasecmp(str_value, rule_svalue));  // Compare strings - this also works for hexadecimals
+        break;
+      case  COMPARE_OPERATOR_STRING_NOT_CONTAINS:
+        match = (str_str_value.indexOf(rule_svalue) < 0);
+        break;
+      default:
+        match = true;
+    }
+  } else match = true;
+
+  if (stop_all_rules) { match = false; }
+
+//AddLog(LOG_LEVEL_DEBUG, PSTR("RUL-RM4: Match 1 %d, Triggers %08X, TriggerCount %d"), match, Rules.triggers[rule_set], Rules.trigger_count[rule_set]);
+
+  if (bitRead(Settings->rule_once, rule_set)) {
+    if (match) {                                       // Only allow match state changes
+      if (!bitRead(Rules.triggers[rule_set], Rules.trigger_count[rule_set])) {
+        bitSet(Rules.triggers[rule_set], Rules.trigger_count[rule_set]);
+      } else {
+        match = false;
+      }
+    } else {
+      bitClear(Rules.triggers[rule_set], Rules.trigger_count[rule_set]);
+    }
+  }
+
+//AddLog(LOG_LEVEL_DEBUG, PSTR("RUL-RM5: Match 2 %d, Triggers %08X, TriggerCount %d"), match, Rules.triggers[rule_set], Rules.trigger_count[rule_set]);
+
+  return match;
+}
+
+/********************************************************************************************/
+/*
+ * Parse a comparison expression.
+ * Get 3 parts - left expression, compare operator and right expression.
+ * Input:
+ *      expr        - A comparison expression like VAR1 >= MEM1 + 10
+ *      leftExpr    - Used to accept returned left parts of expression
+ *      rightExpr   - Used to accept returned right parts of expression
+ * Output:
+ *      leftExpr    - Left parts of expression
+ *      rightExpr   - Right parts of expression
+ * Return:
+ *      compare operator
+ *      COMPARE_OPERATOR_NONE   - failed
+ */
+int8_t parseCompareExpression(String &expr, String &leftExpr, String &rightExpr)
+{
+  char compare_operator[3];
+  int8_t compare = COMPARE_OPERATOR_NONE;
+  leftExpr = expr;
+  int position;
+  for (int8_t i = MAXIMUM_COMPARE_OPERATOR; i >= 0; i--) {
+    snprintf_P(compare_operator, sizeof(compare_operator), kCompareOperators + (i *2));
+    if ((position = expr.indexOf(compare_operator)) > 0) {
+      compare = i;
+      leftExpr = expr.substring(0, position);
+      leftExpr.trim();
+      rightExpr = expr.substring(position + strlen(compare_operator));
+      rightExpr.trim();
+      break;
+    }
+  }
+  return compare;
+}
+
+void RulesVarReplace(String &commands, const String &sfind, const String &replace)
+{
+//  String ufind = sfind;
+//  ufind.toUpperCase();
+//  char *find = (char*)ufind.c_str();
+  char *find = (char*)sfind.c_str();
+  uint32_t flen = strlen(find);
+
+  String ucommand = commands;
+  ucommand.toUpperCase();
+  char *read_from = (char*)ucommand.c_str();
+  char *write_to = (char*)commands.c_str();
+  char *found_at;
+  while ((found_at = strstr(read_from, find)) != nullptr) {
+    write_to += (found_at - read_from);
+    memmove_P(write_to, find, flen);                      // Make variable Uppercase
+    write_to += flen;
+    read_from = found_at + flen;
+  }
+
+  commands.replace(find, replace);
+}
+
+/*******************************************************************************************/
+
+bool RuleSetProcess(uint8_t rule_set, String &event_saved)
+{
+  bool serviced = false;
+  char stemp[10];
+
+  delay(0);                                               // Prohibit possible loop software watchdog
+
+//AddLog(LOG_LEVEL_DEBUG, PSTR("RUL-RP1: Event = %s, Rule = %s"), event_saved.c_str(), Settings->rules[rule_set]);
+
+  String rules = GetRule(rule_set);
+
+  Rules.trigger_count[rule_set] = 0;
+  int plen = 0;
+  int plen2 = 0;
+  bool stop_all_rules = false;
+  while (true) {
+    rules = rules.substring(plen);                        // Select relative to last rule
+    rules.trim();
+    if (!rules.length()) { return serviced; }             // No more rules
+
+    String rule = rules;
+    rule.toUpperCase();                                   // "ON INA219#CURRENT>0.100 DO BACKLOG DIMMER 10;COLOR 100000 ENDON"
+    if (!rule.startsWith(F("ON "))) { return serviced; }     // Bad syntax - Nothing to start on
+
+    int pevt = rule.indexOf(F(" DO "));
+    if (pevt == -1) { return serviced; }                  // Bad syntax - Nothing to do
+    String event_trigger = rule.substring(3, pevt);       // "INA219#CURRENT>0.100"
+
+    plen = rule.indexOf(F(" ENDON"));
+    plen2 = rule.indexOf(F(" BREAK"));
+    if ((plen == -1) && (plen2 == -1)) { return serviced; } // Bad syntax - No ENDON neither BREAK
+
+    if (plen == -1) { plen = 9999; }
+    if (plen2 == -1) { plen2 = 9999; }
+    plen = tmin(plen, plen2);
+
+    String commands = rules.substring(pevt +4, plen);     // "Backlog Dimmer 10;Color 100000"
+    Rules.event_value = "";
+    String event = event_saved;
+
+#ifdef DEBUG_RULES
+//    AddLog(LOG_LEVEL_DEBUG, PSTR("RUL-RP2: Event |%s|, Rule |%s|, Command(s) |%s|"), event.c_str(), event_trigger.c_str(), commands.c_str());
+#endif
+
+    if (RulesRuleMatch(rule_set, event, event_trigger, stop_all_rules)) {
+      if (Rules.no_execute) return true;
+      if (plen == plen2) { stop_all_rules = true; }       // If BREAK was used on a triggered rule, Stop execution of this rule set
+      commands.trim();
+      String ucommand = commands;
+      ucommand.toUpperCase();
+
+//      if (!ucommand.startsWith("BACKLOG")) { commands = "backlog " + commands; }  // Always use Backlog to prevent power race exception
+      // Use Backlog with event to prevent rule event loop exception unless IF is used which uses an implicit backlog
+      if ((ucommand.indexOf(F("IF ")) == -1) &&
+          (ucommand.indexOf(F("EVENT ")) != -1) &&
+          (ucommand.indexOf(F("BACKLOG ")) == -1)) {
+        commands = String(F("backlog ")) + commands;
+      }
+
+      RulesVarReplace(commands, F("%VALUE%"), Rules.event_value);
+      for (uint32_t i = 0; i < MAX_RULE_VARS; i++) {
+        snprintf_P(stemp, sizeof(stemp), PSTR("%%VAR%d%%"), i +1);
+        RulesVarReplace(commands, stemp, rules_vars[i]);
+      }
+      for (uint32_t i = 0; i < MAX_RULE_MEMS; i++) {
+        snprintf_P(stemp, sizeof(stemp), PSTR("%%MEM%d%%"), i +1);
+        RulesVarReplace(commands, stemp, SettingsText(SET_MEM1 +i));
+      }
+      RulesVarReplace(commands, F("%TIME%"), String(MinutesPastMidnight()));
+      RulesVarReplace(commands, F("%UTCTIME%"), String(UtcTime()));
+      RulesVarReplace(commands, F("%UPTIME%"), String(MinutesUptime()));
+      RulesVarReplace(commands, F("%TIMESTAMP%"), GetDateAndTime(DT_LOCAL));
+      RulesVarReplace(commands, F("%TOPIC%"), TasmotaGlobal.mqtt_topic);
+      snprintf_P(stemp, sizeof(stemp), PSTR("%06X"), ESP_getChipId());
+      RulesVarReplace(commands, F("%DEVICEID%"), stemp);
+      RulesVarReplace(commands, F("%MACADDR%"), NetworkUniqueId());
+#if defined(USE_TIMERS) && defined(USE_SUNRISE)
+      RulesVarReplace(commands, F("%SUNRISE%"), String(SunMinutes(0)));
+      RulesVarReplace(commands, F("%SUNSET%"), String(SunMinutes(1)));
+#endif  // USE_TIMERS and USE_SUNRISE
+#ifdef USE_ZIGBEE
+      snprintf_P(stemp, sizeof(stemp), PSTR("0x%04X"), Z_GetLastDevice());
+      RulesVarReplace(commands, F("%ZBDEVICE%"), String(stemp));
+      RulesVarReplace(commands, F("%ZBGROUP%"), String(Z_GetLastGroup()));
+      RulesVarReplace(commands, F("%ZBCLUSTER%"), String(Z_GetLastCluster()));
+      RulesVarReplace(commands, F("%ZBENDPOINT%"), String(Z_GetLastEndpoint()));
+#endif
+
+      char command[commands.length() +1];
+      strlcpy(command, commands.c_str(), sizeof(command));
+
+      AddLog(LOG_LEVEL_INFO, PSTR("RUL: %s performs \"%s\""), event_trigger.c_str(), command);
+
+//      Response_P(S_JSON_COMMAND_SVALUE, D_CMND_RULE, D_JSON_INITIATED);
+//      MqttPublishPrefixTopic_P(RESULT_OR_STAT, PSTR(D_CMND_RULE));
+#ifdef SUPPORT_IF_STATEMENT
+      char *pCmd = command;
+      RulesPreprocessCommand(pCmd);                       // Do pre-process for IF statement
+#endif
+      ExecuteCommand(command, SRC_RULE);
+      serviced = true;
+    }
+    plen += 6;
+    Rules.trigger_count[rule_set]++;
+  }
+  return serviced;
+}
+
+/*******************************************************************************************/
+
+bool RulesProcessEvent(const char *json_event)
+{
+  if (Rules.busy) { return false; }
+
+  Rules.busy = true;
+  bool serviced = false;
+
+  SHOW_FREE_MEM(PSTR("RulesProcessEvent"));
+
+//AddLog(LOG_LEVEL_DEBUG, PSTR("RUL: ProcessEvent |%s|"), json_event);
+
+  String event_saved = json_event;
+  // json_event = {"INA219":{"Voltage":4.494,"Current":0.020,"Power":0.089}}
+  // json_event = {"System":{"Boot":1}}
+  // json_event = {"SerialReceived":"on"} - invalid but will be expanded to {"SerialReceived":{"Data":"on"}}
+  char *p = strchr(json_event, ':');
+  if ((p != NULL) && !(strchr(++p, ':'))) {  // Find second colon
+    event_saved.replace(F(":"), F(":{\"Data\":"));
+    event_saved += F("}");
+    // event_saved = {"SerialReceived":{"Data":"on"}}
+  }
+  event_saved.toUpperCase();
+
+//AddLog(LOG_LEVEL_DEBUG, PSTR("RUL: Event |%s|"), event_saved.c_str());
+
+  for (uint32_t i = 0; i < MAX_RULE_SETS; i++) {
+    if (GetRuleLen(i) && bitRead(Settings->rule_enabled, i)) {
+      if (RuleSetProcess(i, event_saved)) { serviced = true; }
+    }
+  }
+
+  Rules.busy = false;
+
+  return serviced;
+}
+
+}  // namespace Text
+
+namespace Compiled {
+
+int8_t parseCompareExpression(String &expr, String &leftExpr, String &rightExpr);  // Prototype generated by the Arduino IDE
+
+uint32_t RulesKeyBit(const char* key, uint32_t len) {
+  // Bit in event key mask for (upper case) key
+  uint32_t hash = 0;
+  for (uint32_t i = 0; i < len; i++) {
+    hash = (hash * 31) + (uint8_t)key[i];
+  }
+  return 1UL << (hash & 0x1F);
+}
+
+void RulesCompileTrigger(struct RULE_TRIGGER &trigger, const String &event_trigger, String commands, bool stop)
+{
+  // event_trigger = "TELE-INA219#CURRENT[1]>0.100", commands = " Backlog Dimmer 10;Color 100000 "
+  trigger.trigger = event_trigger;
+  trigger.stop = stop;
+
+  String rule_expr = event_trigger;
+  trigger.teleperiod = (rule_expr.indexOf(F("TELE-")) != -1);
+  if (trigger.teleperiod) {
+    rule_expr = event_trigger.substring(5);            // "INA219#CURRENT[1]>0.100"
+  }
+  String rule_name, rule_param;
+  trigger.compare = parseCompareExpression(rule_expr, rule_name, rule_param);  // Parse the compare expression.Return operator and the left, right part of expression
+
+  trigger.name_index = 0;
+  int pos;
+  if ((pos = rule_name.indexOf(F("["))) > 0) {         // "SUBTYPE1#CURRENT[1]"
+    int rule_name_idx = rule_name.substring(pos +1).toInt();
+    if ((rule_name_idx < 1) || (rule_name_idx > 6)) {  // Allow indexes 1 to 6
+      rule_name_idx = 1;
+    }
+    trigger.name_index = rule_name_idx;
+    rule_name = rule_name.substring(0, pos);           // "SUBTYPE1#CURRENT"
+  }
+  trigger.name = rule_name;
+  pos = rule_name.indexOf(F("#"));
+  if (pos <= 0) { pos = rule_name.length(); }
+  if ((1 == pos) && ('?' == rule_name[0])) {
+    trigger.root_bit = 0xFFFFFFFF;                     // Wildcard matches any key
+  } else {
+    trigger.root_bit = RulesKeyBit(rule_name.c_str(), pos);
+  }
+
+  // Parameters not starting with a variable are converted once
+  trigger.param = rule_param;
+  trigger.constant = !rule_param.startsWith(F("%"));
+  trigger.value = 0;
+  if ((trigger.compare != COMPARE_OPERATOR_NONE) && trigger.constant) {
+    char rule_svalue[80];
+    strlcpy(rule_svalue, rule_param.c_str(), sizeof(rule_svalue));
+    trigger.param = rule_svalue;
+    trigger.value = CharToFloat(rule_svalue);          // 0.1      - This saves 9k code over toFLoat()!
+  }
+
+  commands.trim();
+  String ucommand = commands;
+  ucommand.toUpperCase();
+//  if (!ucommand.startsWith("BACKLOG")) { commands = "backlog " + commands; }  // Always use Backlog to prevent power race exception
+  // Use Backlog with event to prevent rule event loop exception unless IF is used which uses an implicit backlog
+  if ((ucommand.indexOf(F("IF ")) == -1) &&
+      (ucommand.indexOf(F("EVENT ")) != -1) &&
+      (ucommand.indexOf(F("BACKLOG ")) == -1)) {
+    commands = String(F("backlog ")) + commands;
+  }
+  trigger.commands = commands;
+
+  // Locate variables used in commands so only those are replaced on execution
+  char stemp[14];
+  trigger.vars = 0;
+  trigger.mems = 0;
+  trigger.specials = 0;
+  if (ucommand.indexOf(F("%")) != -1) {
+    for (uint32_t i = 0; i < MAX_RULE_VARS; i++) {
+      snprintf_P(stemp, sizeof(stemp), PSTR("%%VAR%d%%"), i +1);
+      if (ucommand.indexOf(stemp) != -1) { bitSet(trigger.vars, i); }
+    }
+    for (uint32_t i = 0; i < MAX_RULE_MEMS; i++) {
+      snprintf_P(stemp, sizeof(stemp), PSTR("%%MEM%d%%"), i +1);
+      if (ucommand.indexOf(stemp) != -1) { bitSet(trigger.mems, i); }
+    }
+    for (uint32_t i = 0; i <= RULES_VAR_ZBENDPOINT; i++) {
+      if (ucommand.indexOf(GetTextIndexed(stemp, sizeof(stemp), i, kRulesSpecialVars)) != -1) { bitSet(trigger.specials, i); }
+    }
+  }
+}
+
+void RulesCompile(uint32_t rule_set)
+{
+  // Parse rule set into a table of triggers
+  // rules = "on INA219#Current>0.100 do Backlog Dimmer 10;Color 100000 endon on System#Boot do color 001000 endon"
+  delete[] Rules.compiled[rule_set];
+  Rules.compiled[rule_set] = nullptr;
+  Rules.compiled_count[rule_set] = 0;
+  bitSet(Rules.compiled_valid, rule_set);
+
+  String rules_saved = GetRule(rule_set);
+  uint32_t count = 0;
+  for (uint32_t pass = 0; pass < 2; pass++) {          // First pass counts triggers, second pass compiles them
+    if (pass) {
+      if (!count) { return; }
+      Rules.compiled[rule_set] = new RULE_TRIGGER[count];
+      if (!Rules.compiled[rule_set]) { return; }
+    }
+    String rules = rules_saved;
+    uint32_t index = 0;
+    int plen = 0;
+    int plen2 = 0;
+    while (index < 255) {
+      rules = rules.substring(plen);                   // Select relative to last rule
+      rules.trim();
+      if (!rules.length()) { break; }                  // No more rules
+
+      String rule = rules;
+      rule.toUpperCase();                              // "ON INA219#CURRENT>0.100 DO BACKLOG DIMMER 10;COLOR 100000 ENDON"
+      if (!rule.startsWith(F("ON "))) { break; }       // Bad syntax - Nothing to start on
+
+      int pevt = rule.indexOf(F(" DO "));
+      if (pevt == -1) { break; }                       // Bad syntax - Nothing to do
+
+      plen = rule.indexOf(F(" ENDON"));
+      plen2 = rule.indexOf(F(" BREAK"));
+      if ((plen == -1) && (plen2 == -1)) { break; }    // Bad syntax - No ENDON neither BREAK
+
+      if (plen == -1) { plen = 9999; }
+      if (plen2 == -1) { plen2 = 9999; }
+      plen = tmin(plen, plen2);
+
+      if (pass) {
+        RulesCompileTrigger(Rules.compiled[rule_set][index], rule.substring(3, pevt), rules.substring(pevt +4, plen), (plen == plen2));
+      }
+      index++;
+      plen += 6;
+    }
+    count = index;
+  }
+  Rules.compiled_count[rule_set] = count;
+}
+
+bool RulesRuleMatch(uint8_t rule_set, const struct RULE_TRIGGER &trigger, const JsonParserObject &root, uint32_t event_keys, bool stop_all_rules)
+{
+  // root = {"INA219":{"Voltage":4.494,"Current":0.020,"Power":0.089}}
+  // root = {"System":{"Boot":1}}
+  // trigger.name = "INA219#CURRENT"
+
+  bool match = false;
+  char stemp[10];
+
+  // Step1: Check trigger applies to event
+  if (Rules.teleperiod != trigger.teleperiod) { return false; }  // Pre-amble in rule must match teleperiod event
+  if (!(event_keys & trigger.root_bit)) { return false; }          // First key not in event
+
+  char rule_svalue[80] = { 0 };
+  float rule_value = trigger.value;
+  if (trigger.compare != COMPARE_OPERATOR_NONE) {
+    if (trigger.constant) {
+      strlcpy(rule_svalue, trigger.param.c_str(), sizeof(rule_svalue));
+      int temp_value = GetStateNumber(rule_svalue);    // StateText may have changed since compile
+      if (temp_value > -1) {
+        rule_value = temp_value;
+      }
+    } else {
+      String rule_param = trigger.param;
+      for (uint32_t i = 0; i < MAX_RULE_VARS; i++) {
+        snprintf_P(stemp, sizeof(stemp), PSTR("%%VAR%d%%"), i +1);
+        if (rule_param.startsWith(stemp)) {
+          rule_param = rules_vars[i];
+          break;
+        }
+      }
+      for (uint32_t i = 0; i < MAX_RULE_MEMS; i++) {
+        snprintf_P(stemp, sizeof(stemp), PSTR("%%MEM%d%%"), i +1);
+        if (rule_param.startsWith(stemp)) {
+          rule_param = SettingsText(SET_MEM1 + i);
+          break;
+        }
+      }
+      if (rule_param.startsWith(F("%TIME%"))) {
+        rule_param = String(MinutesPastMidnight());
+      }
+      if (rule_param.startsWith(F("%UPTIME%"))) {
+        rule_param = String(MinutesUptime());
+      }
+      if (rule_param.startsWith(F("%TIMESTAMP%"))) {
+        rule_param = GetDateAndTime(DT_LOCAL).c_str();
+      }
+#if defined(USE_TIMERS) && defined(USE_SUNRISE)
+      if (rule_param.startsWith(F("%SUNRISE%"))) {
+        rule_param = String(SunMinutes(0));
+      }
+      if (rule_param.startsWith(F("%SUNSET%"))) {
+        rule_param = String(SunMinutes(1));
+      }
+#endif  // USE_TIMERS and USE_SUNRISE
+      rule_param.toUpperCase();
+      strlcpy(rule_svalue, rule_param.c_str(), sizeof(rule_svalue));
+
+      int temp_value = GetStateNumber(rule_svalue);
+      if (temp_value > -1) {
+        rule_value = temp_value;
+      } else {
+        rule_value = CharToFloat((char*)rule_svalue);  // 0.1      - This saves 9k code over toFLoat()!
+      }
+    }
+  }
+
+  // Step2: Search rule name
+  JsonParserObject obj = root;
+  const char* rule_name = trigger.name.c_str();
+  const char* pos;
+  uint32_t i = 0;
+  while (((pos = strchr(rule_name, '#')) != nullptr) && (pos > rule_name)) {  // "SUBTYPE1#SUBTYPE2#CURRENT"
+    char subtype[pos - rule_name +1];
+    strlcpy(subtype, rule_name, sizeof(subtype));
+    obj = obj[subtype].getObject();
+    if (!obj) { return false; }                        // not found
+
+    rule_name = pos +1;
+    if (i++ > 10) { return false; }                    // Abandon possible loop
+
+    yield();
+  }
+
+  JsonParserToken val = obj[rule_name];
+  if (!val) { return false; }                          // last level not found
+  const char* str_value;
+  if (trigger.name_index) {
+    if (val.isArray()) {
+      str_value = (val.getArray())[trigger.name_index -1].getStr();
+    } else {
+      str_value = val.getStr();
+    }
+  } else {
+    str_value = val.getStr();                          // "CURRENT"
+  }
+
+#ifdef DEBUG_RULES
+  AddLog(LOG_LEVEL_DEBUG, PSTR("RUL-RM3: Name %s, Value |%s|, TrigCnt %d, TrigSt %d, Json |%s|"),
+    rule_name, rule_svalue, Rules.trigger_count[rule_set], bitRead(Rules.triggers[rule_set],
+    Rules.trigger_count[rule_set]), (str_value[0] != '\0') ? str_value : "none");
+#endif
+
+  Rules.event_value = str_value;                       // Prepare %value%
+
+  // Step 3: Compare rule (value)
+  float value = 0;
+  if (str_value) {
+    value = CharToFloat((char*)str_value);
+    int int_value = int(value);
+    int int_rule_value = int(rule_value);
+    switch (trigger.compare) {
+      case COMPARE_OPERATOR_EXACT_DIVISION:
+        match = (int_rule_value && (int_value % int_rule_value) == 0);
+        break;
+      case COMPARE_OPERATOR_EQUAL:
+        match = (!strcasecmp(str_value, rule_svalue));  // Compare strings - this also works for hexadecimals
+        break;
+      case COMPARE_OPERATOR_BIGGER:
+        match = (value > rule_value);
+        break;
+      case COMPARE_OPERATOR_SMALLER:
+        match = (value < rule_value);
+        break;
+      case COMPARE_OPERATOR_NUMBER_EQUAL:
+        match = (value == rule_value);
+        break;
+      case COMPARE_OPERATOR_NOT_EQUAL:
+        match = (value != rule_value);
+        break;
+      case COMPARE_OPERATOR_BIGGER_EQUAL:
+        match = (value >= rule_value);
+        break;
+      case COMPARE_OPERATOR_SMALLER_EQUAL:
+        match = (value <= rule_value);
+        break;
+      case COMPARE_OPERATOR_STRING_ENDS_WITH: {
+        size_t str_len = strlen(str_value);
+        size_t rule_len = strlen(rule_svalue);
+        match = (str_len >= rule_len) && !strcmp(str_value + str_len - rule_len, rule_svalue);
+        break;
+      }
+      case COMPARE_OPERATOR_STRING_STARTS_WITH:
+        match = !strncmp(str_value, rule_svalue, strlen(rule_svalue));
+        break;
+      case COMPARE_OPERATOR_STRING_CONTAINS:
+        match = (strstr(str_value, rule_svalue) != nullptr);
+        break;
+      case  COMPARE_OPERATOR_STRING_NOT_EQUAL:
+        match = (0!=strcasecmp(str_value, rule_svalue));  // Compare strings - this also works for hexadecimals
+        break;
+      case  COMPARE_OPERATOR_STRING_NOT_CONTAINS:
+        match = (strstr(str_value, rule_svalue) == nullptr);
+        break;
+      default:
+        match = true;
+    }
+  } else match = true;
+
+  if (stop_all_rules) { match = false; }
+
+//AddLog(LOG_LEVEL_DEBUG, PSTR("RUL-RM4: Match 1 %d, Triggers %08X, TriggerCount %d"), match, Rules.triggers[rule_set], Rules.trigger_count[rule_set]);
+
+  if (bitRead(Settings->rule_once, rule_set)) {
+    if (match) {                                       // Only allow match state changes
+      if (!bitRead(Rules.triggers[rule_set], Rules.trigger_count[rule_set])) {
+        bitSet(Rules.triggers[rule_set], Rules.trigger_count[rule_set]);
+      } else {
+        match = false;
+      }
+    } else {
+      bitClear(Rules.triggers[rule_set], Rules.trigger_count[rule_set]);
+    }
+  }
+
+//AddLog(LOG_LEVEL_DEBUG, PSTR("RUL-RM5: Match 2 %d, Triggers %08X, TriggerCount %d"), match, Rules.triggers[rule_set], Rules.trigger_count[rule_set]);
+
+  return match;
+}
+
+/********************************************************************************************/
+/*
+ * Parse a comparison expression.
+ * Get 3 parts - left expression, compare operator and right expression.
+ * Input:
+ *      expr        - A comparison expression like VAR1 >= MEM1 + 10
+ *      leftExpr    - Used to accept returned left parts of expression
+ *      rightExpr   - Used to accept returned right parts of expression
+ * Output:
+ *      leftExpr    - Left parts of expression
+ *      rightExpr   - Right parts of expression
+ * Return:
+ *      compare operator
+ *      COMPARE_OPERATOR_NONE   - failed
+ */
+int8_t parseCompareExpression(String &expr, String &leftExpr, String &rightExpr)
+{
+  char compare_operator[3];
+  int8_t compare = COMPARE_OPERATOR_NONE;
+  leftExpr = expr;
+  int position;
+  for (int8_t i = MAXIMUM_COMPARE_OPERATOR; i >= 0; i--) {
+    snprintf_P(compare_operator, sizeof(compare_operator), kCompareOperators + (i *2));
+    if ((position = expr.indexOf(compare_operator)) > 0) {
+      compare = i;
+      leftExpr = expr.substring(0, position);
+      leftExpr.trim();
+      rightExpr = expr.substring(position + strlen(compare_operator));
+      rightExpr.trim();
+      break;
+    }
+  }
+  return compare;
+}
+
+void RulesVarReplace(String &commands, const String &sfind, const String &replace)
+{
+//  String ufind = sfind;
+//  ufind.toUpperCase();
+//  char *find = (char*)ufind.c_str();
+  char *find = (char*)sfind.c_str();
+  uint32_t flen = strlen(find);
+
+  String ucommand = commands;
+  ucommand.toUpperCase();
+  char *read_from = (char*)ucommand.c_str();
+  char *write_to = (char*)commands.c_str();
+  char *found_at;
+  while ((found_at = strstr(read_from, find)) != nullptr) {
+    write_to += (found_at - read_from);
+    memmove_P(write_to, find, flen);                      // Make variable Uppercase
+    write_to += flen;
+    read_from = found_at + flen;
+  }
+
+  commands.replace(find, replace);
+}
+
+/*******************************************************************************************/
+
+bool RuleSetProcess(uint8_t rule_set, const JsonParserObject &root, uint32_t event_keys)
+{
+  bool serviced = false;
+  char stemp[10];
+
+  delay(0);                                               // Prohibit possible loop software watchdog
+
+  if (!bitRead(Rules.compiled_valid, rule_set)) {
+    RulesCompile(rule_set);
+  }
+  // Commands may change rules but the compiled triggers are only replaced on the next event
+  const RULE_TRIGGER* triggers = Rules.compiled[rule_set];
+  uint32_t count = Rules.compiled_count[rule_set];
+
+  Rules.trigger_count[rule_set] = 0;
+  bool stop_all_rules = false;
+  for (uint32_t index = 0; index < count; index++) {
+    const RULE_TRIGGER &trigger = triggers[index];
+    Rules.event_value = "";
+
+    if (RulesRuleMatch(rule_set, trigger, root, event_keys, stop_all_rules)) {
+      if (Rules.no_execute) return true;
+      if (trigger.stop) { stop_all_rules = true; }        // If BREAK was used on a triggered rule, Stop execution of this rule set
+      String commands = trigger.commands;                 // "Backlog Dimmer 10;Color 100000"
+
+      if (bitRead(trigger.specials, RULES_VAR_VALUE)) { RulesVarReplace(commands, F("%VALUE%"), Rules.event_value); }
+      for (uint32_t i = 0; i < MAX_RULE_VARS; i++) {
+        if (bitRead(trigger.vars, i)) {
+          snprintf_P(stemp, sizeof(stemp), PSTR("%%VAR%d%%"), i +1);
+          RulesVarReplace(commands, stemp, rules_vars[i]);
+        }
+      }
+      for (uint32_t i = 0; i < MAX_RULE_MEMS; i++) {
+        if (bitRead(trigger.mems, i)) {
+          snprintf_P(stemp, sizeof(stemp), PSTR("%%MEM%d%%"), i +1);
+          RulesVarReplace(commands, stemp, SettingsText(SET_MEM1 +i));
+        }
+      }
+      if (trigger.specials) {
+        if (bitRead(trigger.specials, RULES_VAR_TIME)) { RulesVarReplace(commands, F("%TIME%"), String(MinutesPastMidnight())); }
+        if (bitRead(trigger.specials, RULES_VAR_UTCTIME)) { RulesVarReplace(commands, F("%UTCTIME%"), String(UtcTime())); }
+        if (bitRead(trigger.specials, RULES_VAR_UPTIME)) { RulesVarReplace(commands, F("%UPTIME%"), String(MinutesUptime())); }
+        if (bitRead(trigger.specials, RULES_VAR_TIMESTAMP)) { RulesVarReplace(commands, F("%TIMESTAMP%"), GetDateAndTime(DT_LOCAL)); }
+        if (bitRead(trigger.specials, RULES_VAR_TOPIC)) { RulesVarReplace(commands, F("%TOPIC%"), TasmotaGlobal.mqtt_topic); }
+        if (bitRead(trigger.specials, RULES_VAR_DEVICEID)) {
+          snprintf_P(stemp, sizeof(stemp), PSTR("%06X"), ESP_getChipId());
+          RulesVarReplace(commands, F("%DEVICEID%"), stemp);
+        }
+        if (bitRead(trigger.specials, RULES_VAR_MACADDR)) { RulesVarReplace(commands, F("%MACADDR%"), NetworkUniqueId()); }
+#if defined(USE_TIMERS) && defined(USE_SUNRISE)
+        if (bitRead(trigger.specials, RULES_VAR_SUNRISE)) { RulesVarReplace(commands, F("%SUNRISE%"), String(SunMinutes(0))); }
+        if (bitRead(trigger.specials, RULES_VAR_SUNSET)) { RulesVarReplace(commands, F("%SUNSET%"), String(SunMinutes(1))); }
+#endif  // USE_TIMERS and USE_SUNRISE
+#ifdef USE_ZIGBEE
+        if (bitRead(trigger.specials, RULES_VAR_ZBDEVICE)) {
+          snprintf_P(stemp, sizeof(stemp), PSTR("0x%04X"), Z_GetLastDevice());
+          RulesVarReplace(commands, F("%ZBDEVICE%"), String(stemp));
+        }
+        if (bitRead(trigger.specials, RULES_VAR_ZBGROUP)) { RulesVarReplace(commands, F("%ZBGROUP%"), String(Z_GetLastGroup())); }
+        if (bitRead(trigger.specials, RULES_VAR_ZBCLUSTER)) { RulesVarReplace(commands, F("%ZBCLUSTER%"), String(Z_GetLastCluster())); }
+        if (bitRead(trigger.specials, RULES_VAR_ZBENDPOINT)) { RulesVarReplace(commands, F("%ZBENDPOINT%"), String(Z_GetLastEndpoint())); }
+#endif
+      }
+
+      char command[commands.length() +1];
+      strlcpy(command, commands.c_str(), sizeof(command));
+
+      AddLog(LOG_LEVEL_INFO, PSTR("RUL: %s performs \"%s\""), trigger.trigger.c_str(), command);
+
+//      Response_P(S_JSON_COMMAND_SVALUE, D_CMND_RULE, D_JSON_INITIATED);
+//      MqttPublishPrefixTopic_P(RESULT_OR_STAT, PSTR(D_CMND_RULE));
+#ifdef SUPPORT_IF_STATEMENT
+      char *pCmd = command;
+      RulesPreprocessCommand(pCmd);                       // Do pre-process for IF statement
+#endif
+      ExecuteCommand(command, SRC_RULE);
+      serviced = true;
+    }
+    Rules.trigger_count[rule_set]++;
+  }
+  return serviced;
+}
+
+/*******************************************************************************************/
+
+bool RulesProcessEvent(const char *json_event)
+{
+  if (Rules.busy) { return false; }
+
+  uint32_t rule_sets = 0;
+  for (uint32_t i = 0; i < MAX_RULE_SETS; i++) {
+    if (GetRuleLen(i) && bitRead(Settings->rule_enabled, i)) { bitSet(rule_sets, i); }
+  }
+  if (!rule_sets) { return false; }                       // No enabled rule sets
+
+  Rules.busy = true;
+  bool serviced = false;
+
+  SHOW_FREE_MEM(PSTR("RulesProcessEvent"));
+
+//AddLog(LOG_LEVEL_DEBUG, PSTR("RUL: ProcessEvent |%s|"), json_event);
+
+  String event_saved = json_event;
+  // json_event = {"INA219":{"Voltage":4.494,"Current":0.020,"Power":0.089}}
+  // json_event = {"System":{"Boot":1}}
+  // json_event = {"SerialReceived":"on"} - invalid but will be expanded to {"SerialReceived":{"Data":"on"}}
+  char *p = strchr(json_event, ':');
+  if ((p != NULL) && !(strchr(++p, ':'))) {  // Find second colon
+    event_saved.replace(F(":"), F(":{\"Data\":"));
+    event_saved += F("}");
+    // event_saved = {"SerialReceived":{"Data":"on"}}
+  }
+  event_saved.toUpperCase();
+
+//AddLog(LOG_LEVEL_DEBUG, PSTR("RUL: Event |%s|"), event_saved.c_str());
+
+  // Parse event once for all triggers and collect its first level keys
+  JsonParser parser((char*)event_saved.c_str());
+  JsonParserObject root = parser.getRootObject();
+  if (!root) {
+    AddLog(LOG_LEVEL_DEBUG, PSTR("RUL: No valid JSON (%s)"), json_event);
+  } else {
+    uint32_t event_keys = 0;
+    for (auto key : root) {
+      const char* key_str = key.getStr();
+      event_keys |= RulesKeyBit(key_str, strlen(key_str));
+    }
+
+    for (uint32_t i = 0; i < MAX_RULE_SETS; i++) {
+      if (bitRead(rule_sets, i)) {
+        if (RuleSetProcess(i, root, event_keys)) { serviced = true; }
+      }
+    }
+  }
+
+  Rules.busy = false;
+
+  return serviced;
+}
+
+}  // namespace Compiled
+
+/*********************************************************************************************\
+ * Workload
+\*********************************************************************************************/
+
+const char* kRuleSets[MAX_RULE_SETS] = {
+  "on System#Boot do Var1 0 endon "
+  "on Switch1#State=1 do Power1 toggle endon "
+  "on Tele-SI7021#Temperature>25 do Power2 on endon "
+  "on Tele-SI7021#Temperature<23 do Power2 off endon "
+  "on Tele-ENERGY#Power>1000 do Backlog Power1 off; Publish stat/alert %value% endon "
+  "on Power1#State do Var2 %value% endon",
+
+  "on Time#Minute|5 do Publish stat/%topic%/time %time% endon "
+  "on Tele-BME280#Humidity>=%var3% do Event hum=%value% endon "
+  "on Event#hum do Power3 on endon "
+  "on Tele-DS18B20-1#Temperature!=%mem1% do Mem1 %value% endon "
+  "on Tele-ANALOG#A0<100 do Dimmer 10 endon "
+  "on Tele-ANALOG#A0>800 do Dimmer 100 endon "
+  "on Mqtt#Connected do Subscribe BkLt, cmnd/other/POWER endon",
+
+  "on Tele-PMS5003#PM2.5>50 do FanSpeed 3 break "
+  "on Tele-PMS5003#PM2.5>25 do FanSpeed 2 break "
+  "on Tele-PMS5003#PM2.5>0 do FanSpeed 1 endon "
+  "on Wifi#Connected$|1 do Publish stat/wifi up endon "
+  "on ZbReceived#0x1234#Temperature>20 do Power4 on endon "
+  "on Tele-ENERGY#Voltage[2]<200 do Publish stat/undervoltage %value% endon"
+};
+
+struct Sensors {
+  float temperature = 24;
+  float humidity = 50;
+  float ds18b20 = 20;
+  float a0 = 500;
+  float power = 800;
+  float voltage = 230;
+  float pm25 = 20;
+};
+
+float Walk(float value, float step, float min, float max) {
+  value += ((random() % 2001) - 1000) * step / 1000;
+  return (value < min) ? min : (value > max) ? max : value;
+}
+
+struct Event {
+  std::string json;
+  bool teleperiod;
+};
+
+std::vector<Event> MakeEvents(uint32_t count) {
+  std::vector<Event> events;
+  Sensors s;
+  char json[600];
+  events.push_back({ "{\"System\":{\"Boot\":1}}", false });
+  events.push_back({ "{\"Mqtt\":{\"Connected\":1}}", false });
+  events.push_back({ "{\"Var3\":\"55\"}", false });
+  for (uint32_t i = events.size(); i < count; i++) {
+    uint32_t r = random() % 100;
+    if (r < 40) {
+      s.temperature = Walk(s.temperature, 0.5, 15, 35);
+      s.humidity = Walk(s.humidity, 2, 20, 90);
+      s.ds18b20 = Walk(s.ds18b20, 0.2, 10, 30);
+      s.a0 = Walk(s.a0, 80, 0, 1024);
+      s.power = Walk(s.power, 60, 0, 2000);
+      s.voltage = Walk(s.voltage, 5, 190, 250);
+      s.pm25 = Walk(s.pm25, 5, 0, 100);
+      snprintf(json, sizeof(json),
+        "{\"Time\":\"2021-07-14T12:%02u:00\",\"SI7021\":{\"Temperature\":%.1f,\"Humidity\":%.1f,\"DewPoint\":12.1},"
+        "\"BME280\":{\"Temperature\":%.1f,\"Humidity\":%.1f,\"DewPoint\":11.0,\"Pressure\":1013.2},"
+        "\"DS18B20-1\":{\"Id\":\"01144A0CB2AA\",\"Temperature\":%.1f},\"ANALOG\":{\"A0\":%u},"
+        "\"ENERGY\":{\"TotalStartTime\":\"2021-01-01T00:00:00\",\"Total\":123.456,\"Yesterday\":1.234,\"Today\":0.567,"
+        "\"Power\":%u,\"ApparentPower\":%u,\"ReactivePower\":12,\"Factor\":0.98,\"Voltage\":[%u,%u],\"Current\":3.456},"
+        "\"PMS5003\":{\"CF1\":10,\"CF2.5\":%u,\"CF10\":22,\"PM1\":10,\"PM2.5\":%u,\"PM10\":22},\"TempUnit\":\"C\"}",
+        i % 60, s.temperature, s.humidity, s.temperature - 0.3, s.humidity + 1, s.ds18b20, (uint32_t)s.a0,
+        (uint32_t)s.power, (uint32_t)s.power + 10, (uint32_t)s.voltage, (uint32_t)s.voltage - 15, (uint32_t)s.pm25, (uint32_t)s.pm25);
+      events.push_back({ json, true });
+    } else if (r < 55) {
+      snprintf(json, sizeof(json), "{\"Power1\":{\"State\":%u}}", (uint32_t)(random() % 2));
+      events.push_back({ json, false });
+    } else if (r < 65) {
+      snprintf(json, sizeof(json), "{\"Switch1\":{\"State\":%u}}", (uint32_t)(random() % 2));
+      events.push_back({ json, false });
+    } else if (r < 80) {
+      snprintf(json, sizeof(json), "{\"Time\":{\"Minute\":%u}}", i % 1440);
+      events.push_back({ json, false });
+    } else if (r < 88) {
+      snprintf(json, sizeof(json), "{\"ZbReceived\":{\"0x%04X\":{\"Device\":\"0x1234\",\"Temperature\":%.1f,\"Endpoint\":1,\"LinkQuality\":%u}}}",
+        (random() % 2) ? 0x1234 : 0x5678, s.temperature - 4, (uint32_t)(random() % 256));
+      events.push_back({ json, false });
+    } else if (r < 92) {
+      snprintf(json, sizeof(json), "{\"Event\":{\"hum\":\"%.1f\"}}", s.humidity);
+      events.push_back({ json, false });
+    } else {
+      snprintf(json, sizeof(json), "{\"Wifi\":{\"Connected\":%u}}", (uint32_t)(random() % 2));
+      events.push_back({ json, false });
+    }
+  }
+  return events;
+}
+
+double Run(bool compiled, const std::vector<Event>& events, std::vector<std::string>& commands, uint32_t& allocs) {
+  for (uint32_t i = 0; i < MAX_RULE_SETS; i++) {
+    rule_text[i] = kRuleSets[i];
+    delete[] Rules.compiled[i];
+    Rules.compiled[i] = nullptr;
+    Rules.compiled_count[i] = 0;
+    Rules.triggers[i] = 0;
+  }
+  Rules.compiled_valid = 0;
+  Settings->rule_enabled = 0x07;
+  Settings->rule_once = 0x04;              // Rule3 only triggers on state changes
+  memset(rules_vars, 0, sizeof(rules_vars));
+  memset(rules_mems, 0, sizeof(rules_mems));
+  executed.clear();
+  String_stats.allocs = 0;
+
+  struct timespec start, end;
+  clock_gettime(CLOCK_MONOTONIC, &start);
+  for (uint32_t i = 0; i < events.size(); i++) {
+    minutes_past_midnight = i % 1440;
+    Rules.teleperiod = events[i].teleperiod;
+    if (compiled) {
+      Compiled::RulesProcessEvent(events[i].json.c_str());
+    } else {
+      Text::RulesProcessEvent(events[i].json.c_str());
+    }
+    Rules.teleperiod = false;
+  }
+  clock_gettime(CLOCK_MONOTONIC, &end);
+  commands = executed;
+  allocs = String_stats.allocs;
+  return ((end.tv_sec - start.tv_sec) * 1e9 + (end.tv_nsec - start.tv_nsec)) / events.size();
+}
+
+int main(int argc, char* argv[]) {
+  uint32_t count = (argc > 1) ? atoi(argv[1]) : 20000;
+
+  srandom(1);
+  std::vector<Event> events = MakeEvents(count);
+
+  std::vector<std::string> text_commands, compiled_commands;
+  uint32_t text_allocs, compiled_allocs;
+  double text_ns = Run(false, events, text_commands, text_allocs);
+  double compiled_ns = Run(true, events, compiled_commands, compiled_allocs);
+
+  uint32_t differences = 0;
+  uint32_t size = (text_commands.size() > compiled_commands.size()) ? text_commands.size() : compiled_commands.size();
+  for (uint32_t i = 0; i < size; i++) {
+    const char* text = (i < text_commands.size()) ? text_commands[i].c_str() : "(none)";
+    const char* comp = (i < compiled_commands.size()) ? compiled_commands[i].c_str() : "(none)";
+    if (strcmp(text, comp)) {
+      if (differences < 5) { printf("  command %u: text \"%s\", compiled \"%s\"\n", i, text, comp); }
+      differences++;
+    }
+  }
+
+  printf("%u events, %u rules in %u rule sets, %u commands executed\n", count, 19, MAX_RULE_SETS, (uint32_t)text_commands.size());
+  printf("  Text rules     %8.1f nS/event %6.1f String allocations/event\n", text_ns, (double)text_allocs / count);
+  printf("  Compiled rules %8.1f nS/event %6.1f String allocations/event\n", compiled_ns, (double)compiled_allocs / count);
+  printf("  %u commands differ\n", differences);
+
+  return (differences) ? 1 : 0;
+}
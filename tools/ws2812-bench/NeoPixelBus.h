@@ -0,0 +1,107 @@
+/*
+  NeoPixelBus.h - minimal NeoPixelBus replacement for ws2812-bench, for Tasmota
+
+  Copyright (C) 2021  Theo Arends
+
+  This program is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef _NEOPIXELBUS_BENCH_H_
+#define _NEOPIXELBUS_BENCH_H_
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+// Same layout and API as the NeoPixelBus classes used by xlgt_01_ws2812.ino,
+// Show() only counts the frames that would be sent to the strip
+
+struct RgbColor {
+  RgbColor(uint8_t v = 0) : R(v), G(v), B(v) {}
+  bool operator==(const RgbColor& other) const { return (R == other.R && G == other.G && B == other.B); }
+  uint8_t R, G, B;
+};
+
+class NeoGrbFeature {
+public:
+  typedef RgbColor ColorObject;
+  static const size_t PixelSize = 3;
+
+  static void applyPixelColor(uint8_t* pPixels, uint16_t indexPixel, ColorObject color) {
+    uint8_t* p = pPixels + indexPixel * PixelSize;
+    *p++ = color.G;
+    *p++ = color.R;
+    *p = color.B;
+  }
+
+  static ColorObject retrievePixelColor(const uint8_t* pPixels, uint16_t indexPixel) {
+    ColorObject color;
+    const uint8_t* p = pPixels + indexPixel * PixelSize;
+    color.G = *p++;
+    color.R = *p++;
+    color.B = *p;
+    return color;
+  }
+};
+
+class NeoEsp8266BitBangWs2812xMethod {};
+
+template<typename T_COLOR_FEATURE, typename T_METHOD> class NeoPixelBus {
+public:
+  NeoPixelBus(uint16_t countPixels, uint8_t pin) : _countPixels(countPixels) {
+    _pixels = (uint8_t*)calloc(countPixels, T_COLOR_FEATURE::PixelSize);
+  }
+  ~NeoPixelBus() { free(_pixels); }
+
+  void Begin(void) { ClearTo(0); }
+
+  void Show(bool maintainBufferConsistency = true) {
+    if (!_dirty) { return; }
+    shown++;
+    _dirty = false;
+  }
+
+  void Dirty(void) { _dirty = true; }
+  uint8_t* Pixels(void) { return _pixels; }
+
+  void SetPixelColor(uint16_t indexPixel, typename T_COLOR_FEATURE::ColorObject color) {
+    if (indexPixel < _countPixels) {
+      T_COLOR_FEATURE::applyPixelColor(_pixels, indexPixel, color);
+      Dirty();
+    }
+  }
+
+  typename T_COLOR_FEATURE::ColorObject GetPixelColor(uint16_t indexPixel) const {
+    if (indexPixel < _countPixels) {
+      return T_COLOR_FEATURE::retrievePixelColor(_pixels, indexPixel);
+    }
+    return 0;
+  }
+
+  void ClearTo(typename T_COLOR_FEATURE::ColorObject color) {
+    for (uint32_t i = 0; i < _countPixels; i++) {
+      T_COLOR_FEATURE::applyPixelColor(_pixels, i, color);
+    }
+    Dirty();
+  }
+
+  uint32_t shown = 0;               // number of frames sent to the strip
+
+private:
+  uint16_t _countPixels;
+  uint8_t* _pixels;
+  bool _dirty = false;
+};
+
+#endif  // _NEOPIXELBUS_BENCH_H_
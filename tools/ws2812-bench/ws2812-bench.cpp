@@ -0,0 +1,320 @@
+/*
+  ws2812-bench.cpp - host benchmark of the WS2812 schemes, for Tasmota
+
+  Copyright (C) 2021  Theo Arends
+
+  This program is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+Instructions:
+  Builds xlgt_01_ws2812.ino on the host with a minimal NeoPixelBus and renders
+  the Gradient (Fade 1) and Bars (Fade 0) schemes on a strip of WS2812_MAX_LEDS
+  pixels, for each scheme it reports the pixels/second and the number of frames
+  sent to the strip.
+
+  The original float renderer is kept below as a reference: the benchmark
+  reports its speed too and checks that both renderers produce the same
+  frames, colors may differ by one step as the dimmer now uses integer math.
+
+  Host speeds don't reflect ESP8266 speeds, which has no FPU nor hardware
+  division, compare the ratios between the renderers.
+
+Usage:
+  g++ -O2 -I tools/ws2812-bench -o ws2812-bench tools/ws2812-bench/ws2812-bench.cpp
+  ./ws2812-bench [frames [speed [width]]]
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+#include <math.h>
+#include <time.h>
+
+/*********************************************************************************************\
+ * Tasmota environment used by the driver
+\*********************************************************************************************/
+
+#define USE_LIGHT
+#define USE_WS2812
+#define PROGMEM
+#define PSTR(s) (s)
+#define snprintf_P snprintf
+
+#define NEO_RGB                0
+#define NEO_GRB                1
+#define NEO_3LED               4
+#define NEO_HW_WS2812X         1
+#define NEO_HW_P9813           4
+#define USE_WS2812_CTYPE       NEO_GRB
+#define USE_WS2812_HARDWARE    NEO_HW_WS2812X
+
+#define D_CMND_LED "Led"
+#define D_CMND_PIXELS "Pixels"
+#define D_CMND_ROTATION "Rotation"
+#define D_CMND_WIDTH "Width"
+
+#define tmin(a,b) ((a)<(b)?(a):(b))
+
+const uint16_t WS2812_MAX_LEDS = 512;
+const uint8_t STATES = 20;
+const uint8_t LIGHT_COLOR_SIZE = 25;
+enum Ws2812ClockIndex { WS_SECOND, WS_MINUTE, WS_HOUR, WS_MARKER };
+enum Ws2812Color { WS_RED, WS_GREEN, WS_BLUE };
+enum LightTypes { LT_RGB = 3, LT_RGBW = 4 };
+enum XsnsFunctions { FUNC_SET_CHANNELS, FUNC_SET_SCHEME, FUNC_COMMAND, FUNC_MODULE_INIT };
+enum UserSelectablePins { GPIO_WS2812, GPIO_P9813_CLK, GPIO_P9813_DAT };
+
+struct {
+  uint8_t light_correction = 1;
+  uint16_t light_pixels = WS2812_MAX_LEDS;
+  uint16_t light_rotation = 0;
+  uint8_t light_dimmer = 100;
+  uint8_t light_width = 1;
+  uint8_t light_speed = 1;
+  uint8_t light_scheme = 0;
+  uint8_t light_fade = 0;
+  uint8_t ws_width[3] = { 1, 3, 5 };
+  uint8_t ws_color[4][3] = {};
+  struct { uint32_t ws_clock_reverse : 1; uint32_t decimal_text : 1; } flag = {};
+} SettingsBench;
+auto Settings = &SettingsBench;
+
+struct {
+  uint32_t strip_timer_counter = 0;
+  bool update = false;
+  uint8_t subtype = 3;
+  uint8_t max_scheme = 4;
+  uint8_t entry_color[5];
+} Light;
+
+struct {
+  uint8_t state_250mS = 0;
+  uint8_t light_type = 0;
+  uint8_t light_driver = 0;
+} TasmotaGlobal;
+
+struct { uint8_t second, minute, hour; } RtcTime;
+
+struct {
+  uint32_t index;
+  uint32_t data_len;
+  int32_t payload;
+  char *data;
+} XdrvMailbox;
+
+bool PinUsed(uint32_t gpio, uint32_t index = 0) { return true; }
+uint32_t Pin(uint32_t gpio, uint32_t index = 0) { return 0; }
+bool DecodeCommand(const char* haystack, void (* const MyCommand[])(void)) { return false; }
+bool LightColorEntry(char *buffer, uint32_t buffer_length) { return false; }
+void ResponseCmndNumber(int value) {}
+void ResponseCmndIdxNumber(int value) {}
+void ResponseCmndIdxChar(const char* value) {}
+
+float FastPrecisePowf(const float x, const float y) { return powf(x, y); }
+
+// prototypes generated by the Arduino builder
+uint16_t changeUIntScale(uint16_t inum, uint16_t ifrom_min, uint16_t ifrom_max, uint16_t ito_min, uint16_t ito_max);
+void CmndLed(void);
+void CmndPixels(void);
+void CmndRotation(void);
+void CmndWidth(void);
+
+#include "../../tasmota/xdrv_04_light_utils.ino"
+#include "../../tasmota/xlgt_01_ws2812.ino"
+
+uint16_t changeUIntScale(uint16_t inum, uint16_t ifrom_min, uint16_t ifrom_max, uint16_t ito_min, uint16_t ito_max) {
+  if (ifrom_min >= ifrom_max) { return (ito_min > ito_max ? ito_max : ito_min); }
+  uint32_t num = inum, from_min = ifrom_min, from_max = ifrom_max, to_min = ito_min, to_max = ito_max;
+  num = (num > from_max ? from_max : (num < from_min ? from_min : num));
+  if (to_min > to_max) {
+    num = (from_max - num) + from_min;
+    to_min = ito_max;
+    to_max = ito_min;
+  }
+  uint32_t numerator = (num - from_min) * (to_max - to_min);
+  uint32_t result;
+  if (numerator >= 0x80000000L) {
+    result = numerator / (from_max - from_min);
+  } else {
+    result = (((numerator * 2) / (from_max - from_min)) + 1) / 2;
+  }
+  return (uint32_t) (result + to_min);
+}
+
+/*********************************************************************************************\
+ * Reference float renderer
+\*********************************************************************************************/
+
+NeoPixelBus<selectedNeoFeatureType, selectedNeoSpeedType> *ref_strip = nullptr;
+
+void RefStripShow(void) {
+  if (Settings->light_correction) {
+    for (uint32_t i = 0; i < Settings->light_pixels; i++) {
+      RgbColor c = ref_strip->GetPixelColor(i);
+      c.R = ledGamma(c.R);
+      c.G = ledGamma(c.G);
+      c.B = ledGamma(c.B);
+      ref_strip->SetPixelColor(i, c);
+    }
+  }
+  ref_strip->Show();
+}
+
+void RefGradientColor(uint32_t schemenr, struct WsColor* mColor, uint32_t range, uint32_t gradRange, uint32_t i) {
+  ColorScheme scheme = kSchemes[schemenr];
+  uint32_t curRange = i / range;
+  uint32_t rangeIndex = i % range;
+  uint32_t colorIndex = rangeIndex / gradRange;
+  uint32_t start = colorIndex;
+  uint32_t end = colorIndex +1;
+  if (curRange % 2 != 0) {
+    start = (scheme.count -1) - start;
+    end = (scheme.count -1) - end;
+  }
+  float dimmer = 100 / (float)Settings->light_dimmer;
+  float fmyRed = (float)wsmap(rangeIndex % gradRange, 0, gradRange, scheme.colors[start].red, scheme.colors[end].red) / dimmer;
+  float fmyGrn = (float)wsmap(rangeIndex % gradRange, 0, gradRange, scheme.colors[start].green, scheme.colors[end].green) / dimmer;
+  float fmyBlu = (float)wsmap(rangeIndex % gradRange, 0, gradRange, scheme.colors[start].blue, scheme.colors[end].blue) / dimmer;
+  mColor->red = (uint8_t)fmyRed;
+  mColor->green = (uint8_t)fmyGrn;
+  mColor->blue = (uint8_t)fmyBlu;
+}
+
+void RefGradient(uint32_t schemenr) {
+  RgbColor c;
+  ColorScheme scheme = kSchemes[schemenr];
+  if (scheme.count < 2) { return; }
+
+  uint32_t repeat = kWsRepeat[Settings->light_width];
+  uint32_t range = (uint32_t)ceil((float)Settings->light_pixels / (float)repeat);
+  uint32_t gradRange = (uint32_t)ceil((float)range / (float)(scheme.count - 1));
+  uint32_t speed = ((Settings->light_speed * 2) -1) * (STATES / 10);
+  uint32_t offset = speed > 0 ? Light.strip_timer_counter / speed : 0;
+
+  WsColor oldColor, currentColor;
+  RefGradientColor(schemenr, &oldColor, range, gradRange, offset);
+  currentColor = oldColor;
+  speed = speed ? speed : 1;
+  for (uint32_t i = 0; i < Settings->light_pixels; i++) {
+    if (kWsRepeat[Settings->light_width] > 1) {
+      RefGradientColor(schemenr, &currentColor, range, gradRange, i + offset + 1);
+    }
+    c.R = wsmap(Light.strip_timer_counter % speed, 0, speed, oldColor.red, currentColor.red);
+    c.G = wsmap(Light.strip_timer_counter % speed, 0, speed, oldColor.green, currentColor.green);
+    c.B = wsmap(Light.strip_timer_counter % speed, 0, speed, oldColor.blue, currentColor.blue);
+    ref_strip->SetPixelColor(i, c);
+    oldColor = currentColor;
+  }
+  RefStripShow();
+}
+
+void RefBars(uint32_t schemenr) {
+  RgbColor c;
+  ColorScheme scheme = kSchemes[schemenr];
+
+  uint32_t maxSize = Settings->light_pixels / scheme.count;
+  if (kWidth[Settings->light_width] > maxSize) { maxSize = 0; }
+
+  uint32_t speed = ((Settings->light_speed * 2) -1) * (STATES / 10);
+  uint32_t offset = (speed > 0) ? Light.strip_timer_counter / speed : 0;
+
+  WsColor mcolor[scheme.count];
+  memcpy(mcolor, scheme.colors, sizeof(mcolor));
+  float dimmer = 100 / (float)Settings->light_dimmer;
+  for (uint32_t i = 0; i < scheme.count; i++) {
+    mcolor[i].red = (uint8_t)((float)mcolor[i].red / dimmer);
+    mcolor[i].green = (uint8_t)((float)mcolor[i].green / dimmer);
+    mcolor[i].blue = (uint8_t)((float)mcolor[i].blue / dimmer);
+  }
+  uint32_t colorIndex = offset % scheme.count;
+  for (uint32_t i = 0; i < Settings->light_pixels; i++) {
+    if (maxSize) { colorIndex = ((i + offset) % (scheme.count * kWidth[Settings->light_width])) / kWidth[Settings->light_width]; }
+    c.R = mcolor[colorIndex].red;
+    c.G = mcolor[colorIndex].green;
+    c.B = mcolor[colorIndex].blue;
+    ref_strip->SetPixelColor(i, c);
+  }
+  RefStripShow();
+}
+
+/*********************************************************************************************\
+ * Benchmark
+\*********************************************************************************************/
+
+double Now(void) {
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+// Render frames with one renderer, returns pixels/second
+double Run(void (*render)(uint32_t), uint32_t schemenr, uint32_t frames) {
+  double start = Now();
+  for (uint32_t f = 0; f < frames; f++) {
+    Light.strip_timer_counter = f;
+    render(schemenr);
+  }
+  return (double)frames * Settings->light_pixels / (Now() - start);
+}
+
+// Compare the frames of both renderers, returns the largest difference of a color
+uint32_t Compare(void (*render)(uint32_t), void (*ref_render)(uint32_t), uint32_t schemenr, uint32_t frames) {
+  uint32_t diff = 0;
+  for (uint32_t f = 0; f < frames; f++) {
+    Light.strip_timer_counter = f;
+    render(schemenr);
+    ref_render(schemenr);
+    for (uint32_t i = 0; i < Settings->light_pixels * NeoGrbFeature::PixelSize; i++) {
+      uint32_t d = abs(strip->Pixels()[i] - ref_strip->Pixels()[i]);
+      if (d > diff) { diff = d; }
+    }
+  }
+  return diff;
+}
+
+int main(int argc, char *argv[]) {
+  uint32_t frames = (argc > 1) ? atoi(argv[1]) : 2000;
+  Settings->light_speed = (argc > 2) ? atoi(argv[2]) : 1;
+  Settings->light_width = (argc > 3) ? atoi(argv[3]) : 1;
+  ledGammaInitTable(Settings->light_correction);
+  strip = new NeoPixelBus<selectedNeoFeatureType, selectedNeoSpeedType>(WS2812_MAX_LEDS, 0);
+  ref_strip = new NeoPixelBus<selectedNeoFeatureType, selectedNeoSpeedType>(WS2812_MAX_LEDS, 0);
+
+  printf("%d pixels, %d frames, Speed %d, Width %d\n", Settings->light_pixels, frames, Settings->light_speed, Settings->light_width);
+  printf("%-9s %-13s %12s %12s %8s %8s %6s\n", "Renderer", "Scheme", "Pixels/s", "Float px/s", "Shown", "Float", "Diff");
+  const char *names[WS2812_SCHEMES -1] = { "Incandescent", "RGB", "Christmas", "Hanukkah", "Kwanzaa", "Rainbow", "Fire" };
+  int result = 0;
+  for (uint32_t r = 0; r < 2; r++) {
+    void (*render)(uint32_t) = r ? Ws2812Bars : Ws2812Gradient;
+    void (*ref_render)(uint32_t) = r ? RefBars : RefGradient;
+    for (uint32_t schemenr = 0; schemenr < WS2812_SCHEMES -1; schemenr++) {
+      Settings->light_dimmer = 100;
+      strip->shown = 0;
+      ref_strip->shown = 0;
+      double pps = Run(render, schemenr, frames);
+      double ref_pps = Run(ref_render, schemenr, frames);
+      uint32_t shown = strip->shown;
+      uint32_t ref_shown = ref_strip->shown;
+      uint32_t diff = 0;
+      for (uint32_t dimmer = 1; dimmer <= 100; dimmer += 11) {
+        Settings->light_dimmer = dimmer;
+        uint32_t d = Compare(render, ref_render, schemenr, 2 * STATES * Settings->light_speed);
+        if (d > diff) { diff = d; }
+      }
+      if (diff > 1) { result = 1; }
+      printf("%-9s %-13s %12.0f %12.0f %8u %8u %6u\n", r ? "Bars" : "Gradient", names[schemenr], pps, ref_pps, shown, ref_shown, diff);
+    }
+  }
+  return result;
+}
@@ -0,0 +1,849 @@
+/*
+  zigbee-bench.cpp - host benchmark of the Zigbee device lookups, for Tasmota
+
+  Copyright (C) 2021  Theo Arends and Stephan Hadinger
+
+  This program is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+Instructions:
+  Replays a burst of attribute reports (default 1000) on a coordinator with
+  paired devices (default 150) and reports the cost per report and the number
+  of devices compared of:
+    - the list scan, Z_Devices walking the device list on every lookup
+    - the indexed lookup, Z_Devices with the shortaddr, longaddr and
+      friendlyName indexes
+
+  Every attribute report looks up its sender by short address as the receive
+  path does: getShortAddr() in Z_IncomingMessage() followed by five
+  findShortAddr() for deviceWasReached(), jsonIsConflict(), jsonAppend(),
+  the attribute conversion and the publish. A few devices report most of the
+  time, like plugs reporting power. Interleaved with the reports are commands
+  by friendly name, devices rejoining with a new short address, renames and
+  devices leaving and pairing again, so that the indexes are maintained as on
+  a live network. The benchmark checks that both return the same device for
+  every lookup.
+
+  A recorded burst can be replayed instead: the file is scanned for
+  "Device":"0x1234" as in ZbReceived messages, each one is a report from that
+  device.
+
+  Z_DeviceIndex and the Z_Devices lookups are copies of
+  tasmota/xdrv_23_zigbee_2a_devices_impl.ino, before and after the indexes,
+  reduced to the device addresses and names. LList is a copy of
+  tasmota/support_light_list.ino.
+
+  Host speeds don't reflect ESP32 speeds, compare the ratios.
+
+Usage:
+  g++ -O2 -o zigbee-bench tools/zigbee-bench/zigbee-bench.cpp
+  ./zigbee-bench [reports [devices [recorded_log]]]
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+#include <strings.h>
+#include <ctype.h>
+#include <time.h>
+#include <string>
+#include <vector>
+
+#define strlcpy(dst, src, size) snprintf(dst, size, "%s", src)
+
+const uint16_t BAD_SHORTADDR = 0xFFFE;
+
+uint32_t visits = 0;                         // Devices compared
+
+/*********************************************************************************************\
+ * Copy of tasmota/support_light_list.ino
+\*********************************************************************************************/
+
+template <typename T>
+class LList;
+
+template <typename T>
+class LList_elt {
+public:
+
+  LList_elt() : _next(nullptr), _val() {}
+
+  inline T & val(void) { return _val; }
+  inline LList_elt<T> * next(void) { return _next; }
+  inline void next(LList_elt<T> * next) { _next = next; }
+
+  friend class LList<T>;
+
+protected:
+  LList_elt<T> * _next;
+  T _val;
+};
+
+template <typename T>
+class LList {
+public:
+  LList() : _head(nullptr) {}
+  ~LList() { reset(); }
+
+  void reset(void);
+  void remove(const T * val);
+  T & addToLast(void);
+
+  class iterator {
+  public:
+    iterator(LList_elt<T> *_cur): cur(_cur), next(nullptr) { if (cur) { next = cur->_next; } }
+    iterator operator++() { cur = next; if (cur) { next = cur->_next;} return *this; }
+    bool operator!=(const iterator & other) const { return cur != other.cur; }
+    T & operator*() const { return cur->_val; }
+  private:
+    LList_elt<T> *cur;
+    LList_elt<T> *next;
+  };
+  iterator begin() { return iterator(this->_head); }
+  iterator end() { return iterator(nullptr); }
+
+  class const_iterator {
+    public:
+      const_iterator(const LList_elt<T> *_cur): cur(_cur), next(nullptr) { if (cur) { next = cur->_next; } }
+      const_iterator operator++() { cur = next; if (cur) { next = cur->_next;} return *this; }
+      bool operator!=(const_iterator & other) const { return cur != other.cur; }
+      const T & operator*() const { return cur->_val; }
+    private:
+      const LList_elt<T> *cur;
+      const LList_elt<T> *next;
+    };
+  const_iterator begin() const { return const_iterator(this->_head); }
+  const_iterator end() const { return const_iterator(nullptr); }
+
+protected:
+  LList_elt<T> * _head;
+};
+
+template <typename T>
+void LList<T>::reset(void) {
+  while (_head) {
+    LList_elt<T> * next = _head->next();
+    delete _head;
+    _head = next;
+  }
+}
+
+template <typename T>
+void LList<T>::remove(const T * val) {
+  if (nullptr == val) { return; }
+  LList_elt<T> **curr_ptr = &_head;
+  while (*curr_ptr) {
+    LList_elt<T> * curr_elt = *curr_ptr;
+    if ( &(curr_elt->_val) == val) {
+      *curr_ptr = curr_elt->_next;
+      delete curr_elt;
+      break;
+    }
+    curr_ptr = &((*curr_ptr)->_next);
+  }
+}
+
+template <typename T>
+T & LList<T>::addToLast(void) {
+  LList_elt<T> **curr_ptr = &_head;
+  while (*curr_ptr) {
+    curr_ptr = &((*curr_ptr)->_next);
+  }
+  LList_elt<T> * elt = new LList_elt<T>();
+  *curr_ptr = elt;
+  return elt->_val;
+}
+
+/*********************************************************************************************\
+ * Z_Device reduced to addresses and names, padded to the size of the attribute cache
+\*********************************************************************************************/
+
+class Z_Device {
+public:
+  uint64_t              longaddr;
+  char *                manufacturerId;
+  char *                modelId;
+  char *                friendlyName;
+  uint16_t              shortaddr;
+  uint8_t               attributes[80];
+
+  Z_Device(uint16_t _shortaddr = BAD_SHORTADDR, uint64_t _longaddr = 0x00):
+    longaddr(_longaddr),
+    manufacturerId(nullptr),
+    modelId(nullptr),
+    friendlyName(nullptr),
+    shortaddr(_shortaddr),
+    attributes{} {};
+  ~Z_Device() { free(manufacturerId); free(modelId); free(friendlyName); }
+
+  inline bool valid(void) const { return BAD_SHORTADDR != shortaddr; }
+
+  static void setStringAttribute(char*& attr, const char * str) {
+    if (nullptr == str)  { return; }
+    size_t str_len = strlen(str);
+
+    if ((nullptr == attr) && (0 == str_len)) { return; }
+    if (attr) {
+      if (strcmp(attr, str) != 0) {
+        free(attr);
+        attr = nullptr;
+      } else {
+        return;
+      }
+    }
+    if (str_len) {
+      if (str_len > 31) { str_len = 31; }
+      attr = (char*) malloc(str_len + 1);
+      strlcpy(attr, str, str_len + 1);
+    }
+  }
+};
+
+Z_Device device_unk = Z_Device(BAD_SHORTADDR);
+
+/*********************************************************************************************\
+ * List scan, before the indexes
+\*********************************************************************************************/
+
+namespace Linear {
+
+class Z_Devices {
+public:
+  ~Z_Devices() { _devices.reset(); }
+
+  inline bool foundDevice(const Z_Device & device) const { return device.valid(); }
+
+  Z_Device & findShortAddr(uint16_t shortaddr) {
+    for (auto & elem : _devices) {
+      visits++;
+      if (elem.shortaddr == shortaddr) { return elem; }
+    }
+    return device_unk;
+  }
+  Z_Device & findLongAddr(uint64_t longaddr) {
+    if (!longaddr) { return device_unk; }
+    for (auto &elem : _devices) {
+      visits++;
+      if (elem.longaddr == longaddr) { return elem; }
+    }
+    return device_unk;
+  }
+  Z_Device & isKnownFriendlyNameDevice(const char * name) {
+    if ((!name) || (0 == strlen(name))) { return device_unk; }
+    for (auto &elem : _devices) {
+      visits++;
+      if (elem.friendlyName) {
+        if (strcasecmp(elem.friendlyName, name) == 0) { return elem; }
+      }
+    }
+    return device_unk;
+  }
+
+  Z_Device & getShortAddr(uint16_t shortaddr) {
+    if (BAD_SHORTADDR == shortaddr) { return device_unk; }
+    Z_Device & device = findShortAddr(shortaddr);
+    if (foundDevice(device)) {
+      return device;
+    }
+    return createDeviceEntry(shortaddr, 0);
+  }
+
+  bool removeDevice(uint16_t shortaddr) {
+    Z_Device & device = findShortAddr(shortaddr);
+    if (foundDevice(device)) {
+      _devices.remove(&device);
+      return true;
+    }
+    return false;
+  }
+
+  Z_Device & updateDevice(uint16_t shortaddr, uint64_t longaddr) {
+    Z_Device * s_found = &findShortAddr(shortaddr);
+    Z_Device * l_found = &findLongAddr(longaddr);
+
+    if (foundDevice(*s_found) && foundDevice(*l_found)) {
+      if (s_found == l_found) {
+      } else {
+        l_found->shortaddr = shortaddr;
+        _devices.remove(s_found);
+        return *l_found;
+      }
+    } else if (foundDevice(*s_found)) {
+      s_found->longaddr = longaddr;
+      return *s_found;
+    } else if (foundDevice(*l_found)) {
+      l_found->shortaddr = shortaddr;
+      return *l_found;
+    } else {
+      if ((BAD_SHORTADDR != shortaddr) || longaddr) {
+        return createDeviceEntry(shortaddr, longaddr);
+      }
+      return device_unk;
+    }
+    return device_unk;
+  }
+
+  void setFriendlyName(Z_Device & device, const char * str) {
+    Z_Device::setStringAttribute(device.friendlyName, str);
+  }
+
+private:
+  LList<Z_Device> _devices;
+
+  Z_Device & createDeviceEntry(uint16_t shortaddr, uint64_t longaddr) {
+    if ((BAD_SHORTADDR == shortaddr) && !longaddr) { return device_unk; }
+    Z_Device & device = _devices.addToLast();
+    device.shortaddr = shortaddr;
+    device.longaddr = longaddr;
+    return device;
+  }
+};
+
+}  // namespace Linear
+
+/*********************************************************************************************\
+ * Indexed lookups
+\*********************************************************************************************/
+
+namespace Indexed {
+
+class Z_DeviceIndex {
+public:
+  Z_DeviceIndex() {};
+  ~Z_DeviceIndex() { free(_slots); }
+
+  void add(uint32_t hash, Z_Device * device);
+  bool remove(uint32_t hash, const Z_Device * device);
+  Z_Device * next(uint32_t hash, int32_t & pos) const;
+  inline bool valid(void) const { return !_failed; }
+
+  static uint32_t hashShortAddr(uint16_t shortaddr);
+  static uint32_t hashLongAddr(uint64_t longaddr);
+  static uint32_t hashName(const char * name);
+
+protected:
+  typedef struct Z_DeviceIndexSlot {
+    Z_Device *  device;
+    uint32_t    hash;
+  } Z_DeviceIndexSlot;
+
+  static inline Z_Device * deleted(void) { return (Z_Device*) &_slots_deleted; }
+  bool resize(uint32_t size);
+
+  Z_DeviceIndexSlot * _slots = nullptr;
+  uint16_t  _size = 0;
+  uint16_t  _used = 0;
+  uint16_t  _count = 0;
+  bool      _failed = false;
+  static uint8_t _slots_deleted;
+};
+
+uint8_t Z_DeviceIndex::_slots_deleted = 0;
+
+uint32_t Z_DeviceIndex::hashShortAddr(uint16_t shortaddr) {
+  uint32_t hash = shortaddr * 2654435761UL;
+  return hash ^ (hash >> 16);
+}
+
+uint32_t Z_DeviceIndex::hashLongAddr(uint64_t longaddr) {
+  return hashShortAddr((uint16_t)longaddr) ^ (((uint32_t)(longaddr >> 16)) * 2654435761UL);
+}
+
+uint32_t Z_DeviceIndex::hashName(const char * name) {
+  uint32_t hash = 2166136261UL;
+  if (name) {
+    while (*name) {
+      hash = (hash ^ tolower((uint8_t)*name++)) * 16777619UL;
+    }
+  }
+  return hash;
+}
+
+bool Z_DeviceIndex::resize(uint32_t size) {
+  Z_DeviceIndexSlot * slots = (Z_DeviceIndexSlot*) calloc(size, sizeof(Z_DeviceIndexSlot));
+  if (!slots) { return false; }
+  Z_DeviceIndexSlot * old_slots = _slots;
+  uint32_t old_size = _size;
+  _slots = slots;
+  _size = size;
+  _used = 0;
+  _count = 0;
+  for (uint32_t i = 0; i < old_size; i++) {
+    if (old_slots[i].device && (deleted() != old_slots[i].device)) {
+      add(old_slots[i].hash, old_slots[i].device);
+    }
+  }
+  free(old_slots);
+  return true;
+}
+
+void Z_DeviceIndex::add(uint32_t hash, Z_Device * device) {
+  if (_failed) { return; }
+  if ((_used + 1) * 4 > _size * 3) {
+    uint32_t size = 16;
+    while (size < (uint32_t)(_count + 1) * 2) { size <<= 1; }
+    if (!resize(size) && (_used + 1 >= _size)) {
+      _failed = true;
+      return;
+    }
+  }
+  uint32_t mask = _size - 1;
+  for (uint32_t probe = 0; probe < _size; probe++) {
+    Z_DeviceIndexSlot & slot = _slots[(hash + probe) & mask];
+    if ((nullptr == slot.device) || (deleted() == slot.device)) {
+      if (nullptr == slot.device) { _used++; }
+      slot.device = device;
+      slot.hash = hash;
+      _count++;
+      return;
+    }
+  }
+}
+
+bool Z_DeviceIndex::remove(uint32_t hash, const Z_Device * device) {
+  if (!_size) { return false; }
+  uint32_t mask = _size - 1;
+  for (uint32_t probe = 0; probe < _size; probe++) {
+    Z_DeviceIndexSlot & slot = _slots[(hash + probe) & mask];
+    if (nullptr == slot.device) { break; }
+    if (device == slot.device) {
+      slot.device = deleted();
+      _count--;
+      return true;
+    }
+  }
+  return false;
+}
+
+Z_Device * Z_DeviceIndex::next(uint32_t hash, int32_t & pos) const {
+  uint32_t mask = _size - 1;
+  for (uint32_t probe = pos + 1; probe < _size; probe++) {
+    const Z_DeviceIndexSlot & slot = _slots[(hash + probe) & mask];
+    if (nullptr == slot.device) { break; }
+    if ((hash == slot.hash) && (deleted() != slot.device)) {
+      pos = probe;
+      visits++;
+      return slot.device;
+    }
+  }
+  pos = _size;
+  return nullptr;
+}
+
+class Z_Devices {
+public:
+  ~Z_Devices() { _devices.reset(); }
+
+  inline bool foundDevice(const Z_Device & device) const { return device.valid(); }
+
+  Z_Device & findShortAddr(uint16_t shortaddr) {
+    if (_short_index.valid()) {
+      uint32_t hash = Z_DeviceIndex::hashShortAddr(shortaddr);
+      Z_Device * found = nullptr;
+      uint32_t matches = 0;
+      int32_t pos = -1;
+      while (Z_Device * device = _short_index.next(hash, pos)) {
+        if (device->shortaddr == shortaddr) { found = device; matches++; }
+      }
+      if (matches <= 1) { return found ? *found : device_unk; }
+    }
+    for (auto & elem : _devices) {
+      visits++;
+      if (elem.shortaddr == shortaddr) { return elem; }
+    }
+    return device_unk;
+  }
+  Z_Device & findLongAddr(uint64_t longaddr) {
+    if (!longaddr) { return device_unk; }
+    if (_long_index.valid()) {
+      uint32_t hash = Z_DeviceIndex::hashLongAddr(longaddr);
+      Z_Device * found = nullptr;
+      uint32_t matches = 0;
+      int32_t pos = -1;
+      while (Z_Device * device = _long_index.next(hash, pos)) {
+        if (device->longaddr == longaddr) { found = device; matches++; }
+      }
+      if (matches <= 1) { return found ? *found : device_unk; }
+    }
+    for (auto &elem : _devices) {
+      visits++;
+      if (elem.longaddr == longaddr) { return elem; }
+    }
+    return device_unk;
+  }
+  Z_Device * findFriendlyNameDevice(const char * name) {
+    if ((!name) || (0 == name[0])) { return nullptr; }
+    if (_name_index.valid()) {
+      uint32_t hash = Z_DeviceIndex::hashName(name);
+      Z_Device * found = nullptr;
+      uint32_t matches = 0;
+      int32_t pos = -1;
+      while (Z_Device * device = _name_index.next(hash, pos)) {
+        if ((device->friendlyName) && (strcasecmp(device->friendlyName, name) == 0)) { found = device; matches++; }
+      }
+      if (matches <= 1) { return found; }
+    }
+    for (auto &elem : _devices) {
+      visits++;
+      if ((elem.friendlyName) && (strcasecmp(elem.friendlyName, name) == 0)) { return &elem; }
+    }
+    return nullptr;
+  }
+  Z_Device & isKnownFriendlyNameDevice(const char * name) {
+    if ((!name) || (0 == strlen(name))) { return device_unk; }
+    Z_Device * device = findFriendlyNameDevice(name);
+    if (device) {
+      return *device;
+    } else {
+      return device_unk;
+    }
+  }
+
+  Z_Device & getShortAddr(uint16_t shortaddr) {
+    if (BAD_SHORTADDR == shortaddr) { return device_unk; }
+    Z_Device & device = findShortAddr(shortaddr);
+    if (foundDevice(device)) {
+      return device;
+    }
+    return createDeviceEntry(shortaddr, 0);
+  }
+
+  bool removeDevice(uint16_t shortaddr) {
+    Z_Device & device = findShortAddr(shortaddr);
+    if (foundDevice(device)) {
+      unindexDevice(&device);
+      _devices.remove(&device);
+      return true;
+    }
+    return false;
+  }
+
+  Z_Device & updateDevice(uint16_t shortaddr, uint64_t longaddr) {
+    Z_Device * s_found = &findShortAddr(shortaddr);
+    Z_Device * l_found = &findLongAddr(longaddr);
+
+    if (foundDevice(*s_found) && foundDevice(*l_found)) {
+      if (s_found == l_found) {
+      } else {
+        unindexDevice(s_found);
+        _short_index.remove(Z_DeviceIndex::hashShortAddr(l_found->shortaddr), l_found);
+        l_found->shortaddr = shortaddr;
+        _short_index.add(Z_DeviceIndex::hashShortAddr(shortaddr), l_found);
+        _devices.remove(s_found);
+        return *l_found;
+      }
+    } else if (foundDevice(*s_found)) {
+      _long_index.remove(Z_DeviceIndex::hashLongAddr(s_found->longaddr), s_found);
+      s_found->longaddr = longaddr;
+      _long_index.add(Z_DeviceIndex::hashLongAddr(longaddr), s_found);
+      return *s_found;
+    } else if (foundDevice(*l_found)) {
+      _short_index.remove(Z_DeviceIndex::hashShortAddr(l_found->shortaddr), l_found);
+      l_found->shortaddr = shortaddr;
+      _short_index.add(Z_DeviceIndex::hashShortAddr(shortaddr), l_found);
+      return *l_found;
+    } else {
+      if ((BAD_SHORTADDR != shortaddr) || longaddr) {
+        return createDeviceEntry(shortaddr, longaddr);
+      }
+      return device_unk;
+    }
+    return device_unk;
+  }
+
+  // Z_Device::setFriendlyName()
+  void setFriendlyName(Z_Device & device, const char * str) {
+    uint32_t old_hash = Z_DeviceIndex::hashName(device.friendlyName);
+    Z_Device::setStringAttribute(device.friendlyName, str);
+    reindexFriendlyName(&device, old_hash);
+  }
+
+private:
+  LList<Z_Device>           _devices;
+  Z_DeviceIndex             _short_index;
+  Z_DeviceIndex             _long_index;
+  Z_DeviceIndex             _name_index;
+
+  Z_Device & createDeviceEntry(uint16_t shortaddr, uint64_t longaddr) {
+    if ((BAD_SHORTADDR == shortaddr) && !longaddr) { return device_unk; }
+    Z_Device & device = _devices.addToLast();
+    device.shortaddr = shortaddr;
+    device.longaddr = longaddr;
+    indexDevice(&device);
+    return device;
+  }
+
+  void indexDevice(Z_Device * device) {
+    _short_index.add(Z_DeviceIndex::hashShortAddr(device->shortaddr), device);
+    _long_index.add(Z_DeviceIndex::hashLongAddr(device->longaddr), device);
+    _name_index.add(Z_DeviceIndex::hashName(device->friendlyName), device);
+  }
+
+  void unindexDevice(Z_Device * device) {
+    _short_index.remove(Z_DeviceIndex::hashShortAddr(device->shortaddr), device);
+    _long_index.remove(Z_DeviceIndex::hashLongAddr(device->longaddr), device);
+    _name_index.remove(Z_DeviceIndex::hashName(device->friendlyName), device);
+  }
+
+  void reindexFriendlyName(Z_Device * device, uint32_t old_hash) {
+    if (_name_index.remove(old_hash, device)) {
+      _name_index.add(Z_DeviceIndex::hashName(device->friendlyName), device);
+    }
+  }
+};
+
+}  // namespace Indexed
+
+/*********************************************************************************************\
+ * Network and burst
+\*********************************************************************************************/
+
+enum EventTypes { EV_REPORT, EV_COMMAND, EV_REJOIN, EV_RENAME, EV_LEAVE, EV_PAIR };
+
+struct Event {
+  uint8_t type;
+  uint16_t shortaddr;
+  uint64_t longaddr;
+  std::string name;
+};
+
+struct Node {
+  uint16_t shortaddr;
+  uint64_t longaddr;
+  std::string name;
+  bool paired;
+};
+
+std::vector<Node> network;
+
+uint16_t NewShortAddr(void) {
+  while (true) {
+    uint16_t shortaddr = 0x0001 + random() % 0xFFF0;
+    bool used = false;
+    for (auto& node : network) { if (node.shortaddr == shortaddr) { used = true; } }
+    if (!used) { return shortaddr; }
+  }
+}
+
+void MakeNetwork(uint32_t device_count) {
+  static const char* kRooms[] = { "Kitchen", "Living", "Bedroom", "Bath", "Hall", "Garage", "Office", "Garden" };
+  static const char* kKinds[] = { "Light", "Plug", "Temp", "Door", "Motion", "Switch", "Blind", "Valve" };
+  for (uint32_t i = 0; i < device_count; i++) {
+    Node node;
+    node.shortaddr = NewShortAddr();
+    node.longaddr = 0x00158D0000000000ULL | ((uint64_t)random() << 8) | i;
+    if (random() % 10) {                     // Most devices are named
+      node.name = std::string(kRooms[random() % 8]) + "_" + kKinds[random() % 8] + "_" + std::to_string(i);
+    }
+    node.paired = true;
+    network.push_back(node);
+  }
+}
+
+std::string MixedCase(std::string name) {
+  // Names as typed by users in commands
+  for (auto& c : name) { if (random() % 3 == 0) { c = (isupper(c)) ? tolower(c) : toupper(c); } }
+  return name;
+}
+
+std::vector<Event> MakeBurst(uint32_t reports) {
+  // A fifth of the devices send most of the reports
+  std::vector<uint32_t> chatty;
+  for (uint32_t i = 0; i < network.size(); i++) { if (random() % 5 == 0) { chatty.push_back(i); } }
+  if (chatty.empty()) { chatty.push_back(0); }
+
+  std::vector<Event> burst;
+  for (uint32_t i = 0; i < reports; i++) {
+    uint32_t r = random() % 1000;
+    if (r < 30) {
+      Node& node = network[random() % network.size()];
+      if (node.paired && node.name.size()) {
+        burst.push_back({ EV_COMMAND, 0, 0, MixedCase(node.name) });
+      }
+    } else if (r < 35) {
+      Node& node = network[random() % network.size()];
+      if (node.paired) {
+        node.shortaddr = NewShortAddr();     // Device rejoined through another router
+        burst.push_back({ EV_REJOIN, node.shortaddr, node.longaddr, "" });
+      }
+    } else if (r < 37) {
+      Node& node = network[random() % network.size()];
+      if (node.paired) {
+        node.name = "Renamed_" + std::to_string(i);
+        burst.push_back({ EV_RENAME, 0, node.longaddr, node.name });
+      }
+    } else if (r < 39) {
+      Node& node = network[random() % network.size()];
+      if (node.paired) {
+        node.paired = false;
+        burst.push_back({ EV_LEAVE, node.shortaddr, 0, "" });
+      } else {
+        node.paired = true;
+        node.shortaddr = NewShortAddr();
+        burst.push_back({ EV_PAIR, node.shortaddr, node.longaddr, node.name });
+      }
+    }
+    uint32_t index = (random() % 5) ? chatty[random() % chatty.size()] : random() % network.size();
+    if (network[index].paired) {
+      burst.push_back({ EV_REPORT, network[index].shortaddr, 0, "" });
+    }
+  }
+  return burst;
+}
+
+std::vector<Event> LoadBurst(const char* filename, uint32_t& reports) {
+  // Reports from a recorded log, one per "Device":"0x1234"
+  std::vector<Event> burst;
+  FILE* file = fopen(filename, "r");
+  if (!file) { return burst; }
+  char line[1024];
+  while (fgets(line, sizeof(line), file)) {
+    const char* device = line;
+    while ((device = strstr(device, "\"Device\":\"0x")) != nullptr) {
+      device += 12;
+      uint16_t shortaddr = strtoul(device, nullptr, 16);
+      burst.push_back({ EV_REPORT, shortaddr, 0, "" });
+      bool known = false;
+      for (auto& node : network) { if (node.shortaddr == shortaddr) { known = true; } }
+      if (!known) {
+        network.push_back({ shortaddr, 0x00158D0000000000ULL | network.size(), "Device_" + std::to_string(network.size()), true });
+      }
+    }
+  }
+  fclose(file);
+  reports = burst.size();
+  return burst;
+}
+
+uint64_t Signature(const Z_Device& device) {
+  // Same device found in both implementations
+  uint64_t signature = device.longaddr ^ ((uint64_t)device.shortaddr << 48);
+  if (device.friendlyName) {
+    for (const char* c = device.friendlyName; *c; c++) { signature = signature * 31 + *c; }
+  }
+  return signature;
+}
+
+template <typename Devices>
+void Pair(Devices& devices, const std::vector<Node>& nodes) {
+  for (auto& node : nodes) {
+    Z_Device& device = devices.updateDevice(node.shortaddr, node.longaddr);
+    if (node.name.size()) { devices.setFriendlyName(device, node.name.c_str()); }
+  }
+}
+
+template <typename Devices>
+void Replay(Devices& devices, const std::vector<Event>& burst, std::vector<uint64_t>& results) {
+  for (auto& event : burst) {
+    switch (event.type) {
+      case EV_REPORT: {
+        Z_Device& device = devices.getShortAddr(event.shortaddr);     // Z_IncomingMessage()
+        uint64_t signature = Signature(device);
+        for (uint32_t i = 0; i < 5; i++) {
+          signature += Signature(devices.findShortAddr(event.shortaddr));
+        }
+        results.push_back(signature);
+        break;
+      }
+      case EV_COMMAND: {
+        Z_Device& device = devices.isKnownFriendlyNameDevice(event.name.c_str());
+        results.push_back(Signature(device) + Signature(devices.findShortAddr(device.shortaddr)));
+        break;
+      }
+      case EV_REJOIN:
+      case EV_PAIR: {
+        Z_Device& device = devices.updateDevice(event.shortaddr, event.longaddr);
+        if (event.name.size()) { devices.setFriendlyName(device, event.name.c_str()); }
+        results.push_back(Signature(device));
+        break;
+      }
+      case EV_RENAME: {
+        Z_Device& device = devices.findLongAddr(event.longaddr);
+        if (device.valid()) { devices.setFriendlyName(device, event.name.c_str()); }
+        results.push_back(Signature(device));
+        break;
+      }
+      case EV_LEAVE:
+        results.push_back(devices.removeDevice(event.shortaddr));
+        break;
+    }
+  }
+}
+
+template <typename Devices>
+double Run(const std::vector<Node>& nodes, const std::vector<Event>& burst, uint32_t rounds,
+           std::vector<uint64_t>& results, uint32_t& compared) {
+  double ns = 0;
+  compared = 0;
+  for (uint32_t round = 0; round < rounds; round++) {
+    Devices devices;
+    Pair(devices, nodes);
+    std::vector<uint64_t> round_results;
+    round_results.reserve(burst.size());
+    visits = 0;
+    struct timespec start, end;
+    clock_gettime(CLOCK_MONOTONIC, &start);
+    Replay(devices, burst, round_results);
+    clock_gettime(CLOCK_MONOTONIC, &end);
+    ns += (end.tv_sec - start.tv_sec) * 1e9 + (end.tv_nsec - start.tv_nsec);
+    compared = visits;
+    if (0 == round) { results = round_results; }
+  }
+  return ns / rounds;
+}
+
+int main(int argc, char* argv[]) {
+  uint32_t reports = (argc > 1) ? atoi(argv[1]) : 1000;
+  uint32_t device_count = (argc > 2) ? atoi(argv[2]) : 150;
+  const uint32_t rounds = 200;
+
+  srandom(1);
+  std::vector<Event> burst;
+  if (argc > 3) {
+    burst = LoadBurst(argv[3], reports);
+    if (burst.empty()) {
+      printf("No \"Device\":\"0x....\" found in %s\n", argv[3]);
+      return 1;
+    }
+  } else {
+    MakeNetwork(device_count);
+  }
+  std::vector<Node> nodes = network;       // Network as paired before the burst
+  if (argc <= 3) { burst = MakeBurst(reports); }
+  printf("%u reports, %u devices, %u events\n", reports, (uint32_t)nodes.size(), (uint32_t)burst.size());
+
+  std::vector<uint64_t> linear_results, indexed_results;
+  uint32_t linear_compared, indexed_compared;
+  double linear_ns = Run<Linear::Z_Devices>(nodes, burst, rounds, linear_results, linear_compared);
+  double indexed_ns = Run<Indexed::Z_Devices>(nodes, burst, rounds, indexed_results, indexed_compared);
+
+  uint32_t differences = 0;
+  for (uint32_t i = 0; i < burst.size(); i++) {
+    if (linear_results[i] != indexed_results[i]) {
+      if (differences < 5) {
+        printf("  Event %u type %u: list scan %016llX, indexed %016llX\n", i, burst[i].type,
+          (unsigned long long)linear_results[i], (unsigned long long)indexed_results[i]);
+      }
+      differences++;
+    }
+  }
+
+  printf("  List scan  %10.1f nS/burst %7.1f nS/report %7.1f devices compared/report\n",
+    linear_ns, linear_ns / reports, (double)linear_compared / reports);
+  printf("  Indexed    %10.1f nS/burst %7.1f nS/report %7.1f devices compared/report\n",
+    indexed_ns, indexed_ns / reports, (double)indexed_compared / reports);
+  printf("  %u lookups returned a different device\n", differences);
+
+  return (differences) ? 1 : 0;
+}
@@ -0,0 +1,691 @@
+/*
+  zigbee-journal-test.cpp - host test of the Zigbee devices journal, for Tasmota
+
+  Copyright (C) 2021  Theo Arends and Stephan Hadinger
+
+  This program is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+Instructions:
+  Builds xdrv_23_zigbee_4a_nano_fs.ino and xdrv_23_zigbee_4c_devices.ino on
+  the host, with an EEPROM and a file system in RAM, and runs the journal
+  functions as Tasmota does: journalZigbeeDevices() and saveZigbeeDevices()
+  when devices changed, loadZigbeeDevices() at boot.
+
+  Checks:
+    - an EEPROM formatted before the journal existed gets the 'jrn2' entry
+      and its blocks 64 to 94 are marked used in the bitmap
+    - the largest device record fits in a single journal record
+    - a day of changes on a network (default 100 devices): after every save
+      the devices are reloaded from storage and compared with the devices in
+      memory, and a torn last journal record is detected and ignored
+  It reports the bytes written per day with the journal and with a full
+  rewrite of the devices on every save, for the EEPROM and the file system.
+
+  Z_Device and Z_Devices are reduced to what the storage functions use, the
+  ESP8266 Flash journal is not built (RAM layout of ESP32).
+
+Usage:
+  g++ -O2 -fpermissive -I lib/default/Ext-printf/src -o zigbee-journal-test tools/zigbee-journal-test/zigbee-journal-test.cpp
+  ./zigbee-journal-test [devices [days]]
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <stdarg.h>
+#include <string.h>
+#include <map>
+#include <string>
+#include <vector>
+#include <random>
+#include <algorithm>
+
+/*********************************************************************************************\
+ * Tasmota environment used by the driver
+\*********************************************************************************************/
+
+#define USE_ZIGBEE
+#define USE_ZIGBEE_EEPROM
+#define USE_UFILESYS
+#define ESP32
+
+#define PROGMEM
+#define PSTR(s) (s)
+#define pgm_read_byte(p) (*(const uint8_t*)(p))
+#define nitems(x) (sizeof(x) / sizeof(x[0]))
+
+#define D_LOG_ZIGBEE "ZIG: "
+#define D_PRFX_ZB "Zb"
+#define D_CMND_ZIGBEE_RESTORE "Restore"
+#define D_CMND_ZIGBEE_DATA "Data"
+#define TASM_FILE_ZIGBEE "/zb"
+#define TASM_FILE_ZIGBEE_JOURNAL "/zbjournal"
+#define RESULT_OR_STAT 0
+
+typedef uint8_t byte;
+
+enum LoggingLevels { LOG_LEVEL_NONE, LOG_LEVEL_ERROR, LOG_LEVEL_INFO, LOG_LEVEL_DEBUG, LOG_LEVEL_DEBUG_MORE };
+
+uint32_t log_level = LOG_LEVEL_ERROR;
+char last_log[256];
+
+void AddLog(uint32_t loglevel, const char* formatP, ...) {
+  va_list arg;
+  va_start(arg, formatP);
+  vsnprintf(last_log, sizeof(last_log), formatP, arg);
+  va_end(arg);
+  if (loglevel <= log_level) { printf("%s\n", last_log); }
+}
+
+void Response_P(const char* format, ...) {}
+void MqttPublishPrefixTopicRulesProcess_P(uint32_t prefix, const char* subtopic) {}
+
+#include "SBuffer.hpp"
+#include "../../tasmota/support_light_list.ino"
+
+uint32_t bytes_written = 0;           // bytes written to EEPROM or file system
+
+// 24C512 EEPROM
+class Eeprom_Ram {
+public:
+  uint8_t mem[0x10000];
+
+  void readBytes(uint16_t address, uint16_t length, byte* buffer) {
+    memcpy(buffer, mem + address, length);
+  }
+  void writeBytes(uint16_t address, uint16_t length, byte* buffer) {
+    memcpy(mem + address, buffer, length);
+    bytes_written += length;
+  }
+};
+
+struct ZIGBEE {
+  bool eeprom_present = false;
+  bool eeprom_ready = false;
+  Eeprom_Ram eeprom;
+} zigbee;
+
+class File {
+public:
+  File(void) : data(nullptr), pos(0) {}
+  File(std::vector<uint8_t>* _data, size_t _pos) : data(_data), pos(_pos) {}
+
+  operator bool() const { return data != nullptr; }
+  size_t size(void) const { return data->size(); }
+  size_t position(void) const { return pos; }
+  bool seek(uint32_t _pos) { pos = std::min<size_t>(_pos, data->size()); return true; }
+  int read(uint8_t* buf, size_t len) {
+    len = std::min(len, data->size() - pos);
+    memcpy(buf, data->data() + pos, len);
+    pos += len;
+    return len;
+  }
+  size_t write(const uint8_t* buf, size_t len) {
+    if (pos + len > data->size()) { data->resize(pos + len); }
+    memcpy(data->data() + pos, buf, len);
+    pos += len;
+    bytes_written += len;
+    return len;
+  }
+  void close(void) {}
+
+private:
+  std::vector<uint8_t>* data;
+  size_t pos;
+};
+
+class FS {
+public:
+  std::map<std::string, std::vector<uint8_t>> files;
+
+  File open(const char* path, const char* mode) {
+    if ('r' == mode[0]) {
+      auto it = files.find(path);
+      return (it == files.end()) ? File() : File(&it->second, 0);
+    }
+    std::vector<uint8_t>& data = files[path];
+    if ('w' == mode[0]) { data.clear(); }
+    return File(&data, data.size());
+  }
+};
+
+FS ram_fs;
+FS *dfsp = nullptr;
+extern "C" uint32_t _FS_end;
+uint32_t _FS_end = 0;
+
+bool TfsDeleteFile(const char* fname) {
+  return dfsp && dfsp->files.erase(fname);
+}
+
+/*********************************************************************************************\
+ * Zigbee devices, reduced to what is stored
+\*********************************************************************************************/
+
+const uint16_t BAD_SHORTADDR = 0xFFFE;
+const size_t endpoints_max = 8;
+
+enum class Z_Data_Type : uint8_t {
+  Z_Unknown = 0x00, Z_Light = 1, Z_Plug = 2, Z_PIR = 3, Z_Alarm = 4, Z_Thermo = 5, Z_OnOff = 6,
+  Z_Mode = 0xE, Z_Ext = 0xF, Z_Device = 0xFF
+};
+const Z_Data_Type kDataTypes[] = { Z_Data_Type::Z_Light, Z_Data_Type::Z_Plug, Z_Data_Type::Z_PIR, Z_Data_Type::Z_Alarm,
+                                   Z_Data_Type::Z_Thermo, Z_Data_Type::Z_OnOff, Z_Data_Type::Z_Mode };
+
+class Z_Data {
+public:
+  Z_Data(Z_Data_Type type = Z_Data_Type::Z_Unknown, uint8_t endpoint = 0) : _type(type), _endpoint(endpoint), _config(0xF) {}
+  inline uint8_t getEndpoint(void) const { return _endpoint; }
+  inline void setConfig(int8_t config) { _config = config; }
+  uint8_t getConfigByte(void) const { return ( ((uint8_t)_type) << 4) | ((_config & 0xF) & 0x0F); }
+
+  Z_Data_Type _type;
+  uint8_t     _endpoint;
+  uint8_t     _config;
+};
+
+class Z_Data_Set : public LList<Z_Data> {
+public:
+  Z_Data & getByType(Z_Data_Type type, uint8_t ep = 0) {      // creates if non-existent
+    for (auto & elt : *this) {
+      if ((elt._type == type) && (elt._endpoint == ep)) { return elt; }
+    }
+    Z_Data & elt = addToLast();
+    elt._type = type;
+    elt._endpoint = ep;
+    return elt;
+  }
+  static bool updateData(Z_Data & elt) { return false; }
+};
+
+class Z_Device {
+public:
+  uint64_t      longaddr;
+  char *        manufacturerId;
+  char *        modelId;
+  char *        friendlyName;
+  uint32_t      journal_crc;
+  uint8_t       endpoints[endpoints_max];
+  Z_Data_Set    data;
+  uint16_t      shortaddr;
+
+  Z_Device(uint16_t _shortaddr = BAD_SHORTADDR, uint64_t _longaddr = 0x00) :
+    longaddr(_longaddr), manufacturerId(nullptr), modelId(nullptr), friendlyName(nullptr),
+    journal_crc(0), endpoints{ 0, 0, 0, 0, 0, 0, 0, 0 }, data(), shortaddr(_shortaddr) {}
+  ~Z_Device() { free(manufacturerId); free(modelId); free(friendlyName); }
+
+  bool addEndpoint(uint8_t endpoint) {
+    if ((0x00 == endpoint) || (endpoint > 240)) { return false; }
+    for (uint32_t i = 0; i < endpoints_max; i++) {
+      if (endpoint == endpoints[i]) { return false; }
+      if (0 == endpoints[i]) {
+        endpoints[i] = endpoint;
+        return true;
+      }
+    }
+    return false;
+  }
+  void setManufId(const char * str) { setStringAttribute(manufacturerId, str); }
+  void setModelId(const char * str) { setStringAttribute(modelId, str); }
+  void setFriendlyName(const char * str) { setStringAttribute(friendlyName, str); }
+
+private:
+  static void setStringAttribute(char*& attr, const char * str);
+};
+
+bool journalZigbeeDevices(void);
+void saveZigbeeDevices(void);
+
+class Z_Devices {
+public:
+  inline const LList<Z_Device> & getDevices(void) const { return _devices; }
+  inline LList<Z_Device> & getDevices(void) { return _devices; }
+  size_t devicesSize(void) const { return _devices.length(); }
+
+  Z_Device & findShortAddr(uint16_t shortaddr);
+  Z_Device & findLongAddr(uint64_t longaddr);
+  inline bool foundDevice(const Z_Device & device) const;
+  Z_Device & updateDevice(uint16_t shortaddr, uint64_t longaddr);
+  bool removeDevice(uint16_t shortaddr) {
+    Z_Device & device = findShortAddr(shortaddr);
+    if (!foundDevice(device)) { return false; }
+    _devices.remove(&device);
+    dirtyAll();
+    return true;
+  }
+  void reset(void) { _devices.reset(); clean(); }
+
+  void dirty(void) { _dirty = true; }
+  void dirtyAll(void) { _saveAll = true; dirty(); }
+  void clean(void) { _dirty = false; _saveAll = false; }
+  bool isDirty(void) const { return _dirty; }
+
+  // Z_Devices::runTimer() when the save timer is reached
+  void save(bool journal) {
+    if (!_dirty) { return; }
+    if (!journal || _saveAll || !journalZigbeeDevices()) {
+      saveZigbeeDevices();      // full rewrite, also starts a new journal
+    }
+    clean();
+  }
+
+private:
+  LList<Z_Device> _devices;
+  bool _dirty = false;
+  bool _saveAll = false;
+};
+
+Z_Devices zigbee_devices;
+Z_Device device_unk(BAD_SHORTADDR);
+
+void Z_Device::setStringAttribute(char*& attr, const char * str) {
+  if (nullptr == str)  { return; }
+  size_t str_len = strlen(str);
+  if ((nullptr == attr) && (0 == str_len)) { return; }
+  if (attr) {
+    if (strcmp(attr, str) == 0) { return; }
+    free(attr);
+    attr = nullptr;
+  }
+  if (str_len) {
+    if (str_len > 31) { str_len = 31; }
+    attr = (char*) malloc(str_len + 1);
+    memcpy(attr, str, str_len);
+    attr[str_len] = '\0';
+  }
+  zigbee_devices.dirty();
+}
+
+Z_Device & Z_Devices::findShortAddr(uint16_t shortaddr) {
+  if (BAD_SHORTADDR == shortaddr) { return device_unk; }
+  for (auto & device : _devices) {
+    if (device.shortaddr == shortaddr) { return device; }
+  }
+  return device_unk;
+}
+
+Z_Device & Z_Devices::findLongAddr(uint64_t longaddr) {
+  if (!longaddr) { return device_unk; }
+  for (auto & device : _devices) {
+    if (device.longaddr == longaddr) { return device; }
+  }
+  return device_unk;
+}
+
+bool Z_Devices::foundDevice(const Z_Device & device) const {
+  return &device != &device_unk;
+}
+
+Z_Device & Z_Devices::updateDevice(uint16_t shortaddr, uint64_t longaddr) {
+  Z_Device * s_found = &findShortAddr(shortaddr);
+  Z_Device * l_found = &findLongAddr(longaddr);
+  if (foundDevice(*s_found) && foundDevice(*l_found)) {
+    if (s_found != l_found) {
+      _devices.remove(s_found);
+      l_found->shortaddr = shortaddr;
+      dirty();
+    }
+    return *l_found;
+  } else if (foundDevice(*s_found)) {
+    if (longaddr) { s_found->longaddr = longaddr; dirty(); }
+    return *s_found;
+  } else if (foundDevice(*l_found)) {
+    l_found->shortaddr = shortaddr;
+    dirty();
+    return *l_found;
+  }
+  Z_Device & device = _devices.addToLast();
+  device.shortaddr = shortaddr;
+  device.longaddr = longaddr;
+  dirty();
+  return device;
+}
+
+uint32_t Z_Crc32(uint32_t crc, const uint8_t * buf, size_t len);
+void ZFS_Erase(void);
+
+#include "../../tasmota/xdrv_23_zigbee_4a_nano_fs.ino"
+#include "../../tasmota/xdrv_23_zigbee_4c_devices.ino"
+
+void ZFS_Erase(void) {
+  if (zigbee.eeprom_present) { ZFS::erase(); }
+}
+
+/*********************************************************************************************\
+ * Test helpers
+\*********************************************************************************************/
+
+enum Storage { STORAGE_EEPROM, STORAGE_FILE };
+const char* const kStorageNames[] = { "eeprom", "file" };
+
+uint32_t errors = 0;
+
+#define CHECK(cond, ...) do { if (!(cond)) { errors++; printf("FAIL line %d: ", __LINE__); printf(__VA_ARGS__); printf("\n"); } } while (0)
+
+void StorageInit(uint32_t storage) {
+  zigbee_devices.reset();
+  zigbee_journal = Z_Journal();
+  ram_fs.files.clear();
+  memset(zigbee.eeprom.mem, 0xFF, sizeof(zigbee.eeprom.mem));
+  zigbee.eeprom_present = (STORAGE_EEPROM == storage);
+  zigbee.eeprom_ready = false;
+  dfsp = (STORAGE_FILE == storage) ? &ram_fs : nullptr;
+  ZFS::initOrFormat();
+}
+
+// Device records in memory, by long address
+std::map<uint64_t, std::vector<uint8_t>> Snapshot(void) {
+  std::map<uint64_t, std::vector<uint8_t>> records;
+  for (const auto & device : zigbee_devices.getDevices()) {
+    const SBuffer buf = hibernateDevice(device);
+    records[device.longaddr].assign(buf.getBuffer(), buf.getBuffer() + buf.len());
+  }
+  return records;
+}
+
+// Restart, returns true if the journal was usable
+bool Reboot(void) {
+  zigbee_devices.reset();
+  zigbee_journal = Z_Journal();
+  loadZigbeeDevices();
+  return !zigbee_devices.isDirty();
+}
+
+// Last byte of the journal, to tear the last record
+uint8_t* JournalLastByte(uint32_t storage) {
+  if (STORAGE_EEPROM == storage) {
+    ZFS_File_Entry entry;
+    if (!ZFS::findFileEntry(ZIGB_JOURNAL2, entry, nullptr) || !entry.length) { return nullptr; }
+    return &zigbee.eeprom.mem[(entry.blk_start << 8) + entry.length - 1];
+  }
+  std::vector<uint8_t>& journal = ram_fs.files[TASM_FILE_ZIGBEE_JOURNAL];
+  return journal.empty() ? nullptr : &journal.back();
+}
+
+/*********************************************************************************************\
+ * EEPROM formatted before the journal
+\*********************************************************************************************/
+
+void TestEepromUpgrade(void) {
+  StorageInit(STORAGE_EEPROM);
+  // layout without 'jrn2': the bitmap reserves blocks 0 to 63
+  ZFS_Dir_Block dir;
+  dir.format();
+  dir.e[2] = ZFS_File_Entry();
+  zigbee.eeprom.writeBytes(0x0000, sizeof(dir), (byte*) &dir);
+  ZFS_Bitmap bitmap;
+  memset(&bitmap, 0, sizeof(bitmap));
+  for (uint32_t i = 0; i < 64; i++) { bitmap.block[i].used = true; }
+  bitmap.block[0xFF].used = true;
+  zigbee.eeprom.writeBytes(0xFF00, sizeof(bitmap), (byte*) &bitmap);
+
+  zigbee.eeprom_ready = false;
+  ZFS::initOrFormat();
+
+  ZFS_File_Entry entry;
+  CHECK(ZFS::findFileEntry(ZIGB_JOURNAL2, entry, nullptr) && (64 == entry.blk_start), "journal entry not added");
+  zigbee.eeprom.readBytes(0xFF00, sizeof(bitmap), (byte*) &bitmap);
+  for (uint32_t i = 0; i < 0x100; i++) {
+    bool used = (i < 2 + 31 * 3) || (0xFF == i);
+    CHECK(bitmap.block[i].used == used, "bitmap block %d used %d, expected %d", i, bitmap.block[i].used, used);
+  }
+  ZFS_Dir_Block dir_read;
+  zigbee.eeprom.readBytes(0x0000, sizeof(dir_read), (byte*) &dir_read);
+  CHECK((dir_read.e[0].name == ZIGB_NAME2) && (dir_read.e[1].name == ZIGB_DATA2), "existing entries changed");
+}
+
+/*********************************************************************************************\
+ * Largest device record
+\*********************************************************************************************/
+
+void TestLargestRecord(void) {
+  StorageInit(STORAGE_EEPROM);
+  Z_Device & small = zigbee_devices.updateDevice(0x1000, 0x1001);
+  small.setFriendlyName("Small");
+  zigbee_devices.save(true);
+
+  Z_Device & large = zigbee_devices.updateDevice(0x2000, 0x2001);
+  std::string name(40, 'x');
+  large.setModelId(name.c_str());
+  large.setManufId(name.c_str());
+  large.setFriendlyName(name.c_str());
+  for (uint8_t ep = 0; ep <= endpoints_max; ep++) {
+    if (ep) { large.addEndpoint(ep); }
+    for (auto type : kDataTypes) { large.data.getByType(type, ep).setConfig(ep & 0x0F); }
+  }
+  zigbee_devices.save(true);      // new device, journaled
+  CHECK(!strstr(last_log, "too large"), "largest device not journaled: %s", last_log);
+  CHECK(zigbee_journal.len > Z_JOURNAL_HEADER, "largest device not journaled");
+
+  std::map<uint64_t, std::vector<uint8_t>> expected = Snapshot();
+  CHECK(Reboot() && (Snapshot() == expected), "largest device not restored");
+}
+
+/*********************************************************************************************\
+ * A day of changes on a network
+\*********************************************************************************************/
+
+struct Z_Model {
+  const char* manuf;
+  const char* model;
+  uint8_t endpoint[2];
+  uint8_t config[2];        // config byte per endpoint, 0 if none
+};
+
+const Z_Model kModels[] = {
+  { "IKEA of Sweden", "TRADFRI bulb E27 WS opal 980lm", { 1, 0 },   { 0x43, 0 } },
+  { "IKEA of Sweden", "TRADFRI remote control",         { 1, 0 },   { 0, 0 } },
+  { "LUMI",           "lumi.sensor_motion.aq2",         { 1, 0 },   { 0x32, 0 } },
+  { "LUMI",           "lumi.weather",                   { 1, 0 },   { 0, 0 } },
+  { "LUMI",           "lumi.sensor_magnet.aq2",         { 1, 0 },   { 0, 0 } },
+  { "Philips",        "LCT015",                         { 11, 242 }, { 0x45, 0 } },
+  { "_TZE200_ckud7u2l", "TS0601",                       { 1, 0 },   { 0xE1, 0 } },
+  { "Xiaomi",         "lumi.plug.maeu01",               { 1, 2 },   { 0x20, 0 } },
+};
+
+enum NetworkEvents { EV_JOIN, EV_DESCRIBE, EV_ENDPOINTS, EV_CONFIGURE, EV_REJOIN, EV_RENAME, EV_CONFIG, EV_REMOVE };
+
+struct Z_Event {
+  uint32_t time;            // seconds
+  uint8_t  type;
+  uint64_t longaddr;        // device of a pairing
+};
+
+class Network {
+public:
+  std::mt19937 rnd;
+  uint16_t next_short = 0x1000;
+  std::vector<uint64_t> devices;      // by long address, devices in memory are reloaded at each save
+
+  Network(uint32_t seed) : rnd(seed) {}
+
+  uint32_t random(uint32_t range) { return rnd() % range; }
+  uint16_t newShort(void) {
+    next_short += 1 + random(0x300);
+    if (next_short >= BAD_SHORTADDR) { next_short = 0x1000; }
+    return next_short;
+  }
+  uint64_t newLong(void) { return ((uint64_t)rnd() << 32) | rnd() | 1; }
+  const Z_Model & model(const Z_Device & device) {
+    for (const auto & m : kModels) {
+      if (device.modelId && !strcmp(device.modelId, m.model)) { return m; }
+    }
+    return kModels[0];
+  }
+  Z_Device & pick(void) { return zigbee_devices.findLongAddr(devices[random(devices.size())]); }
+
+  void apply(const Z_Event & ev) {
+    if (EV_JOIN == ev.type) {
+      zigbee_devices.updateDevice(newShort(), ev.longaddr);
+      devices.push_back(ev.longaddr);
+      return;
+    }
+    if ((EV_DESCRIBE <= ev.type) && (ev.type <= EV_CONFIGURE)) {
+      Z_Device & device = zigbee_devices.findLongAddr(ev.longaddr);
+      if (!zigbee_devices.foundDevice(device)) { return; }   // removed meanwhile
+      if (EV_DESCRIBE == ev.type) {
+        const Z_Model & m = kModels[random(nitems(kModels))];
+        char name[32];
+        snprintf(name, sizeof(name), "Room_%.8s_%u", m.model, (uint32_t)devices.size());
+        device.setManufId(m.manuf);
+        device.setModelId(m.model);
+        device.setFriendlyName(name);
+      } else {
+        const Z_Model & m = model(device);
+        for (uint32_t i = 0; i < 2; i++) {
+          if (!m.endpoint[i]) { continue; }
+          if (device.addEndpoint(m.endpoint[i])) { zigbee_devices.dirty(); }
+          if ((EV_CONFIGURE == ev.type) && m.config[i]) {
+            device.data.getByType((Z_Data_Type)(m.config[i] >> 4), m.endpoint[i]).setConfig(m.config[i] & 0x0F);
+            zigbee_devices.dirty();
+          }
+        }
+      }
+      return;
+    }
+    if (devices.empty()) { return; }
+    Z_Device & device = pick();
+    switch (ev.type) {
+      case EV_REJOIN:
+        zigbee_devices.updateDevice(newShort(), device.longaddr);
+        break;
+      case EV_RENAME: {
+        char name[32];
+        snprintf(name, sizeof(name), "Room_%04X", random(0x10000));
+        device.setFriendlyName(name);
+        break;
+      }
+      case EV_CONFIG:
+        device.addEndpoint(1);
+        device.data.getByType(Z_Data_Type::Z_Light, device.endpoints[0]).setConfig(random(6));   // ZbLight
+        zigbee_devices.dirty();
+        break;
+      case EV_REMOVE:
+        devices.erase(std::find(devices.begin(), devices.end(), device.longaddr));
+        zigbee_devices.removeDevice(device.shortaddr);
+        break;
+    }
+  }
+};
+
+struct Z_DayResult {
+  uint32_t bytes = 0;           // bytes written during the day
+  uint32_t saves = 0;
+  uint32_t full = 0;            // saves rewriting all devices
+  uint32_t torn = 0;            // torn records checked
+  size_t   file_len = 0;
+};
+
+// journal = false saves all devices each time, as before the journal
+Z_DayResult SimulateDay(uint32_t storage, uint32_t devices, uint32_t days, bool journal) {
+  const uint32_t kSaveDelay = 2;         // ZIGBEE_SAVE_DELAY_SECONDS
+  Z_DayResult res;
+  Network net(1);
+  StorageInit(storage);
+
+  // start from a saved network
+  for (uint32_t i = 0; i < devices; i++) {
+    uint64_t longaddr = net.newLong();
+    net.apply({ 0, EV_JOIN, longaddr });
+    net.apply({ 0, EV_DESCRIBE, longaddr });
+    net.apply({ 0, EV_CONFIGURE, longaddr });
+  }
+  zigbee_devices.save(false);
+  CHECK(Reboot(), "%s: network not restored", kStorageNames[storage]);
+
+  // events per day: 2 pairings, 10 rejoins, 5 renames, 20 configuration changes, 1 removal
+  const uint32_t seconds = 86400 * days;
+  const struct { uint8_t type; uint32_t per_day; } kRates[] = {
+    { EV_JOIN, 2 }, { EV_REJOIN, 10 }, { EV_RENAME, 5 }, { EV_CONFIG, 20 }, { EV_REMOVE, 1 } };
+  std::vector<Z_Event> events;
+  for (const auto & rate : kRates) {
+    for (uint32_t i = 0; i < rate.per_day * days; i++) {
+      uint32_t t = net.random(seconds);
+      if (EV_JOIN == rate.type) {
+        // a pairing is a burst of changes a few seconds apart
+        uint64_t longaddr = net.newLong();
+        for (uint8_t step = EV_JOIN; step <= EV_CONFIGURE; step++) {
+          events.push_back({ t + step * 5, step, longaddr });
+        }
+      } else {
+        events.push_back({ t, rate.type, 0 });
+      }
+    }
+  }
+  std::stable_sort(events.begin(), events.end(), [](const Z_Event & a, const Z_Event & b) { return a.time < b.time; });
+
+  bytes_written = 0;
+  uint32_t pending = 0;
+  auto save = [&]() {
+    uint32_t stamp = zigbee_journal.stamp;
+    uint32_t len = zigbee_journal.len;
+    bool full = !journal || (Z_JOURNAL_NONE == zigbee_journal.storage);
+    zigbee_devices.save(journal);
+    full = full || (zigbee_journal.stamp != stamp) || (zigbee_journal.len < len);   // a new journal was started
+    res.saves++;
+    if (full) { res.full++; }
+    if (!journal) { return; }
+
+    // boot from storage and compare with memory
+    uint32_t written = bytes_written;
+    std::map<uint64_t, std::vector<uint8_t>> expected = Snapshot();
+    CHECK(Reboot(), "%s: journal not usable after save %u", kStorageNames[storage], res.saves);
+    CHECK(Snapshot() == expected, "%s: devices differ after save %u", kStorageNames[storage], res.saves);
+    if (zigbee_journal.len > Z_JOURNAL_HEADER) {
+      uint8_t* last = JournalLastByte(storage);
+      *last ^= 0x5A;
+      CHECK(!Reboot(), "%s: torn record not detected after save %u", kStorageNames[storage], res.saves);
+      *last ^= 0x5A;
+      CHECK(Reboot() && (Snapshot() == expected), "%s: devices differ after save %u", kStorageNames[storage], res.saves);
+      res.torn++;
+    }
+    bytes_written = written;        // checks don't write, but don't count them anyway
+  };
+  for (const auto & ev : events) {
+    if (pending && (ev.time > pending)) {
+      save();
+      pending = 0;
+    }
+    net.apply(ev);
+    if (zigbee_devices.isDirty()) { pending = ev.time + kSaveDelay; }
+  }
+  if (pending) { save(); }
+
+  res.bytes = bytes_written / days;
+  for (const auto & device : zigbee_devices.getDevices()) { res.file_len += hibernateDevice(device).len(); }
+  return res;
+}
+
+int main(int argc, char* argv[]) {
+  uint32_t devices = (argc > 1) ? atoi(argv[1]) : 100;
+  uint32_t days = (argc > 2) ? atoi(argv[2]) : 1;
+  if (days < 1) { days = 1; }
+
+  TestEepromUpgrade();
+  TestLargestRecord();
+
+  printf("%u devices, %u day(s), per day: 2 pairings, 10 rejoins, 5 renames, 20 config changes, 1 removal\n\n", devices, days);
+  printf("%-8s %-8s %10s %8s %8s\n", "storage", "mode", "bytes/day", "saves", "full");
+  for (uint32_t storage = STORAGE_EEPROM; storage <= STORAGE_FILE; storage++) {
+    Z_DayResult rewrite = SimulateDay(storage, devices, days, false);
+    Z_DayResult journal = SimulateDay(storage, devices, days, true);
+    printf("%-8s %-8s %10u %8u %8u\n", kStorageNames[storage], "rewrite", rewrite.bytes, rewrite.saves, rewrite.full);
+    printf("%-8s %-8s %10u %8u %8u\n", kStorageNames[storage], "journal", journal.bytes, journal.saves, journal.full);
+    printf("%-8s devices file %u bytes, %u saves reloaded and checked, %u torn records, %.1fx fewer bytes\n",
+      "", (uint32_t)journal.file_len + 1, journal.saves, journal.torn, (double)rewrite.bytes / (journal.bytes ? journal.bytes : 1));
+  }
+
+  printf("\n%u error(s)\n", errors);
+  return errors ? 1 : 0;
+}